@@ -0,0 +1,234 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/education/posit/CMakeLists.txt"
+  "/root/repo/education/quire/CMakeLists.txt"
+  "/root/repo/examples/blas/CMakeLists.txt"
+  "/root/repo/examples/dsp/CMakeLists.txt"
+  "/root/repo/examples/playground/CMakeLists.txt"
+  "/root/repo/examples/stl/CMakeLists.txt"
+  "/root/repo/tests/areal/CMakeLists.txt"
+  "/root/repo/tests/bitblock/CMakeLists.txt"
+  "/root/repo/tests/decimal/CMakeLists.txt"
+  "/root/repo/tests/functions/CMakeLists.txt"
+  "/root/repo/tests/integer/CMakeLists.txt"
+  "/root/repo/tests/numerical/CMakeLists.txt"
+  "/root/repo/tests/posit/CMakeLists.txt"
+  "/root/repo/tests/posit/specialized/CMakeLists.txt"
+  "/root/repo/tools/cmake/Templates/cmake-uninstall.cmake.in"
+  "/root/repo/tools/cmake/Templates/universal-config.cmake.in"
+  "/root/repo/tools/cmake/summary.cmake"
+  "/root/repo/tools/cmd/CMakeLists.txt"
+  "/root/repo/tools/utils/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake-uninstall.cmake"
+  "universal-config.cmake"
+  "universal-config-version.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/bitblock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/integer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/decimal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/posit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/posit/specialized/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/areal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/cmd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "education/posit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "education/quire/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/stl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/blas/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dsp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/numerical/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/functions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/playground/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "tests/bitblock/CMakeFiles/bitblock_arithmetic.dir/DependInfo.cmake"
+  "tests/bitblock/CMakeFiles/bitblock_logic.dir/DependInfo.cmake"
+  "tests/bitblock/CMakeFiles/bitblock_multi_word.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_arithmetic.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_binomial_coefficients.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_conversion_chars.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_logic.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_math_functions.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_misc.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_performance.dir/DependInfo.cmake"
+  "tests/integer/CMakeFiles/integer_specializations.dir/DependInfo.cmake"
+  "tests/decimal/CMakeFiles/decimal_decimal.dir/DependInfo.cmake"
+  "tests/decimal/CMakeFiles/decimal_performance.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_add.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_batch.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_complex.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_divide.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_fma.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_literals.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_multiply.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_negate.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_posit_pair.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_reciprocate.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_sqrt.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_arithmetic_subtract.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_assignment.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_casting.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_conversion.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_conversion_batch.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_conversion_chars.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_conversion_exact_decimal.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_conversion_functions.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_decode.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_decrement.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_dsp_fft.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_dsp_filters.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_file_format.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_increment.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_logic.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_classify.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_exponent.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_exponential_logarithm.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_hyperbolic.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_logarithm.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_pow.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_math_trigonometry.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_numbers_irrational.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_numbers_rational.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_packed_vector.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_postfix.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_prefix.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_quire_accumulation.dir/DependInfo.cmake"
+  "tests/posit/CMakeFiles/posit_reciprocal_tables.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_128_4.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_16_1.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_256_5.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_2_0.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_32_2.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_3_0.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_48_2.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_4_0.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_64_3.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_8_0.dir/DependInfo.cmake"
+  "tests/posit/specialized/CMakeFiles/fast_posit_8_1.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_16dot5_float.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_8dot2_float.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_arithmetic_add.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_arithmetic_divide.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_arithmetic_multiply.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_arithmetic_sqrt.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_arithmetic_subtract.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_performance.dir/DependInfo.cmake"
+  "tests/areal/CMakeFiles/areal_specializations.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_convert.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_dc.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_fc.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_ieee2posit.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_ieee_fp.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_ldc.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_numeric_limits.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_pc.dir/DependInfo.cmake"
+  "tools/cmd/CMakeFiles/cmd_posit_properties.dir/DependInfo.cmake"
+  "tools/utils/CMakeFiles/utils_lookup_arithmetic.dir/DependInfo.cmake"
+  "tools/utils/CMakeFiles/utils_reverse_view.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_basic_operators.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_components.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_conversion.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_discretization_curves.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_enumeration.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_exceptions.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_exponents.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_extract.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_fractions.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_raw_bit_patterns.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_regimes.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_scales.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_serialization.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_signalling_nar.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_tables.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_ulp.dir/DependInfo.cmake"
+  "education/posit/CMakeFiles/edu_values.dir/DependInfo.cmake"
+  "education/quire/CMakeFiles/edu_quires.dir/DependInfo.cmake"
+  "examples/stl/CMakeFiles/stl_sequential_containers.dir/DependInfo.cmake"
+  "examples/blas/CMakeFiles/blas_l1_fused_dot.dir/DependInfo.cmake"
+  "examples/dsp/CMakeFiles/dsp_adc_mapping.dir/DependInfo.cmake"
+  "examples/dsp/CMakeFiles/dsp_fir_filter.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_catastrophic_cancellation.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_contract_expand.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_exp_div_factorial.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_exponentiation.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_integer_cover.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_paranoia.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_physics_constants.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_precision.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_rounding_error_addition.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_rounding_error_multiplication.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_sterbenz_lemma.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_sum_of_integers.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_thin_triangle.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_two_sum.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_type_traits.dir/DependInfo.cmake"
+  "tests/numerical/CMakeFiles/numerical_underflow.dir/DependInfo.cmake"
+  "tests/functions/CMakeFiles/functions_compensated_sum.dir/DependInfo.cmake"
+  "tests/functions/CMakeFiles/functions_factorial.dir/DependInfo.cmake"
+  "tests/functions/CMakeFiles/functions_isrepresentable.dir/DependInfo.cmake"
+  "tests/functions/CMakeFiles/functions_logistic_loss.dir/DependInfo.cmake"
+  "tests/functions/CMakeFiles/functions_polynomial.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_efunc_posits.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_efunc_valids.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_gismo_test.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_meta_programming.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_serialization.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_skeleton.dir/DependInfo.cmake"
+  "examples/playground/CMakeFiles/playground_type_test.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_review_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests/bitblock")
+subdirs("tests/integer")
+subdirs("tests/decimal")
+subdirs("tests/posit")
+subdirs("tests/posit/specialized")
+subdirs("tests/areal")
+subdirs("tools/cmd")
+subdirs("tools/utils")
+subdirs("education/posit")
+subdirs("education/quire")
+subdirs("examples/stl")
+subdirs("examples/blas")
+subdirs("examples/dsp")
+subdirs("tests/numerical")
+subdirs("tests/functions")
+subdirs("examples/playground")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_basic_operators.dir/basic_operators.cpp.o"
+  "CMakeFiles/edu_basic_operators.dir/basic_operators.cpp.o.d"
+  "edu_basic_operators"
+  "edu_basic_operators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_basic_operators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
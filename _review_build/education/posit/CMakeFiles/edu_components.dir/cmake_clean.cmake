@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_components.dir/components.cpp.o"
+  "CMakeFiles/edu_components.dir/components.cpp.o.d"
+  "edu_components"
+  "edu_components.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_components.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_conversion.dir/conversion.cpp.o"
+  "CMakeFiles/edu_conversion.dir/conversion.cpp.o.d"
+  "edu_conversion"
+  "edu_conversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_discretization_curves.dir/discretization_curves.cpp.o"
+  "CMakeFiles/edu_discretization_curves.dir/discretization_curves.cpp.o.d"
+  "edu_discretization_curves"
+  "edu_discretization_curves.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_discretization_curves.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
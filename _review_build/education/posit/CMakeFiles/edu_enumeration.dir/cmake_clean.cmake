@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_enumeration.dir/enumeration.cpp.o"
+  "CMakeFiles/edu_enumeration.dir/enumeration.cpp.o.d"
+  "edu_enumeration"
+  "edu_enumeration.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_enumeration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_exceptions.dir/exceptions.cpp.o"
+  "CMakeFiles/edu_exceptions.dir/exceptions.cpp.o.d"
+  "edu_exceptions"
+  "edu_exceptions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_exceptions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_exponents.dir/exponents.cpp.o"
+  "CMakeFiles/edu_exponents.dir/exponents.cpp.o.d"
+  "edu_exponents"
+  "edu_exponents.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_exponents.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_extract.dir/extract.cpp.o"
+  "CMakeFiles/edu_extract.dir/extract.cpp.o.d"
+  "edu_extract"
+  "edu_extract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_extract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_fractions.dir/fractions.cpp.o"
+  "CMakeFiles/edu_fractions.dir/fractions.cpp.o.d"
+  "edu_fractions"
+  "edu_fractions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_fractions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_raw_bit_patterns.dir/raw_bit_patterns.cpp.o"
+  "CMakeFiles/edu_raw_bit_patterns.dir/raw_bit_patterns.cpp.o.d"
+  "edu_raw_bit_patterns"
+  "edu_raw_bit_patterns.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_raw_bit_patterns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_regimes.dir/regimes.cpp.o"
+  "CMakeFiles/edu_regimes.dir/regimes.cpp.o.d"
+  "edu_regimes"
+  "edu_regimes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_regimes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_scales.dir/scales.cpp.o"
+  "CMakeFiles/edu_scales.dir/scales.cpp.o.d"
+  "edu_scales"
+  "edu_scales.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_scales.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
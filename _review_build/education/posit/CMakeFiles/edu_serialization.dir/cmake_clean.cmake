@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_serialization.dir/serialization.cpp.o"
+  "CMakeFiles/edu_serialization.dir/serialization.cpp.o.d"
+  "edu_serialization"
+  "edu_serialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_serialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
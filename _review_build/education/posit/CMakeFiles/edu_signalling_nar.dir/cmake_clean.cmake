@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_signalling_nar.dir/signalling_nar.cpp.o"
+  "CMakeFiles/edu_signalling_nar.dir/signalling_nar.cpp.o.d"
+  "edu_signalling_nar"
+  "edu_signalling_nar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_signalling_nar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
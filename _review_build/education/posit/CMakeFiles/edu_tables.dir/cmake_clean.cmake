@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_tables.dir/tables.cpp.o"
+  "CMakeFiles/edu_tables.dir/tables.cpp.o.d"
+  "edu_tables"
+  "edu_tables.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
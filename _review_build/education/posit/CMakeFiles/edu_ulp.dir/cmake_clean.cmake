@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_ulp.dir/ulp.cpp.o"
+  "CMakeFiles/edu_ulp.dir/ulp.cpp.o.d"
+  "edu_ulp"
+  "edu_ulp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_ulp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_values.dir/values.cpp.o"
+  "CMakeFiles/edu_values.dir/values.cpp.o.d"
+  "edu_values"
+  "edu_values.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_values.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
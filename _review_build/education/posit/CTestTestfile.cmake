@@ -0,0 +1,40 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/education/posit
+# Build directory: /root/repo/_review_build/education/posit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(edu_basic_operators "/edu_basic_operators")
+set_tests_properties(edu_basic_operators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_components "/edu_components")
+set_tests_properties(edu_components PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_conversion "/edu_conversion")
+set_tests_properties(edu_conversion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_discretization_curves "/edu_discretization_curves")
+set_tests_properties(edu_discretization_curves PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_enumeration "/edu_enumeration")
+set_tests_properties(edu_enumeration PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_exceptions "/edu_exceptions")
+set_tests_properties(edu_exceptions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_exponents "/edu_exponents")
+set_tests_properties(edu_exponents PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_extract "/edu_extract")
+set_tests_properties(edu_extract PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_fractions "/edu_fractions")
+set_tests_properties(edu_fractions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_raw_bit_patterns "/edu_raw_bit_patterns")
+set_tests_properties(edu_raw_bit_patterns PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_regimes "/edu_regimes")
+set_tests_properties(edu_regimes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_scales "/edu_scales")
+set_tests_properties(edu_scales PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_serialization "/edu_serialization")
+set_tests_properties(edu_serialization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_signalling_nar "/edu_signalling_nar")
+set_tests_properties(edu_signalling_nar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_tables "/edu_tables")
+set_tests_properties(edu_tables PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_ulp "/edu_ulp")
+set_tests_properties(edu_ulp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
+add_test(edu_values "/edu_values")
+set_tests_properties(edu_values PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/posit/CMakeLists.txt;3;compile_all;/root/repo/education/posit/CMakeLists.txt;0;")
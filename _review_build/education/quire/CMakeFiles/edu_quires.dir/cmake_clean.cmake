@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/edu_quires.dir/quires.cpp.o"
+  "CMakeFiles/edu_quires.dir/quires.cpp.o.d"
+  "edu_quires"
+  "edu_quires.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/edu_quires.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/education/quire
+# Build directory: /root/repo/_review_build/education/quire
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(edu_quires "/edu_quires")
+set_tests_properties(edu_quires PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/education/quire/CMakeLists.txt;3;compile_all;/root/repo/education/quire/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blas_l1_fused_dot.dir/l1_fused_dot.cpp.o"
+  "CMakeFiles/blas_l1_fused_dot.dir/l1_fused_dot.cpp.o.d"
+  "blas_l1_fused_dot"
+  "blas_l1_fused_dot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blas_l1_fused_dot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/blas
+# Build directory: /root/repo/_review_build/examples/blas
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(blas_l1_fused_dot "/blas_l1_fused_dot")
+set_tests_properties(blas_l1_fused_dot PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/blas/CMakeLists.txt;3;compile_all;/root/repo/examples/blas/CMakeLists.txt;0;")
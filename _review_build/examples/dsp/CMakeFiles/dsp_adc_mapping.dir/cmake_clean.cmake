@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dsp_adc_mapping.dir/adc_mapping.cpp.o"
+  "CMakeFiles/dsp_adc_mapping.dir/adc_mapping.cpp.o.d"
+  "dsp_adc_mapping"
+  "dsp_adc_mapping.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dsp_adc_mapping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dsp_fir_filter.dir/fir_filter.cpp.o"
+  "CMakeFiles/dsp_fir_filter.dir/fir_filter.cpp.o.d"
+  "dsp_fir_filter"
+  "dsp_fir_filter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dsp_fir_filter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
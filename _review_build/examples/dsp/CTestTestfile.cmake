@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/dsp
+# Build directory: /root/repo/_review_build/examples/dsp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(dsp_adc_mapping "/dsp_adc_mapping")
+set_tests_properties(dsp_adc_mapping PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/dsp/CMakeLists.txt;3;compile_all;/root/repo/examples/dsp/CMakeLists.txt;0;")
+add_test(dsp_fir_filter "/dsp_fir_filter")
+set_tests_properties(dsp_fir_filter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/dsp/CMakeLists.txt;3;compile_all;/root/repo/examples/dsp/CMakeLists.txt;0;")
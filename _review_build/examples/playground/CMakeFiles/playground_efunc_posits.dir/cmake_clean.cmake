@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_efunc_posits.dir/efunc_posits.cpp.o"
+  "CMakeFiles/playground_efunc_posits.dir/efunc_posits.cpp.o.d"
+  "playground_efunc_posits"
+  "playground_efunc_posits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_efunc_posits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
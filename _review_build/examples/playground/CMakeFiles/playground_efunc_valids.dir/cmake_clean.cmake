@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_efunc_valids.dir/efunc_valids.cpp.o"
+  "CMakeFiles/playground_efunc_valids.dir/efunc_valids.cpp.o.d"
+  "playground_efunc_valids"
+  "playground_efunc_valids.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_efunc_valids.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_gismo_test.dir/gismo_test.cpp.o"
+  "CMakeFiles/playground_gismo_test.dir/gismo_test.cpp.o.d"
+  "playground_gismo_test"
+  "playground_gismo_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_gismo_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
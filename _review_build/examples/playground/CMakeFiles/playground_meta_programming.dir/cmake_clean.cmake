@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_meta_programming.dir/meta_programming.cpp.o"
+  "CMakeFiles/playground_meta_programming.dir/meta_programming.cpp.o.d"
+  "playground_meta_programming"
+  "playground_meta_programming.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_meta_programming.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_serialization.dir/serialization.cpp.o"
+  "CMakeFiles/playground_serialization.dir/serialization.cpp.o.d"
+  "playground_serialization"
+  "playground_serialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_serialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_skeleton.dir/skeleton.cpp.o"
+  "CMakeFiles/playground_skeleton.dir/skeleton.cpp.o.d"
+  "playground_skeleton"
+  "playground_skeleton.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_skeleton.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/playground_type_test.dir/type_test.cpp.o"
+  "CMakeFiles/playground_type_test.dir/type_test.cpp.o.d"
+  "playground_type_test"
+  "playground_type_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/playground_type_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/playground
+# Build directory: /root/repo/_review_build/examples/playground
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(playground_efunc_posits "/playground_efunc_posits")
+set_tests_properties(playground_efunc_posits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
+add_test(playground_efunc_valids "/playground_efunc_valids")
+set_tests_properties(playground_efunc_valids PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
+add_test(playground_gismo_test "/playground_gismo_test")
+set_tests_properties(playground_gismo_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
+add_test(playground_meta_programming "/playground_meta_programming")
+set_tests_properties(playground_meta_programming PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
+add_test(playground_serialization "/playground_serialization")
+set_tests_properties(playground_serialization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
+add_test(playground_skeleton "/playground_skeleton")
+set_tests_properties(playground_skeleton PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
+add_test(playground_type_test "/playground_type_test")
+set_tests_properties(playground_type_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/playground/CMakeLists.txt;3;compile_all;/root/repo/examples/playground/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stl_sequential_containers.dir/sequential_containers.cpp.o"
+  "CMakeFiles/stl_sequential_containers.dir/sequential_containers.cpp.o.d"
+  "stl_sequential_containers"
+  "stl_sequential_containers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stl_sequential_containers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/stl
+# Build directory: /root/repo/_review_build/examples/stl
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(stl_sequential_containers "/stl_sequential_containers")
+set_tests_properties(stl_sequential_containers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/examples/stl/CMakeLists.txt;3;compile_all;/root/repo/examples/stl/CMakeLists.txt;0;")
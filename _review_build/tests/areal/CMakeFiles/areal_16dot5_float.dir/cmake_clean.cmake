@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_16dot5_float.dir/16dot5_float.cpp.o"
+  "CMakeFiles/areal_16dot5_float.dir/16dot5_float.cpp.o.d"
+  "areal_16dot5_float"
+  "areal_16dot5_float.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_16dot5_float.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_8dot2_float.dir/8dot2_float.cpp.o"
+  "CMakeFiles/areal_8dot2_float.dir/8dot2_float.cpp.o.d"
+  "areal_8dot2_float"
+  "areal_8dot2_float.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_8dot2_float.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
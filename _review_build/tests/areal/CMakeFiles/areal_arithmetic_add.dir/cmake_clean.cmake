@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_arithmetic_add.dir/arithmetic_add.cpp.o"
+  "CMakeFiles/areal_arithmetic_add.dir/arithmetic_add.cpp.o.d"
+  "areal_arithmetic_add"
+  "areal_arithmetic_add.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_arithmetic_add.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
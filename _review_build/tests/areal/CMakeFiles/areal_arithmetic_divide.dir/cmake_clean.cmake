@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_arithmetic_divide.dir/arithmetic_divide.cpp.o"
+  "CMakeFiles/areal_arithmetic_divide.dir/arithmetic_divide.cpp.o.d"
+  "areal_arithmetic_divide"
+  "areal_arithmetic_divide.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_arithmetic_divide.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
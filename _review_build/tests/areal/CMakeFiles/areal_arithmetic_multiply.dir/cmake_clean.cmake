@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_arithmetic_multiply.dir/arithmetic_multiply.cpp.o"
+  "CMakeFiles/areal_arithmetic_multiply.dir/arithmetic_multiply.cpp.o.d"
+  "areal_arithmetic_multiply"
+  "areal_arithmetic_multiply.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_arithmetic_multiply.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
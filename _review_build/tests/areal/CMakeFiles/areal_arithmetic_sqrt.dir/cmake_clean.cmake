@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_arithmetic_sqrt.dir/arithmetic_sqrt.cpp.o"
+  "CMakeFiles/areal_arithmetic_sqrt.dir/arithmetic_sqrt.cpp.o.d"
+  "areal_arithmetic_sqrt"
+  "areal_arithmetic_sqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_arithmetic_sqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_arithmetic_subtract.dir/arithmetic_subtract.cpp.o"
+  "CMakeFiles/areal_arithmetic_subtract.dir/arithmetic_subtract.cpp.o.d"
+  "areal_arithmetic_subtract"
+  "areal_arithmetic_subtract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_arithmetic_subtract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_performance.dir/performance.cpp.o"
+  "CMakeFiles/areal_performance.dir/performance.cpp.o.d"
+  "areal_performance"
+  "areal_performance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_performance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/areal_specializations.dir/specializations.cpp.o"
+  "CMakeFiles/areal_specializations.dir/specializations.cpp.o.d"
+  "areal_specializations"
+  "areal_specializations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/areal_specializations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/areal
+# Build directory: /root/repo/_review_build/tests/areal
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(areal_16dot5_float "/areal_16dot5_float")
+set_tests_properties(areal_16dot5_float PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_8dot2_float "/areal_8dot2_float")
+set_tests_properties(areal_8dot2_float PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_arithmetic_add "/areal_arithmetic_add")
+set_tests_properties(areal_arithmetic_add PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_arithmetic_divide "/areal_arithmetic_divide")
+set_tests_properties(areal_arithmetic_divide PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_arithmetic_multiply "/areal_arithmetic_multiply")
+set_tests_properties(areal_arithmetic_multiply PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_arithmetic_sqrt "/areal_arithmetic_sqrt")
+set_tests_properties(areal_arithmetic_sqrt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_arithmetic_subtract "/areal_arithmetic_subtract")
+set_tests_properties(areal_arithmetic_subtract PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_performance "/areal_performance")
+set_tests_properties(areal_performance PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
+add_test(areal_specializations "/areal_specializations")
+set_tests_properties(areal_specializations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/areal/CMakeLists.txt;3;compile_all;/root/repo/tests/areal/CMakeLists.txt;0;")
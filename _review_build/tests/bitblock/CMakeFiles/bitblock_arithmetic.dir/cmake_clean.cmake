@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bitblock_arithmetic.dir/arithmetic.cpp.o"
+  "CMakeFiles/bitblock_arithmetic.dir/arithmetic.cpp.o.d"
+  "bitblock_arithmetic"
+  "bitblock_arithmetic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitblock_arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
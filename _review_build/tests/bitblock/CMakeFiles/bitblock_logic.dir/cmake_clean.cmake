@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bitblock_logic.dir/logic.cpp.o"
+  "CMakeFiles/bitblock_logic.dir/logic.cpp.o.d"
+  "bitblock_logic"
+  "bitblock_logic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitblock_logic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
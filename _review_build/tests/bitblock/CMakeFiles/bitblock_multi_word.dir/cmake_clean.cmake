@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bitblock_multi_word.dir/multi_word.cpp.o"
+  "CMakeFiles/bitblock_multi_word.dir/multi_word.cpp.o.d"
+  "bitblock_multi_word"
+  "bitblock_multi_word.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitblock_multi_word.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/bitblock
+# Build directory: /root/repo/_review_build/tests/bitblock
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(bitblock_arithmetic "/bitblock_arithmetic")
+set_tests_properties(bitblock_arithmetic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/bitblock/CMakeLists.txt;3;compile_all;/root/repo/tests/bitblock/CMakeLists.txt;0;")
+add_test(bitblock_logic "/bitblock_logic")
+set_tests_properties(bitblock_logic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/bitblock/CMakeLists.txt;3;compile_all;/root/repo/tests/bitblock/CMakeLists.txt;0;")
+add_test(bitblock_multi_word "/bitblock_multi_word")
+set_tests_properties(bitblock_multi_word PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/bitblock/CMakeLists.txt;3;compile_all;/root/repo/tests/bitblock/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/decimal_decimal.dir/decimal.cpp.o"
+  "CMakeFiles/decimal_decimal.dir/decimal.cpp.o.d"
+  "decimal_decimal"
+  "decimal_decimal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/decimal_decimal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/decimal_performance.dir/performance.cpp.o"
+  "CMakeFiles/decimal_performance.dir/performance.cpp.o.d"
+  "decimal_performance"
+  "decimal_performance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/decimal_performance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
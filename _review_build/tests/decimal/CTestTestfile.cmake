@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/decimal
+# Build directory: /root/repo/_review_build/tests/decimal
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(decimal_decimal "/decimal_decimal")
+set_tests_properties(decimal_decimal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/decimal/CMakeLists.txt;3;compile_all;/root/repo/tests/decimal/CMakeLists.txt;0;")
+add_test(decimal_performance "/decimal_performance")
+set_tests_properties(decimal_performance PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/decimal/CMakeLists.txt;3;compile_all;/root/repo/tests/decimal/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functions_compensated_sum.dir/compensated_sum.cpp.o"
+  "CMakeFiles/functions_compensated_sum.dir/compensated_sum.cpp.o.d"
+  "functions_compensated_sum"
+  "functions_compensated_sum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functions_compensated_sum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
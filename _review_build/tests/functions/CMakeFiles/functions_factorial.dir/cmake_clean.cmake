@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functions_factorial.dir/factorial.cpp.o"
+  "CMakeFiles/functions_factorial.dir/factorial.cpp.o.d"
+  "functions_factorial"
+  "functions_factorial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functions_factorial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functions_isrepresentable.dir/isrepresentable.cpp.o"
+  "CMakeFiles/functions_isrepresentable.dir/isrepresentable.cpp.o.d"
+  "functions_isrepresentable"
+  "functions_isrepresentable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functions_isrepresentable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
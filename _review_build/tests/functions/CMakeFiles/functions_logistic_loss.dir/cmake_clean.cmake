@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functions_logistic_loss.dir/logistic_loss.cpp.o"
+  "CMakeFiles/functions_logistic_loss.dir/logistic_loss.cpp.o.d"
+  "functions_logistic_loss"
+  "functions_logistic_loss.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functions_logistic_loss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
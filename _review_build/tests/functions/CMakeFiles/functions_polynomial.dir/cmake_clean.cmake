@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functions_polynomial.dir/polynomial.cpp.o"
+  "CMakeFiles/functions_polynomial.dir/polynomial.cpp.o.d"
+  "functions_polynomial"
+  "functions_polynomial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functions_polynomial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
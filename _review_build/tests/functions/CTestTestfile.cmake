@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/functions
+# Build directory: /root/repo/_review_build/tests/functions
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(functions_compensated_sum "/functions_compensated_sum")
+set_tests_properties(functions_compensated_sum PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/functions/CMakeLists.txt;3;compile_all;/root/repo/tests/functions/CMakeLists.txt;0;")
+add_test(functions_factorial "/functions_factorial")
+set_tests_properties(functions_factorial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/functions/CMakeLists.txt;3;compile_all;/root/repo/tests/functions/CMakeLists.txt;0;")
+add_test(functions_isrepresentable "/functions_isrepresentable")
+set_tests_properties(functions_isrepresentable PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/functions/CMakeLists.txt;3;compile_all;/root/repo/tests/functions/CMakeLists.txt;0;")
+add_test(functions_logistic_loss "/functions_logistic_loss")
+set_tests_properties(functions_logistic_loss PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/functions/CMakeLists.txt;3;compile_all;/root/repo/tests/functions/CMakeLists.txt;0;")
+add_test(functions_polynomial "/functions_polynomial")
+set_tests_properties(functions_polynomial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/functions/CMakeLists.txt;3;compile_all;/root/repo/tests/functions/CMakeLists.txt;0;")
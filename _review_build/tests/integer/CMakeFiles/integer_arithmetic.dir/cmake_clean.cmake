@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_arithmetic.dir/arithmetic.cpp.o"
+  "CMakeFiles/integer_arithmetic.dir/arithmetic.cpp.o.d"
+  "integer_arithmetic"
+  "integer_arithmetic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
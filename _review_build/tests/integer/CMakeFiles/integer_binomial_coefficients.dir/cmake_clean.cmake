@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_binomial_coefficients.dir/binomial_coefficients.cpp.o"
+  "CMakeFiles/integer_binomial_coefficients.dir/binomial_coefficients.cpp.o.d"
+  "integer_binomial_coefficients"
+  "integer_binomial_coefficients.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_binomial_coefficients.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
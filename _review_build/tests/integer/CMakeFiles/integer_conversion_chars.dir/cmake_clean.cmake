@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_conversion_chars.dir/conversion_chars.cpp.o"
+  "CMakeFiles/integer_conversion_chars.dir/conversion_chars.cpp.o.d"
+  "integer_conversion_chars"
+  "integer_conversion_chars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_conversion_chars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
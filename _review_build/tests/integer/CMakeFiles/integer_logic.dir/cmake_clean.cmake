@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_logic.dir/logic.cpp.o"
+  "CMakeFiles/integer_logic.dir/logic.cpp.o.d"
+  "integer_logic"
+  "integer_logic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_logic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_math_functions.dir/math_functions.cpp.o"
+  "CMakeFiles/integer_math_functions.dir/math_functions.cpp.o.d"
+  "integer_math_functions"
+  "integer_math_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_math_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_misc.dir/misc.cpp.o"
+  "CMakeFiles/integer_misc.dir/misc.cpp.o.d"
+  "integer_misc"
+  "integer_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_performance.dir/performance.cpp.o"
+  "CMakeFiles/integer_performance.dir/performance.cpp.o.d"
+  "integer_performance"
+  "integer_performance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_performance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_specializations.dir/specializations.cpp.o"
+  "CMakeFiles/integer_specializations.dir/specializations.cpp.o.d"
+  "integer_specializations"
+  "integer_specializations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_specializations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
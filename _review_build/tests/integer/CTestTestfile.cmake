@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/integer
+# Build directory: /root/repo/_review_build/tests/integer
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(integer_arithmetic "/integer_arithmetic")
+set_tests_properties(integer_arithmetic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_binomial_coefficients "/integer_binomial_coefficients")
+set_tests_properties(integer_binomial_coefficients PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_conversion_chars "/integer_conversion_chars")
+set_tests_properties(integer_conversion_chars PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_logic "/integer_logic")
+set_tests_properties(integer_logic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_math_functions "/integer_math_functions")
+set_tests_properties(integer_math_functions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_misc "/integer_misc")
+set_tests_properties(integer_misc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_performance "/integer_performance")
+set_tests_properties(integer_performance PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
+add_test(integer_specializations "/integer_specializations")
+set_tests_properties(integer_specializations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/integer/CMakeLists.txt;3;compile_all;/root/repo/tests/integer/CMakeLists.txt;0;")
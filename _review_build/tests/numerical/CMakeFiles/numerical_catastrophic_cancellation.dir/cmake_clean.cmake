@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_catastrophic_cancellation.dir/catastrophic_cancellation.cpp.o"
+  "CMakeFiles/numerical_catastrophic_cancellation.dir/catastrophic_cancellation.cpp.o.d"
+  "numerical_catastrophic_cancellation"
+  "numerical_catastrophic_cancellation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_catastrophic_cancellation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_contract_expand.dir/contract_expand.cpp.o"
+  "CMakeFiles/numerical_contract_expand.dir/contract_expand.cpp.o.d"
+  "numerical_contract_expand"
+  "numerical_contract_expand.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_contract_expand.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_exp_div_factorial.dir/exp_div_factorial.cpp.o"
+  "CMakeFiles/numerical_exp_div_factorial.dir/exp_div_factorial.cpp.o.d"
+  "numerical_exp_div_factorial"
+  "numerical_exp_div_factorial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_exp_div_factorial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
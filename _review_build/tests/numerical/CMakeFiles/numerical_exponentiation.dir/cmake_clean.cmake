@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_exponentiation.dir/exponentiation.cpp.o"
+  "CMakeFiles/numerical_exponentiation.dir/exponentiation.cpp.o.d"
+  "numerical_exponentiation"
+  "numerical_exponentiation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_exponentiation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
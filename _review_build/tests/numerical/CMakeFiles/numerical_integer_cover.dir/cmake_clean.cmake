@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_integer_cover.dir/integer_cover.cpp.o"
+  "CMakeFiles/numerical_integer_cover.dir/integer_cover.cpp.o.d"
+  "numerical_integer_cover"
+  "numerical_integer_cover.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_integer_cover.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_paranoia.dir/paranoia.cpp.o"
+  "CMakeFiles/numerical_paranoia.dir/paranoia.cpp.o.d"
+  "numerical_paranoia"
+  "numerical_paranoia.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_paranoia.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
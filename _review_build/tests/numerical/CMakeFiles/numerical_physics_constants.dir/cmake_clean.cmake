@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_physics_constants.dir/physics_constants.cpp.o"
+  "CMakeFiles/numerical_physics_constants.dir/physics_constants.cpp.o.d"
+  "numerical_physics_constants"
+  "numerical_physics_constants.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_physics_constants.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
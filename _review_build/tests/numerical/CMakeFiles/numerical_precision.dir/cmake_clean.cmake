@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_precision.dir/precision.cpp.o"
+  "CMakeFiles/numerical_precision.dir/precision.cpp.o.d"
+  "numerical_precision"
+  "numerical_precision.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_precision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
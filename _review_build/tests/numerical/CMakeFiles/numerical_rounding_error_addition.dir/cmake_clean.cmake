@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_rounding_error_addition.dir/rounding_error_addition.cpp.o"
+  "CMakeFiles/numerical_rounding_error_addition.dir/rounding_error_addition.cpp.o.d"
+  "numerical_rounding_error_addition"
+  "numerical_rounding_error_addition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_rounding_error_addition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
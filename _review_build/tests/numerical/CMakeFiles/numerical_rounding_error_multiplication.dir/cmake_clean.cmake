@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_rounding_error_multiplication.dir/rounding_error_multiplication.cpp.o"
+  "CMakeFiles/numerical_rounding_error_multiplication.dir/rounding_error_multiplication.cpp.o.d"
+  "numerical_rounding_error_multiplication"
+  "numerical_rounding_error_multiplication.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_rounding_error_multiplication.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
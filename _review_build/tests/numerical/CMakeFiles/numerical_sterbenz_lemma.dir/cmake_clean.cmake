@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_sterbenz_lemma.dir/sterbenz_lemma.cpp.o"
+  "CMakeFiles/numerical_sterbenz_lemma.dir/sterbenz_lemma.cpp.o.d"
+  "numerical_sterbenz_lemma"
+  "numerical_sterbenz_lemma.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_sterbenz_lemma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_sum_of_integers.dir/sum_of_integers.cpp.o"
+  "CMakeFiles/numerical_sum_of_integers.dir/sum_of_integers.cpp.o.d"
+  "numerical_sum_of_integers"
+  "numerical_sum_of_integers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_sum_of_integers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
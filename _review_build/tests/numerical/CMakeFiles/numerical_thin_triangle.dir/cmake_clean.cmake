@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_thin_triangle.dir/thin_triangle.cpp.o"
+  "CMakeFiles/numerical_thin_triangle.dir/thin_triangle.cpp.o.d"
+  "numerical_thin_triangle"
+  "numerical_thin_triangle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_thin_triangle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_two_sum.dir/two_sum.cpp.o"
+  "CMakeFiles/numerical_two_sum.dir/two_sum.cpp.o.d"
+  "numerical_two_sum"
+  "numerical_two_sum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_two_sum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_type_traits.dir/type_traits.cpp.o"
+  "CMakeFiles/numerical_type_traits.dir/type_traits.cpp.o.d"
+  "numerical_type_traits"
+  "numerical_type_traits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_type_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
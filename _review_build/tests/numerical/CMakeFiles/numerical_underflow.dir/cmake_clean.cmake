@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical_underflow.dir/underflow.cpp.o"
+  "CMakeFiles/numerical_underflow.dir/underflow.cpp.o.d"
+  "numerical_underflow"
+  "numerical_underflow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numerical_underflow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
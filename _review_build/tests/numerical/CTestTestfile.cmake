@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/numerical
+# Build directory: /root/repo/_review_build/tests/numerical
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(numerical_catastrophic_cancellation "/numerical_catastrophic_cancellation")
+set_tests_properties(numerical_catastrophic_cancellation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_contract_expand "/numerical_contract_expand")
+set_tests_properties(numerical_contract_expand PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_exp_div_factorial "/numerical_exp_div_factorial")
+set_tests_properties(numerical_exp_div_factorial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_exponentiation "/numerical_exponentiation")
+set_tests_properties(numerical_exponentiation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_integer_cover "/numerical_integer_cover")
+set_tests_properties(numerical_integer_cover PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_paranoia "/numerical_paranoia")
+set_tests_properties(numerical_paranoia PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_physics_constants "/numerical_physics_constants")
+set_tests_properties(numerical_physics_constants PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_precision "/numerical_precision")
+set_tests_properties(numerical_precision PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_rounding_error_addition "/numerical_rounding_error_addition")
+set_tests_properties(numerical_rounding_error_addition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_rounding_error_multiplication "/numerical_rounding_error_multiplication")
+set_tests_properties(numerical_rounding_error_multiplication PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_sterbenz_lemma "/numerical_sterbenz_lemma")
+set_tests_properties(numerical_sterbenz_lemma PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_sum_of_integers "/numerical_sum_of_integers")
+set_tests_properties(numerical_sum_of_integers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_thin_triangle "/numerical_thin_triangle")
+set_tests_properties(numerical_thin_triangle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_two_sum "/numerical_two_sum")
+set_tests_properties(numerical_two_sum PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_type_traits "/numerical_type_traits")
+set_tests_properties(numerical_type_traits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
+add_test(numerical_underflow "/numerical_underflow")
+set_tests_properties(numerical_underflow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/numerical/CMakeLists.txt;3;compile_all;/root/repo/tests/numerical/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_add.dir/arithmetic_add.cpp.o"
+  "CMakeFiles/posit_arithmetic_add.dir/arithmetic_add.cpp.o.d"
+  "posit_arithmetic_add"
+  "posit_arithmetic_add.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_add.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
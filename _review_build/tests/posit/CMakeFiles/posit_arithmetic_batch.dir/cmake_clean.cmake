@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_batch.dir/arithmetic_batch.cpp.o"
+  "CMakeFiles/posit_arithmetic_batch.dir/arithmetic_batch.cpp.o.d"
+  "posit_arithmetic_batch"
+  "posit_arithmetic_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
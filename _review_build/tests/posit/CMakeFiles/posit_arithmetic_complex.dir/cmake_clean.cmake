@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_complex.dir/arithmetic_complex.cpp.o"
+  "CMakeFiles/posit_arithmetic_complex.dir/arithmetic_complex.cpp.o.d"
+  "posit_arithmetic_complex"
+  "posit_arithmetic_complex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_complex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
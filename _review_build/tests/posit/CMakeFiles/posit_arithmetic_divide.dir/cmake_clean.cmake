@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_divide.dir/arithmetic_divide.cpp.o"
+  "CMakeFiles/posit_arithmetic_divide.dir/arithmetic_divide.cpp.o.d"
+  "posit_arithmetic_divide"
+  "posit_arithmetic_divide.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_divide.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
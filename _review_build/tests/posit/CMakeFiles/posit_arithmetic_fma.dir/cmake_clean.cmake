@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_fma.dir/arithmetic_fma.cpp.o"
+  "CMakeFiles/posit_arithmetic_fma.dir/arithmetic_fma.cpp.o.d"
+  "posit_arithmetic_fma"
+  "posit_arithmetic_fma.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_fma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_literals.dir/arithmetic_literals.cpp.o"
+  "CMakeFiles/posit_arithmetic_literals.dir/arithmetic_literals.cpp.o.d"
+  "posit_arithmetic_literals"
+  "posit_arithmetic_literals.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_literals.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_multiply.dir/arithmetic_multiply.cpp.o"
+  "CMakeFiles/posit_arithmetic_multiply.dir/arithmetic_multiply.cpp.o.d"
+  "posit_arithmetic_multiply"
+  "posit_arithmetic_multiply.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_multiply.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
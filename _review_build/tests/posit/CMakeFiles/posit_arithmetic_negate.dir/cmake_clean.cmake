@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_negate.dir/arithmetic_negate.cpp.o"
+  "CMakeFiles/posit_arithmetic_negate.dir/arithmetic_negate.cpp.o.d"
+  "posit_arithmetic_negate"
+  "posit_arithmetic_negate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_negate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_posit_pair.dir/arithmetic_posit_pair.cpp.o"
+  "CMakeFiles/posit_arithmetic_posit_pair.dir/arithmetic_posit_pair.cpp.o.d"
+  "posit_arithmetic_posit_pair"
+  "posit_arithmetic_posit_pair.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_posit_pair.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_reciprocate.dir/arithmetic_reciprocate.cpp.o"
+  "CMakeFiles/posit_arithmetic_reciprocate.dir/arithmetic_reciprocate.cpp.o.d"
+  "posit_arithmetic_reciprocate"
+  "posit_arithmetic_reciprocate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_reciprocate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
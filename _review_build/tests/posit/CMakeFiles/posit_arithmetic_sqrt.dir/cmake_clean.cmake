@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_sqrt.dir/arithmetic_sqrt.cpp.o"
+  "CMakeFiles/posit_arithmetic_sqrt.dir/arithmetic_sqrt.cpp.o.d"
+  "posit_arithmetic_sqrt"
+  "posit_arithmetic_sqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_sqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
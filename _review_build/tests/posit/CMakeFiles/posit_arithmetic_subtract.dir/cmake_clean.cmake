@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_arithmetic_subtract.dir/arithmetic_subtract.cpp.o"
+  "CMakeFiles/posit_arithmetic_subtract.dir/arithmetic_subtract.cpp.o.d"
+  "posit_arithmetic_subtract"
+  "posit_arithmetic_subtract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_arithmetic_subtract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
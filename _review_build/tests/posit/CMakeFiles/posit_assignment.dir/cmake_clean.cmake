@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_assignment.dir/assignment.cpp.o"
+  "CMakeFiles/posit_assignment.dir/assignment.cpp.o.d"
+  "posit_assignment"
+  "posit_assignment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_assignment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_casting.dir/casting.cpp.o"
+  "CMakeFiles/posit_casting.dir/casting.cpp.o.d"
+  "posit_casting"
+  "posit_casting.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_casting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_conversion.dir/conversion.cpp.o"
+  "CMakeFiles/posit_conversion.dir/conversion.cpp.o.d"
+  "posit_conversion"
+  "posit_conversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_conversion_batch.dir/conversion_batch.cpp.o"
+  "CMakeFiles/posit_conversion_batch.dir/conversion_batch.cpp.o.d"
+  "posit_conversion_batch"
+  "posit_conversion_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_conversion_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_conversion_chars.dir/conversion_chars.cpp.o"
+  "CMakeFiles/posit_conversion_chars.dir/conversion_chars.cpp.o.d"
+  "posit_conversion_chars"
+  "posit_conversion_chars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_conversion_chars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
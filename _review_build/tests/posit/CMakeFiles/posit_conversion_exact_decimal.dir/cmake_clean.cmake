@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_conversion_exact_decimal.dir/conversion_exact_decimal.cpp.o"
+  "CMakeFiles/posit_conversion_exact_decimal.dir/conversion_exact_decimal.cpp.o.d"
+  "posit_conversion_exact_decimal"
+  "posit_conversion_exact_decimal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_conversion_exact_decimal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
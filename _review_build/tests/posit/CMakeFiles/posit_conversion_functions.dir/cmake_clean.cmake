@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_conversion_functions.dir/conversion_functions.cpp.o"
+  "CMakeFiles/posit_conversion_functions.dir/conversion_functions.cpp.o.d"
+  "posit_conversion_functions"
+  "posit_conversion_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_conversion_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
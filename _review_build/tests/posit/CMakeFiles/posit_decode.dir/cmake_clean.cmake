@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_decode.dir/decode.cpp.o"
+  "CMakeFiles/posit_decode.dir/decode.cpp.o.d"
+  "posit_decode"
+  "posit_decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
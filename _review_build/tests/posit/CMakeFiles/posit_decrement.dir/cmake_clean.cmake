@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_decrement.dir/decrement.cpp.o"
+  "CMakeFiles/posit_decrement.dir/decrement.cpp.o.d"
+  "posit_decrement"
+  "posit_decrement.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_decrement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
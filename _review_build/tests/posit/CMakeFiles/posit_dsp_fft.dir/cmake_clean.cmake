@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_dsp_fft.dir/dsp_fft.cpp.o"
+  "CMakeFiles/posit_dsp_fft.dir/dsp_fft.cpp.o.d"
+  "posit_dsp_fft"
+  "posit_dsp_fft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_dsp_fft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_dsp_filters.dir/dsp_filters.cpp.o"
+  "CMakeFiles/posit_dsp_filters.dir/dsp_filters.cpp.o.d"
+  "posit_dsp_filters"
+  "posit_dsp_filters.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_dsp_filters.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
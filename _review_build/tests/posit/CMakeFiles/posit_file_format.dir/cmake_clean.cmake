@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_file_format.dir/file_format.cpp.o"
+  "CMakeFiles/posit_file_format.dir/file_format.cpp.o.d"
+  "posit_file_format"
+  "posit_file_format.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_file_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_increment.dir/increment.cpp.o"
+  "CMakeFiles/posit_increment.dir/increment.cpp.o.d"
+  "posit_increment"
+  "posit_increment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_increment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_logic.dir/logic.cpp.o"
+  "CMakeFiles/posit_logic.dir/logic.cpp.o.d"
+  "posit_logic"
+  "posit_logic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_logic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
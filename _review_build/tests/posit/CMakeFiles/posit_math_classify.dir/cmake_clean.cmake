@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_classify.dir/math_classify.cpp.o"
+  "CMakeFiles/posit_math_classify.dir/math_classify.cpp.o.d"
+  "posit_math_classify"
+  "posit_math_classify.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_classify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_exponent.dir/math_exponent.cpp.o"
+  "CMakeFiles/posit_math_exponent.dir/math_exponent.cpp.o.d"
+  "posit_math_exponent"
+  "posit_math_exponent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_exponent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
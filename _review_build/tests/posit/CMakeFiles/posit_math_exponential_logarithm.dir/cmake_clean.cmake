@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_exponential_logarithm.dir/math_exponential_logarithm.cpp.o"
+  "CMakeFiles/posit_math_exponential_logarithm.dir/math_exponential_logarithm.cpp.o.d"
+  "posit_math_exponential_logarithm"
+  "posit_math_exponential_logarithm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_exponential_logarithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
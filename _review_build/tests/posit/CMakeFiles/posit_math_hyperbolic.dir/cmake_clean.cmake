@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_hyperbolic.dir/math_hyperbolic.cpp.o"
+  "CMakeFiles/posit_math_hyperbolic.dir/math_hyperbolic.cpp.o.d"
+  "posit_math_hyperbolic"
+  "posit_math_hyperbolic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_hyperbolic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_logarithm.dir/math_logarithm.cpp.o"
+  "CMakeFiles/posit_math_logarithm.dir/math_logarithm.cpp.o.d"
+  "posit_math_logarithm"
+  "posit_math_logarithm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_logarithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_pow.dir/math_pow.cpp.o"
+  "CMakeFiles/posit_math_pow.dir/math_pow.cpp.o.d"
+  "posit_math_pow"
+  "posit_math_pow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_pow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_math_trigonometry.dir/math_trigonometry.cpp.o"
+  "CMakeFiles/posit_math_trigonometry.dir/math_trigonometry.cpp.o.d"
+  "posit_math_trigonometry"
+  "posit_math_trigonometry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_math_trigonometry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
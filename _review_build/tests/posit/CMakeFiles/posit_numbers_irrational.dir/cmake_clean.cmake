@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_numbers_irrational.dir/numbers_irrational.cpp.o"
+  "CMakeFiles/posit_numbers_irrational.dir/numbers_irrational.cpp.o.d"
+  "posit_numbers_irrational"
+  "posit_numbers_irrational.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_numbers_irrational.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_numbers_rational.dir/numbers_rational.cpp.o"
+  "CMakeFiles/posit_numbers_rational.dir/numbers_rational.cpp.o.d"
+  "posit_numbers_rational"
+  "posit_numbers_rational.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_numbers_rational.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
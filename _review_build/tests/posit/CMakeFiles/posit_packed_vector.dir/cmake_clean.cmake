@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_packed_vector.dir/packed_vector.cpp.o"
+  "CMakeFiles/posit_packed_vector.dir/packed_vector.cpp.o.d"
+  "posit_packed_vector"
+  "posit_packed_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_packed_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
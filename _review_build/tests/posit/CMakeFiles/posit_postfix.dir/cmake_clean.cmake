@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_postfix.dir/postfix.cpp.o"
+  "CMakeFiles/posit_postfix.dir/postfix.cpp.o.d"
+  "posit_postfix"
+  "posit_postfix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_postfix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_prefix.dir/prefix.cpp.o"
+  "CMakeFiles/posit_prefix.dir/prefix.cpp.o.d"
+  "posit_prefix"
+  "posit_prefix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_prefix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
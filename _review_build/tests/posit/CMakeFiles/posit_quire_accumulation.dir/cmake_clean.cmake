@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_quire_accumulation.dir/quire_accumulation.cpp.o"
+  "CMakeFiles/posit_quire_accumulation.dir/quire_accumulation.cpp.o.d"
+  "posit_quire_accumulation"
+  "posit_quire_accumulation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_quire_accumulation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posit_reciprocal_tables.dir/reciprocal_tables.cpp.o"
+  "CMakeFiles/posit_reciprocal_tables.dir/reciprocal_tables.cpp.o.d"
+  "posit_reciprocal_tables"
+  "posit_reciprocal_tables.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posit_reciprocal_tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
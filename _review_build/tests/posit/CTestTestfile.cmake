@@ -0,0 +1,86 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/posit
+# Build directory: /root/repo/_review_build/tests/posit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(posit_arithmetic_add "/posit_arithmetic_add")
+set_tests_properties(posit_arithmetic_add PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_batch "/posit_arithmetic_batch")
+set_tests_properties(posit_arithmetic_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_complex "/posit_arithmetic_complex")
+set_tests_properties(posit_arithmetic_complex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_divide "/posit_arithmetic_divide")
+set_tests_properties(posit_arithmetic_divide PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_fma "/posit_arithmetic_fma")
+set_tests_properties(posit_arithmetic_fma PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_literals "/posit_arithmetic_literals")
+set_tests_properties(posit_arithmetic_literals PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_multiply "/posit_arithmetic_multiply")
+set_tests_properties(posit_arithmetic_multiply PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_negate "/posit_arithmetic_negate")
+set_tests_properties(posit_arithmetic_negate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_posit_pair "/posit_arithmetic_posit_pair")
+set_tests_properties(posit_arithmetic_posit_pair PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_reciprocate "/posit_arithmetic_reciprocate")
+set_tests_properties(posit_arithmetic_reciprocate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_sqrt "/posit_arithmetic_sqrt")
+set_tests_properties(posit_arithmetic_sqrt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_arithmetic_subtract "/posit_arithmetic_subtract")
+set_tests_properties(posit_arithmetic_subtract PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_assignment "/posit_assignment")
+set_tests_properties(posit_assignment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_casting "/posit_casting")
+set_tests_properties(posit_casting PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_conversion "/posit_conversion")
+set_tests_properties(posit_conversion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_conversion_batch "/posit_conversion_batch")
+set_tests_properties(posit_conversion_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_conversion_chars "/posit_conversion_chars")
+set_tests_properties(posit_conversion_chars PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_conversion_exact_decimal "/posit_conversion_exact_decimal")
+set_tests_properties(posit_conversion_exact_decimal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_conversion_functions "/posit_conversion_functions")
+set_tests_properties(posit_conversion_functions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_decode "/posit_decode")
+set_tests_properties(posit_decode PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_decrement "/posit_decrement")
+set_tests_properties(posit_decrement PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_dsp_fft "/posit_dsp_fft")
+set_tests_properties(posit_dsp_fft PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_dsp_filters "/posit_dsp_filters")
+set_tests_properties(posit_dsp_filters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_file_format "/posit_file_format")
+set_tests_properties(posit_file_format PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_increment "/posit_increment")
+set_tests_properties(posit_increment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_logic "/posit_logic")
+set_tests_properties(posit_logic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_classify "/posit_math_classify")
+set_tests_properties(posit_math_classify PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_exponent "/posit_math_exponent")
+set_tests_properties(posit_math_exponent PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_exponential_logarithm "/posit_math_exponential_logarithm")
+set_tests_properties(posit_math_exponential_logarithm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_hyperbolic "/posit_math_hyperbolic")
+set_tests_properties(posit_math_hyperbolic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_logarithm "/posit_math_logarithm")
+set_tests_properties(posit_math_logarithm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_pow "/posit_math_pow")
+set_tests_properties(posit_math_pow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_math_trigonometry "/posit_math_trigonometry")
+set_tests_properties(posit_math_trigonometry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_numbers_irrational "/posit_numbers_irrational")
+set_tests_properties(posit_numbers_irrational PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_numbers_rational "/posit_numbers_rational")
+set_tests_properties(posit_numbers_rational PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_packed_vector "/posit_packed_vector")
+set_tests_properties(posit_packed_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_postfix "/posit_postfix")
+set_tests_properties(posit_postfix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_prefix "/posit_prefix")
+set_tests_properties(posit_prefix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_quire_accumulation "/posit_quire_accumulation")
+set_tests_properties(posit_quire_accumulation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
+add_test(posit_reciprocal_tables "/posit_reciprocal_tables")
+set_tests_properties(posit_reciprocal_tables PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/CMakeLists.txt;0;")
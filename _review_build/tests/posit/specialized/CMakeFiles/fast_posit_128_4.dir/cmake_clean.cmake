@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_posit_128_4.dir/posit_128_4.cpp.o"
+  "CMakeFiles/fast_posit_128_4.dir/posit_128_4.cpp.o.d"
+  "fast_posit_128_4"
+  "fast_posit_128_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_posit_128_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_posit_16_1.dir/posit_16_1.cpp.o"
+  "CMakeFiles/fast_posit_16_1.dir/posit_16_1.cpp.o.d"
+  "fast_posit_16_1"
+  "fast_posit_16_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_posit_16_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_posit_256_5.dir/posit_256_5.cpp.o"
+  "CMakeFiles/fast_posit_256_5.dir/posit_256_5.cpp.o.d"
+  "fast_posit_256_5"
+  "fast_posit_256_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_posit_256_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
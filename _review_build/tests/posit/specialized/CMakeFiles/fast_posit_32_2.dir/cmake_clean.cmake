@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_posit_32_2.dir/posit_32_2.cpp.o"
+  "CMakeFiles/fast_posit_32_2.dir/posit_32_2.cpp.o.d"
+  "fast_posit_32_2"
+  "fast_posit_32_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_posit_32_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_posit_3_0.dir/posit_3_0.cpp.o"
+  "CMakeFiles/fast_posit_3_0.dir/posit_3_0.cpp.o.d"
+  "fast_posit_3_0"
+  "fast_posit_3_0.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_posit_3_0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
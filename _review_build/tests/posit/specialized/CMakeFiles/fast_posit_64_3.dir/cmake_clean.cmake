@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_posit_64_3.dir/posit_64_3.cpp.o"
+  "CMakeFiles/fast_posit_64_3.dir/posit_64_3.cpp.o.d"
+  "fast_posit_64_3"
+  "fast_posit_64_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_posit_64_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
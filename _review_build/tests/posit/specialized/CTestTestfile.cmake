@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/posit/specialized
+# Build directory: /root/repo/_review_build/tests/posit/specialized
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(fast_posit_128_4 "/fast_posit_128_4")
+set_tests_properties(fast_posit_128_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_16_1 "/fast_posit_16_1")
+set_tests_properties(fast_posit_16_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_256_5 "/fast_posit_256_5")
+set_tests_properties(fast_posit_256_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_2_0 "/fast_posit_2_0")
+set_tests_properties(fast_posit_2_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_32_2 "/fast_posit_32_2")
+set_tests_properties(fast_posit_32_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_3_0 "/fast_posit_3_0")
+set_tests_properties(fast_posit_3_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_48_2 "/fast_posit_48_2")
+set_tests_properties(fast_posit_48_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_4_0 "/fast_posit_4_0")
+set_tests_properties(fast_posit_4_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_64_3 "/fast_posit_64_3")
+set_tests_properties(fast_posit_64_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_8_0 "/fast_posit_8_0")
+set_tests_properties(fast_posit_8_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
+add_test(fast_posit_8_1 "/fast_posit_8_1")
+set_tests_properties(fast_posit_8_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tests/posit/specialized/CMakeLists.txt;3;compile_all;/root/repo/tests/posit/specialized/CMakeLists.txt;0;")
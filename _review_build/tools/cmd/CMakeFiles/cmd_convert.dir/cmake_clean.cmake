@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_convert.dir/convert.cpp.o"
+  "CMakeFiles/cmd_convert.dir/convert.cpp.o.d"
+  "cmd_convert"
+  "cmd_convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_dc.dir/dc.cpp.o"
+  "CMakeFiles/cmd_dc.dir/dc.cpp.o.d"
+  "cmd_dc"
+  "cmd_dc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_dc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_fc.dir/fc.cpp.o"
+  "CMakeFiles/cmd_fc.dir/fc.cpp.o.d"
+  "cmd_fc"
+  "cmd_fc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_fc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
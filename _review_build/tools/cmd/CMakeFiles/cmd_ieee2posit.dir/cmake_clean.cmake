@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_ieee2posit.dir/ieee2posit.cpp.o"
+  "CMakeFiles/cmd_ieee2posit.dir/ieee2posit.cpp.o.d"
+  "cmd_ieee2posit"
+  "cmd_ieee2posit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_ieee2posit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
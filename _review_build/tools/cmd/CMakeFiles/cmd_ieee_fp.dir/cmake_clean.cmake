@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_ieee_fp.dir/ieee_fp.cpp.o"
+  "CMakeFiles/cmd_ieee_fp.dir/ieee_fp.cpp.o.d"
+  "cmd_ieee_fp"
+  "cmd_ieee_fp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_ieee_fp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
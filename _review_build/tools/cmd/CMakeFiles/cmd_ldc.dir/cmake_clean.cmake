@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_ldc.dir/ldc.cpp.o"
+  "CMakeFiles/cmd_ldc.dir/ldc.cpp.o.d"
+  "cmd_ldc"
+  "cmd_ldc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_ldc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
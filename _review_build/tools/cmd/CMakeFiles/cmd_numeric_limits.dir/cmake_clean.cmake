@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_numeric_limits.dir/numeric_limits.cpp.o"
+  "CMakeFiles/cmd_numeric_limits.dir/numeric_limits.cpp.o.d"
+  "cmd_numeric_limits"
+  "cmd_numeric_limits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_numeric_limits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
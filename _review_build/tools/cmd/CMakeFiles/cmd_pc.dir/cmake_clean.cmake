@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_pc.dir/pc.cpp.o"
+  "CMakeFiles/cmd_pc.dir/pc.cpp.o.d"
+  "cmd_pc"
+  "cmd_pc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_pc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_posit_properties.dir/posit_properties.cpp.o"
+  "CMakeFiles/cmd_posit_properties.dir/posit_properties.cpp.o.d"
+  "cmd_posit_properties"
+  "cmd_posit_properties.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_posit_properties.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/cmd
+# Build directory: /root/repo/_review_build/tools/cmd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cmd_convert "/cmd_convert")
+set_tests_properties(cmd_convert PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_dc "/cmd_dc")
+set_tests_properties(cmd_dc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_fc "/cmd_fc")
+set_tests_properties(cmd_fc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_ieee2posit "/cmd_ieee2posit")
+set_tests_properties(cmd_ieee2posit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_ieee_fp "/cmd_ieee_fp")
+set_tests_properties(cmd_ieee_fp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_ldc "/cmd_ldc")
+set_tests_properties(cmd_ldc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_numeric_limits "/cmd_numeric_limits")
+set_tests_properties(cmd_numeric_limits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_pc "/cmd_pc")
+set_tests_properties(cmd_pc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
+add_test(cmd_posit_properties "/cmd_posit_properties")
+set_tests_properties(cmd_posit_properties PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/cmd/CMakeLists.txt;3;compile_all;/root/repo/tools/cmd/CMakeLists.txt;0;")
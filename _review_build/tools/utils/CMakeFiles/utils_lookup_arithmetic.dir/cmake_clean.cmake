@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_lookup_arithmetic.dir/lookup_arithmetic.cpp.o"
+  "CMakeFiles/utils_lookup_arithmetic.dir/lookup_arithmetic.cpp.o.d"
+  "utils_lookup_arithmetic"
+  "utils_lookup_arithmetic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_lookup_arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
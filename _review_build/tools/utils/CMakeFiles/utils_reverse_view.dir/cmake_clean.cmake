@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils_reverse_view.dir/reverse_view.cpp.o"
+  "CMakeFiles/utils_reverse_view.dir/reverse_view.cpp.o.d"
+  "utils_reverse_view"
+  "utils_reverse_view.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils_reverse_view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
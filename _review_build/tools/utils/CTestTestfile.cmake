@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/utils
+# Build directory: /root/repo/_review_build/tools/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(utils_lookup_arithmetic "/utils_lookup_arithmetic")
+set_tests_properties(utils_lookup_arithmetic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/utils/CMakeLists.txt;3;compile_all;/root/repo/tools/utils/CMakeLists.txt;0;")
+add_test(utils_reverse_view "/utils_reverse_view")
+set_tests_properties(utils_reverse_view PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;291;add_test;/root/repo/tools/utils/CMakeLists.txt;3;compile_all;/root/repo/tools/utils/CMakeLists.txt;0;")
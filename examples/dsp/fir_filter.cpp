@@ -58,6 +58,13 @@ try {
 	}
 	cout << "Value is " << fir << endl;
 
+	// the streaming filter accumulates exactly and rounds every output sample once:
+	// its output at the last sample is the dot product above without the rounding error of the intermediate sums
+	fir_filter< posit<nbits, es> > filter(weights);
+	vector< posit<nbits, es> > output(vecSize);
+	filter.process(sinusoid.data(), output.data(), vecSize);
+	cout << "Streaming filter output is " << output[vecSize - 1] << endl;
+
 	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 catch (char const* msg) {
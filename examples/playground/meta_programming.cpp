@@ -22,10 +22,10 @@ struct hasSerialize {
 	template<typename U, U function>
 	struct reallyHas;
 
-	template<typename S> static yes& test(reallyHas<std::string(S::*)(), &S::serialize>* /*unused*/) {return ' '; }
-	template<typename S> static yes& test(reallyHas<std::string(S::*)() const, &S::serialize>* /*unused*/) {return ' '; }
+	template<typename S> static yes& test(reallyHas<std::string(S::*)(), &S::serialize>* /*unused*/);
+	template<typename S> static yes& test(reallyHas<std::string(S::*)() const, &S::serialize>* /*unused*/);
 
-	template<typename> static no& test(...) { return ' ';}
+	template<typename> static no& test(...);
 
 	// constant used as return value for the test
 	static const bool value = sizeof(test<T>(0)) == sizeof(yes);
@@ -1,358 +1,427 @@
 #pragma once
-// areal.hpp: definition of a variable float representation that mimics the posit configuration
+// areal.hpp: definition of an arbitrary configuration linear floating-point representation with an uncertainty bit
 //
-// Copyright (C) 2017-2018 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
 #include <limits>
-#include <bitset>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <utility>
 
-#include "universal/posit/exponent.hpp"
-#include "universal/posit/fraction.hpp"
-#include "universal/posit/value.hpp"
+#include "universal/bitblock/bitblock.hpp"
+#include "universal/posit/trace_constants.hpp"
+#include "universal/posit/uint128.hpp"
+#include "universal/utility/int128.hpp"
 
 namespace sw {
 	namespace unum {
-		
+
 		// Forward definitions
 		template<size_t nbits, size_t es> class areal;
 		template<size_t nbits, size_t es> areal<nbits,es> abs(const areal<nbits,es>& v);
 
-		template<size_t nbits, size_t es>
-		void extract_fields(const bitblock<nbits>& raw_bits, bool& _sign, exponent<nbits, es>& _exponent, fraction<nbits - es -1>& _fraction) {
-			constexpr size_t fbits = nbits - es - 1;
-			_sign = raw_bits[nbits - 1];
-			bitblock<es> bits;
-			for (size_t i = nbits - 2; i > nbits - es - 1; --i) bits[i - nbits - es] = raw_bits[i];
-			_exponent.set(bits, es);
-			bitblock<fbits> fraction_bits;
-			int f = fbits - 1;
-			for (size_t i = nbits - es - 2; f >= 0; --i, --f) fraction_bits[f] = raw_bits[i];
-			_fraction.set(fraction_bits, fbits);
-		}
-
-		// decode takes the raw bits representing an arbitrary real coming from memory
-		// and decodes the sign, the exponent, and the fraction.
-		// This function has the functionality of the real(float) register-file load.
-		template<size_t nbits, size_t es>
-		void decode(const bitblock<nbits>& raw_bits, bool& _sign, exponent<nbits, es>& _exponent, fraction<nbits - es - 1>& _fraction) {
-			// check special cases
-			_sign = raw_bits.test(nbits - 1);
-			if (_sign) {
-				std::bitset<nbits> tmp(raw_bits);
-				tmp.reset(nbits - 1);
-				if (tmp.none()) {
-					// setnan();   special case = NaR (Not a Real)
-					_sign = true;
-					_exponent.reset();
+		namespace impl {
+
+			/*
+			An areal<nbits, es> is laid out as an IEEE-754 binary format: a sign bit, es exponent bits with a bias of 2^(es-1) - 1,
+			and fbits = nbits - 1 - es fraction bits, with the subnormals at the exponent field 0, and the infinities and NaNs at
+			the exponent field of all ones. The uncertainty bit, the ubit, is carried next to the encoding as an inexact flag.
+			The arithmetic truncates the exact result of the encoded values toward zero, and sets the ubit when nonzero bits were
+			truncated, or when an operand carried the ubit, so that a result never claims to be exact when it is not. When the
+			operands are exact, a set ubit bounds the exact result to the open interval between the encoding and its neighbor away
+			from zero. The operators do not widen the result by the uncertainty of the operands, so that the result of an
+			uncertain operand is not such a bound: 1.5u * 1.5u truncates to 2.25u, while the product of the intervals reaches
+			above the neighbor of 2.25, and 1.0u - 0.5u is 0.5u, while the difference of the intervals reaches below 0.5.
+			An enclosure of the uncertain operands takes a pair of bounds, each rounded outward, like the valid
+			of the posit environment. Infinities and NaNs are exact, and the overflow of a finite result is the largest finite value
+			with the ubit set.
+
+			The operators work on the word-level fields: the significand and the exponent of a finite encoding, with
+			|value| = significand * 2^exponent, fit a 64-bit word and an int, and the exact sums, products, quotients, and square roots
+			are formed in the uint128 of the extended precision posit kernels before they are truncated back into the encoding.
+			*/
+			template<size_t nbits, size_t es>
+			struct areal_encoding {
+				static constexpr unsigned fbits = unsigned(nbits - 1 - es);
+				static constexpr int      bias  = (1 << (es - 1)) - 1;
+				static constexpr int      emax  = bias;                 // scale of the largest binade
+				static constexpr int      emin  = 1 - bias;             // scale of the smallest normal binade
+				static constexpr int      qmin  = emin - int(fbits);    // exponent of the least significant bit of the subnormals
+				static constexpr uint64_t hidden = uint64_t(1) << fbits;
+				static constexpr uint64_t fraction_mask = hidden - 1;
+				static constexpr uint64_t exponent_mask = (uint64_t(1) << es) - 1;
+				static constexpr uint64_t sign_mask = uint64_t(1) << (nbits - 1);
+				static constexpr uint64_t magnitude_mask = sign_mask - 1;
+				static constexpr uint64_t infinity = exponent_mask << fbits;
+				static constexpr uint64_t maxpos = infinity - 1;
+				static constexpr uint64_t quiet_nan = infinity | (hidden >> 1);
+			};
+
+			template<size_t nbits, size_t es>
+			inline bool areal_isnan(uint64_t bits) { return (bits & areal_encoding<nbits, es>::magnitude_mask) > areal_encoding<nbits, es>::infinity; }
+			template<size_t nbits, size_t es>
+			inline bool areal_isinf(uint64_t bits) { return (bits & areal_encoding<nbits, es>::magnitude_mask) == areal_encoding<nbits, es>::infinity; }
+			template<size_t nbits, size_t es>
+			inline bool areal_iszero(uint64_t bits) { return (bits & areal_encoding<nbits, es>::magnitude_mask) == 0; }
+
+			// the significand of a finite encoding, and its exponent: |value| = significand * 2^exponent
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_unpack(uint64_t bits, int& exponent) {
+				typedef areal_encoding<nbits, es> E;
+				int field = int((bits >> E::fbits) & E::exponent_mask);
+				uint64_t fraction = bits & E::fraction_mask;
+				if (field == 0) {
+					exponent = E::qmin;
+					return fraction;
+				}
+				exponent = field - E::bias - int(E::fbits);
+				return fraction | E::hidden;
+			}
+
+			// truncate the nonzero significand * 2^exponent toward zero into an encoding, and set the ubit when bits are lost
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_pack(bool sign, const uint128& significand, int exponent, bool& ubit) {
+				typedef areal_encoding<nbits, es> E;
+				uint64_t s = sign ? E::sign_mask : 0;
+				int scale = exponent + 127 - int(countLeadingZeros(significand));
+				if (scale > E::emax) {
+					ubit = true;
+					return s | E::maxpos;
+				}
+				// exponent of the least significant bit of the result
+				int lsb = (scale < E::emin ? E::qmin : scale - int(E::fbits));
+				uint64_t fraction;
+				if (lsb > exponent) {
+					unsigned shift = unsigned(lsb - exponent);
+					if (anyAfter(significand, shift)) ubit = true;
+					fraction = (significand >> shift).lower;
 				}
 				else {
-					extract_fields(raw_bits, _sign, _exponent, _fraction);
+					fraction = (significand << unsigned(exponent - lsb)).lower;
+				}
+				if (scale < E::emin) return s | fraction;
+				// the hidden bit of a normal significand carries into the exponent field
+				return s | ((uint64_t(scale + E::bias - 1) << E::fbits) + fraction);
+			}
+
+			// quotient of the 128-bit x by the word d, with x.upper < d so that the quotient fits a word
+			inline uint64_t areal_divide(const uint128& x, uint64_t d, uint64_t& remainder) {
+#if defined(__SIZEOF_INT128__)
+				native_uint128 n = ((native_uint128)x.upper << 64) | x.lower;
+				remainder = uint64_t(n % d);
+				return uint64_t(n / d);
+#else
+				uint64_t r = x.upper, q = 0;
+				for (int i = 63; i >= 0; --i) {
+					bool carry = (r >> 63) != 0;
+					r = (r << 1) | ((x.lower >> i) & 1);
+					q <<= 1;
+					if (carry || r >= d) {
+						r -= d;
+						q |= 1;
+					}
 				}
+				remainder = r;
+				return q;
+#endif
 			}
-			else {
-				if (raw_bits.none()) {
-					// setzero();  special case = 0
-					_sign = false;
-					_exponent.reset();
-					_fraction.reset();
+
+			// integer square root of the nonzero x, which is left holding the remainder x - root^2:
+			// the root in double precision, one Newton correction on the words, and the last units by the square
+			inline uint64_t areal_isqrt(uint128& x) {
+				double estimate = std::sqrt(std::ldexp(double(x.upper), 64) + double(x.lower));
+				uint64_t root = estimate >= std::ldexp(1.0, 64) ? ~uint64_t(0) : (estimate < 1.0 ? 1 : uint64_t(estimate));
+				// the difference of the square is close to 2 * root * error, so that its quotient by root fits a word
+				uint64_t remainder;
+				uint128 square = multiply(root, root);
+				if (x < square) {
+					root -= areal_divide(square - x, root, remainder) / 2;
+				}
+				else {
+					uint64_t correction = areal_divide(x - square, root, remainder) / 2;
+					root = (root + correction < root) ? ~uint64_t(0) : root + correction;
+				}
+				while (x < multiply(root, root)) --root;
+				while (root != ~uint64_t(0) && multiply(root + 1, root + 1) < x + uint128{ 1, 0 }) ++root;
+				x = x - multiply(root, root);
+				return root;
+			}
+
+			// sum of two encodings: the ubit enters as the uncertainty of the operands and leaves as the uncertainty of the sum
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_add(uint64_t a, uint64_t b, bool& ubit) {
+				typedef areal_encoding<nbits, es> E;
+				if (areal_isnan<nbits, es>(a) || areal_isnan<nbits, es>(b)) {
+					ubit = false;
+					return E::quiet_nan;
+				}
+				bool sa = (a & E::sign_mask) != 0, sb = (b & E::sign_mask) != 0;
+				if (areal_isinf<nbits, es>(a)) {
+					ubit = false;
+					return (areal_isinf<nbits, es>(b) && sa != sb) ? E::quiet_nan : a;
+				}
+				if (areal_isinf<nbits, es>(b)) {
+					ubit = false;
+					return b;
+				}
+				// the sum of zeros of opposite sign is +0
+				if (areal_iszero<nbits, es>(b)) return (areal_iszero<nbits, es>(a) && sa != sb) ? 0 : a;
+				if (areal_iszero<nbits, es>(a)) return b;
+
+				int ea, eb;
+				uint64_t ma = areal_unpack<nbits, es>(a, ea);
+				uint64_t mb = areal_unpack<nbits, es>(b, eb);
+				if (ea < eb) {
+					std::swap(ma, mb);
+					std::swap(ea, eb);
+					std::swap(sa, sb);
+				}
+				// align at the smaller exponent: an operand below a quarter unit in the last place of the other
+				// truncates like any value strictly inside that quarter, and is replaced by a sticky bit
+				uint128 x = { ma, 0 }, y = { mb, 0 };
+				int exponent = eb;
+				if (ea - eb > 64) {
+					x = x << 3;
+					y.lower = 1;
+					exponent = ea - 3;
 				}
 				else {
-					extract_fields(raw_bits, _sign, _exponent, _fraction);
+					x = x << unsigned(ea - eb);
+				}
+				if (sa == sb) return areal_pack<nbits, es>(sa, x + y, exponent, ubit);
+				if (x == y) return 0;
+				return (y < x) ? areal_pack<nbits, es>(sa, x - y, exponent, ubit) : areal_pack<nbits, es>(sb, y - x, exponent, ubit);
+			}
+
+			// product of two encodings
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_mul(uint64_t a, uint64_t b, bool& ubit) {
+				typedef areal_encoding<nbits, es> E;
+				if (areal_isnan<nbits, es>(a) || areal_isnan<nbits, es>(b)) {
+					ubit = false;
+					return E::quiet_nan;
+				}
+				uint64_t s = (a ^ b) & E::sign_mask;
+				bool zero = areal_iszero<nbits, es>(a) || areal_iszero<nbits, es>(b);
+				if (areal_isinf<nbits, es>(a) || areal_isinf<nbits, es>(b)) {
+					ubit = false;
+					return zero ? E::quiet_nan : (s | E::infinity);
+				}
+				if (zero) return s;
+
+				int ea, eb;
+				uint64_t ma = areal_unpack<nbits, es>(a, ea);
+				uint64_t mb = areal_unpack<nbits, es>(b, eb);
+				return areal_pack<nbits, es>(s != 0, multiply(ma, mb), ea + eb, ubit);
+			}
+
+			// quotient of two encodings
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_div(uint64_t a, uint64_t b, bool& ubit) {
+				typedef areal_encoding<nbits, es> E;
+				if (areal_isnan<nbits, es>(a) || areal_isnan<nbits, es>(b)) {
+					ubit = false;
+					return E::quiet_nan;
+				}
+				uint64_t s = (a ^ b) & E::sign_mask;
+				if (areal_isinf<nbits, es>(a)) {
+					ubit = false;
+					return areal_isinf<nbits, es>(b) ? E::quiet_nan : (s | E::infinity);
+				}
+				if (areal_iszero<nbits, es>(b)) {
+					ubit = false;
+					return areal_iszero<nbits, es>(a) ? E::quiet_nan : (s | E::infinity);
+				}
+				if (areal_isinf<nbits, es>(b) || areal_iszero<nbits, es>(a)) return s;
+
+				int ea, eb;
+				uint64_t ma = areal_unpack<nbits, es>(a, ea);
+				uint64_t mb = areal_unpack<nbits, es>(b, eb);
+				// normalize the divisor to a most significant bit at 63, and the dividend to 126,
+				// so that the quotient has 63 or 64 bits, and the remainder is the sticky bit
+				unsigned shift = countLeadingZeros(mb);
+				mb <<= shift;
+				eb -= int(shift);
+				shift = 63 + countLeadingZeros(ma);
+				uint128 x = { ma, 0 };
+				x = x << shift;
+				ea -= int(shift);
+				uint64_t remainder;
+				uint128 q = { areal_divide(x, mb, remainder), 0 };
+				q = q << 1;
+				q.lower |= (remainder != 0 ? 1 : 0);
+				return areal_pack<nbits, es>(s != 0, q, ea - eb - 1, ubit);
+			}
+
+			// square root of an encoding
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_sqrt(uint64_t a, bool& ubit) {
+				typedef areal_encoding<nbits, es> E;
+				if (areal_isnan<nbits, es>(a)) {
+					ubit = false;
+					return E::quiet_nan;
+				}
+				// sqrt(-0) is -0
+				if (areal_iszero<nbits, es>(a)) return a;
+				if (a & E::sign_mask) {
+					ubit = false;
+					return E::quiet_nan;
+				}
+				if (areal_isinf<nbits, es>(a)) {
+					ubit = false;
+					return a;
+				}
+
+				int exponent;
+				uint64_t m = areal_unpack<nbits, es>(a, exponent);
+				// normalize to a most significant bit at 125 or 126 with an even exponent, so that the root has 63 or 64 bits
+				unsigned shift = 62 + countLeadingZeros(m);
+				if ((exponent - int(shift)) & 1) ++shift;
+				uint128 x = { m, 0 };
+				x = x << shift;
+				uint128 root = { areal_isqrt(x), 0 };
+				root = root << 1;
+				root.lower |= (iszero(x) ? 0 : 1);
+				return areal_pack<nbits, es>(false, root, (exponent - int(shift)) / 2 - 1, ubit);
+			}
+
+			// the integer sign * magnitude truncated into an encoding
+			template<size_t nbits, size_t es>
+			inline uint64_t areal_from_integer(bool sign, uint64_t magnitude, bool& ubit) {
+				ubit = false;
+				if (magnitude == 0) return 0;
+				uint128 significand = { magnitude, 0 };
+				return areal_pack<nbits, es>(sign, significand, 0, ubit);
+			}
+
+			// a native floating-point value truncated into an encoding
+			template<size_t nbits, size_t es, typename Real>
+			inline uint64_t areal_from_native(Real v, bool& ubit) {
+				typedef areal_encoding<nbits, es> E;
+				ubit = false;
+				if (std::isnan(v)) return E::quiet_nan;
+				uint64_t s = std::signbit(v) ? E::sign_mask : 0;
+				if (std::isinf(v)) return s | E::infinity;
+				if (v == 0) return s;
+				int exponent;
+				Real scaled = std::ldexp(std::frexp(std::fabs(v), &exponent), 64);
+				Real whole = std::floor(scaled);
+				if (whole != scaled) ubit = true;
+				uint128 significand = { uint64_t(whole), 0 };
+				return areal_pack<nbits, es>(s != 0, significand, exponent - 64, ubit);
+			}
+
+			// the native floating-point value of an encoding, rounded when the native type is narrower
+			template<size_t nbits, size_t es, typename Real>
+			inline Real areal_to_native(uint64_t bits) {
+				Real v;
+				if (areal_isnan<nbits, es>(bits)) {
+					v = std::numeric_limits<Real>::quiet_NaN();
+				}
+				else if (areal_isinf<nbits, es>(bits)) {
+					v = std::numeric_limits<Real>::infinity();
 				}
+				else {
+					int exponent;
+					uint64_t significand = areal_unpack<nbits, es>(bits, exponent);
+					v = std::ldexp(Real(significand), exponent);
+				}
+				return (bits & areal_encoding<nbits, es>::sign_mask) ? -v : v;
 			}
-			if (_trace_decode) std::cout << "raw bits: " << raw_bits << " posit bits: " << (_sign ? "1|" : "0|") << "|" << _exponent << "|" << _fraction << std::endl;
-
-			// we are storing both the raw bit representation and the decoded form
-			// so no need to transform back via 2's complement of regime/exponent/fraction
-		}
-
-		// needed to avoid double rounding situations: TODO: does that mean the condensed version above should be removed?
-		template<size_t nbits, size_t es, size_t fbits>
-		inline areal<nbits, es>& convert_(bool _sign, int _scale, const bitblock<fbits>& fraction_in, areal<nbits, es>& r) {
-			if (_trace_conversion) std::cout << "------------------- CONVERT ------------------" << std::endl;
-			if (_trace_conversion) std::cout << "sign " << (_sign ? "-1 " : " 1 ") << "scale " << std::setw(3) << _scale << " fraction " << fraction_in << std::endl;
-
-			r.reset();
-
-			return r;
-		}
 
-		// convert a floating point value to a specific areal configuration. Semantically, p = v, return reference to p
-		template<size_t nbits, size_t es>
-		inline areal<nbits, es>& convert(const value<nbits - es - 1>& v, areal<nbits, es>& p) {
-			constexpr size_t fbits = nbits - es - 1;
-			if (_trace_conversion) std::cout << "------------------- CONVERT ------------------" << std::endl;
-			if (_trace_conversion) std::cout << "sign " << (v.sign() ? "-1 " : " 1 ") << "scale " << std::setw(3) << v.scale() << " fraction " << v.fraction() << std::endl;
-
-			if (v.iszero()) {
-				p.setzero();
-				return p;
+			// scale of the most significant bit of a finite nonzero encoding, 0 otherwise
+			template<size_t nbits, size_t es>
+			inline int areal_scale(uint64_t bits) {
+				if (areal_iszero<nbits, es>(bits) || areal_isinf<nbits, es>(bits) || areal_isnan<nbits, es>(bits)) return 0;
+				int exponent;
+				uint64_t significand = areal_unpack<nbits, es>(bits, exponent);
+				return exponent + 63 - int(countLeadingZeros(significand));
 			}
-			if (v.isnan() || v.isinf()) {
-				p.setnan();
-				return p;
+
+			// three-way comparison of non-NaN encodings, in which an exact value orders below the uncertain interval
+			// that starts at it, and above the uncertain interval that ends at it when negative
+			template<size_t nbits, size_t es>
+			inline int areal_compare(uint64_t a, bool ua, uint64_t b, bool ub) {
+				typedef areal_encoding<nbits, es> E;
+				// the ubit is the least significant bit of the key of the magnitude
+				uint64_t ka = ((a & E::magnitude_mask) << 1) | (ua ? 1 : 0);
+				uint64_t kb = ((b & E::magnitude_mask) << 1) | (ub ? 1 : 0);
+				bool na = (a & E::sign_mask) != 0 && ka != 0;
+				bool nb = (b & E::sign_mask) != 0 && kb != 0;
+				if (na != nb) return na ? -1 : 1;
+				if (ka == kb) return 0;
+				return ((ka < kb) != na) ? -1 : 1;
 			}
-			return convert_<nbits, es, fbits>(v.sign(), v.scale(), v.fraction(), p);
-		}
 
-		// template class representing a value in scientific notation, using a template size for the number of fraction bits
+		} // namespace impl
+
+		// template class representing a linear floating-point value with an uncertainty bit
 		template<size_t nbits, size_t es>
 		class areal {
+			typedef impl::areal_encoding<nbits, es> Encoding;
 		public:
+			static_assert(nbits <= 64, "areal arithmetic is implemented on the fields of a 64-bit word: nbits must be <= 64");
+			static_assert(es >= 1 && es <= 30, "areal exponent field must be 1 to 30 bits");
+			static_assert(nbits > es + 1, "areal requires at least one fraction bit");
+
 			static constexpr size_t fbits  = nbits - 1 - es;    // number of fraction bits excluding the hidden bit
 			static constexpr size_t fhbits = fbits + 1;         // number of fraction bits including the hidden bit
-			static constexpr size_t abits = fhbits + 3;         // size of the addend
-			static constexpr size_t mbits = 2 * fhbits;         // size of the multiplier output
-			static constexpr size_t divbits = 3 * fhbits + 4;   // size of the divider output
 
-			areal() : _sign(false), _scale(0), _nrOfBits(fbits), _inf(false), _zero(true), _nan(false) {}
-			areal(bool sign, int scale, const bitblock<fbits>& fraction_without_hidden_bit, bool zero = true, bool inf = false) : _sign(sign), _scale(scale), _nrOfBits(fbits), _fraction(fraction_without_hidden_bit), _inf(inf), _zero(zero), _nan(false) {}
-			areal(signed char initial_value) {
-				*this = initial_value;
-			}
-			areal(short initial_value) {
-				*this = initial_value;
-			}
-			areal(int initial_value) {
-				*this = initial_value;
-			}
-			areal(long long initial_value) {
-				*this = initial_value;
-			}
-			areal(unsigned long long initial_value) {
-				*this = initial_value;
-			}
-			areal(float initial_value) {
-				*this = initial_value;
-			}
-			areal(double initial_value) {
-				*this = initial_value;
-			}
-			areal(long double initial_value) {
-				*this = initial_value;
-			}
-			areal(const areal& rhs) {
-				*this = rhs;
-			}
-			areal& operator=(const areal& rhs) {
-				_sign	  = rhs._sign;
-				_scale	  = rhs._scale;
-				_fraction = rhs._fraction;
-				_raw_bits = rhs._raw_bits ;
-				_nrOfBits = rhs._nrOfBits;
-				_inf      = rhs._inf;
-				_zero     = rhs._zero;
-				_nan      = rhs._nan;
-				return *this;
-			}
-			areal& operator=(signed char rhs) {
-				*this = (long long)(rhs);
-				return *this;
-			}
-			areal& operator=(short rhs) {
-				*this = (long long)(rhs);
-				return *this;
-			}
-			areal& operator=(int rhs) {
-				*this = (long long)(rhs);
-				return *this;
-			}
+			areal() : _bits(0), _ubit(false) {}
+
+			areal(signed char initial_value) { *this = initial_value; }
+			areal(short initial_value) { *this = initial_value; }
+			areal(int initial_value) { *this = initial_value; }
+			areal(long initial_value) { *this = initial_value; }
+			areal(long long initial_value) { *this = initial_value; }
+			areal(unsigned int initial_value) { *this = initial_value; }
+			areal(unsigned long initial_value) { *this = initial_value; }
+			areal(unsigned long long initial_value) { *this = initial_value; }
+			areal(float initial_value) { *this = initial_value; }
+			areal(double initial_value) { *this = initial_value; }
+			areal(long double initial_value) { *this = initial_value; }
+			areal(const areal& rhs) = default;
+
+			areal& operator=(const areal& rhs) = default;
+			areal& operator=(signed char rhs) { return *this = (long long)(rhs); }
+			areal& operator=(short rhs) { return *this = (long long)(rhs); }
+			areal& operator=(int rhs) { return *this = (long long)(rhs); }
+			areal& operator=(long rhs) { return *this = (long long)(rhs); }
 			areal& operator=(long long rhs) {
 				if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-				if (rhs == 0) {
-					setzero();
-					return *this;
-				}
-				reset();
-				_sign = (0x8000000000000000 & rhs);  // 1 is negative, 0 is positive
-				if (_sign) {
-					// process negative number: process 2's complement of the input
-					_scale = findMostSignificantBit(-rhs) - 1;
-					uint64_t _fraction_without_hidden_bit = (-rhs << (64 - _scale));
-					_fraction = copy_integer_fraction<fbits>(_fraction_without_hidden_bit);
-					//take_2s_complement();
-					_nrOfBits = fbits;
-					if (_trace_conversion) std::cout << "int64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
-				}
-				else {
-					// process positive number
-					if (rhs != 0) {
-						_scale = findMostSignificantBit(rhs) - 1;
-						uint64_t _fraction_without_hidden_bit = (rhs << (64 - _scale));
-						_fraction = copy_integer_fraction<fbits>(_fraction_without_hidden_bit);
-						_nrOfBits = fbits;
-						if (_trace_conversion) std::cout << "int64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
-					}
-				}
+				_bits = impl::areal_from_integer<nbits, es>(rhs < 0, rhs < 0 ? 0ull - (unsigned long long)(rhs) : (unsigned long long)(rhs), _ubit);
 				return *this;
 			}
+			areal& operator=(unsigned int rhs) { return *this = (unsigned long long)(rhs); }
+			areal& operator=(unsigned long rhs) { return *this = (unsigned long long)(rhs); }
 			areal& operator=(unsigned long long rhs) {
 				if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-				if (rhs == 0) {
-					setzero();
-				}
-				else {
-					reset();
-					_scale = findMostSignificantBit(rhs) - 1;
-					uint64_t _fraction_without_hidden_bit = (rhs << (64 - _scale));
-					_fraction = copy_integer_fraction<fbits>(_fraction_without_hidden_bit);
-					_nrOfBits = fbits;
-				}
-				if (_trace_conversion) std::cout << "uint64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
-				return *this;
-			}
-			areal& operator=(float rhs) {
-				reset();
-				if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-
-				switch (std::fpclassify(rhs)) {
-				case FP_ZERO:
-					_nrOfBits = fbits;
-					_zero = true;
-					break;
-				case FP_INFINITE:
-					_inf  = true;
-					break;
-				case FP_NAN:
-					_nan = true;
-					break;
-				case FP_SUBNORMAL:
-					std::cerr << "TODO: subnormal number: returning 0" << std::endl;
-					break;
-				case FP_NORMAL:
-				{
-					float _fr;
-					unsigned int _23b_fraction_without_hidden_bit;
-					int _exponent;
-					extract_fp_components(rhs, _sign, _exponent, _fr, _23b_fraction_without_hidden_bit);
-					_scale = _exponent - 1;
-					_fraction = extract_23b_fraction<fbits>(_23b_fraction_without_hidden_bit);
-					_nrOfBits = fbits;
-					if (_trace_conversion) std::cout << "float " << rhs << " sign " << _sign << " scale " << _scale << " 23b fraction 0x" << std::hex << _23b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-				}
-				break;
-				}
-				return *this;
-			}
-			areal& operator=(double rhs) {
-				reset();
-				if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-
-				switch (std::fpclassify(rhs)) {
-				case FP_ZERO:
-					_nrOfBits = fbits;
-					_zero = true;
-					break;
-				case FP_INFINITE:
-					_inf = true;
-					break;
-				case FP_NAN:
-					_nan = true;
-					break;
-				case FP_SUBNORMAL:
-					std::cerr << "TODO: subnormal number: returning 0" << std::endl;
-					break;
-				case FP_NORMAL:
-				{
-					double _fr;
-					unsigned long long _52b_fraction_without_hidden_bit;
-					int _exponent;
-					extract_fp_components(rhs, _sign, _exponent, _fr, _52b_fraction_without_hidden_bit);
-					_scale = _exponent - 1;
-					_fraction = extract_52b_fraction<fbits>(_52b_fraction_without_hidden_bit);
-					_nrOfBits = fbits;
-					if (_trace_conversion) std::cout << "double " << rhs << " sign " << _sign << " scale " << _scale << " 52b fraction 0x" << std::hex << _52b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-				}
-				break;
-				}
-				return *this;
-			}
-			areal& operator=(long double rhs) {
-				reset();
-				if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-
-				switch (std::fpclassify(rhs)) {
-				case FP_ZERO:
-					_nrOfBits = fbits;
-					_zero = true;
-					break;
-				case FP_INFINITE:
-					_inf = true;
-					break;
-				case FP_NAN:
-					_nan = true;
-					break;
-				case FP_SUBNORMAL:
-					std::cerr << "TODO: subnormal number: returning 0" << std::endl;
-					break;
-				case FP_NORMAL:
-				{
-					long double _fr;
-					unsigned long long _63b_fraction_without_hidden_bit;
-					int _exponent;
-					extract_fp_components(rhs, _sign, _exponent, _fr, _63b_fraction_without_hidden_bit);
-					_scale = _exponent - 1;
-					// how to interpret the fraction bits: TODO: this should be a static compile-time code block
-					if (sizeof(long double) == 8) {
-						// we are just a double and thus only have 52bits of fraction
-						_fraction = extract_52b_fraction<fbits>(_63b_fraction_without_hidden_bit);
-						if (_trace_conversion) std::cout << "long double " << rhs << " sign " << _sign << " scale " << _scale << " 52b fraction 0x" << std::hex << _63b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-
-					}
-					else if (sizeof(long double) == 16) {
-						// how to differentiate between 80bit and 128bit formats?
-						_fraction = extract_63b_fraction<fbits>(_63b_fraction_without_hidden_bit);
-						if (_trace_conversion) std::cout << "long double " << rhs << " sign " << _sign << " scale " << _scale << " 63b fraction 0x" << std::hex << _63b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-
-					}
-					_nrOfBits = fbits;
-				}
-				break;
-				}
+				_bits = impl::areal_from_integer<nbits, es>(false, rhs, _ubit);
 				return *this;
 			}
+			areal& operator=(float rhs) { return float_assign(rhs); }
+			areal& operator=(double rhs) { return float_assign(rhs); }
+			areal& operator=(long double rhs) { return float_assign(rhs); }
 
 			// operators
 			// prefix operator
-			areal operator-() const {				
-				return areal<nbits,es>(!_sign, _scale, _fraction, _zero, _inf);
+			areal operator-() const {
+				areal negated(*this);
+				negated._bits ^= Encoding::sign_mask;
+				return negated;
 			}
 
-			// we model a hw pipeline with register assignments, functional block, and conversion
+			// the ubit of a result is set when the result is inexact, or an operand is uncertain, which flags without bounding
 			areal& operator+=(const areal& rhs) {
 				if (_trace_add) std::cout << "---------------------- ADD -------------------" << std::endl;
-				// special case handling of the inputs
-				if (isnan() || rhs.isnan()) {
-					setnan();
-					return *this;
-				}
-				if (iszero()) {
-					*this = rhs;
-					return *this;
-				}
-				if (rhs.iszero()) return *this;
-
-				// arithmetic operation
-				value<abits + 1> sum;
-				value<fbits> a, b;
-				// transform the inputs into (sign,scale,fraction) triples
-				normalize(a);
-				rhs.normalize(b);
-				module_add<fbits, abits>(a, b, sum);		// add the two inputs
-
-															// special case handling of the result
-				if (sum.iszero()) {
-					setzero();
-				}
-				else if (sum.isinf()) {
-					setnan();
-				}
-				else {
-					//convert(sum, *this);
-					convert_<nbits, es, abits+1>(sum.sign(), sum.scale(), sum.fraction(), *this);
-				}
+				_ubit = _ubit || rhs._ubit;
+				_bits = impl::areal_add<nbits, es>(_bits, rhs._bits, _ubit);
 				return *this;
 			}
 			areal& operator+=(double rhs) {
@@ -360,72 +429,17 @@ namespace sw {
 			}
 			areal& operator-=(const areal& rhs) {
 				if (_trace_sub) std::cout << "---------------------- SUB -------------------" << std::endl;
-				// special case handling of the inputs
-				if (isnan() || rhs.isnan()) {
-					setnan();
-					return *this;
-				}
-				if (iszero()) {
-					*this = -rhs;
-					return *this;
-				}
-				if (rhs.iszero()) return *this;
-
-				// arithmetic operation
-				value<abits + 1> difference;
-				value<fbits> a, b;
-				// transform the inputs into (sign,scale,fraction) triples
-				normalize(a);
-				rhs.normalize(b);
-				module_subtract<fbits, abits>(a, b, difference);	// add the two inputs
-
-																	// special case handling of the result
-				if (difference.iszero()) {
-					setzero();
-				}
-				else if (difference.isinf()) {
-					setnan();
-				}
-				else {
-					//convert(difference, *this);
-				}
+				_ubit = _ubit || rhs._ubit;
+				_bits = impl::areal_add<nbits, es>(_bits, rhs._bits ^ Encoding::sign_mask, _ubit);
 				return *this;
 			}
 			areal& operator-=(double rhs) {
 				return *this -= areal<nbits, es>(rhs);
 			}
 			areal& operator*=(const areal& rhs) {
-				static_assert(fhbits > 0, "posit configuration does not support multiplication");
 				if (_trace_mul) std::cout << "---------------------- MUL -------------------" << std::endl;
-				// special case handling of the inputs
-				if (isnan() || rhs.isnan()) {
-					setnan();
-					return *this;
-				}
-				if (iszero() || rhs.iszero()) {
-					setzero();
-					return *this;
-				}
-
-				// arithmetic operation
-				value<mbits> product;
-				value<fbits> a, b;
-				// transform the inputs into (sign,scale,fraction) triples
-				normalize(a);
-				rhs.normalize(b);
-
-				module_multiply(a, b, product);    // multiply the two inputs
-
-												   // special case handling on the output
-				if (product.iszero()) {
-					setzero();
-				}
-				else if (product.isinf()) {
-					setnan();
-				}
-				else {
-					//convert(product, *this);
-				}
+				_ubit = _ubit || rhs._ubit;
+				_bits = impl::areal_mul<nbits, es>(_bits, rhs._bits, _ubit);
 				return *this;
 			}
 			areal& operator*=(double rhs) {
@@ -433,45 +447,21 @@ namespace sw {
 			}
 			areal& operator/=(const areal& rhs) {
 				if (_trace_div) std::cout << "---------------------- DIV -------------------" << std::endl;
-				// since we are encoding error conditions as NaR (Not a Real), we need to process that condition first
-				// quiet signalling NaR
-				if (rhs.iszero()) {
-					setnan();
-					return *this;
-				}
-				if (rhs.isnan()) {
-					setnan();
-					return *this;
-				}
-				if (iszero() || isnan()) {
-					return *this;
-				}
-
-				value<divbits> ratio;
-				value<fbits> a, b;
-				// transform the inputs into (sign,scale,fraction) triples
-				normalize(a);
-				rhs.normalize(b);
-
-				module_divide(a, b, ratio);
-
-				// special case handling on the output
-				if (ratio.iszero()) {
-					setzero();  // this shouldn't happen as we should project back onto minpos
-				}
-				else if (ratio.isinf()) {
-					setnan();  // this shouldn't happen as we should project back onto maxpos
-				}
-				else {
-					//convert<nbits, es, divbits>(ratio, *this);
-				}
+				_ubit = _ubit || rhs._ubit;
+				_bits = impl::areal_div<nbits, es>(_bits, rhs._bits, _ubit);
 				return *this;
 			}
 			areal& operator/=(double rhs) {
 				return *this /= areal<nbits, es>(rhs);
 			}
+			// the increment and decrement step to the next encoding up and down, and clear the ubit
 			areal& operator++() {
-				// increment_posit();
+				if (!isnan() && _bits != Encoding::infinity) {
+					if (_bits == Encoding::sign_mask) _bits = 1;
+					else if (_bits & Encoding::sign_mask) --_bits;
+					else ++_bits;
+				}
+				_ubit = false;
 				return *this;
 			}
 			areal operator++(int) {
@@ -480,7 +470,12 @@ namespace sw {
 				return tmp;
 			}
 			areal& operator--() {
-				//decrement_posit();
+				if (!isnan() && _bits != (Encoding::sign_mask | Encoding::infinity)) {
+					if (_bits == 0) _bits = Encoding::sign_mask | 1;
+					else if (_bits & Encoding::sign_mask) ++_bits;
+					else --_bits;
+				}
+				_ubit = false;
 				return *this;
 			}
 			areal operator--(int) {
@@ -491,270 +486,109 @@ namespace sw {
 
 			// modifiers
 			void reset() {
-				_sign  = false;
-				_scale = 0;
-				_nrOfBits = 0;
-				_inf = false;
-				_zero = false;
-				_nan = false;
-				_fraction.reset();
-				_raw_bits.reset();
-			}
-			void set(bool sign, int scale, bitblock<fbits> fraction_without_hidden_bit, bool zero, bool inf, bool nan = false) {
-				_sign     = sign;
-				_scale    = scale;
-				_fraction = fraction_without_hidden_bit;
-				_zero     = zero;
-				_inf      = inf;
-				_nan      = nan;
-			}
-			// Set the raw bits of the posit given an unsigned value starting from the lsb. Handy for enumerating a posit state space
-			areal& set_raw_bits(uint64_t value) {
-				reset();
-				bitblock<nbits> raw_bits;
-				uint64_t mask = 1;
-				for (size_t i = 0; i < nbits; i++) {
-					raw_bits.set(i, (value & mask));
-					mask <<= 1;
-				}
-				_raw_bits = raw_bits;
+				_bits = 0;
+				_ubit = false;
+			}
+			// Set the raw bits of the areal given an unsigned value starting from the lsb. Handy for enumerating an areal state space
+			areal& set_raw_bits(uint64_t value, bool ubit = false) {
+				_bits = (nbits < 64 ? value & ((uint64_t(1) << (nbits & 63)) - 1) : value);
+				_ubit = ubit;
 				return *this;
 			}
-			void setzero() {
-				_zero     = true;
-				_sign     = false;
-				_inf      = false;
-				_nan      = false;
-				_scale    = 0;
-				_nrOfBits = fbits;
-				_fraction.reset();
-			}
-			void setinf() {
-				_inf      = true;
-				_sign     = false;
-				_zero     = false;
-				_nan      = false;
-				_scale    = 0;
-				_nrOfBits = fbits;
-				_fraction.reset();
+			void setzero() { reset(); }
+			void setinf(bool sign = false) {
+				_bits = (sign ? Encoding::sign_mask : 0) | Encoding::infinity;
+				_ubit = false;
 			}
 			void setnan() {
-				_nan      = true;
-				_sign     = false;
-				_zero     = false;
-				_inf      = false;
-				_scale    = 0;
-				_nrOfBits = fbits;	
-				_fraction.reset();
+				_bits = Encoding::quiet_nan;
+				_ubit = false;
 			}
-			inline void setscale(int e) { _scale = e; }
+			void setubit(bool ubit = true) { _ubit = ubit; }
 
 			// selectors
-			inline bool isneg() const { return _sign; }
-			inline bool iszero() const { return _zero; }
-			inline bool isinf() const { return _inf; }
-			inline bool isnan() const { return _nan; }
-			inline bool sign() const { return _sign; }
-			inline int scale() const { return _scale; }
-			bitblock<fbits> get_fraction() const { return _fraction; }
-			/// Normalized shift (e.g., for addition).
-			template <size_t Size>
-			bitblock<Size> nshift(long shift) const {
-				bitblock<Size> number;
-
-				// Check range
-				if (long(fbits) + shift >= long(Size))
-					throw shift_too_large{};
-
-				const long hpos = fbits + shift;       // position of hidden bit
-														  
-				if (hpos <= 0) {   // If hidden bit is LSB or beyond just set uncertainty bit and call it a day
-					number[0] = true;
-					return number;
-				}
-				number[hpos] = true;                   // hidden bit now safely set
-
-													   // Copy fraction bits into certain part
-				for (long npos = hpos - 1, fpos = long(fbits) - 1; npos > 0 && fpos >= 0; --npos, --fpos)
-					number[npos] = _fraction[fpos];
-
-				// Set uncertainty bit
-				bool uncertainty = false;
-				for (long fpos = std::min(long(fbits) - 1, -shift); fpos >= 0 && !uncertainty; --fpos)
-					uncertainty |= _fraction[fpos];
-				number[0] = uncertainty;
-				return number;
-			}
-
-			bitblock<nbits> get() const { return _raw_bits; }
-			// get a fixed point number by making the hidden bit explicit: useful for multiply units
-			bitblock<fhbits> get_fixed_point() const {
-				bitblock<fbits + 1> fixed_point_number;
-				fixed_point_number.set(fbits, true); // make hidden bit explicit
-				for (unsigned int i = 0; i < fbits; i++) {
-					fixed_point_number[i] = _fraction[i];
-				}
-				return fixed_point_number;
-			}
-			// get the fraction value including the implicit hidden bit (this is at an exponent level 1 smaller)
-			template<typename Ty = double>
-			Ty get_implicit_fraction_value() const {
-				if (_zero) return (long double)0.0;
-				Ty v = 1.0;
-				Ty scale = 0.5;
-				for (int i = int(fbits) - 1; i >= 0; i--) {
-					if (_fraction.test(i)) v += scale;
-					scale *= 0.5;
-					if (scale == 0.0) break;
-				}
-				return v;
-			}
-			int sign_value() const { return (_sign ? -1 : 1); }
-			double scale_value() const {
-				if (_zero) return (long double)(0.0);
-				return std::pow((long double)2.0, (long double)_scale);
-			}
-			template<typename Ty = double>
-			Ty fraction_value() const {
-				if (_zero) return (long double)0.0;
-				Ty v = 1.0;
-				Ty scale = 0.5;
-				for (int i = int(fbits) - 1; i >= 0; i--) {
-					if (_fraction.test(i)) v += scale;
-					scale *= 0.5;
-					if (scale == 0.0) break;
-				}
-				return v;
-			}
-			long double to_long_double() const {
-				return sign_value() * scale_value() * fraction_value<long double>();
-			}
-			double to_double() const {
-				return sign_value() * scale_value() * fraction_value<double>();
+			inline bool isneg() const { return (_bits & Encoding::sign_mask) != 0; }
+			inline bool iszero() const { return impl::areal_iszero<nbits, es>(_bits); }
+			inline bool isinf() const { return impl::areal_isinf<nbits, es>(_bits); }
+			inline bool isnan() const { return impl::areal_isnan<nbits, es>(_bits); }
+			inline bool sign() const { return isneg(); }
+			inline int scale() const { return impl::areal_scale<nbits, es>(_bits); }
+			inline bool ubit() const { return _ubit; }
+			inline uint64_t encoding() const { return _bits; }
+			bitblock<nbits> get() const {
+				bitblock<nbits> raw_bits;
+				for (size_t i = 0; i < nbits; ++i) raw_bits.set(i, (_bits >> i) & 1);
+				return raw_bits;
 			}
-			float to_float() const {
-				return float(sign_value() * scale_value() * fraction_value<float>());
+			bitblock<fbits> get_fraction() const {
+				bitblock<fbits> fraction;
+				for (size_t i = 0; i < fbits; ++i) fraction.set(i, (_bits >> i) & 1);
+				return fraction;
 			}
+
+			// the conversions return the value of the encoding, which is truncated toward zero when the ubit is set
+			long double to_long_double() const { return impl::areal_to_native<nbits, es, long double>(_bits); }
+			double to_double() const { return impl::areal_to_native<nbits, es, double>(_bits); }
+			float to_float() const { return impl::areal_to_native<nbits, es, float>(_bits); }
 			// Maybe remove explicit
 			explicit operator long double() const { return to_long_double(); }
 			explicit operator double() const { return to_double(); }
 			explicit operator float() const { return to_float(); }
 
-			// currently, size is tied to fbits size of areal config. Is there a need for a case that captures a user-defined sized fraction?
-			value<fbits> to_value() const {
-				bool		     	 _sign;
-				exponent<nbits, es>  _exponent;
-				fraction<fbits>      _fraction;
-				decode(_raw_bits, _sign, _exponent, _fraction);
-				return value<fbits>(_sign, _exponent.scale(), _fraction.get(), iszero(), isnan());
-			}
-			void normalize(value<fbits>& v) const {
-				bool		     	 _sign;
-				exponent<nbits, es>  _exponent;
-				fraction<fbits>      _fraction;
-				decode(_raw_bits, _sign, _exponent, _fraction);
-				v.set(_sign, _exponent.scale(), _fraction.get(), iszero(), isnan());
-			}
-			template<size_t tgt_size>
-			value<tgt_size> round_to() {
-				bitblock<tgt_size> rounded_fraction;
-				if (tgt_size == 0) {
-					bool round_up = false;
-					if (fbits >= 2) {
-						bool blast = _fraction[int(fbits) - 1];
-						bool sb = anyAfter(_fraction, int(fbits) - 2);
-						if (blast && sb) round_up = true;
-					}
-					else if (fbits == 1) {
-						round_up = _fraction[0];
-					}
-					return value<tgt_size>(_sign, (round_up ? _scale + 1 : _scale), rounded_fraction, _zero, _inf);
-				}
-				else {
-					if (!_zero || !_inf) {
-						if (tgt_size < fbits) {
-							int rb = int(tgt_size) - 1;
-							int lb = int(fbits) - int(tgt_size) - 1;
-							for (int i = int(fbits) - 1; i > lb; i--, rb--) {
-								rounded_fraction[rb] = _fraction[i];
-							}
-							bool blast = _fraction[lb];
-							bool sb = false;
-							if (lb > 0) sb = anyAfter(_fraction, lb-1);
-							if (blast || sb) rounded_fraction[0] = true;
-						}
-						else {
-							int rb = int(tgt_size) - 1;
-							for (int i = int(fbits) - 1; i >= 0; i--, rb--) {
-								rounded_fraction[rb] = _fraction[i];
-							}
-						}
-					}
-				}
-				return value<tgt_size>(_sign, _scale, rounded_fraction, _zero, _inf);
-			}
 		private:
-			bitblock<nbits> _raw_bits;
-			bool            _sign;
-			int             _scale;
-			bitblock<fbits>	_fraction;
-			int             _nrOfBits;  // in case the fraction is smaller than the full fbits
-			bool            _inf;
-			bool            _zero;
-			bool            _nan;
+			uint64_t _bits;   // the encoding in the nbits least significant bits
+			bool     _ubit;   // the inexact flag: the encoding is a truncation of the value it stands for
 
-			// template parameters need names different from class template parameters (for gcc and clang)
-			template<size_t nnbits, size_t nes>
-			friend std::ostream& operator<< (std::ostream& ostr, const areal<nnbits,nes>& r);
-			template<size_t nnbits, size_t nes>
-			friend std::istream& operator>> (std::istream& istr, areal<nnbits,nes>& r);
+			template<typename Real>
+			areal& float_assign(Real rhs) {
+				if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
+				_bits = impl::areal_from_native<nbits, es>(rhs, _ubit);
+				return *this;
+			}
 
+			// template parameters need names different from class template parameters (for gcc and clang)
 			template<size_t nnbits, size_t nes>
 			friend bool operator==(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs);
 			template<size_t nnbits, size_t nes>
-			friend bool operator!=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs);
-			template<size_t nnbits, size_t nes>
 			friend bool operator< (const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs);
-			template<size_t nnbits, size_t nes>
-			friend bool operator> (const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs);
-			template<size_t nnbits, size_t nes>
-			friend bool operator<=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs);
-			template<size_t nnbits, size_t nes>
-			friend bool operator>=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs);
 		};
 
 		////////////////////// VALUE operators
 		template<size_t nnbits, size_t nes>
 		inline std::ostream& operator<<(std::ostream& ostr, const areal<nnbits,nes>& v) {
-			if (v._inf) {
-				ostr << FP_INFINITE;
-			}
-			else {
-				ostr << (long double)v;
-			}
+			ostr << v.to_long_double();
 			return ostr;
 		}
 
 		template<size_t nnbits, size_t nes>
-		inline std::istream& operator>> (std::istream& istr, const areal<nnbits,nes>& v) {
-			istr >> v._fraction;
+		inline std::istream& operator>> (std::istream& istr, areal<nnbits,nes>& v) {
+			long double value;
+			istr >> value;
+			v = value;
 			return istr;
 		}
 
+		// the comparisons order the encodings with the ubit as the least significant bit of the magnitude: NaN is unordered, and -0 == +0
 		template<size_t nnbits, size_t nes>
-		inline bool operator==(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return lhs._sign == rhs._sign && lhs._scale == rhs._scale && lhs._fraction == rhs._fraction && lhs._nrOfBits == rhs._nrOfBits && lhs._zero == rhs._zero && lhs._inf == rhs._inf; }
+		inline bool operator==(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) {
+			if (lhs.isnan() || rhs.isnan()) return false;
+			return impl::areal_compare<nnbits, nes>(lhs._bits, lhs._ubit, rhs._bits, rhs._ubit) == 0;
+		}
 		template<size_t nnbits, size_t nes>
 		inline bool operator!=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return !operator==(lhs, rhs); }
 		template<size_t nnbits, size_t nes>
-		inline bool operator< (const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return lhs.to_long_double() < rhs.to_long_double(); }
+		inline bool operator< (const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) {
+			if (lhs.isnan() || rhs.isnan()) return false;
+			return impl::areal_compare<nnbits, nes>(lhs._bits, lhs._ubit, rhs._bits, rhs._ubit) < 0;
+		}
 		template<size_t nnbits, size_t nes>
 		inline bool operator> (const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return  operator< (rhs, lhs); }
 		template<size_t nnbits, size_t nes>
-		inline bool operator<=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return !operator> (lhs, rhs); }
+		inline bool operator<=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return operator< (lhs, rhs) || operator==(lhs, rhs); }
 		template<size_t nnbits, size_t nes>
-		inline bool operator>=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return !operator< (lhs, rhs); }
+		inline bool operator>=(const areal<nnbits,nes>& lhs, const areal<nnbits,nes>& rhs) { return operator> (lhs, rhs) || operator==(lhs, rhs); }
 
-		// posit - posit binary arithmetic operators
+		// areal - areal binary arithmetic operators
 		// BINARY ADDITION
 		template<size_t nbits, size_t es>
 		inline areal<nbits, es> operator+(const areal<nbits, es>& lhs, const areal<nbits, es>& rhs) {
@@ -784,29 +618,45 @@ namespace sw {
 			return ratio;
 		}
 
+		// square root, truncated toward zero, with the ubit of the operand and of the truncation
+		template<size_t nbits, size_t es>
+		inline areal<nbits, es> sqrt(const areal<nbits, es>& a) {
+			if (_trace_sqrt) std::cout << "---------------------- SQRT -------------------" << std::endl;
+			bool ubit = a.ubit();
+			uint64_t root = impl::areal_sqrt<nbits, es>(a.encoding(), ubit);
+			areal<nbits, es> r;
+			r.set_raw_bits(root, ubit);
+			return r;
+		}
 
 		template<size_t nbits, size_t es>
 		inline std::string components(const areal<nbits,es>& v) {
 			std::stringstream s;
-			if (v.iszero()) {
-				s << " zero b" << std::setw(nbits) << v.fraction();
+			if (v.isnan()) {
+				s << " nan b" << v.get();
+				return s.str();
+			}
+			else if (v.iszero()) {
+				s << " zero b" << v.get() << (v.ubit() ? " ..." : "");
 				return s.str();
 			}
 			else if (v.isinf()) {
-				s << " infinite b" << std::setw(nbits) << v.fraction();
+				s << " infinite b" << v.get();
 				return s.str();
 			}
-			s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << v.fraction() << ")";
+			s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << v.get_fraction() << (v.ubit() ? ",..." : "") << ")";
 			return s.str();
 		}
 
-		/// Magnitude of a scientific notation value (equivalent to turning the sign bit off).
+		/// Magnitude of an areal (equivalent to turning the sign bit off).
 		template<size_t nbits, size_t es>
 		areal<nbits,es> abs(const areal<nbits,es>& v) {
-			return areal<nbits,es>(false, v.scale(), v.fraction(), v.isZero());
+			return v.isneg() ? -v : v;
 		}
 
-
 	}  // namespace unum
 
 }  // namespace sw
+
+// fast specializations of the configurations of the IEEE-754 hardware
+#include "specializations.hpp"
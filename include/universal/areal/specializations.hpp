@@ -0,0 +1,23 @@
+#pragma once
+// specializations.hpp: header to include and configure any areal specializations
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// enable fast implementations of the areal configurations of the IEEE-754 floating-point hardware
+// AREAL_FAST_SPECIALIZATION when set will turn on all fast implementations
+// Each implementation defines a macro AREAL_FAST_AREAL_`nbits`_`es`,
+// and includes the fast implementation if set to 1.
+// For example, AREAL_FAST_AREAL_32_8, when set to 1, will enable the fast implementation of areal<32,8>.
+// The individual AREAL_FAST_### macros enable fine grain control over which configurations
+// use fast code.
+#ifdef AREAL_FAST_SPECIALIZATION
+#define AREAL_FAST_AREAL_32_8  1
+#define AREAL_FAST_AREAL_64_11 1
+#endif
+
+// fast specializations for the single and double precision formats
+#include "specialized/native_areal.hpp"
+#include "specialized/areal_32_8.hpp"
+#include "specialized/areal_64_11.hpp"
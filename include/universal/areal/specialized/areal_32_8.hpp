@@ -0,0 +1,25 @@
+#pragma once
+// areal_32_8.hpp: specialized areal<32,8> that computes in the IEEE-754 single precision hardware
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if AREAL_FAST_AREAL_32_8
+#pragma message("Fast specialization of areal<32,8>")
+
+	// fast specialized areal<32,8>
+	template<>
+	class areal<32, 8> : public native_areal<32, 8, float, uint32_t> {
+	public:
+		using native_areal<32, 8, float, uint32_t>::native_areal;
+		using native_areal<32, 8, float, uint32_t>::operator=;
+	};
+
+#endif // AREAL_FAST_AREAL_32_8
+
+} // namespace unum
+} // namespace sw
@@ -0,0 +1,25 @@
+#pragma once
+// areal_64_11.hpp: specialized areal<64,11> that computes in the IEEE-754 double precision hardware
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if AREAL_FAST_AREAL_64_11
+#pragma message("Fast specialization of areal<64,11>")
+
+	// fast specialized areal<64,11>
+	template<>
+	class areal<64, 11> : public native_areal<64, 11, double, uint64_t> {
+	public:
+		using native_areal<64, 11, double, uint64_t>::native_areal;
+		using native_areal<64, 11, double, uint64_t>::operator=;
+	};
+
+#endif // AREAL_FAST_AREAL_64_11
+
+} // namespace unum
+} // namespace sw
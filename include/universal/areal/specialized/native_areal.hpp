@@ -0,0 +1,309 @@
+#pragma once
+// native_areal.hpp: implementation of the areal<nbits,es> specializations that compute on the IEEE-754 floating-point hardware
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+namespace sw {
+namespace unum {
+
+namespace impl {
+	// 2^e as a compile-time constant in the normal range of Real
+	template<typename Real>
+	constexpr Real pow2(int e) {
+		Real v = 1;
+		for (int i = 0; i < (e < 0 ? -e : e); ++i) v *= (e < 0 ? Real(0.5) : Real(2));
+		return v;
+	}
+
+	// a * b + c with the sign and zero of the exact value: the product of floats is exact in double,
+	// which avoids the library fma of the targets without a fused multiply-add instruction
+	inline double residual_fma(float a, float b, float c) { return double(a) * double(b) + double(c); }
+	inline double residual_fma(double a, double b, double c) { return std::fma(a, b, c); }
+} // namespace impl
+
+/*
+native_areal is the implementation of the specializations of areal<nbits, es> whose encoding is a binary format of the
+floating-point hardware: areal<32,8> is the layout of a float, and areal<64,11> the layout of a double. The value is held in
+the native type Real, the operators compute the round-to-nearest result in hardware, and an error-free transformation
+recovers the exact rounding error: TwoSum for the sum and the difference, and a fused multiply-add for the residuals of the
+product, the quotient, and the square root, which for float is the exact product in double. A nonzero error sets the ubit,
+and an error of the opposite sign of the result steps the result one encoding toward zero, which reproduces the truncation
+of the field arithmetic of areal<nbits, es> bit for bit. Checking the inexact flag with fetestexcept would set the ubit as well, but it cannot tell the direction of
+the error, and it costs a floating-point environment access per operator.
+
+The transformations are only error free when the result does not overflow and stays away from the subnormal range:
+the operands outside those bounds, and the infinities, NaNs, and zeros, take the field arithmetic in impl, which also
+carries out the conversions from the other native types. The transformations assume IEEE-754 evaluation in the
+precision of Real: compiling with -ffast-math, or for the x87 stack with excess precision, breaks them.
+
+A specialization derives from native_areal<nbits, es, Real, Bits>, and inherits its constructors and assignment operators.
+The operators of native_areal return the specialization areal<nbits, es>, and the comparisons and the square root are
+non-template friends that overload resolution prefers over the templates.
+*/
+template<size_t _nbits, size_t _es, typename Real, typename Bits>
+class native_areal {
+	typedef areal<_nbits, _es> Areal;
+	static_assert(std::numeric_limits<Real>::is_iec559 && std::numeric_limits<Real>::digits == int(_nbits - _es), "native_areal requires the IEEE-754 format of the same layout");
+	static_assert(sizeof(Real) == sizeof(Bits) && sizeof(Bits) * 8 == _nbits, "native_areal requires an unsigned integer of the width of Real");
+
+	// the bounds of the error-free transformations
+	static constexpr int digits = std::numeric_limits<Real>::digits;
+	static constexpr int emin = std::numeric_limits<Real>::min_exponent - 1;
+	static constexpr Real maxpos = std::numeric_limits<Real>::max();
+	static constexpr Real sum_max = maxpos / 2;                                   // the largest addend without intermediate overflow in TwoSum
+	static constexpr Real product_min = impl::pow2<Real>(emin + digits + 1);      // the smallest product with an exact fma residual
+	static constexpr Real dividend_min = impl::pow2<Real>(emin + 2 * digits);     // the smallest dividend and radicand with an exact residual
+
+public:
+	static constexpr size_t nbits  = _nbits;
+	static constexpr size_t es     = _es;
+	static constexpr size_t fbits  = nbits - 1 - es;
+	static constexpr size_t fhbits = fbits + 1;
+
+	native_areal() : _value(0), _ubit(false) {}
+
+	// initializers for native types
+	native_areal(signed char initial_value) { *this = initial_value; }
+	native_areal(short initial_value) { *this = initial_value; }
+	native_areal(int initial_value) { *this = initial_value; }
+	native_areal(long initial_value) { *this = initial_value; }
+	native_areal(long long initial_value) { *this = initial_value; }
+	native_areal(unsigned int initial_value) { *this = initial_value; }
+	native_areal(unsigned long initial_value) { *this = initial_value; }
+	native_areal(unsigned long long initial_value) { *this = initial_value; }
+	native_areal(float initial_value) { *this = initial_value; }
+	native_areal(double initial_value) { *this = initial_value; }
+	native_areal(long double initial_value) { *this = initial_value; }
+
+	// assignment operators for native types: the integers and the other floating-point formats truncate through the fields
+	Areal& operator=(signed char rhs) { return *this = (long long)(rhs); }
+	Areal& operator=(short rhs) { return *this = (long long)(rhs); }
+	Areal& operator=(int rhs) { return *this = (long long)(rhs); }
+	Areal& operator=(long rhs) { return *this = (long long)(rhs); }
+	Areal& operator=(long long rhs) {
+		bool ubit;
+		uint64_t bits = impl::areal_from_integer<nbits, es>(rhs < 0, rhs < 0 ? 0ull - (unsigned long long)(rhs) : (unsigned long long)(rhs), ubit);
+		return set_raw_bits(bits, ubit);
+	}
+	Areal& operator=(unsigned int rhs) { return *this = (unsigned long long)(rhs); }
+	Areal& operator=(unsigned long rhs) { return *this = (unsigned long long)(rhs); }
+	Areal& operator=(unsigned long long rhs) {
+		bool ubit;
+		uint64_t bits = impl::areal_from_integer<nbits, es>(false, rhs, ubit);
+		return set_raw_bits(bits, ubit);
+	}
+	Areal& operator=(float rhs) { return float_assign(rhs); }
+	Areal& operator=(double rhs) { return float_assign(rhs); }
+	Areal& operator=(long double rhs) { return float_assign(rhs); }
+
+	// prefix operator
+	Areal operator-() const {
+		Areal negated(self());
+		negated._value = -_value;
+		return negated;
+	}
+
+	// arithmetic operators
+	Areal& operator+=(const Areal& rhs) {
+		return sum(rhs._value, rhs._ubit);
+	}
+	Areal& operator+=(double rhs) {
+		return *this += Areal(rhs);
+	}
+	Areal& operator-=(const Areal& rhs) {
+		return sum(-rhs._value, rhs._ubit);
+	}
+	Areal& operator-=(double rhs) {
+		return *this -= Areal(rhs);
+	}
+	Areal& operator*=(const Areal& rhs) {
+		Real a = _value, b = rhs._value;
+		Real p = a * b;
+		bool ubit = _ubit || rhs._ubit;
+		if (std::fabs(p) >= product_min && std::fabs(p) <= maxpos) {
+			// a * b = p + residual exactly
+			double residual = impl::residual_fma(a, b, -p);
+			_ubit = ubit;
+			return truncate(p, residual != 0, (residual < 0) != (p < 0));
+		}
+		uint64_t bits = impl::areal_mul<nbits, es>(encoding_of(a), encoding_of(b), ubit);
+		return set_raw_bits(bits, ubit);
+	}
+	Areal& operator*=(double rhs) {
+		return *this *= Areal(rhs);
+	}
+	Areal& operator/=(const Areal& rhs) {
+		Real a = _value, b = rhs._value;
+		Real q = a / b;
+		bool ubit = _ubit || rhs._ubit;
+		if (std::fabs(a) >= dividend_min && std::fabs(q) >= product_min && std::fabs(q) <= maxpos) {
+			// a / b = q + residual / b exactly
+			double residual = impl::residual_fma(-q, b, a);
+			_ubit = ubit;
+			return truncate(q, residual != 0, ((residual < 0) != (b < 0)) != (q < 0));
+		}
+		uint64_t bits = impl::areal_div<nbits, es>(encoding_of(a), encoding_of(b), ubit);
+		return set_raw_bits(bits, ubit);
+	}
+	Areal& operator/=(double rhs) {
+		return *this /= Areal(rhs);
+	}
+	// the increment and decrement step to the next encoding up and down, and clear the ubit
+	Areal& operator++() {
+		_value = std::nextafter(_value, std::numeric_limits<Real>::infinity());
+		_ubit = false;
+		return self();
+	}
+	Areal operator++(int) {
+		Areal tmp(self());
+		operator++();
+		return tmp;
+	}
+	Areal& operator--() {
+		_value = std::nextafter(_value, -std::numeric_limits<Real>::infinity());
+		_ubit = false;
+		return self();
+	}
+	Areal operator--(int) {
+		Areal tmp(self());
+		operator--();
+		return tmp;
+	}
+
+	// modifiers
+	void reset() {
+		_value = 0;
+		_ubit = false;
+	}
+	Areal& set_raw_bits(uint64_t value, bool ubit = false) {
+		Bits bits = Bits(value);
+		std::memcpy(&_value, &bits, sizeof(Real));
+		_ubit = ubit;
+		return self();
+	}
+	void setzero() { reset(); }
+	void setinf(bool sign = false) {
+		_value = sign ? -std::numeric_limits<Real>::infinity() : std::numeric_limits<Real>::infinity();
+		_ubit = false;
+	}
+	void setnan() {
+		_value = std::numeric_limits<Real>::quiet_NaN();
+		_ubit = false;
+	}
+	void setubit(bool ubit = true) { _ubit = ubit; }
+
+	// selectors
+	inline bool isneg() const { return std::signbit(_value); }
+	inline bool iszero() const { return _value == 0; }
+	inline bool isinf() const { return std::isinf(_value); }
+	inline bool isnan() const { return std::isnan(_value); }
+	inline bool sign() const { return isneg(); }
+	inline int scale() const { return impl::areal_scale<nbits, es>(encoding()); }
+	inline bool ubit() const { return _ubit; }
+	inline uint64_t encoding() const { return encoding_of(_value); }
+	bitblock<nbits> get() const {
+		bitblock<nbits> raw_bits;
+		uint64_t bits = encoding();
+		for (size_t i = 0; i < nbits; ++i) raw_bits.set(i, (bits >> i) & 1);
+		return raw_bits;
+	}
+	bitblock<fbits> get_fraction() const {
+		bitblock<fbits> fraction;
+		uint64_t bits = encoding();
+		for (size_t i = 0; i < fbits; ++i) fraction.set(i, (bits >> i) & 1);
+		return fraction;
+	}
+
+	// the conversions return the value of the encoding, which is truncated toward zero when the ubit is set
+	long double to_long_double() const { return (long double)(_value); }
+	double to_double() const { return double(_value); }
+	float to_float() const { return float(_value); }
+	explicit operator long double() const { return to_long_double(); }
+	explicit operator double() const { return to_double(); }
+	explicit operator float() const { return to_float(); }
+
+private:
+	Real _value;   // the value of the encoding, truncated toward zero when the ubit is set
+	bool _ubit;
+
+	Areal& self() { return static_cast<Areal&>(*this); }
+	const Areal& self() const { return static_cast<const Areal&>(*this); }
+
+	static uint64_t encoding_of(Real v) {
+		Bits bits;
+		std::memcpy(&bits, &v, sizeof(Real));
+		return bits;
+	}
+
+	// record the inexact result r, and step it toward zero when the exact result is smaller in magnitude
+	// without branches, as the direction of the error of random operands does not predict
+	Areal& truncate(Real r, bool inexact, bool above) {
+		// an inexact r is finite and nonzero: the predecessor of the magnitude is the encoding minus one
+		Bits bits;
+		std::memcpy(&bits, &r, sizeof(Real));
+		bits -= Bits(inexact & above);
+		std::memcpy(&_value, &bits, sizeof(Real));
+		_ubit = _ubit | inexact;
+		return self();
+	}
+
+	Areal& sum(Real b, bool ub) {
+		Real a = _value;
+		Real s = a + b;
+		bool ubit = _ubit || ub;
+		if (std::fabs(a) <= sum_max && std::fabs(b) <= sum_max) {
+			// TwoSum: a + b = s + error exactly, also in the subnormal range
+			Real bb = s - a;
+			Real error = (a - (s - bb)) + (b - bb);
+			_ubit = ubit;
+			return truncate(s, error != 0, (error < 0) != (s < 0));
+		}
+		uint64_t bits = impl::areal_add<nbits, es>(encoding_of(a), encoding_of(b), ubit);
+		return set_raw_bits(bits, ubit);
+	}
+
+	template<typename Native>
+	Areal& float_assign(Native rhs) {
+		if (std::numeric_limits<Native>::digits == digits && std::numeric_limits<Native>::max_exponent == std::numeric_limits<Real>::max_exponent) {
+			_value = Real(rhs);
+			_ubit = false;
+			return self();
+		}
+		bool ubit;
+		uint64_t bits = impl::areal_from_native<nbits, es>(rhs, ubit);
+		return set_raw_bits(bits, ubit);
+	}
+
+	// areal - areal logic comparisons, which order the encodings and the ubit like the field comparisons of areal<nbits, es>
+	int tie() const { return _ubit ? (std::signbit(_value) ? -1 : 1) : 0; }
+	friend bool operator==(const Areal& lhs, const Areal& rhs) { return lhs._value == rhs._value && lhs.tie() == rhs.tie(); }
+	friend bool operator!=(const Areal& lhs, const Areal& rhs) { return !(lhs == rhs); }
+	friend bool operator< (const Areal& lhs, const Areal& rhs) { return lhs._value < rhs._value || (lhs._value == rhs._value && lhs.tie() < rhs.tie()); }
+	friend bool operator> (const Areal& lhs, const Areal& rhs) { return rhs < lhs; }
+	friend bool operator<=(const Areal& lhs, const Areal& rhs) { return lhs < rhs || lhs == rhs; }
+	friend bool operator>=(const Areal& lhs, const Areal& rhs) { return rhs < lhs || lhs == rhs; }
+
+	// square root: the residual of the root s is a - s * s
+	friend Areal sqrt(const Areal& a) {
+		Areal root;
+		Real v = a._value;
+		if (v >= dividend_min && v <= maxpos) {
+			Real s = std::sqrt(v);
+			double residual = impl::residual_fma(-s, s, v);
+			root._ubit = a._ubit;
+			return root.truncate(s, residual != 0, residual < 0);
+		}
+		bool ubit = a._ubit;
+		uint64_t bits = impl::areal_sqrt<nbits, es>(encoding_of(v), ubit);
+		return root.set_raw_bits(bits, ubit);
+	}
+};
+
+} // namespace unum
+} // namespace sw
@@ -1,20 +1,47 @@
 #pragma once
 // decimal.hpp: definition of arbitrary decimal integer configurations
 //
-// Copyright (C) 2017-2019 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 #include <cstdint>
+#include <cmath>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
 #include <vector>
 #include <limits>
-#include <regex>
+#include <memory>
 #include <algorithm>
 
 #include "universal/string/strmanip.hpp"
+#include "universal/utility/ntt.hpp"
+#include "./exceptions.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////
+// enable throwing specific exceptions for decimal arithmetic errors
+// left to application to enable
+#if !defined(DECIMAL_THROW_ARITHMETIC_EXCEPTION)
+// default is to use std::cerr as a signalling error
+#define DECIMAL_THROW_ARITHMETIC_EXCEPTION 0
+#endif
+
+// the number of limbs of nine decimal digits that a decimal holds without a heap allocation
+#ifndef DECIMAL_INLINE_LIMBS
+#define DECIMAL_INLINE_LIMBS 4
+#endif
+
+// below this number of limbs the Karatsuba recursion falls back to the schoolbook multiply
+#ifndef DECIMAL_KARATSUBA_THRESHOLD
+#define DECIMAL_KARATSUBA_THRESHOLD 40
+#endif
+
+// from this number of limbs of the shorter operand the product is computed by the number theoretic transform
+// measured crossover on x86-64 against the Karatsuba multiply: 320 limbs, that is 2880 digits
+#ifndef DECIMAL_NTT_THRESHOLD
+#define DECIMAL_NTT_THRESHOLD 320
+#endif
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -49,35 +76,298 @@
 namespace sw {
 namespace unum {
 
+namespace impl {
+
+// decimals are stored in limbs of nine decimal digits, least significant limb first
+constexpr uint32_t DECIMAL_BASE = 1000000000u;
+constexpr unsigned DECIMAL_BASE_DIGITS = 9;
+constexpr size_t DECIMAL_KARATSUBA = (DECIMAL_KARATSUBA_THRESHOLD < 4 ? 4 : DECIMAL_KARATSUBA_THRESHOLD);
+constexpr uint64_t DECIMAL_NTT_BASE = 1000000000000000000ull;  // two limbs per coefficient of the transform
+
+// -1, 0, or 1 when a[0, na) is less than, equal to, or greater than b[0, nb), both without leading zero limbs
+inline int decimal_compare(const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+	if (na != nb) return (na < nb ? -1 : 1);
+	for (size_t i = na; i > 0; --i) {
+		if (a[i - 1] != b[i - 1]) return (a[i - 1] < b[i - 1] ? -1 : 1);
+	}
+	return 0;
+}
+
+// r[0, n) += a[0, na) with na <= n, returns the carry out of limb n - 1
+inline uint32_t decimal_add(uint32_t* r, size_t n, const uint32_t* a, size_t na) {
+	uint32_t carry = 0;
+	size_t i = 0;
+	for (; i < na; ++i) {
+		uint32_t sum = r[i] + a[i] + carry;
+		carry = (sum >= DECIMAL_BASE ? 1u : 0u);
+		r[i] = sum - carry * DECIMAL_BASE;
+	}
+	for (; carry && i < n; ++i) {
+		uint32_t sum = r[i] + carry;
+		carry = (sum >= DECIMAL_BASE ? 1u : 0u);
+		r[i] = sum - carry * DECIMAL_BASE;
+	}
+	return carry;
+}
+
+// r[0, n) -= a[0, na) with na <= n, returns the borrow out of limb n - 1
+inline uint32_t decimal_sub(uint32_t* r, size_t n, const uint32_t* a, size_t na) {
+	uint32_t borrow = 0;
+	size_t i = 0;
+	for (; i < na; ++i) {
+		uint32_t subtrahend = a[i] + borrow;
+		borrow = (r[i] < subtrahend ? 1u : 0u);
+		r[i] = r[i] + borrow * DECIMAL_BASE - subtrahend;
+	}
+	for (; borrow && i < n; ++i) {
+		borrow = (r[i] == 0 ? 1u : 0u);
+		r[i] = r[i] + borrow * DECIMAL_BASE - 1;
+	}
+	return borrow;
+}
+
+// r[0, n) = a[0, n) - r[0, n) of a >= r
+inline void decimal_sub_reverse(uint32_t* r, size_t n, const uint32_t* a) {
+	uint32_t borrow = 0;
+	for (size_t i = 0; i < n; ++i) {
+		uint32_t subtrahend = r[i] + borrow;
+		borrow = (a[i] < subtrahend ? 1u : 0u);
+		r[i] = a[i] + borrow * DECIMAL_BASE - subtrahend;
+	}
+}
+
+// r[0, n) = r[0, n) * m + carry, returns the carry out of limb n - 1
+inline uint32_t decimal_mul_small(uint32_t* r, size_t n, uint32_t m, uint32_t carry = 0) {
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t t = uint64_t(r[i]) * m + carry;
+		carry = uint32_t(t / DECIMAL_BASE);
+		r[i] = uint32_t(t % DECIMAL_BASE);
+	}
+	return carry;
+}
+
+// u[0, n) = u[0, n) / d, returns the remainder
+inline uint32_t decimal_divmod_small(uint32_t* u, size_t n, uint32_t d) {
+	uint64_t remainder = 0;
+	for (size_t i = n; i > 0; --i) {
+		uint64_t t = remainder * DECIMAL_BASE + u[i - 1];
+		u[i - 1] = uint32_t(t / d);
+		remainder = t % d;
+	}
+	return uint32_t(remainder);
+}
+
+// r[0, na + nb) = a[0, na) * b[0, nb): a * b[j] + r + carry < 10^18 never overflows the 64-bit accumulator
+inline void decimal_mul_schoolbook(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* r) {
+	std::fill(r, r + na + nb, 0u);
+	for (size_t i = 0; i < na; ++i) {
+		uint64_t carry = 0;
+		for (size_t j = 0; j < nb; ++j) {
+			uint64_t t = uint64_t(a[i]) * b[j] + r[i + j] + carry;
+			carry = t / DECIMAL_BASE;
+			r[i + j] = uint32_t(t % DECIMAL_BASE);
+		}
+		r[i + nb] = uint32_t(carry);
+	}
+}
+
+// the number of scratch limbs of decimal_karatsuba on n limbs
+constexpr size_t decimal_multiply_scratch(size_t n) { return 6 * n + 64; }
+
+// r[0, 2n) = a[0, n) * b[0, n), with the same three half size products as the Karatsuba multiply of integer<nbits>
+inline void decimal_karatsuba(const uint32_t* a, const uint32_t* b, size_t n, uint32_t* r, uint32_t* scratch) {
+	if (n < DECIMAL_KARATSUBA) {
+		decimal_mul_schoolbook(a, n, b, n, r);
+		return;
+	}
+	size_t h = n / 2;  // limbs of a0 and b0
+	size_t m = n - h;  // limbs of a1 and b1, m >= h
+	decimal_karatsuba(a, b, h, r, scratch);                  // z0 in r[0, 2h)
+	decimal_karatsuba(a + h, b + h, m, r + 2 * h, scratch);  // z2 in r[2h, 2n)
+
+	// the sums take m + 1 limbs to hold their carry, and their product 2m + 2 limbs
+	uint32_t* sa = scratch;
+	uint32_t* sb = sa + (m + 1);
+	uint32_t* z1 = sb + (m + 1);
+	std::copy(a + h, a + n, sa);
+	std::copy(b + h, b + n, sb);
+	sa[m] = decimal_add(sa, m, a, h);
+	sb[m] = decimal_add(sb, m, b, h);
+	decimal_karatsuba(sa, sb, m + 1, z1, z1 + 2 * (m + 1));
+	decimal_sub(z1, 2 * (m + 1), r, 2 * h);
+	decimal_sub(z1, 2 * (m + 1), r + 2 * h, 2 * m);
+	// z1 = a0 * b1 + a1 * b0 fits the product, so it does not carry out of it
+	decimal_add(r + h, 2 * n - h, z1, 2 * (m + 1));
+}
+
+// r[0, na + nb) = a[0, na) * b[0, nb) by the number theoretic transform: pairs of limbs are coefficients in base 10^18,
+// which halves the transform length, and the convolution of n coefficients is below n * 10^36 < 2^183
+inline void decimal_ntt_multiply(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* r) {
+	auto pack = [](const uint32_t* u, size_t n) {
+		std::vector<uint64_t> coefficients((n + 1) / 2);
+		for (size_t i = 0; i < n; i += 2) coefficients[i / 2] = u[i] + (i + 1 < n ? uint64_t(u[i + 1]) * DECIMAL_BASE : 0);
+		return coefficients;
+	};
+	// a square packs and transforms its operand once
+	bool square = (a == b && na == nb);
+	std::vector<uint64_t> x = pack(a, na), y;
+	if (!square) y = pack(b, nb);
+	const std::vector<uint64_t>& z = (square ? x : y);
+	std::vector<uint64_t> coefficients;
+	ntt_convolution(x.data(), x.size(), z.data(), z.size(), coefficients);
+	size_t length = coefficients.size() / 3;
+	uint64_t c[3] = { 0, 0, 0 };  // the carry into coefficient i
+	for (size_t i = 0; 2 * i < na + nb; ++i) {
+		if (i < length) {
+			const uint64_t* w = coefficients.data() + 3 * i;
+			c[0] += w[0];
+			uint64_t carry = (c[0] < w[0] ? 1 : 0);
+			c[1] += carry;
+			carry = (c[1] < carry ? 1 : 0);
+			c[1] += w[1];
+			carry += (c[1] < w[1] ? 1 : 0);
+			c[2] += w[2] + carry;
+		}
+		// c / 10^18 a word at a time from the most significant word
+		uint64_t remainder = 0;
+		for (int k = 2; k >= 0; --k) c[k] = ntt_div128(remainder, c[k], DECIMAL_NTT_BASE, remainder);
+		r[2 * i] = uint32_t(remainder % DECIMAL_BASE);
+		// the product has na + nb limbs, so a limb beyond it is zero
+		if (2 * i + 1 < na + nb) r[2 * i + 1] = uint32_t(remainder / DECIMAL_BASE);
+	}
+}
+
+// r[0, na + nb) = a[0, na) * b[0, nb): Karatsuba on blocks of the length of the shorter operand,
+// or the number theoretic transform when the shorter operand has DECIMAL_NTT_THRESHOLD limbs or more
+inline void decimal_multiply(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* r) {
+	if (na < nb) {
+		std::swap(a, b);
+		std::swap(na, nb);
+	}
+	if (nb >= DECIMAL_NTT_THRESHOLD) {
+		decimal_ntt_multiply(a, na, b, nb, r);
+		return;
+	}
+	if (nb < DECIMAL_KARATSUBA) {
+		decimal_mul_schoolbook(a, na, b, nb, r);
+		return;
+	}
+	std::vector<uint32_t> block(2 * nb), scratch(decimal_multiply_scratch(nb)), padded;
+	std::fill(r, r + na + nb, 0u);
+	for (size_t i = 0; i < na; i += nb) {
+		size_t length = (na - i < nb ? na - i : nb);
+		const uint32_t* piece = a + i;
+		if (length < nb) {
+			// the last block is zero extended to the length of b
+			padded.assign(nb, 0u);
+			std::copy(a + i, a + na, padded.begin());
+			piece = padded.data();
+		}
+		decimal_karatsuba(piece, b, nb, block.data(), scratch.data());
+		size_t limbs = (na + nb - i < 2 * nb ? na + nb - i : 2 * nb);
+		decimal_add(r + i, na + nb - i, block.data(), limbs);
+	}
+}
+
+// q[0, m - n + 1) = u[0, m) / v[0, n) and r[0, n) = u[0, m) % v[0, n) of m >= n >= 2 and v[n - 1] != 0
+// Knuth's Algorithm D in base 10^9: the scale f = B / (v[n - 1] + 1) lifts the leading limb of v to at least B / 2,
+// so that the estimate of each quotient limb from the leading two limbs of the remainder is at most two too large
+inline void decimal_divmod_knuth(const uint32_t* u, size_t m, const uint32_t* v, size_t n, uint32_t* q, uint32_t* r) {
+	const uint64_t B = DECIMAL_BASE;
+	uint32_t f = uint32_t(B / (uint64_t(v[n - 1]) + 1));
+	std::vector<uint32_t> un(u, u + m), vn(v, v + n);
+	un.push_back(decimal_mul_small(un.data(), m, f));
+	decimal_mul_small(vn.data(), n, f);
+	uint64_t v1 = vn[n - 1], v2 = vn[n - 2];
+	for (size_t j = m - n + 1; j-- > 0; ) {
+		uint64_t numerator = uint64_t(un[j + n]) * B + un[j + n - 1];
+		uint64_t qhat = numerator / v1;
+		uint64_t rhat = numerator % v1;
+		while (qhat >= B || qhat * v2 > rhat * B + un[j + n - 2]) {
+			--qhat;
+			rhat += v1;
+			if (rhat >= B) break;
+		}
+		// multiply and subtract
+		uint64_t carry = 0;
+		int64_t borrow = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t p = qhat * vn[i] + carry;
+			carry = p / B;
+			int64_t t = int64_t(un[i + j]) - int64_t(p % B) - borrow;
+			borrow = (t < 0 ? 1 : 0);
+			un[i + j] = uint32_t(t + borrow * int64_t(B));
+		}
+		int64_t t = int64_t(un[j + n]) - int64_t(carry) - borrow;
+		if (t < 0) {
+			// the estimate was one too large: add back one multiple of v
+			--qhat;
+			un[j + n] = uint32_t(t + int64_t(B));
+			un[j + n] += decimal_add(&un[j], n, vn.data(), n);
+			un[j + n] -= uint32_t(B);
+		}
+		else {
+			un[j + n] = uint32_t(t);
+		}
+		q[j] = uint32_t(qhat);
+	}
+	decimal_divmod_small(un.data(), n, f);
+	std::copy(un.begin(), un.begin() + n, r);
+}
+
+} // namespace impl
+
 	// Forward references
 class decimal;
 template<typename Ty> void convert_to_decimal(Ty v, decimal& d);
 
-// Arbitrary precision decimal number
-class decimal : public std::vector<uint8_t> {
+/*
+Arbitrary precision decimal number: a sign and a magnitude in limbs of nine decimal digits, least significant limb first.
+The limb base 10^9 keeps the text conversions linear, one division per nine digits, and the products of two limbs
+plus carries fit a 64-bit accumulator. Values of up to DECIMAL_INLINE_LIMBS limbs live in the object, larger values
+on the heap. The magnitude has no leading zero limbs, and zero has no limbs and a positive sign.
+*/
+class decimal {
 public:
-	decimal() { setzero(); }
+	static constexpr size_t INLINE_LIMBS = (DECIMAL_INLINE_LIMBS < 1 ? 1 : DECIMAL_INLINE_LIMBS);
+
+	decimal() : _limb(_inline), _size(0), _capacity(INLINE_LIMBS), negative(false) {}
 
-	decimal(const decimal&) = default;
-	decimal(decimal&&) = default;
+	decimal(const decimal& rhs) : decimal() {
+		assign(rhs._limb, rhs._size);
+		negative = rhs.negative;
+	}
+	decimal(decimal&& rhs) noexcept : decimal() {
+		take(rhs);
+	}
 
-	decimal& operator=(const decimal&) = default;
-	decimal& operator=(decimal&&) = default;
+	decimal& operator=(const decimal& rhs) {
+		if (this != &rhs) {
+			_size = 0;
+			assign(rhs._limb, rhs._size);
+			negative = rhs.negative;
+		}
+		return *this;
+	}
+	decimal& operator=(decimal&& rhs) noexcept {
+		if (this != &rhs) take(rhs);
+		return *this;
+	}
 
 	// initializers for native types
-	decimal(const char initial_value) { *this = initial_value; }
-	decimal(const short initial_value) { *this = initial_value; }
-	decimal(const int initial_value) { *this = initial_value; }
-	decimal(const long initial_value) { *this = initial_value; }
-	decimal(const long long initial_value) { *this = initial_value; }
-	decimal(const unsigned char initial_value) { *this = initial_value; }
-	decimal(const unsigned short initial_value) { *this = initial_value; }
-	decimal(const unsigned int initial_value) { *this = initial_value; }
-	decimal(const unsigned long initial_value) { *this = initial_value; }
-	decimal(const unsigned long long initial_value) { *this = initial_value; }
-	decimal(const float initial_value) { *this = initial_value; }
-	decimal(const double initial_value) { *this = initial_value; }
-	decimal(const long double initial_value) { *this = initial_value; }
+	decimal(const char initial_value) : decimal() { *this = initial_value; }
+	decimal(const short initial_value) : decimal() { *this = initial_value; }
+	decimal(const int initial_value) : decimal() { *this = initial_value; }
+	decimal(const long initial_value) : decimal() { *this = initial_value; }
+	decimal(const long long initial_value) : decimal() { *this = initial_value; }
+	decimal(const unsigned char initial_value) : decimal() { *this = initial_value; }
+	decimal(const unsigned short initial_value) : decimal() { *this = initial_value; }
+	decimal(const unsigned int initial_value) : decimal() { *this = initial_value; }
+	decimal(const unsigned long initial_value) : decimal() { *this = initial_value; }
+	decimal(const unsigned long long initial_value) : decimal() { *this = initial_value; }
+	decimal(const float initial_value) : decimal() { *this = initial_value; }
+	decimal(const double initial_value) : decimal() { *this = initial_value; }
+	decimal(const long double initial_value) : decimal() { *this = initial_value; }
 
 	// assignment operators for native types
 	decimal& operator=(const std::string& digits) {
@@ -85,350 +375,300 @@ public:
 		return *this;
 	}
 	decimal& operator=(const char rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const short rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const int rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const long rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const long long rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const unsigned char rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const unsigned short rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const unsigned int rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const unsigned long rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const unsigned long long rhs) {
-		if (0 == rhs) {
-			setzero();
-			push_back(0);
-			return *this;
-		}
-		else {
-			convert_to_decimal(rhs, *this);
-		}
+		convert_to_decimal(rhs, *this);
 		return *this;
 	}
 	decimal& operator=(const float rhs) {
 		return float_assign(rhs);
 	}
 	decimal& operator=(const double rhs) {
-	return float_assign(rhs);
-}
+		return float_assign(rhs);
+	}
 	decimal& operator=(const long double rhs) {
-	return float_assign(rhs);
-}
+		return float_assign(rhs);
+	}
 
 	// arithmetic operators
+	decimal operator-() const {
+		decimal negated(*this);
+		if (!negated.iszero()) negated.negative = !negative;
+		return negated;
+	}
 	decimal& operator+=(const decimal& rhs) {
-		decimal _rhs(rhs);   // is this copy necessary? I introduced it to have a place to pad
-		if (negative != rhs.negative) {  // different signs
-			_rhs.setsign(!rhs.sign());
-			return operator-=(_rhs);
-		}
-		else {
-			// same sign implies this->negative is invariant
-		}
-		size_t l = size();
-		size_t r = _rhs.size();
-		// zero pad the shorter decimal
-		if (l < r) {
-			insert(end(), r - l, 0);
-		}
-		else {
-			_rhs.insert(_rhs.end(), l - r, 0);
-		}
-		decimal::iterator lit = begin();
-		decimal::iterator rit = _rhs.begin();
-		char carry = 0;
-		for (; lit != end() || rit != _rhs.end(); ++lit, ++rit) {
-			*lit += *rit + carry;
-			if (*lit > 9) {
-				carry = 1;
-				*lit -= 10;
-			}
-			else {
-				carry = 0;
-			}
-		}
-		if (carry) push_back(1);
-		return *this;
+		return accumulate(rhs, rhs.negative);
 	}
 	decimal& operator-=(const decimal& rhs) {
-		decimal _rhs(rhs);   // is this copy necessary? I introduced it to have a place to pad
-		bool sign = this->sign();
-		if (negative != rhs.negative) {
-			_rhs.setsign(!rhs.sign());
-			return operator+=(_rhs);
-		}
-		// largest value must be subtracted from
-		size_t l = size();
-		size_t r = _rhs.size();
-		// zero pad the shorter decimal
-		if (l < r) {
-			insert(end(), r - l, 0);
-			std::swap(*this, _rhs);
-			sign = !sign;
-		}
-		else if (r < l) {
-			_rhs.insert(_rhs.end(), l - r, 0);
-		}
-		else {
-			// the operands are the same size, thus we need to check their magnitude
-			if (*this < _rhs) {
-				std::swap(*this, _rhs);
-				sign = !sign;
-			}
-		}
-		decimal::iterator lit = begin();
-		decimal::iterator rit = _rhs.begin();
-		char borrow = 0;
-		for (; lit != end() || rit != _rhs.end(); ++lit, ++rit) {
-			if (*rit > *lit - borrow) {
-				*lit = 10 + *lit - borrow - *rit;
-				borrow = 1;
-			}
-			else {
-				*lit = *lit - borrow - *rit;
-				borrow = 0;
-			}
-		}
-		if (borrow) std::cout << "can this happen?" << std::endl;
-		unpad();
-		this->setsign(sign);
-		return *this;
+		return accumulate(rhs, !rhs.negative);
 	}
 	decimal& operator*=(const decimal& rhs) {
-		bool signOfFinalResult = (negative != rhs.negative) ? true : false;
-		decimal product;
-		// find the smallest decimal to minimize the amount of work
-		size_t l = size();
-		size_t r = rhs.size();
-		decimal::const_iterator sit, bit; // sit = smallest iterator, bit = biggest iterator
-		if (l < r) {
-			size_t position = 0;
-			for (sit = begin(); sit != end(); ++sit) {
-				decimal partial_sum;
-				partial_sum.insert(partial_sum.end(), r + position, 0);
-				decimal::iterator pit = partial_sum.begin() + position;
-				char carry = 0;
-				for (bit = rhs.begin(); bit != rhs.end() || pit != partial_sum.end(); ++bit, ++pit) {
-					char digit = *sit * *bit + carry;
-					*pit = digit % 10;
-					carry = digit / 10;
-				}
-				if (carry) partial_sum.push_back(carry);
-				product += partial_sum;
-//				std::cout << "partial sum " << partial_sum << " intermediate product " << product << std::endl;
-				++position;
-			}
+		bool signOfFinalResult = (negative != rhs.negative);
+		if (iszero() || rhs.iszero()) {
+			setzero();
+			return *this;
+		}
+		if (rhs._size == 1) {
+			// a single limb multiplier scales in place, also when rhs is *this
+			uint32_t m = rhs._limb[0];
+			uint32_t carry = impl::decimal_mul_small(_limb, _size, m);
+			if (carry) push(carry);
 		}
 		else {
-			size_t position = 0;
-			for (sit = rhs.begin(); sit != rhs.end(); ++sit) {
-				decimal partial_sum;
-				partial_sum.insert(partial_sum.end(), l + position, 0);
-				decimal::iterator pit = partial_sum.begin() + position;
-				char carry = 0;
-				for (bit = begin(); bit != end() || pit != partial_sum.end(); ++bit, ++pit) {
-					char digit = *sit * *bit + carry;
-					*pit = digit % 10;
-					carry = digit / 10;
-				}
-				if (carry) partial_sum.push_back(carry);
-				product += partial_sum;
-//				std::cout << "partial sum " << partial_sum << " intermediate product " << product << std::endl;
-				++position;
-			}
+			decimal product;
+			product.resize(_size + rhs._size);
+			impl::decimal_multiply(_limb, _size, rhs._limb, rhs._size, product._limb);
+			product.normalize();
+			take(product);
 		}
-		product.unpad();
-		*this = product;
-		setsign(signOfFinalResult);
+		negative = signOfFinalResult;
 		return *this;
 	}
+	// the quotient truncated toward zero, like the native integer division
 	decimal& operator/=(const decimal& rhs) {
+		decimal quotient;
+		divide(*this, rhs, &quotient, nullptr);
+		take(quotient);
 		return *this;
 	}
-	// selectors
-	inline bool iszero() const {
-		if (size() == 0) return true;
-		return std::all_of(begin(), end(), [](uint8_t i) { return 0 == i; });
+	// the remainder has the sign of the dividend, like the native integer remainder
+	decimal& operator%=(const decimal& rhs) {
+		decimal remainder;
+		divide(*this, rhs, nullptr, &remainder);
+		take(remainder);
+		return *this;
 	}
+
+	// selectors
+	inline bool iszero() const { return _size == 0; }
 	inline bool sign() const { return negative; }
 	inline bool isneg() const { return negative; }
 	inline bool ispos() const { return !negative; }
+	// the number of decimal digits of the magnitude, 1 for zero
+	size_t size() const {
+		if (_size == 0) return 1;
+		size_t digits = (_size - 1) * impl::DECIMAL_BASE_DIGITS;
+		for (uint32_t top = _limb[_size - 1]; top > 0; top /= 10) ++digits;
+		return digits;
+	}
 
 	// modifiers
-	inline void setzero() { clear(); negative = false; }
-	inline void setsign(bool sign) { negative = sign; }
-	inline void setneg() { negative = true; }
+	inline void setzero() { _size = 0; negative = false; }
+	// zero stays positive
+	inline void setsign(bool sign) { negative = sign && _size > 0; }
+	inline void setneg() { negative = (_size > 0); }
 	inline void setpos() { negative = false; }
 
 	// remove any leading zeros from a decimal representation
-	void unpad() {
-		int n = (int)size();
-		for (int i = n - 1; i > 0; --i) {
-			if (operator[](i) == 0) pop_back();
-		}
-	}
+	void unpad() { normalize(); }
 
 	// read a decimal ASCII format and make a decimal type out of it
 	bool parse(std::string digits) {
-		bool bSuccess = false;
 		trim(digits);
-		// check if the txt is an decimal form:[+-]*[0123456789]+
-		std::regex decimal_regex("[+-]*[0123456789]+");
-		if (std::regex_match(digits, decimal_regex)) {
-			// found a decimal representation
-			setzero();
-			auto it = digits.begin();
-			if (*it == '-') {
-				setneg();
-				++it;
-			}
-			else if (*it == '+') {
-				++it;
-			}
-			for (; it != digits.end(); ++it) {
-				uint8_t v;
-				switch (*it) {
-				case '0':
-					v = 0;
-					break;
-				case '1':
-					v = 1;
-					break;
-				case '2':
-					v = 2;
-					break;
-				case '3':
-					v = 3;
-					break;
-				case '4':
-					v = 4;
-					break;
-				case '5':
-					v = 5;
-					break;
-				case '6':
-					v = 6;
-					break;
-				case '7':
-					v = 7;
-					break;
-				case '8':
-					v = 8;
-					break;
-				case '9':
-					v = 9;
-					break;
-				default:
-					v = 0;
-				}
-				push_back(v);
-			}
-			std::reverse(begin(), end());
-			bSuccess = true;
-		}
-		return bSuccess;
+		// check if the txt is an decimal form:[+-]?[0123456789]+
+		size_t first = (!digits.empty() && (digits[0] == '-' || digits[0] == '+') ? 1 : 0);
+		if (first == digits.size()) return false;
+		for (size_t i = first; i < digits.size(); ++i) {
+			if (digits[i] < '0' || digits[i] > '9') return false;
+		}
+		// found a decimal representation: nine digits per limb from the least significant end
+		setzero();
+		size_t length = digits.size() - first;
+		resize((length + impl::DECIMAL_BASE_DIGITS - 1) / impl::DECIMAL_BASE_DIGITS);
+		for (size_t i = 0; i < _size; ++i) {
+			size_t end = digits.size() - i * impl::DECIMAL_BASE_DIGITS;
+			size_t begin = (end - first > impl::DECIMAL_BASE_DIGITS ? end - impl::DECIMAL_BASE_DIGITS : first);
+			uint32_t limb = 0;
+			for (size_t j = begin; j < end; ++j) limb = limb * 10 + uint32_t(digits[j] - '0');
+			_limb[i] = limb;
+		}
+		normalize();
+		if (digits[0] == '-') setneg();
+		return true;
 	}
 
 protected:
 
+	// the integer part of a floating-point value, truncated toward zero: the mantissa times a power of 2
 	template<typename Ty>
-	decimal& float_assign(Ty& rhs) {
+	decimal& float_assign(Ty rhs) {
+		setzero();
+		long double v = std::trunc(std::fabs((long double)rhs));
+		// NaN and infinities have no decimal value
+		if (!(v == v) || v - v != 0) return *this;
+		if (v < 18446744073709551616.0L) {
+			convert_to_decimal((unsigned long long)v, *this);
+		}
+		else {
+			int exponent;
+			long double fraction = std::frexp(v, &exponent);
+			convert_to_decimal((unsigned long long)std::ldexp(fraction, 64), *this);
+			for (exponent -= 64; exponent > 0; exponent -= 29) {
+				uint32_t carry = impl::decimal_mul_small(_limb, _size, 1u << (exponent < 29 ? exponent : 29));
+				if (carry) push(carry);
+			}
+		}
+		if (rhs < 0) setneg();
 		return *this;
 	}
 
 private:
+	uint32_t*                   _limb;      // _inline or _heap
+	size_t                      _size;      // significant limbs
+	size_t                      _capacity;
+	uint32_t                    _inline[INLINE_LIMBS];
+	std::unique_ptr<uint32_t[]> _heap;
 	// sign-magnitude number: indicate if number is positive or negative
 	bool negative;
 
+	// limb storage
+	void reserve(size_t n) {
+		if (n <= _capacity) return;
+		size_t capacity = (n < 2 * _capacity ? 2 * _capacity : n);
+		std::unique_ptr<uint32_t[]> heap(new uint32_t[capacity]);
+		std::copy(_limb, _limb + _size, heap.get());
+		_heap = std::move(heap);
+		_limb = _heap.get();
+		_capacity = capacity;
+	}
+	// grow with zero limbs, or shrink
+	void resize(size_t n) {
+		reserve(n);
+		if (n > _size) std::fill(_limb + _size, _limb + n, 0u);
+		_size = n;
+	}
+	void push(uint32_t limb) {
+		reserve(_size + 1);
+		_limb[_size++] = limb;
+	}
+	void assign(const uint32_t* limbs, size_t n) {
+		reserve(n);
+		std::copy(limbs, limbs + n, _limb);
+		_size = n;
+	}
+	// move the value of rhs into this, and leave rhs zero
+	void take(decimal& rhs) {
+		if (rhs._limb == rhs._inline) {
+			_size = 0;
+			assign(rhs._limb, rhs._size);
+		}
+		else {
+			_heap = std::move(rhs._heap);
+			_limb = _heap.get();
+			_size = rhs._size;
+			_capacity = rhs._capacity;
+			rhs._limb = rhs._inline;
+			rhs._capacity = INLINE_LIMBS;
+		}
+		negative = rhs.negative;
+		rhs.setzero();
+	}
+	// drop the leading zero limbs, and zero is positive
+	void normalize() {
+		while (_size > 0 && _limb[_size - 1] == 0) --_size;
+		if (_size == 0) negative = false;
+	}
+
+	// this += (-1)^rhsNegative * |rhs|
+	decimal& accumulate(const decimal& rhs, bool rhsNegative) {
+		size_t nrhs = rhs._size;
+		if (nrhs == 0) return *this;
+		if (_size == 0 || negative == rhsNegative) {
+			// the magnitudes add, which is safe when rhs is *this as every limb is read before it is written
+			if (_size == 0) negative = rhsNegative;
+			size_t n = (_size > nrhs ? _size : nrhs) + 1;
+			resize(n);
+			impl::decimal_add(_limb, n, rhs._limb, nrhs);
+			normalize();
+			return *this;
+		}
+		// the magnitudes subtract, the larger from the smaller, and the result takes the sign of the larger
+		int order = impl::decimal_compare(_limb, _size, rhs._limb, nrhs);
+		if (order >= 0) {
+			impl::decimal_sub(_limb, _size, rhs._limb, nrhs);
+		}
+		else {
+			resize(nrhs);
+			impl::decimal_sub_reverse(_limb, nrhs, rhs._limb);
+			negative = rhsNegative;
+		}
+		normalize();
+		return *this;
+	}
+
+	// the quotient, truncated toward zero, and the remainder, with the sign of the dividend, of a and b
+	static void divide(const decimal& a, const decimal& b, decimal* quotient, decimal* remainder) {
+		if (b.iszero()) {
+#if DECIMAL_THROW_ARITHMETIC_EXCEPTION
+			throw decimal_divide_by_zero{};
+#else
+			std::cerr << "decimal_divide_by_zero\n";
+			if (quotient) quotient->setzero();
+			if (remainder) *remainder = a;
+			return;
+#endif // DECIMAL_THROW_ARITHMETIC_EXCEPTION
+		}
+		bool signOfQuotient = (a.negative != b.negative);
+		if (impl::decimal_compare(a._limb, a._size, b._limb, b._size) < 0) {
+			if (remainder) *remainder = a;
+			if (quotient) quotient->setzero();
+			return;
+		}
+		decimal q, r;
+		q.resize(a._size - b._size + 1);
+		if (b._size == 1) {
+			std::copy(a._limb, a._limb + a._size, q._limb);
+			r.resize(1);
+			r._limb[0] = impl::decimal_divmod_small(q._limb, a._size, b._limb[0]);
+		}
+		else {
+			r.resize(b._size);
+			impl::decimal_divmod_knuth(a._limb, a._size, b._limb, b._size, q._limb, r._limb);
+		}
+		q.negative = signOfQuotient;
+		r.negative = a.negative;
+		q.normalize();
+		r.normalize();
+		if (quotient) quotient->take(q);
+		if (remainder) remainder->take(r);
+	}
+
+	template<typename Ty> friend void convert_to_decimal(Ty v, decimal& d);
+
 	friend std::ostream& operator<<(std::ostream& ostr, const decimal& d);
 	friend std::istream& operator>>(std::istream& istr, decimal& d);
 
@@ -446,30 +686,11 @@ private:
 // Convert integer types to a decimal representation
 template<typename Ty>
 void convert_to_decimal(Ty v, decimal& d) {
-	using namespace std;
-	//cout << numeric_limits<Ty>::digits << " max value " << numeric_limits<Ty>::max() << endl;
 	d.setzero();
-	bool sign = false;
-	if (v == 0) return;
-	if (numeric_limits<Ty>::is_signed) {
-		if (v < 0) {
-			sign = true; // negative number
-			// transform to sign-magnitude on positive side
-			v *= -1;
-		}
-	}
-	uint64_t mask = 0x1;
-	// can't use assignment operator as it would yield an infinite loop calling convert
-	d.push_back(0); // initialize the decimal value to 0
-	decimal base;
-	base.push_back(1); // set to the value of 1, and double it each iteration
-	while (v) { // minimum loop iterations; exits when no bits left
-		if (v & mask) {
-			d += base;
-		}
-		base += base;
-		v >>= 1;
-	}
+	// the magnitude as an unsigned value, which holds the magnitude of the most negative value as well
+	bool sign = (v < 0);
+	unsigned long long magnitude = (sign ? 0ull - (unsigned long long)v : (unsigned long long)v);
+	for (; magnitude > 0; magnitude /= impl::DECIMAL_BASE) d.push(uint32_t(magnitude % impl::DECIMAL_BASE));
 	// finally set the sign
 	d.setsign(sign);
 }
@@ -481,18 +702,25 @@ void convert_to_decimal(Ty v, decimal& d) {
 // generate an ASCII decimal format and send to ostream
 inline std::ostream& operator<<(std::ostream& ostr, const decimal& d) {
 	// to make certain that setw and left/right operators work properly
-	// we need to transform the integer into a string
-	std::stringstream ss;
-
-	//std::streamsize width = ostr.width();
-	std::ios_base::fmtflags ff;
-	ff = ostr.flags();
-	ss.flags(ff);
-	if (d.isneg()) ss << '-';
-	for (decimal::const_reverse_iterator rit = d.rbegin(); rit != d.rend(); ++rit) {
-		ss << (int)*rit;
+	// we need to transform the decimal into a string
+	std::string digits;
+	digits.reserve(d.size() + 1);
+	if (d.isneg()) digits.push_back('-');
+	if (d._size == 0) {
+		digits.push_back('0');
 	}
-	return ostr << ss.str();
+	else {
+		char chunk[impl::DECIMAL_BASE_DIGITS];
+		// the leading limb without its leading zeros, and every other limb in full
+		for (size_t i = d._size; i-- > 0; ) {
+			uint32_t limb = d._limb[i];
+			for (unsigned j = impl::DECIMAL_BASE_DIGITS; j-- > 0; limb /= 10) chunk[j] = char('0' + limb % 10);
+			unsigned first = 0;
+			if (i + 1 == d._size) while (first + 1 < impl::DECIMAL_BASE_DIGITS && chunk[first] == '0') ++first;
+			digits.append(chunk + first, chunk + impl::DECIMAL_BASE_DIGITS);
+		}
+	}
+	return ostr << digits;
 }
 
 // read an ASCII decimal format from an istream
@@ -531,47 +759,41 @@ inline decimal operator/(const decimal& lhs, const decimal& rhs) {
 	ratio /= rhs;
 	return ratio;
 }
+// binary remainder of decimal numbers
+inline decimal operator%(const decimal& lhs, const decimal& rhs) {
+	decimal remainder = lhs;
+	remainder %= rhs;
+	return remainder;
+}
 
 /// logic operators
 
 	// decimal - decimal logic operators
 // equality test
-bool operator==(const decimal& lhs, const decimal& rhs) {
-	bool areEqual = std::equal(lhs.begin(), lhs.end(), rhs.begin());
-	return areEqual;
+inline bool operator==(const decimal& lhs, const decimal& rhs) {
+	return lhs.negative == rhs.negative && impl::decimal_compare(lhs._limb, lhs._size, rhs._limb, rhs._size) == 0;
 }
 // inequality test
-bool operator!=(const decimal& lhs, const decimal& rhs) {
+inline bool operator!=(const decimal& lhs, const decimal& rhs) {
 	return !operator==(lhs, rhs);
 }
 // less-than test
-bool operator<(const decimal& lhs, const decimal& rhs) {
-	// this logic assumes that there is no padding in the operands
-	size_t l = lhs.size();
-	size_t r = rhs.size();
-	if (l < r) return true;
-	if (l > r) return false;
-	// numbers are the same size, need to compare magnitude
-	decimal::const_reverse_iterator ritl = lhs.rbegin();
-	decimal::const_reverse_iterator ritr = rhs.rbegin();
-	for (; ritl != lhs.rend() || ritr != rhs.rend(); ++ritl, ++ritr) {
-		if (*ritl < *ritr) return true;
-		if (*ritl > *ritr) return false;
-		// if the digits are equal we need to check the next set
-	}
-	// at this point we know the two operands are the same
-	return false;
+inline bool operator<(const decimal& lhs, const decimal& rhs) {
+	if (lhs.negative != rhs.negative) return lhs.negative;
+	// same sign: the larger magnitude is the smaller negative number
+	int order = impl::decimal_compare(lhs._limb, lhs._size, rhs._limb, rhs._size);
+	return (lhs.negative ? order > 0 : order < 0);
 }
 // greater-than test
-bool operator>(const decimal& lhs, const decimal& rhs) {
+inline bool operator>(const decimal& lhs, const decimal& rhs) {
 	return operator<(rhs, lhs);
 }
 // less-or-equal test
-bool operator<=(const decimal& lhs, const decimal& rhs) {
-	return operator<(lhs, rhs) || operator==(lhs, rhs);
+inline bool operator<=(const decimal& lhs, const decimal& rhs) {
+	return !operator<(rhs, lhs);
 }
 // greater-or-equal test
-bool operator>=(const decimal& lhs, const decimal& rhs) {
+inline bool operator>=(const decimal& lhs, const decimal& rhs) {
 	return !operator<(lhs, rhs);
 }
 
@@ -588,8 +810,8 @@ inline bool operator< (const decimal& lhs, long rhs) {
 inline bool operator> (const decimal& lhs, long rhs) {
 	return operator< (decimal(rhs), lhs);
 }
-inline bool operator<=(decimal& lhs, long rhs) {
-	return operator< (lhs, decimal(rhs)) || operator==(lhs, decimal(rhs));
+inline bool operator<=(const decimal& lhs, long rhs) {
+	return operator<=(lhs, decimal(rhs));
 }
 inline bool operator>=(const decimal& lhs, long rhs) {
 	return !operator<(lhs, decimal(rhs));
@@ -603,13 +825,13 @@ inline bool operator!=(long lhs, const decimal& rhs) {
 	return !operator==(decimal(lhs), rhs);
 }
 inline bool operator< (long lhs, const decimal& rhs) {
-	return false;
+	return operator<(decimal(lhs), rhs);
 }
 inline bool operator> (long lhs, const decimal& rhs) {
-	return operator< (decimal(lhs), rhs);
+	return operator< (rhs, decimal(lhs));
 }
 inline bool operator<=(long lhs, const decimal& rhs) {
-	return operator< (decimal(lhs), rhs) || operator==(decimal(lhs), rhs);
+	return operator<=(decimal(lhs), rhs);
 }
 inline bool operator>=(long lhs, const decimal& rhs) {
 	return !operator<(decimal(lhs), rhs);
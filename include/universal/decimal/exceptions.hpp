@@ -0,0 +1,49 @@
+#pragma once
+// exceptions.hpp: definition of decimal exceptions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <exception>
+#include <stdexcept>
+
+#if defined(__clang__)
+/* Clang/LLVM. ---------------------------------------------- */
+
+
+#elif defined(__ICC) || defined(__INTEL_COMPILER)
+/* Intel ICC/ICPC. ------------------------------------------ */
+
+
+#elif defined(__GNUC__) || defined(__GNUG__)
+/* GNU GCC/G++. --------------------------------------------- */
+
+
+#elif defined(__HP_cc) || defined(__HP_aCC)
+/* Hewlett-Packard C/aC++. ---------------------------------- */
+
+#elif defined(__IBMC__) || defined(__IBMCPP__)
+/* IBM XL C/C++. -------------------------------------------- */
+
+#elif defined(_MSC_VER)
+/* Microsoft Visual Studio. --------------------------------- */
+
+
+#elif defined(__PGI)
+/* Portland Group PGCC/PGCPP. ------------------------------- */
+
+#elif defined(__SUNPRO_C) || defined(__SUNPRO_CC)
+/* Oracle Solaris Studio. ----------------------------------- */
+
+#endif
+
+namespace sw {
+namespace unum {
+
+// divide by zero arithmetic exception for decimals
+struct decimal_divide_by_zero : public std::runtime_error {
+	decimal_divide_by_zero() : std::runtime_error("decimal division by zero") {}
+};
+
+} // namespace unum
+} // namespace sw
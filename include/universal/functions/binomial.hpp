@@ -1,26 +1,32 @@
 #pragma once
-// binomial.hpp: definition of recursive binomial coefficient function
+// binomial.hpp: definition of the binomial coefficient function
 //
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <vector>
 
 namespace sw {
 namespace function {
 
-// BinomialCoefficient calculates the binomial coefficience recursively
+// BinomialCoefficient calculates the binomial coefficient with the recurrence of Pascal's triangle
 // (n over k) = (n-1 over k-1) + (n-1 over k)
+// one row at a time: the same sums as the recursion, so Real types round the same, in O(n k) instead of O(2^n) additions
+// (n over k) = 0 when k < 0 or k > n
 template<typename Scalar>
 Scalar BinomialCoefficient(Scalar n, Scalar k) {
-	//std::cout << "( " << n << " over " << k << ")\n";
-	Scalar coef;
-	if (k == 0 || k == n || n == 0) {
-		coef = Scalar(1);
+	if (k < Scalar(0) || n < k) return Scalar(0);
+	long long nn = (long long)n;
+	long long kk = (long long)k;
+	if (nn - kk < kk) kk = nn - kk;  // the rows are symmetric
+	std::vector<Scalar> row(size_t(kk) + 1, Scalar(0));
+	row[0] = Scalar(1);
+	for (long long m = 1; m <= nn; ++m) {
+		for (long long j = (m < kk ? m : kk); j > 0; --j) {
+			row[size_t(j)] = (j == m ? Scalar(1) : row[size_t(j - 1)] + row[size_t(j)]);
+		}
 	}
-	else {
-		coef = BinomialCoefficient(n - 1, k - 1) + BinomialCoefficient(n - 1, k);
-	}
-	return coef;
+	return row[size_t(kk)];
 }
 
 
@@ -0,0 +1,63 @@
+#pragma once
+// compensated_sum.hpp: Sum2 and Dot2 compensated summation and dot product
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+#include <vector>
+#include "twosum.hpp"
+#include "twoprod.hpp"
+
+namespace sw {
+namespace function {
+
+/*
+Sum2 and Dot2 are the compensated algorithms of Ogita, Rump, and Oishi,
+"Accurate Sum and Dot Product", SIAM J. Sci. Comput. 26(6), 2005.
+
+The rounding errors of every addition, and for Dot2 of every product, are captured
+with twoSum and twoProd and accumulated in a second scalar that is added back at
+the end. The result is as accurate as if it had been computed in twice the working 
+precision and then rounded, which covers moderately conditioned problems at a
+fraction of the cost of an exact accumulation.
+
+The calls to twoSum are unqualified so that number systems with their own
+error-free transformation, such as the posit twoSum, are selected.
+*/
+
+// sum2 returns the compensated sum of the elements of a vector
+template<typename Vector>
+typename Vector::value_type sum2(const Vector& v) {
+	using Scalar = typename Vector::value_type;
+	if (v.size() == 0) return Scalar(0);
+	Scalar s = v[0];
+	Scalar sigma(0);
+	for (size_t i = 1; i < v.size(); ++i) {
+		std::pair<Scalar, Scalar> sq = twoSum(s, v[i]);
+		s = sq.first;
+		sigma += sq.second;
+	}
+	return s + sigma;
+}
+
+// dot2 returns the compensated dot product of two vectors of equal length
+template<typename Vector>
+typename Vector::value_type dot2(const Vector& x, const Vector& y) {
+	using Scalar = typename Vector::value_type;
+	size_t n = (x.size() < y.size() ? x.size() : y.size());
+	if (n == 0) return Scalar(0);
+	std::pair<Scalar, Scalar> ps = twoProd(x[0], y[0]);
+	Scalar p = ps.first;
+	Scalar s = ps.second;
+	for (size_t i = 1; i < n; ++i) {
+		std::pair<Scalar, Scalar> hr = twoProd(x[i], y[i]);
+		std::pair<Scalar, Scalar> pq = twoSum(p, hr.first);
+		p = pq.first;
+		s += pq.second + hr.second;
+	}
+	return p + s;
+}
+
+}  // namespace function
+}  // namespace sw
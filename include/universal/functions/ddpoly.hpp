@@ -4,6 +4,10 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <vector>
+#include "twosum.hpp"
+
 namespace sw {
 namespace function {
 
@@ -78,6 +82,172 @@ void ddpoly(const Scalar& x, const Vector& c, Vector& pd) {
 	}
 }
 
+// horner evaluates a polynomial of degree N at point x with a fused multiply-add in each step
+template<typename Vector, typename Scalar>
+Scalar horner(const Scalar& x, const Vector& c) {
+	using std::fma;
+	int N = int(size(c)) - 1;
+	if (N < 0) return Scalar(0);
+	Scalar p = c[N];
+	for (int i = N - 1; i >= 0; --i) {
+		p = fma(p, x, Scalar(c[i]));
+	}
+	return p;
+}
+
+/*
+	Compensated Horner scheme of Graillat, Langlois, and Louvet: 
+	the rounding error of each product is recovered with a fused multiply-add and 
+	the rounding error of each sum with twoSum. The errors are evaluated as a second
+	polynomial and added back at the end, yielding a result that is as accurate as 
+	if Horner's scheme had been computed in twice the working precision.
+*/
+template<typename Vector, typename Scalar>
+Scalar compensated_horner(const Scalar& x, const Vector& c) {
+	using std::fma;
+	int N = int(size(c)) - 1;
+	if (N < 0) return Scalar(0);
+	Scalar s = c[N];
+	Scalar r(0);
+	for (int i = N - 1; i >= 0; --i) {
+		Scalar p = s * x;
+		Scalar pi = fma(s, x, -p);             // rounding error of the product
+		std::pair<Scalar, Scalar> sum = twoSum(p, Scalar(c[i]));
+		s = sum.first;
+		r = fma(r, x, pi + sum.second);        // Horner's scheme on the rounding errors
+	}
+	return s + r;
+}
+
+/*
+	Estrin's scheme evaluates the polynomial as a tree of fused multiply-adds:
+
+	p = (c0 + c1*x) + (c2 + c3*x)*x^2 + ((c4 + c5*x) + (c6 + c7*x)*x^2)*x^4
+
+	The pairs at each level of the tree are independent, which shortens the
+	dependency chain from N to log2(N) fused multiply-adds.
+*/
+template<typename Vector, typename Scalar>
+Scalar estrin(const Scalar& x, const Vector& c) {
+	using std::fma;
+	size_t n = size(c);
+	if (n == 0) return Scalar(0);
+	std::vector<Scalar> level((n + 1) / 2);
+	for (size_t k = 0; k < n / 2; ++k) {
+		level[k] = fma(Scalar(c[2 * k + 1]), x, Scalar(c[2 * k]));
+	}
+	if (n & 1) level[n / 2] = c[n - 1];
+	Scalar power = x * x;
+	while (level.size() > 1) {
+		size_t m = level.size();
+		for (size_t k = 0; k < m / 2; ++k) {
+			level[k] = fma(level[2 * k + 1], power, level[2 * k]);
+		}
+		if (m & 1) level[m / 2] = level[m - 1];
+		level.resize((m + 1) / 2);
+		if (level.size() > 1) power *= power;
+	}
+	return level[0];
+}
+
+#if defined(_POSIT_STANDARD_HEADER_)
+/*
+	polynomial_evaluator evaluates a posit polynomial with the quire-accumulated Estrin scheme, which
+	is not the tree of fused multiply-adds of estrin() above: it shares only the powers of x formed by
+	repeated squaring, which fill a table of x^i, and the polynomial is the dot product of that table
+	with the coefficients, accumulated exactly in the quire, so that the sum is rounded only once.
+	The powers themselves are rounded posit products: x^i, with i the sum of 2^j over its set bits j,
+	takes r_i = sum(j) + popcount(i) - 1 roundings, so that, to first order in the relative
+	rounding error u of the posit at the magnitudes involved,
+	    |result - p(x)| <= u * |p(x)| + sum_i |c[i]| * |x|^i * r_i * u
+	The result is correctly rounded only when the powers are exact, as they are for dyadic x of few bits.
+	The coefficients are decoded into (sign, scale, fraction) triples when the evaluator 
+	is constructed, so that evaluating the polynomial at many points does not decode them again.
+	The evaluator is immutable after construction and can be shared between threads: the table of
+	powers is a scratch buffer of the caller, which the batch evaluation reuses across its points.
+*/
+template<size_t nbits, size_t es, size_t capacity = 10>
+class polynomial_evaluator {
+public:
+	using Posit = sw::unum::posit<nbits, es>;
+	static constexpr size_t fbits = Posit::fbits;
+	static constexpr size_t mbits = 2 * (fbits + 1);
+
+	explicit polynomial_evaluator(const std::vector<Posit>& c) : _coefficients(size(c)), _nar(false) {
+		for (size_t i = 0; i < size(c); ++i) {
+			if (c[i].isnar()) _nar = true;
+			decode(c[i], _coefficients[i]);
+		}
+	}
+
+	size_t degree() const { return _coefficients.empty() ? 0 : size(_coefficients) - 1; }
+
+	// evaluate the polynomial at point x
+	Posit operator()(const Posit& x) const {
+		std::vector<Posit> powers;
+		return evaluate(x, powers);
+	}
+
+	// evaluate the polynomial at point x with the scratch buffer powers of the caller
+	Posit operator()(const Posit& x, std::vector<Posit>& powers) const {
+		return evaluate(x, powers);
+	}
+
+	// evaluate the polynomial at each point of x, p[i] = polynomial(x[i])
+	void operator()(const std::vector<Posit>& x, std::vector<Posit>& p) const {
+		std::vector<Posit> powers;
+		p.resize(size(x));
+		for (size_t i = 0; i < size(x); ++i) {
+			p[i] = evaluate(x[i], powers);
+		}
+	}
+
+private:
+	std::vector<sw::unum::value<fbits>> _coefficients;
+	bool                                _nar;
+
+	static void decode(const Posit& p, sw::unum::value<fbits>& v) {
+		v.set(sw::unum::sign(p), sw::unum::scale(p), sw::unum::extract_fraction<nbits, es, fbits>(p), p.iszero(), p.isnar());
+	}
+
+	Posit evaluate(const Posit& x, std::vector<Posit>& powers) const {
+		Posit p(0);
+		if (_nar || x.isnar()) {
+			p.setnar();
+			return p;
+		}
+		size_t n = size(_coefficients);
+		if (n == 0) return p;
+		powers.resize(n);
+		powers[0] = 1;
+		// x^(2^j) is the square of x^(2^(j-1)), any other power is x^(2^j) times a lower power
+		size_t square = 1;
+		for (size_t i = 1; i < n; ++i) {
+			if (i == 2 * square) square = i;
+			powers[i] = (i == 1) ? x : (i == square ? powers[i / 2] * powers[i / 2] : powers[square] * powers[i - square]);
+		}
+		sw::unum::quire<nbits, es, capacity> q;
+		q += _coefficients[0];
+		sw::unum::value<fbits> power;
+		sw::unum::value<mbits> product;
+		for (size_t i = 1; i < n; ++i) {
+			if (_coefficients[i].iszero() || powers[i].iszero()) continue;
+			decode(powers[i], power);
+			sw::unum::module_multiply(_coefficients[i], power, product);
+			q += product;
+		}
+		convert(q.to_value(), p);     // the only rounding of the sum of the products
+		return p;
+	}
+};
+
+// quire_estrin evaluates a posit polynomial at point x with the quire-accumulated Estrin scheme
+template<size_t nbits, size_t es>
+sw::unum::posit<nbits, es> quire_estrin(const sw::unum::posit<nbits, es>& x, const std::vector<sw::unum::posit<nbits, es>>& c) {
+	return polynomial_evaluator<nbits, es>(c)(x);
+}
+#endif // _POSIT_STANDARD_HEADER_
+
 }  // namespace function
 }  // namespace sw
 
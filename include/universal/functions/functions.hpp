@@ -8,6 +8,8 @@
 // properties of a number
 #include "isrepresentable.hpp"
 #include "twosum.hpp"
+#include "twoprod.hpp"
+#include "compensated_sum.hpp"
 
 // special functions
 #include "factorial.hpp"
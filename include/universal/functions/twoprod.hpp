@@ -0,0 +1,35 @@
+#pragma once
+// twoprod.hpp: definition of the twoProd function
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+#include <cmath>
+#include <tuple>
+
+namespace sw {
+namespace function {
+
+/*
+TwoProd is the error-free transformation of a product.
+
+Given two floating point values a and b, generate a rounded product p and a remainder r, such that
+p = RoundToNearest(a * b), and
+a * b = p + r
+
+With a fused multiply-add that rounds once, the remainder is r = fma(a, b, -p).
+For IEEE floating point the remainder is exact barring underflow. For posits the
+remainder is exact when it is representable, which fails for products whose
+remainder falls in the tapered precision of the regime.
+*/
+template<typename Scalar>
+std::pair<Scalar, Scalar> twoProd(const Scalar& a, const Scalar& b) {
+	using std::fma;
+	Scalar p = a * b;
+	Scalar r = fma(a, b, -p);
+	return std::make_pair(p, r);
+}
+
+}  // namespace function
+}  // namespace sw
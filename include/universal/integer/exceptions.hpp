@@ -44,6 +44,26 @@ struct integer_divide_by_zero : public std::runtime_error {
 	integer_divide_by_zero() : std::runtime_error("integer division by zero") {}
 };
 
+// overflow arithmetic exception for integers: the exact result of +, -, *, / is outside of the range of integer<nbits>
+struct integer_overflow : public std::runtime_error {
+	integer_overflow() : std::runtime_error("integer arithmetic overflow") {}
+};
+
+// square root of a negative integer
+struct integer_negative_sqrt_arg : public std::runtime_error {
+	integer_negative_sqrt_arg() : std::runtime_error("integer square root of a negative number") {}
+};
+
+// factorial of a negative integer
+struct integer_negative_factorial_arg : public std::runtime_error {
+	integer_negative_factorial_arg() : std::runtime_error("integer factorial of a negative number") {}
+};
+
+// modular exponentiation with a negative exponent
+struct integer_negative_exponent : public std::runtime_error {
+	integer_negative_exponent() : std::runtime_error("integer modular exponentiation with a negative exponent") {}
+};
+
 ///////////////////////////////////////////////////////////////
 // internal implementation exceptions
 
@@ -51,5 +71,13 @@ struct integer_byte_index_out_of_bounds : public std::runtime_error {
 	integer_byte_index_out_of_bounds() : std::runtime_error("byte index out of bounds") {}
 };
 
+struct integer_limb_index_out_of_bounds : public std::runtime_error {
+	integer_limb_index_out_of_bounds() : std::runtime_error("limb index out of bounds") {}
+};
+
+struct integer_even_modulus : public std::runtime_error {
+	integer_even_modulus() : std::runtime_error("Montgomery multiplication needs an odd modulus greater than one") {}
+};
+
 } // namespace unum
 } // namespace sw
@@ -4,6 +4,7 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
 #include <string>
 #include <sstream>
 #include <iostream>
@@ -11,8 +12,12 @@
 #include <regex>
 #include <vector>
 #include <map>
+#include <cstring>
+#include <system_error>
 
 #include "./exceptions.hpp"
+#include "../utility/int128.hpp"
+#include "../utility/ntt.hpp"
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -34,7 +39,7 @@
 
 #elif defined(_MSC_VER)
 /* Microsoft Visual Studio. --------------------------------- */
-
+#include <intrin.h>
 
 #elif defined(__PGI)
 /* Portland Group PGCC/PGCPP. ------------------------------- */
@@ -53,6 +58,7 @@ template<size_t nbits> integer<nbits> max_int();
 template<size_t nbits> integer<nbits> min_int();
 template<size_t nbits> struct idiv_t;
 template<size_t nbits> idiv_t<nbits> idiv(const integer<nbits>&, const integer<nbits>&b);
+template<size_t nbits> idiv_t<nbits> divmod(const integer<nbits>&, const integer<nbits>&);
 
 template<size_t nbits>
 inline integer<nbits> max_int() {
@@ -91,30 +97,17 @@ inline long scale(const integer<nbits>& i) {
 
 template<size_t nbits>
 inline void convert(int64_t v, integer<nbits>& result) {
-	constexpr uint64_t mask = 0x1;
-	bool negative = (v < 0 ? true : false);
-	result.clear();
-	unsigned upper = (nbits <= 64 ? nbits : 64);
-	for (unsigned i = 0; i < upper && v != 0; ++i) {
-		if (v & mask) result.set(i);
-		v >>= 1;
-	}
-	if (nbits > 64 && negative) {
-		// sign extend
-		for (unsigned i = upper; i < nbits; ++i) {
-			result.set(i);
-		}
+	// sign extend into the upper limbs
+	uint64_t extension = (v < 0 ? 0xFFFFFFFFFFFFFFFFull : 0ull);
+	for (unsigned i = result.nrLimbs - 1; i > 0; --i) {
+		result.setlimb(i, extension);
 	}
+	result.setlimb(0, uint64_t(v));
 }
 template<size_t nbits>
 inline void convert_unsigned(uint64_t v, integer<nbits>& result) {
-	constexpr uint64_t mask = 0x1;
 	result.clear();
-	unsigned upper = (nbits <= 64 ? nbits : 64);
-	for (unsigned i = 0; i < upper; ++i) {
-		if (v & mask) result.set(i);
-		v >>= 1;
-	}
+	result.setlimb(0, v);
 }
 
 template<size_t nbits>
@@ -127,6 +120,358 @@ struct idiv_t {
 	integer<nbits> rem;  // remainder
 };
 
+namespace impl {
+
+// a + b + carry on 64-bit limbs, carry is set to the carry out
+inline uint64_t addcarry(uint64_t a, uint64_t b, unsigned char& carry) {
+#if defined(__GNUC__) || defined(__clang__)
+	uint64_t sum;
+	bool c1 = __builtin_add_overflow(a, b, &sum);
+	bool c2 = __builtin_add_overflow(sum, uint64_t(carry), &sum);
+	carry = (c1 || c2) ? 1 : 0;
+	return sum;
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long long sum;
+	carry = _addcarry_u64(carry, a, b, &sum);
+	return sum;
+#else
+	uint64_t sum = a + b;
+	unsigned char c1 = (sum < a ? 1 : 0);
+	sum += carry;
+	carry = c1 | (sum < carry ? 1 : 0);
+	return sum;
+#endif
+}
+
+// a - b - borrow on 64-bit limbs, borrow is set to the borrow out
+inline uint64_t subborrow(uint64_t a, uint64_t b, unsigned char& borrow) {
+#if defined(__GNUC__) || defined(__clang__)
+	uint64_t difference;
+	bool b1 = __builtin_sub_overflow(a, b, &difference);
+	bool b2 = __builtin_sub_overflow(difference, uint64_t(borrow), &difference);
+	borrow = (b1 || b2) ? 1 : 0;
+	return difference;
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long long difference;
+	borrow = _subborrow_u64(borrow, a, b, &difference);
+	return difference;
+#else
+	uint64_t difference = a - b;
+	unsigned char b1 = (a < b ? 1 : 0);
+	b1 |= (difference < borrow ? 1 : 0);
+	difference -= borrow;
+	borrow = b1;
+	return difference;
+#endif
+}
+
+// the 128-bit product of two 64-bit limbs: returns the low limb and sets hi to the high limb
+inline uint64_t mul64(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+	native_uint128 product = (native_uint128)a * b;
+	hi = uint64_t(product >> 64);
+	return uint64_t(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long long high;
+	uint64_t low = _umul128(a, b, &high);
+	hi = high;
+	return low;
+#else
+	uint64_t a0 = a & 0xFFFFFFFFull, a1 = a >> 32;
+	uint64_t b0 = b & 0xFFFFFFFFull, b1 = b >> 32;
+	uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+	hi = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+	return (middle << 32) | (p00 & 0xFFFFFFFFull);
+#endif
+}
+
+// r += a * b + carry at limb i + j, returns the carry limb into i + j + 1
+inline uint64_t muladd(uint64_t a, uint64_t b, uint64_t& r, uint64_t carry) {
+	uint64_t hi;
+	uint64_t lo = mul64(a, b, hi);
+	unsigned char c = 0;
+	lo = addcarry(lo, r, c);
+	hi += c;  // a * b + r + carry < 2^128, so the high limb cannot overflow
+	c = 0;
+	r = addcarry(lo, carry, c);
+	return hi + c;
+}
+
+// the number of leading zero bits of a non-zero limb
+inline unsigned clz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return unsigned(__builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, x);
+	return 63u - unsigned(index);
+#else
+	unsigned n = 0;
+	for (unsigned shift = 32; shift > 0; shift >>= 1) {
+		if ((x >> (64 - shift)) == 0) { n += shift; x <<= shift; }
+	}
+	return n;
+#endif
+}
+
+// the number of trailing zero bits of a non-zero limb
+inline unsigned ctz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return unsigned(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, x);
+	return unsigned(index);
+#else
+	unsigned n = 0;
+	for (unsigned shift = 32; shift > 0; shift >>= 1) {
+		if ((x << (64 - shift)) == 0) { n += shift; x >>= shift; }
+	}
+	return n;
+#endif
+}
+
+// the number of set bits of a limb
+inline unsigned popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return unsigned(__builtin_popcountll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	return unsigned(__popcnt64(x));
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ull);
+	x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+	return unsigned((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// the quotient of the 128-bit value hi:lo by d, with hi < d so that the quotient fits a limb, rem is set to the remainder
+inline uint64_t div128(uint64_t hi, uint64_t lo, uint64_t d, uint64_t& rem) {
+#if defined(__SIZEOF_INT128__)
+	native_uint128 n = ((native_uint128)hi << 64) | lo;
+	uint64_t q = uint64_t(n / d);
+	rem = uint64_t(n - (native_uint128)q * d);
+	return q;
+#else
+	// Hacker's Delight divlu: two 64/32-bit digit steps on the normalized divisor
+	const uint64_t b = 1ull << 32;
+	unsigned s = clz64(d);
+	d <<= s;
+	uint64_t vn1 = d >> 32, vn0 = d & 0xFFFFFFFFull;
+	uint64_t un32 = (s == 0 ? hi : ((hi << s) | (lo >> (64 - s))));
+	uint64_t un10 = lo << s;
+	uint64_t un1 = un10 >> 32, un0 = un10 & 0xFFFFFFFFull;
+	uint64_t q1 = un32 / vn1, rhat = un32 - q1 * vn1;
+	while (q1 >= b || q1 * vn0 > b * rhat + un1) {
+		--q1;
+		rhat += vn1;
+		if (rhat >= b) break;
+	}
+	uint64_t un21 = un32 * b + un1 - q1 * d;
+	uint64_t q0 = un21 / vn1;
+	rhat = un21 - q0 * vn1;
+	while (q0 >= b || q0 * vn0 > b * rhat + un0) {
+		--q0;
+		rhat += vn1;
+		if (rhat >= b) break;
+	}
+	rem = (un21 * b + un0 - q0 * d) >> s;
+	return q1 * b + q0;
+#endif
+}
+
+// q[0, m) = u[0, m) / d, returns the remainder: the single limb divisor
+inline uint64_t divmod_limb(const uint64_t* u, size_t m, uint64_t d, uint64_t* q) {
+	uint64_t rem = 0;
+	for (size_t i = m; i > 0; --i) {
+		q[i - 1] = div128(rem, u[i - 1], d, rem);
+	}
+	return rem;
+}
+
+// Knuth, TAOCP Vol 2, 4.3.1, Algorithm D: q[0, m - n + 1) = u[0, m) / v[0, n) and r[0, n) = u[0, m) % v[0, n)
+// with m >= n >= 2 and v[n - 1] != 0. scratch holds the normalized operands, m + n + 1 limbs.
+inline void divmod_knuth(const uint64_t* u, size_t m, const uint64_t* v, size_t n, uint64_t* q, uint64_t* r, uint64_t* scratch) {
+	// normalize: shift the divisor so that its most significant bit is set, which bounds the error of the trial quotient to 2
+	unsigned s = clz64(v[n - 1]);
+	uint64_t* vn = scratch;
+	uint64_t* un = scratch + n;
+	for (size_t i = n - 1; i > 0; --i) vn[i] = (s == 0 ? v[i] : ((v[i] << s) | (v[i - 1] >> (64 - s))));
+	vn[0] = v[0] << s;
+	un[m] = (s == 0 ? 0 : (u[m - 1] >> (64 - s)));
+	for (size_t i = m - 1; i > 0; --i) un[i] = (s == 0 ? u[i] : ((u[i] << s) | (u[i - 1] >> (64 - s))));
+	un[0] = u[0] << s;
+
+	for (size_t j = m - n + 1; j > 0; --j) {
+		size_t k = j - 1;
+		// trial quotient from the top two limbs of the remainder and the top limb of the divisor
+		uint64_t qhat, rhat;
+		unsigned char overflow = 0;
+		if (un[k + n] >= vn[n - 1]) {
+			// the trial quotient does not fit a limb, which only happens when un[k + n] == vn[n - 1]
+			qhat = ~0ull;
+			rhat = addcarry(un[k + n - 1], vn[n - 1], overflow);
+		}
+		else {
+			qhat = div128(un[k + n], un[k + n - 1], vn[n - 1], rhat);
+		}
+		// refine with the second limb of the divisor: qhat is then at most one too large
+		while (!overflow) {
+			uint64_t phi;
+			uint64_t plo = mul64(qhat, vn[n - 2], phi);
+			if (phi < rhat || (phi == rhat && plo <= un[k + n - 2])) break;
+			--qhat;
+			rhat = addcarry(rhat, vn[n - 1], overflow);
+		}
+		// multiply and subtract
+		uint64_t carry = 0;
+		unsigned char borrow = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t phi;
+			uint64_t plo = mul64(qhat, vn[i], phi);
+			plo += carry;
+			carry = phi + (plo < carry ? 1 : 0);
+			un[i + k] = subborrow(un[i + k], plo, borrow);
+		}
+		un[k + n] = subborrow(un[k + n], carry, borrow);
+		if (borrow) {
+			// the trial quotient was one too large: add the divisor back
+			--qhat;
+			unsigned char c = 0;
+			for (size_t i = 0; i < n; ++i) un[i + k] = addcarry(un[i + k], vn[i], c);
+			un[k + n] += c;
+		}
+		q[k] = qhat;
+	}
+	// denormalize the remainder
+	for (size_t i = 0; i < n - 1; ++i) r[i] = (s == 0 ? un[i] : ((un[i] >> s) | (un[i + 1] << (64 - s))));
+	r[n - 1] = un[n - 1] >> s;
+}
+
+// below this number of limbs the Karatsuba recursion falls back to the schoolbook multiply
+// measured crossover on x86-64 with native 128-bit products: 48 limbs, that is integer<3072>
+#ifndef INTEGER_KARATSUBA_THRESHOLD
+#define INTEGER_KARATSUBA_THRESHOLD 48
+#endif
+constexpr size_t KARATSUBA_THRESHOLD = (INTEGER_KARATSUBA_THRESHOLD < 4 ? 4 : INTEGER_KARATSUBA_THRESHOLD);
+
+// the number of scratch limbs the multiply of n limbs needs, an upper bound for both karatsuba() and mul_low()
+constexpr size_t multiply_scratch(size_t n) { return 6 * n + 64; }
+
+// r[0, na + nb) = a[0, na) * b[0, nb)
+inline void mul_schoolbook(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* r) {
+	for (size_t i = 0; i < na + nb; ++i) r[i] = 0;
+	for (size_t i = 0; i < na; ++i) {
+		uint64_t carry = 0;
+		for (size_t j = 0; j < nb; ++j) {
+			carry = muladd(a[i], b[j], r[i + j], carry);
+		}
+		r[i + nb] = carry;
+	}
+}
+
+// r[0, n) = a[0, n) * b[0, n) mod 2^(64n)
+inline void mul_low_schoolbook(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* r) {
+	for (size_t i = 0; i < n; ++i) r[i] = 0;
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t carry = 0;
+		for (size_t j = 0; i + j < n; ++j) {
+			carry = muladd(a[i], b[j], r[i + j], carry);
+		}
+	}
+}
+
+// r[0, n) += a[0, na), returns the carry out of limb n - 1
+inline unsigned char add_limbs(uint64_t* r, size_t n, const uint64_t* a, size_t na) {
+	unsigned char carry = 0;
+	size_t i = 0;
+	for (; i < na && i < n; ++i) r[i] = addcarry(r[i], a[i], carry);
+	for (; carry && i < n; ++i) r[i] = addcarry(r[i], 0, carry);
+	return carry;
+}
+
+// r[0, n) -= a[0, na), returns the borrow out of limb n - 1
+inline unsigned char sub_limbs(uint64_t* r, size_t n, const uint64_t* a, size_t na) {
+	unsigned char borrow = 0;
+	size_t i = 0;
+	for (; i < na && i < n; ++i) r[i] = subborrow(r[i], a[i], borrow);
+	for (; borrow && i < n; ++i) r[i] = subborrow(r[i], 0, borrow);
+	return borrow;
+}
+
+// r[0, 2n) = a[0, n) * b[0, n)
+// with a = a1 * B^h + a0 and b = b1 * B^h + b0, the product is z2 * B^2h + z1 * B^h + z0 with
+// z0 = a0 * b0, z2 = a1 * b1, and z1 = (a0 + a1)(b0 + b1) - z0 - z2: three half size products instead of four
+inline void karatsuba(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* r, uint64_t* scratch) {
+	if (n < KARATSUBA_THRESHOLD) {
+		mul_schoolbook(a, n, b, n, r);
+		return;
+	}
+	size_t h = n / 2;  // limbs of a0 and b0
+	size_t m = n - h;  // limbs of a1 and b1, m >= h
+	karatsuba(a, b, h, r, scratch);                  // z0 in r[0, 2h)
+	karatsuba(a + h, b + h, m, r + 2 * h, scratch);  // z2 in r[2h, 2n)
+
+	// the sums take m + 1 limbs to hold their carry, and their product 2m + 2 limbs
+	uint64_t* sa = scratch;
+	uint64_t* sb = sa + (m + 1);
+	uint64_t* z1 = sb + (m + 1);
+	for (size_t i = 0; i < m; ++i) { sa[i] = a[h + i]; sb[i] = b[h + i]; }
+	sa[m] = add_limbs(sa, m, a, h);
+	sb[m] = add_limbs(sb, m, b, h);
+	karatsuba(sa, sb, m + 1, z1, z1 + 2 * (m + 1));
+	sub_limbs(z1, 2 * (m + 1), r, 2 * h);
+	sub_limbs(z1, 2 * (m + 1), r + 2 * h, 2 * m);
+	// z1 < 2^(64(n+m+1)) so it does not carry out of the full product
+	add_limbs(r + h, 2 * n - h, z1, 2 * (m + 1));
+}
+
+// r[0, n) = a[0, n) * b[0, n) mod 2^(64n): the full product of the low halves and the truncated cross products
+inline void mul_low(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* r, uint64_t* scratch) {
+	if (n < KARATSUBA_THRESHOLD) {
+		mul_low_schoolbook(a, b, n, r);
+		return;
+	}
+	size_t h = n / 2;  // limbs of a0 and b0
+	size_t m = n - h;  // limbs of a1 and b1, m >= h
+	karatsuba(a, b, h, r, scratch);  // a0 * b0 in r[0, 2h)
+	// for odd n, a1 * b1 at limb 2h contributes the low limb of its least significant product
+	if (2 * h < n) r[2 * h] = a[h] * b[h];
+
+	// the cross products a1 * b0 + a0 * b1 only contribute their low m limbs at limb h
+	uint64_t* pad = scratch;
+	uint64_t* cross = pad + m;
+	for (size_t i = 0; i < m; ++i) pad[i] = (i < h ? b[i] : 0);
+	mul_low(a + h, pad, m, cross, cross + m);
+	add_limbs(r + h, m, cross, m);
+	for (size_t i = 0; i < m; ++i) pad[i] = (i < h ? a[i] : 0);
+	mul_low(pad, b + h, m, cross, cross + m);
+	add_limbs(r + h, m, cross, m);
+}
+
+// from this number of limbs the products are computed by the number theoretic transform of utility/ntt.hpp
+// measured crossover on x86-64 against the Karatsuba multiply: 1536 limbs, that is integer<98304>
+#ifndef INTEGER_NTT_THRESHOLD
+#define INTEGER_NTT_THRESHOLD 1536
+#endif
+constexpr size_t NTT_THRESHOLD = (INTEGER_NTT_THRESHOLD < KARATSUBA_THRESHOLD ? KARATSUBA_THRESHOLD : INTEGER_NTT_THRESHOLD);
+
+// r[0, 2n) = a[0, n) * b[0, n) by the schoolbook, the Karatsuba, or the transform multiply, whichever is fastest for n limbs
+inline void multiply_limbs(const uint64_t* a, const uint64_t* b, size_t n, uint64_t* r, uint64_t* scratch) {
+	if (n < KARATSUBA_THRESHOLD) {
+		mul_schoolbook(a, n, b, n, r);
+	}
+	else if (n < NTT_THRESHOLD) {
+		karatsuba(a, b, n, r, scratch);
+	}
+	else {
+		ntt_multiply(a, n, b, n, r);
+	}
+}
+
+} // namespace impl
+
 /*
 The rules for detecting overflow in a two's complement sum are simple:
  - If the sum of two positive numbers yields a negative result, the sum has overflowed.
@@ -144,6 +489,9 @@ allowable range of numbers, and their sum is between them, it must fit as well.
 
 When implementing addition/subtraction on chuncks the overflow condition must be deduced from the 
 chunk values. The chunks need to be interpreted as unsigned binary segments.
+
+The integer is stored in 64-bit limbs, least significant limb first. The bits of the most significant
+limb above nbits are always zero, so that comparisons and logic can work on whole limbs.
 */
 // integer is an arbitrary size 2's complement integer
 template<size_t _nbits>
@@ -151,8 +499,9 @@ class integer {
 public:
 	static constexpr size_t nbits = _nbits;
 	static constexpr unsigned nrBytes = (1 + ((nbits - 1) / 8));
-	static constexpr unsigned MS_BYTE = nrBytes - 1;
-	static constexpr uint8_t MS_BYTE_MASK = (0xFF >> (nrBytes * 8 - nbits));
+	static constexpr unsigned nrLimbs = (1 + ((nbits - 1) / 64));
+	static constexpr unsigned MS_LIMB = nrLimbs - 1;
+	static constexpr uint64_t MS_LIMB_MASK = (0xFFFFFFFFFFFFFFFFull >> (nrLimbs * 64 - nbits));
 
 	integer() { setzero(); }
 
@@ -347,9 +696,8 @@ public:
 
 	// prefix operators
 	integer operator-() const {
-		integer<nbits> negated(*this);
-		negated.flip();
-		negated += 1;
+		integer<nbits> negated;
+		negated -= *this;
 		return negated;
 	}
 	// one's complement
@@ -365,8 +713,11 @@ public:
 		return tmp;
 	}
 	integer& operator++() {
-		*this += integer<nbits>(1);
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		// the carry stops at the first limb that does not wrap around
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			if (++_limb[i] != 0) break;
+		}
+		_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 	// decrement
@@ -376,8 +727,11 @@ public:
 		return tmp;
 	}
 	integer& operator--() {
-		*this -= integer<nbits>(1);
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		// the borrow stops at the first limb that is not zero
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			if (_limb[i]-- != 0) break;
+		}
+		_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 	// conversion operators
@@ -396,38 +750,68 @@ public:
 
 	// arithmetic operators
 	integer& operator+=(const integer& rhs) {
-		integer<nbits> sum;
-		bool carry = false;
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			// cast up so we can test for overflow
-			uint16_t l = uint16_t(b[i]);
-			uint16_t r = uint16_t(rhs.b[i]);
-			uint16_t s = l + r + (carry ? uint16_t(0x0001) : uint16_t(0x0000));
-			carry = (s > 255 ? true : false);
-			sum.b[i] = (uint8_t)(s & 0xFF);
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		bool lhs_sign = sign();
+		bool rhs_sign = rhs.sign();
+#endif
+		unsigned char carry = 0;
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			_limb[i] = impl::addcarry(_limb[i], rhs._limb[i], carry);
 		}
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
-		sum.b[MS_BYTE] = MS_BYTE_MASK & sum.b[MS_BYTE];
-		//if (carry) throw "overflow";
-		*this = sum;
+		_limb[MS_LIMB] &= MS_LIMB_MASK;
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		// the sum of two operands of the same sign has overflowed when its sign differs from theirs
+		if (lhs_sign == rhs_sign && sign() != lhs_sign) throw integer_overflow{};
+#endif
 		return *this;
 	}
 	integer& operator-=(const integer& rhs) {
-		operator+=(twos_complement(rhs));
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		bool lhs_sign = sign();
+		bool rhs_sign = rhs.sign();
+#endif
+		unsigned char borrow = 0;
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			_limb[i] = impl::subborrow(_limb[i], rhs._limb[i], borrow);
+		}
+		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+		_limb[MS_LIMB] &= MS_LIMB_MASK;
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		// the difference of two operands of opposite sign has overflowed when its sign differs from the minuend
+		if (lhs_sign != rhs_sign && sign() != lhs_sign) throw integer_overflow{};
+#endif
 		return *this;
 	}
+	// the two's complement product modulo 2^nbits is the unsigned product of the bit patterns
 	integer& operator*=(const integer& rhs) {
-		integer<nbits> base(*this);
-		integer<nbits> multiplicant(rhs);
-		clear();
-		for (unsigned i = 0; i < nbits; ++i) {
-			if (base.at(i)) {
-				operator+=(multiplicant);
-			}
-			multiplicant <<= 1;
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		// the product fits when the bits of the exact product from bit nbits - 1 up are all copies of its sign
+		integer<2 * nbits> exact = multiply(*this, rhs);
+		exact >>= signed(nbits - 1);
+		unsigned ones = exact.popcount();
+		bool overflow = (ones != 0 && ones != nbits + 1);
+#endif
+		uint64_t product[nrLimbs];
+		if (nrLimbs < impl::KARATSUBA_THRESHOLD) {
+			impl::mul_low_schoolbook(_limb, rhs._limb, nrLimbs, product);
+		}
+		else if (nrLimbs >= impl::NTT_THRESHOLD) {
+			// the transform computes the full product at the cost of the low half
+			std::vector<uint64_t> full(2 * nrLimbs);
+			impl::ntt_multiply(_limb, nrLimbs, rhs._limb, nrLimbs, full.data());
+			std::memcpy(product, full.data(), sizeof(_limb));
 		}
-		// since we used operator++, which enforces the nulling of leading bits
-		// we don't need to null here
+		else {
+			uint64_t scratch[impl::multiply_scratch(nrLimbs)];
+			impl::mul_low(_limb, rhs._limb, nrLimbs, product, scratch);
+		}
+		std::memcpy(_limb, product, sizeof(_limb));
+		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+		_limb[MS_LIMB] &= MS_LIMB_MASK;
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		if (overflow) throw integer_overflow{};
+#endif
 		return *this;
 	}
 	integer& operator/=(const integer& rhs) {
@@ -450,11 +834,16 @@ public:
 			clear();
 			return *this;
 		}
-		integer<nbits> target;
-		for (unsigned i = shift; i < nbits; ++i) {  // TODO: inefficient as it works at the bit level
-			target.set(i, at(i - shift));
+		// move whole limbs, and funnel the remaining bits in from the next less significant limb
+		unsigned limbShift = unsigned(shift) / 64;
+		unsigned bitShift = unsigned(shift) % 64;
+		for (unsigned i = nrLimbs; i-- > limbShift; ) {
+			uint64_t hi = _limb[i - limbShift];
+			uint64_t lo = (i > limbShift ? _limb[i - limbShift - 1] : 0);
+			_limb[i] = (bitShift == 0 ? hi : ((hi << bitShift) | (lo >> (64 - bitShift))));
 		}
-		*this = target;
+		for (unsigned i = 0; i < limbShift; ++i) _limb[i] = 0;
+		_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 	integer& operator>>=(const signed shift) {
@@ -467,213 +856,158 @@ public:
 			clear();
 			return *this;
 		}
-		integer<nbits> target;
-		for (int i = nbits - 1; i >= int(shift); --i) {  // TODO: inefficient as it works at the bit level
-			target.set(i - shift, at(i));
+		// move whole limbs, and funnel the remaining bits in from the next more significant limb
+		unsigned limbShift = unsigned(shift) / 64;
+		unsigned bitShift = unsigned(shift) % 64;
+		for (unsigned i = 0; i + limbShift < nrLimbs; ++i) {
+			uint64_t lo = _limb[i + limbShift];
+			uint64_t hi = (i + limbShift + 1 < nrLimbs ? _limb[i + limbShift + 1] : 0);
+			_limb[i] = (bitShift == 0 ? lo : ((lo >> bitShift) | (hi << (64 - bitShift))));
 		}
-		*this = target;
+		for (unsigned i = nrLimbs - limbShift; i < nrLimbs; ++i) _limb[i] = 0;
 		return *this;
 	}
 	
 	// modifiers
-	inline void clear() { std::memset(&b, 0, nrBytes); }
+	inline void clear() { std::memset(&_limb, 0, sizeof(_limb)); }
 	inline void setzero() { clear(); }
 	inline void set(unsigned int i) {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t mask = 1 << (i % 8);
-			b[i / 8] = byte | mask;
+			_limb[i / 64] |= (1ull << (i % 64));
 			return;
 		}
 		throw "integer<nbits> bit index out of bounds";
 	}
 	inline void reset(unsigned int i) {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t mask = ~(1 << (i % 8));
-			b[i / 8] = byte & mask;
+			_limb[i / 64] &= ~(1ull << (i % 64));
 			return;
 		}
 		throw "integer<nbits> bit index out of bounds";
 	}
 	inline void set(unsigned i, bool v) {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t null = ~(1 << (i % 8));
-			uint8_t bit = (v ? 1 : 0);
-			uint8_t mask = (bit << (i % 8));
-			b[i / 8] = (byte & null) | mask;
+			uint64_t mask = (1ull << (i % 64));
+			_limb[i / 64] = (v ? (_limb[i / 64] | mask) : (_limb[i / 64] & ~mask));
 			return;
 		}
 		throw "integer<nbits> bit index out of bounds";
 	}
 	inline void setbyte(unsigned i, uint8_t value) {
-		if (i < nrBytes) { b[i] = value; return; }
+		if (i < nrBytes) {
+			unsigned shift = 8 * (i % 8);
+			_limb[i / 8] = (_limb[i / 8] & ~(0xFFull << shift)) | (uint64_t(value) << shift);
+			_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
+			return;
+		}
 		throw integer_byte_index_out_of_bounds{};
 	}
+	inline void setlimb(unsigned i, uint64_t value) {
+		if (i < nrLimbs) {
+			_limb[i] = value;
+			_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
+			return;
+		}
+		throw integer_limb_index_out_of_bounds{};
+	}
 	// use un-interpreted raw bits to set the bits of the integer
 	inline void set_raw_bits(unsigned long long value) {
 		clear();
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] = value & 0xFF;
-			value >>= 8;
-		}
+		_limb[0] = value;
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
-		b[MS_BYTE] = MS_BYTE_MASK & b[MS_BYTE];
+		_limb[MS_LIMB] &= MS_LIMB_MASK;
 	}
 	inline integer& assign(const std::string& txt) {
 		if (!parse(txt, *this)) {
 			std::cerr << "Unable to parse: " << txt << std::endl;
 		}
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
-		b[MS_BYTE] = MS_BYTE_MASK & b[MS_BYTE];
+		_limb[MS_LIMB] &= MS_LIMB_MASK;
 		return *this;
 	}
 	// pure bit copy of source integer, no sign extension
 	template<size_t src_nbits>
 	inline void bitcopy(const integer<src_nbits>& src) {
-		int lastByte = (nrBytes < src.nrBytes ? nrBytes : src.nrBytes);
+		unsigned lastLimb = (nrLimbs < src.nrLimbs ? nrLimbs : src.nrLimbs);
 		clear();
-		for (int i = 0; i < lastByte; ++i) {
-			b[i] = src.byte(i);
+		for (unsigned i = 0; i < lastLimb; ++i) {
+			_limb[i] = src.limb(i);
 		}
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
 	}
 	// in-place one's complement
 	inline integer& flip() {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] = ~b[i];
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			_limb[i] = ~_limb[i];
 		}
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		_limb[MS_LIMB] &= MS_LIMB_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
+	// in-place rotation of the nbits to the left, the bits shifted out at the top come back in at the bottom
+	inline integer& rotl(unsigned k) {
+		k %= unsigned(nbits);
+		if (k == 0) return *this;
+		integer<nbits> wrapped(*this);
+		wrapped >>= signed(nbits - k);
+		operator<<=(signed(k));
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			_limb[i] |= wrapped._limb[i];
+		}
+		return *this;
+	}
+	// in-place rotation of the nbits to the right, the bits shifted out at the bottom come back in at the top
+	inline integer& rotr(unsigned k) {
+		k %= unsigned(nbits);
+		return (k == 0 ? *this : rotl(unsigned(nbits) - k));
+	}
 
 	// selectors
 	inline bool iszero() const {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			if (b[i] != 0x00) return false;
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			if (_limb[i] != 0) return false;
 		}
 		return true;
 	}
-	inline bool sign() const { return at(nbits - 1); }
+	// the number of set bits
+	inline unsigned popcount() const {
+		unsigned count = 0;
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			count += impl::popcount64(_limb[i]);
+		}
+		return count;
+	}
+	inline bool sign() const { return ((_limb[MS_LIMB] >> ((nbits - 1) % 64)) & 1) != 0; }
 	inline bool at(unsigned int i) const {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t mask = 1 << (i % 8);
-			return (byte & mask);
+			return ((_limb[i / 64] >> (i % 64)) & 1) != 0;
 		}
 		throw "bit index out of bounds";
 	}
 	inline uint8_t byte(unsigned int i) const {
-		if (i < nrBytes) return b[i];
+		if (i < nrBytes) return uint8_t(_limb[i / 8] >> (8 * (i % 8)));
 		throw integer_byte_index_out_of_bounds{};
 	}
+	inline uint64_t limb(unsigned int i) const {
+		if (i < nrLimbs) return _limb[i];
+		throw integer_limb_index_out_of_bounds{};
+	}
 
 protected:
 	// HELPER methods
 
-	// conversion functions
-	short to_short() const {
-		constexpr unsigned sizeofshort = 8 * sizeof(short);
-		short s = 0;
-		short mask = 1;
-		unsigned upper = (nbits < sizeofshort ? nbits : sizeofshort);
-		for (unsigned i = 0; i < upper; ++i) {
-			s |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeofshort) { // sign extend
-			for (unsigned i = upper; i < sizeofshort; ++i) {
-				s |= mask;
-				mask <<= 1;
-			}
-		}
-		return s;
-	}
-	int to_int() const {
-		constexpr unsigned sizeofint = 8 * sizeof(int);
-		int value = 0;
-		int mask = 1;
-		unsigned upper = (nbits < sizeofint ? nbits : sizeofint);
-		for (unsigned i = 0; i < upper; ++i) {
-			value |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeofint) { // sign extend
-			for (unsigned i = upper; i < sizeofint; ++i) {
-				value |= mask;
-				mask <<= 1;
-			}
-		}
-		return value;
-	}
-	long to_long() const {
-		constexpr unsigned sizeoflong = 8 * sizeof(long);
-		long l = 0;
-		long mask = 1;
-		unsigned upper = (nbits < sizeoflong ? nbits : sizeoflong);
-		for (unsigned i = 0; i < upper; ++i) {
-			l |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeoflong) { // sign extend
-			for (unsigned i = upper; i < sizeoflong; ++i) {
-				l |= mask;
-				mask <<= 1;
-			}
-		}
-		return l;
-	}
+	// conversion functions: the least significant limb, sign extended when nbits is smaller than the native type
+	short to_short() const { return short(to_long_long()); }
+	int to_int() const { return int(to_long_long()); }
+	long to_long() const { return long(to_long_long()); }
 	long long to_long_long() const {
-		constexpr unsigned sizeoflonglong = 8 * sizeof(long long);
-		long long ll = 0;
-		long long mask = 1;
-		unsigned upper = (nbits < sizeoflonglong ? nbits : sizeoflonglong);
-		for (unsigned i = 0; i < upper; ++i) {
-			ll |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeoflonglong) { // sign extend
-			for (unsigned i = upper; i < sizeoflonglong; ++i) {
-				ll |= mask;
-				mask <<= 1;
-			}
-		}
-		return ll;
-	}
-	unsigned short to_ushort() const {
-		if (iszero()) return 0;
-		unsigned short us;
-		char* p = (char*)&us;
-		*p = b[0];
-		*(p + 1) = b[1];
-		return us;
-	}
-	unsigned int to_uint() const {
-		unsigned int ui;
-		char* p = (char*)&ui;
-		*p = b[0];
-		*(p + 1) = b[1];
-		*(p + 2) = b[2];
-		*(p + 3) = b[3];
-		return ui;
-	}
-	unsigned long to_ulong() const {
-		unsigned long ul = 0;
-		char* p = (char*)&ul;
-		for (int i = 0; i < nrBytes; ++i) {
-			*(p + i) = b[i];
-		}
-		return ul;
-	}
-	unsigned long long to_ulong_long() const {
-		unsigned long long ull = 0;
-		char* p = (char*)&ull;
-		for (int i = 0; i < nrBytes; ++i) {
-			*(p + i) = b[i];
-		}
-		return ull;
-	}
+		uint64_t ll = _limb[0];
+		if (nbits < 64 && sign()) ll |= ~MS_LIMB_MASK; // sign extend
+		return (long long)ll;
+	}
+	unsigned short to_ushort() const { return (unsigned short)_limb[0]; }
+	unsigned int to_uint() const { return (unsigned int)_limb[0]; }
+	unsigned long to_ulong() const { return (unsigned long)_limb[0]; }
+	unsigned long long to_ulong_long() const { return (unsigned long long)_limb[0]; }
 	float to_float() const { 
 		float f = float((long long)(*this));
 		return f; 
@@ -687,15 +1021,38 @@ protected:
 		return ld;
 	}
 
+	// truncate toward zero, and wrap the integer part modulo 2^nbits, or throw when it is outside of the range
 	template<typename Ty>
-	void float_assign(Ty& rhs) {
+	void float_assign(const Ty& rhs) {
 		clear();
-		// TODO
+		Ty magnitude = std::trunc(std::fabs(rhs));
+		if (!std::isfinite(magnitude)) {
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+			throw integer_overflow{};
+#endif
+			return;
+		}
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		Ty limit = std::ldexp(Ty(1), int(nbits) - 1);
+		if (rhs < 0 ? magnitude > limit : magnitude >= limit) throw integer_overflow{};
+#endif
+		magnitude = std::fmod(magnitude, std::ldexp(Ty(1), int(nbits)));
+		// the integer part in limbs, from the most significant: scaling by powers of 2 and the subtractions are exact
+		for (unsigned i = nrLimbs; i-- > 0; ) {
+			Ty digit = std::floor(std::ldexp(magnitude, -int(64 * i)));
+			magnitude -= std::ldexp(digit, int(64 * i));
+			_limb[i] = uint64_t(digit);
+		}
+		_limb[MS_LIMB] &= MS_LIMB_MASK;
+		// two's complement negation, which wraps the most negative value onto itself
+		if (rhs < 0) {
+			flip();
+			++(*this);
+		}
 	}
 
 private:
-	//array<uint8_t, (1 + ((nbits - 1) / 8))> bytes;
-	uint8_t b[nrBytes];
+	uint64_t _limb[nrLimbs];
 
 	// convert
 	template<size_t nnbits>
@@ -745,184 +1102,187 @@ private:
 
 	// find the most significant bit set
 	template<size_t nnbits>
-	friend signed findMsb(const integer<nnbits>& v); 
+	friend signed findMsb(const integer<nnbits>& v);
+	template<size_t nnbits>
+	friend signed findLsb(const integer<nnbits>& v);
 };
 
-// paired down implementation of a decimal type to generate decimal representations for integer<nbits> types
+// chunked and divide and conquer conversions between limbs and decimal digits
 namespace impl {
-	// Decimal representation as a set of decimal digits with sign used for creating decimal representations of the integers
-class decimal : public std::vector<uint8_t> {
+
+// 10^19, the largest power of 10 that fits a limb
+constexpr uint64_t DECIMAL_CHUNK = 10000000000000000000ull;
+constexpr size_t DECIMAL_CHUNK_DIGITS = 19;
+
+// from this number of limbs up the decimal conversions divide and conquer with the powers 10^(19 * 2^k).
+// the conversion to decimal gains from the start, as the Knuth division by a power is cheaper than the limb by
+// limb division by 10^19, but the conversion from decimal only gains once the products are Karatsuba products.
+#ifndef INTEGER_DECIMAL_DC_THRESHOLD
+#define INTEGER_DECIMAL_DC_THRESHOLD 8
+#endif
+constexpr size_t DECIMAL_DC_THRESHOLD = (INTEGER_DECIMAL_DC_THRESHOLD < 2 ? 2 : INTEGER_DECIMAL_DC_THRESHOLD);
+#ifndef INTEGER_DECIMAL_PARSE_DC_THRESHOLD
+#define INTEGER_DECIMAL_PARSE_DC_THRESHOLD (2 * INTEGER_KARATSUBA_THRESHOLD)
+#endif
+constexpr size_t DECIMAL_PARSE_DC_THRESHOLD = (INTEGER_DECIMAL_PARSE_DC_THRESHOLD < 2 ? 2 : INTEGER_DECIMAL_PARSE_DC_THRESHOLD);
+
+// the number of 19 digit chunks that hold any nbits magnitude: 10^(19c) > 2^(63c) >= 2^nbits
+constexpr size_t decimal_chunks(size_t nbits) { return (nbits + 62) / 63; }
+// the number of levels k of the powers 10^(19 * 2^k) so that 2^levels chunks hold any nbits magnitude
+constexpr size_t decimal_levels(size_t nbits, size_t levels = 0) { return ((size_t(1) << levels) >= decimal_chunks(nbits) ? levels : decimal_levels(nbits, levels + 1)); }
+// the upper bound of the limbs of a value of the given number of decimal digits
+constexpr size_t decimal_limbs(size_t digits) { return digits / DECIMAL_CHUNK_DIGITS + 2; }
+
+// the characters to_chars needs for any integer<nbits> before the leading zeros are dropped, including the sign
+constexpr size_t max_chars(size_t nbits) {
+	return ((DECIMAL_CHUNK_DIGITS << decimal_levels(nbits)) > nbits ? (DECIMAL_CHUNK_DIGITS << decimal_levels(nbits)) : nbits) + 1;
+}
+
+// the value of a digit character in the bases up to 36, and 36 for any other character
+inline int digit_value(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'z') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'Z') return c - 'A' + 10;
+	return 36;
+}
+
+inline size_t significant_limbs(const uint64_t* u, size_t n) {
+	while (n > 0 && u[n - 1] == 0) --n;
+	return n;
+}
+
+// the powers 10^(19 * 2^k), k = 0 .. levels - 1, squared one from the other once per integer size
+class decimal_powers {
 public:
-	bool sign;
-	// remove any leading zeros from a decimal representation
-	void unpad() {
-		int n = (int)size();
-		for (int i = n - 1; i > 0; --i) {
-			if (operator[](i) == 0) pop_back();
-		}
-	}
+	explicit decimal_powers(size_t levels) : _offset(levels), _size(levels) {
+		_limbs.push_back(DECIMAL_CHUNK);
+		_offset[0] = 0;
+		_size[0] = 1;
+		for (size_t k = 1; k < levels; ++k) {
+			size_t p = _size[k - 1];
+			std::vector<uint64_t> square(2 * p), scratch(multiply_scratch(p));
+			multiply_limbs(power(k - 1), power(k - 1), p, square.data(), scratch.data());
+			_offset[k] = _limbs.size();
+			_size[k] = significant_limbs(square.data(), 2 * p);
+			_limbs.insert(_limbs.end(), square.begin(), square.begin() + _size[k]);
+		}
+	}
+	const uint64_t* power(size_t k) const { return _limbs.data() + _offset[k]; }
+	size_t size(size_t k) const { return _size[k]; }
+
 private:
-	friend std::ostream& operator<<(std::ostream& ostr, const decimal& d);
+	std::vector<uint64_t> _limbs;
+	std::vector<size_t>   _offset, _size;
 };
 
-// generate an ASCII decimal format and send to ostream
-inline std::ostream& operator<<(std::ostream& ostr, const decimal& d) {
-	// to make certain that setw and left/right operators work properly
-	// we need to transform the integer into a string
-	std::stringstream ss;
-
-	//std::streamsize width = ostr.width();
-	std::ios_base::fmtflags ff;
-	ff = ostr.flags();
-	ss.flags(ff);
-	if (d.sign) ss << '-';
-	for (decimal::const_reverse_iterator rit = d.rbegin(); rit != d.rend(); ++rit) {
-		ss << (int)*rit;
+// the 19 decimal digits of a chunk < 10^19 at out[0, 19)
+inline void chunk_to_decimal(uint64_t chunk, char* out) {
+	for (size_t i = DECIMAL_CHUNK_DIGITS; i > 0; --i) {
+		out[i - 1] = char('0' + chunk % 10);
+		chunk /= 10;
 	}
-	return ostr << ss.str();
 }
-// forward reference
-void sub(decimal& lhs, const decimal& rhs);
-
-bool less(const decimal& lhs, const decimal& rhs) {
-	// this logic assumes that there is no padding in the operands
-	size_t l = lhs.size();
-	size_t r = rhs.size();
-	if (l < r) return true;
-	if (l > r) return false;
-	// numbers are the same size, need to compare magnitude
-	decimal::const_reverse_iterator ritl = lhs.rbegin();
-	decimal::const_reverse_iterator ritr = rhs.rbegin();
-	for (; ritl != lhs.rend() || ritr != rhs.rend(); ++ritl, ++ritr) {
-		if (*ritl < *ritr) return true;
-		if (*ritl > *ritr) return false;
-		// if the digits are equal we need to check the next set
-	}
-	// at this point we know the two operands are the same
-	return false;
-}
-void add(decimal& lhs, const decimal& rhs) {
-	decimal _rhs(rhs);   // is this copy necessary? I introduced it to have a place to pad
-	if (lhs.sign != rhs.sign) {  // different signs
-		_rhs.sign = !rhs.sign;
-		return sub(lhs, _rhs);
-	}
-	else {
-		// same sign implies this->negative is invariant
-	}
-	size_t l = lhs.size();
-	size_t r = _rhs.size();
-	// zero pad the shorter decimal
-	if (l < r) {
-		lhs.insert(lhs.end(), r - l, 0);
-	}
-	else {
-		_rhs.insert(_rhs.end(), l - r, 0);
-	}
-	decimal::iterator lit = lhs.begin();
-	decimal::iterator rit = _rhs.begin();
-	char carry = 0;
-	for (; lit != lhs.end() || rit != _rhs.end(); ++lit, ++rit) {
-		*lit += *rit + carry;
-		if (*lit > 9) {
-			carry = 1;
-			*lit -= 10;
-		}
-		else {
-			carry = 0;
+
+// the value of u[0, n) < 10^(19 * chunks) as exactly 19 * chunks decimal digits at out, one limb division per chunk.
+// u is overwritten with the quotients.
+inline void chunks_to_decimal(uint64_t* u, size_t n, size_t chunks, char* out) {
+	n = significant_limbs(u, n);
+	for (size_t c = chunks; c > 0; --c) {
+		uint64_t chunk = 0;
+		if (n > 0) {
+			chunk = divmod_limb(u, n, DECIMAL_CHUNK, u);
+			n = significant_limbs(u, n);
 		}
+		chunk_to_decimal(chunk, out + (c - 1) * DECIMAL_CHUNK_DIGITS);
 	}
-	if (carry) lhs.push_back(1);
 }
-void sub(decimal& lhs, const decimal& rhs) {
-	decimal _rhs(rhs);   // is this copy necessary? I introduced it to have a place to pad
-	bool sign = lhs.sign;
-	if (lhs.sign != rhs.sign) {
-		_rhs.sign = !rhs.sign;
-		return add(lhs, _rhs);
-	}
-	// largest value must be subtracted from
-	size_t l = lhs.size();
-	size_t r = _rhs.size();
-	// zero pad the shorter decimal
-	if (l < r) {
-		lhs.insert(lhs.end(), r - l, 0);
-		std::swap(lhs, _rhs);
-		sign = !sign;
-	}
-	else if (r < l) {
-		_rhs.insert(_rhs.end(), l - r, 0);
+
+// the value of u[0, n) < 10^(19 * 2^k) as exactly 19 * 2^k decimal digits at out: the quotient and the remainder
+// of the division by 10^(19 * 2^(k-1)) are the two halves of the digits. scratch holds 4n + 2^(k+1) limbs.
+inline void limbs_to_decimal(const uint64_t* u, size_t n, size_t k, const decimal_powers& powers, char* out, uint64_t* scratch) {
+	n = significant_limbs(u, n);
+	size_t width = DECIMAL_CHUNK_DIGITS << k;
+	if (k == 0 || n < DECIMAL_DC_THRESHOLD) {
+		for (size_t i = 0; i < n; ++i) scratch[i] = u[i];
+		chunks_to_decimal(scratch, n, size_t(1) << k, out);
+		return;
+	}
+	const uint64_t* p = powers.power(k - 1);
+	size_t np = powers.size(k - 1);
+	size_t half = width / 2;
+	if (n < np) {
+		for (size_t i = 0; i < half; ++i) out[i] = '0';
+		limbs_to_decimal(u, n, k - 1, powers, out + half, scratch);
+		return;
+	}
+	uint64_t* q = scratch;
+	uint64_t* r = q + (n - np + 1);
+	uint64_t* next = r + np;
+	if (np == 1) {
+		r[0] = divmod_limb(u, n, p[0], q);
 	}
 	else {
-		// the operands are the same size, thus we need to check their magnitude
-		if (less(lhs, _rhs)) {
-			std::swap(lhs, _rhs);
-			sign = !sign;
-		}
+		divmod_knuth(u, n, p, np, q, r, next);
 	}
-	decimal::iterator lit = lhs.begin();
-	decimal::iterator rit = _rhs.begin();
-	char borrow = 0;
-	for (; lit != lhs.end() || rit != _rhs.end(); ++lit, ++rit) {
-		if (*rit > *lit - borrow) {
-			*lit = 10 + *lit - borrow - *rit;
-			borrow = 1;
+	limbs_to_decimal(q, n - np + 1, k - 1, powers, out, next);
+	limbs_to_decimal(r, np, k - 1, powers, out + half, next);
+}
+
+// the value of the decimal digits [digits, digits + length) into r, one multiply-add per chunk; returns the limbs of r
+inline size_t decimal_chunks_to_limbs(const char* digits, size_t length, uint64_t* r) {
+	size_t n = 0;
+	size_t lead = length % DECIMAL_CHUNK_DIGITS;
+	for (size_t i = 0; i < length; ) {
+		size_t end = i + (i == 0 && lead > 0 ? lead : DECIMAL_CHUNK_DIGITS);
+		uint64_t chunk = 0, scale = 1;
+		for (; i < end; ++i) {
+			chunk = chunk * 10 + uint64_t(digits[i] - '0');
+			scale *= 10;
 		}
-		else {
-			*lit = *lit - borrow - *rit;
-			borrow = 0;
-		}
-	}
-	if (borrow) std::cout << "can this happen?" << std::endl;
-	lhs.unpad();
-	lhs.sign = sign;
-}
-void mul(decimal& lhs, const decimal& rhs) {
-	bool signOfFinalResult = (lhs.sign != rhs.sign) ? true : false;
-	decimal product;
-	// find the smallest decimal to minimize the amount of work
-	size_t l = lhs.size();
-	size_t r = rhs.size();
-	decimal::const_iterator sit, bit; // sit = smallest iterator, bit = biggest iterator
-	if (l < r) {
-		size_t position = 0;
-		for (sit = lhs.begin(); sit != lhs.end(); ++sit) {
-			decimal partial_sum;
-			partial_sum.insert(partial_sum.end(), r + position, 0);
-			decimal::iterator pit = partial_sum.begin() + position;
-			char carry = 0;
-			for (bit = rhs.begin(); bit != rhs.end() || pit != partial_sum.end(); ++bit, ++pit) {
-				char digit = *sit * *bit + carry;
-				*pit = digit % 10;
-				carry = digit / 10;
-			}
-			if (carry) partial_sum.push_back(carry);
-			add(product, partial_sum);
-//			std::cout << "partial sum " << partial_sum << " intermediate product " << product << std::endl;
-			++position;
+		// r = r * scale + chunk
+		uint64_t carry = chunk;
+		for (size_t j = 0; j < n; ++j) {
+			uint64_t product = 0;
+			carry = muladd(r[j], scale, product, carry);
+			r[j] = product;
 		}
+		if (carry != 0) r[n++] = carry;
+	}
+	return n;
+}
+
+// the value of the decimal digits [digits, digits + length) into r, which holds decimal_limbs(length) limbs:
+// high * 10^(19 * 2^k) + low for the low 19 * 2^k digits. scratch holds 8 decimal_limbs(length) + 64 limbs.
+// returns the limbs of r
+inline size_t decimal_to_limbs(const char* digits, size_t length, const decimal_powers& powers, size_t levels, uint64_t* r, uint64_t* scratch) {
+	if (length < DECIMAL_CHUNK_DIGITS * DECIMAL_PARSE_DC_THRESHOLD) return decimal_chunks_to_limbs(digits, length, r);
+	size_t k = 0;
+	while (k + 1 < levels && (DECIMAL_CHUNK_DIGITS << (k + 1)) < length) ++k;
+	size_t lowLength = DECIMAL_CHUNK_DIGITS << k;
+	size_t highLength = length - lowLength;
+	const uint64_t* p = powers.power(k);
+	size_t np = powers.size(k);
+	// the high part is smaller than the power as long as the high digits do not outnumber the low digits
+	if (highLength > lowLength) return decimal_chunks_to_limbs(digits, length, r);
+	uint64_t* high = scratch;
+	uint64_t* low = high + np;
+	uint64_t* product = low + np;
+	uint64_t* next = product + 2 * np;
+	for (size_t i = 0; i < 2 * np; ++i) high[i] = 0;
+	size_t nh = decimal_to_limbs(digits, highLength, powers, levels, high, next);
+	size_t nl = decimal_to_limbs(digits + highLength, lowLength, powers, levels, low, next);
+	if (2 * nh < np) {
+		// a short high part: the unbalanced schoolbook product is cheaper than the padded Karatsuba product
+		mul_schoolbook(p, np, high, nh, product);
+		for (size_t i = np + nh; i < 2 * np; ++i) product[i] = 0;
 	}
 	else {
-		size_t position = 0;
-		for (sit = rhs.begin(); sit != rhs.end(); ++sit) {
-			decimal partial_sum;
-			partial_sum.insert(partial_sum.end(), l + position, 0);
-			decimal::iterator pit = partial_sum.begin() + position;
-			char carry = 0;
-			for (bit = lhs.begin(); bit != lhs.end() || pit != partial_sum.end(); ++bit, ++pit) {
-				char digit = *sit * *bit + carry;
-				*pit = digit % 10;
-				carry = digit / 10;
-			}
-			if (carry) partial_sum.push_back(carry);
-			add(product, partial_sum);
-//			std::cout << "partial sum " << partial_sum << " intermediate product " << product << std::endl;
-			++position;
-		}
+		multiply_limbs(high, p, np, product, next);
 	}
-	product.unpad();
-	product.sign = signOfFinalResult;
-	lhs = product;
+	add_limbs(product, 2 * np, low, nl);
+	size_t n = significant_limbs(product, 2 * np);
+	for (size_t i = 0; i < n; ++i) r[i] = product[i];
+	return n;
 }
 
 } // namespace impl
@@ -936,45 +1296,155 @@ inline integer<nbits> twos_complement(const integer<nbits>& value) {
 	return complement;
 }
 
-// convert integer to decimal string
+/*
+to_chars and from_chars convert integers to and from text in caller provided buffers, like their std:: counterparts:
+base 10, or the power of two bases 2, 8, and 16 with lower case digits and no prefix, and a leading '-' for negative values.
+
+to_chars writes no terminating null character: the result points one past the last character written,
+or holds std::errc::value_too_large with ptr == last when the buffer is too small.
+from_chars consumes an optional '-' and the longest sequence of digits, and holds std::errc::invalid_argument
+with ptr == first when there are no digits, or std::errc::result_out_of_range when the value does not fit
+integer<nbits>; value is only modified on success.
+
+Decimal conversion works on 19 digit chunks, one limb division or multiply-add per chunk, and from
+INTEGER_DECIMAL_DC_THRESHOLD limbs up divides and conquers with the powers 10^(19 * 2^k).
+*/
+struct integer_to_chars_result {
+	char* ptr;
+	std::errc ec;
+};
+
+struct integer_from_chars_result {
+	const char* ptr;
+	std::errc ec;
+};
+
 template<size_t nbits>
-std::string convert_to_decimal_string(const integer<nbits>& value) {
-	if (value.iszero()) {
-		return std::string("0");
-	}
-	integer<nbits> number = value.sign() ? twos_complement(value) : value;
-	impl::decimal partial, multiplier;
-	partial.push_back(0); partial.sign = false;
-	multiplier.push_back(1); multiplier.sign = false;
-	// convert integer to decimal by adding and doubling multipliers
-	for (unsigned i = 0; i < nbits; ++i) {
-		if (number.at(i)) {
-			impl::add(partial, multiplier);
-			// std::cout << partial << std::endl;
+integer_to_chars_result to_chars(char* first, char* last, const integer<nbits>& value, int base = 10) {
+	constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+	constexpr size_t levels = impl::decimal_levels(nbits);
+	constexpr size_t maxDigits = impl::max_chars(nbits) - 1;
+	if (base != 2 && base != 8 && base != 10 && base != 16) return { last, std::errc::invalid_argument };
+
+	bool negative = value.sign();
+	integer<nbits> magnitude = (negative ? twos_complement(value) : value);
+	uint64_t u[nrLimbs];
+	for (unsigned i = 0; i < nrLimbs; ++i) u[i] = magnitude.limb(i);
+	char digits[maxDigits];
+	size_t length;
+	if (base == 10) {
+		if (nrLimbs < impl::DECIMAL_DC_THRESHOLD) {
+			length = impl::DECIMAL_CHUNK_DIGITS * impl::decimal_chunks(nbits);
+			impl::chunks_to_decimal(u, nrLimbs, impl::decimal_chunks(nbits), digits);
+		}
+		else {
+			static const impl::decimal_powers powers(levels);
+			uint64_t scratch[4 * nrLimbs + 2 * levels + 64];
+			length = impl::DECIMAL_CHUNK_DIGITS << levels;
+			impl::limbs_to_decimal(u, nrLimbs, levels, powers, digits, scratch);
 		}
-		impl::add(multiplier, multiplier);
 	}
-	std::stringstream ss;
-	if (value.sign()) ss << '-';
-	for (impl::decimal::const_reverse_iterator rit = partial.rbegin(); rit != partial.rend(); ++rit) {
-		ss << (int)*rit;
+	else {
+		unsigned bitsPerDigit = (base == 2 ? 1 : (base == 8 ? 3 : 4));
+		length = (nbits + bitsPerDigit - 1) / bitsPerDigit;
+		for (size_t i = 0; i < length; ++i) {
+			size_t bit = i * bitsPerDigit;
+			uint64_t d = u[bit / 64] >> (bit % 64);
+			if (bit % 64 + bitsPerDigit > 64 && bit / 64 + 1 < nrLimbs) d |= u[bit / 64 + 1] << (64 - bit % 64);
+			digits[length - 1 - i] = "0123456789abcdef"[d & ((1u << bitsPerDigit) - 1)];
+		}
+	}
+	const char* begin = digits;
+	const char* end = digits + length;
+	while (begin < end - 1 && *begin == '0') ++begin;
+	size_t nrChars = size_t(end - begin) + (negative ? 1 : 0);
+	if (size_t(last - first) < nrChars) return { last, std::errc::value_too_large };
+	if (negative) *first++ = '-';
+	std::memcpy(first, begin, size_t(end - begin));
+	return { first + (end - begin), std::errc() };
+}
+
+template<size_t nbits>
+integer_from_chars_result from_chars(const char* first, const char* last, integer<nbits>& value, int base = 10) {
+	constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+	constexpr size_t levels = impl::decimal_levels(nbits);
+	constexpr size_t maxDecimalDigits = impl::DECIMAL_CHUNK_DIGITS * impl::decimal_chunks(nbits);
+	constexpr size_t capacity = impl::decimal_limbs(maxDecimalDigits) > nrLimbs ? impl::decimal_limbs(maxDecimalDigits) : nrLimbs;
+	if (base != 2 && base != 8 && base != 10 && base != 16) return { first, std::errc::invalid_argument };
+
+	const char* p = first;
+	bool negative = false;
+	if (p < last && *p == '-') {
+		negative = true;
+		++p;
+	}
+	const char* begin = p;
+	while (p < last && impl::digit_value(*p) < base) ++p;
+	const char* end = p;
+	if (begin == end) return { first, std::errc::invalid_argument };
+	while (begin < end - 1 && *begin == '0') ++begin;
+	size_t length = size_t(end - begin);
+
+	uint64_t r[capacity];
+	for (size_t i = 0; i < capacity; ++i) r[i] = 0;
+	if (base == 10) {
+		if (length > maxDecimalDigits) return { end, std::errc::result_out_of_range };
+		if (nrLimbs < impl::DECIMAL_PARSE_DC_THRESHOLD) {
+			impl::decimal_chunks_to_limbs(begin, length, r);
+		}
+		else {
+			static const impl::decimal_powers powers(levels);
+			uint64_t scratch[8 * capacity + 64];
+			impl::decimal_to_limbs(begin, length, powers, levels, r, scratch);
+		}
 	}
-	return ss.str();
+	else {
+		unsigned bitsPerDigit = (base == 2 ? 1 : (base == 8 ? 3 : 4));
+		for (size_t i = 0; i < length; ++i) {
+			uint64_t d = uint64_t(impl::digit_value(end[-1 - std::ptrdiff_t(i)]));
+			if (d == 0) continue;
+			size_t bit = i * bitsPerDigit;
+			if (bit + 64 - impl::clz64(d) > nbits) return { end, std::errc::result_out_of_range };
+			r[bit / 64] |= d << (bit % 64);
+			if (bit % 64 + bitsPerDigit > 64 && bit / 64 + 1 < capacity) r[bit / 64 + 1] |= d >> (64 - bit % 64);
+		}
+	}
+	// the magnitude must fit nbits - 1 bits, or be the magnitude of the largest negative number
+	for (size_t i = nrLimbs; i < capacity; ++i) {
+		if (r[i] != 0) return { end, std::errc::result_out_of_range };
+	}
+	if ((r[nrLimbs - 1] & ~integer<nbits>::MS_LIMB_MASK) != 0) return { end, std::errc::result_out_of_range };
+	integer<nbits> magnitude;
+	for (unsigned i = 0; i < nrLimbs; ++i) magnitude.setlimb(i, r[i]);
+	if (magnitude.sign() && !(negative && magnitude == min_int<nbits>())) return { end, std::errc::result_out_of_range };
+	value = (negative ? twos_complement(magnitude) : magnitude);
+	return { end, std::errc() };
+}
+
+// convert integer to decimal string
+template<size_t nbits>
+std::string convert_to_decimal_string(const integer<nbits>& value) {
+	char buffer[impl::max_chars(nbits)];
+	integer_to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), value);
+	return std::string(buffer, result.ptr);
 }
 
 // findMsb takes an integer<nbits> reference and returns the position of the most significant bit, -1 if v == 0
 template<size_t nbits>
 inline signed findMsb(const integer<nbits>& v) {
-	for (signed i = v.nrBytes - 1; i >= 0; --i) {
-		if (v.b[i] != 0) {
-			uint8_t mask = 0x80;
-			for (signed j = 7; j >= 0; --j) {
-				if (v.b[i] & mask) {
-					return i * 8 + j;
-				}
-				mask >>= 1;
-			}
-		}
+	for (signed i = v.nrLimbs - 1; i >= 0; --i) {
+		uint64_t limb = v._limb[i];
+		if (limb != 0) return i * 64 + 63 - signed(impl::clz64(limb));
+	}
+	return -1; // no significant bit found, all bits are zero
+}
+
+// findLsb takes an integer<nbits> reference and returns the position of the least significant bit, -1 if v == 0
+template<size_t nbits>
+inline signed findLsb(const integer<nbits>& v) {
+	for (unsigned i = 0; i < v.nrLimbs; ++i) {
+		uint64_t limb = v._limb[i];
+		if (limb != 0) return signed(i * 64 + impl::ctz64(limb));
 	}
 	return -1; // no significant bit found, all bits are zero
 }
@@ -1010,60 +1480,64 @@ void remainder(const integer<nbits>& a, const integer<nbits>& b, integer<nbits>&
 }
 
 // divide integer<nbits> a and b and return result argument
+// divmod returns the quotient, truncated toward zero, and the remainder, which has the sign of the dividend, in one call
 template<size_t nbits>
-idiv_t<nbits> idiv(const integer<nbits>& _a, const integer<nbits>& _b) {
-	if (_b == integer<nbits>(0)) {
+idiv_t<nbits> divmod(const integer<nbits>& _a, const integer<nbits>& _b) {
+	constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+	idiv_t<nbits> divresult;
+	if (_b.iszero()) {
 #if INTEGER_THROW_ARITHMETIC_EXCEPTION
 		throw integer_divide_by_zero{};
 #else
 		std::cerr << "integer_divide_by_zero\n";
+		divresult.rem = _a;
+		return divresult;
 #endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
 	}
-	// generate the absolute values to do long division 
-	// 2's complement special case -max requires an signed int that is 1 bit bigger to represent abs()
+	// divide the magnitudes: the nbits unsigned bit pattern holds the magnitude of the largest negative number as well
 	bool a_negative = _a.sign();
 	bool b_negative = _b.sign();
-	bool result_negative = (a_negative ^ b_negative);
-	integer<nbits + 1> a; a.bitcopy(a_negative ? -_a : _a);
-	integer<nbits + 1> b; b.bitcopy(b_negative ? -_b : _b);
-	idiv_t<nbits> divresult;
-	if (a < b) {
-		divresult.rem = _a; // a % b = a when a / b = 0
-		return divresult; // a / b = 0 when b > a
-	}
-	// initialize the long division
-	integer<nbits + 1> accumulator = a;
-	// prepare the subtractand
-	integer<nbits + 1> subtractand = b;
-	int msb_b = findMsb(b);
-	int msb_a = findMsb(a);
-	int shift = msb_a - msb_b;
-	subtractand <<= shift;
-	// long division
-	for (int i = shift; i >= 0; --i) {
-		if (subtractand <= accumulator) {
-			accumulator -= subtractand;
-			divresult.quot.set(i);
-		}
-		else {
-			divresult.quot.reset(i);
-		}
-		subtractand >>= 1;
-	}
-	if (result_negative) {  // take 2's complement
-		divresult.quot.flip();
-		divresult.quot += 1;
-	} 
-	if (_a < integer<nbits>(0)) {
-		divresult.rem = -accumulator;
+	integer<nbits> a = (a_negative ? twos_complement(_a) : _a);
+	integer<nbits> b = (b_negative ? twos_complement(_b) : _b);
+	uint64_t u[nrLimbs], v[nrLimbs], q[nrLimbs], r[nrLimbs];
+	size_t m = 0, n = 0; // significant limbs of the dividend and the divisor
+	for (unsigned i = 0; i < nrLimbs; ++i) {
+		u[i] = a.limb(i);
+		v[i] = b.limb(i);
+		q[i] = 0;
+		r[i] = 0;
+		if (u[i] != 0) m = i + 1;
+		if (v[i] != 0) n = i + 1;
+	}
+	if (m < n) {
+		divresult.rem = _a; // |a| < |b|: a / b = 0 and a % b = a
+		return divresult;
+	}
+	if (n == 1) {
+		r[0] = impl::divmod_limb(u, m, v[0], q);
 	}
 	else {
-		divresult.rem = accumulator;
-	}
-
+		uint64_t scratch[2 * nrLimbs + 1];
+		impl::divmod_knuth(u, m, v, n, q, r, scratch);
+	}
+	for (unsigned i = 0; i < nrLimbs; ++i) {
+		divresult.quot.setlimb(i, q[i]);
+		divresult.rem.setlimb(i, r[i]);
+	}
+	if (a_negative != b_negative) divresult.quot = twos_complement(divresult.quot);
+	if (a_negative) divresult.rem = twos_complement(divresult.rem);
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+	// the quotient of two negative operands is negative only for the largest negative number divided by -1
+	if (a_negative && b_negative && divresult.quot.sign()) throw integer_overflow{};
+#endif
 	return divresult;
 }
 
+template<size_t nbits>
+idiv_t<nbits> idiv(const integer<nbits>& a, const integer<nbits>& b) {
+	return divmod(a, b);
+}
+
 /// stream operators
 
 // read a integer ASCII format and make a binary integer out of it
@@ -1144,15 +1618,8 @@ bool parse(const std::string& number, integer<nbits>& value) {
 	}
 	else if (std::regex_match(number, decimal_regex)) {
 		//std::cout << "found a decimal integer representation\n";
-		integer<nbits> scale = 1;
-		for (std::string::const_reverse_iterator r = number.rbegin();
-			r != number.rend();
-			++r) {
-			integer<nbits> digit = charLookup.at(*r);
-			value += scale * digit;
-			scale *= 10;
-		}
-		bSuccess = true;
+		integer_from_chars_result result = from_chars(number.data(), number.data() + number.size(), value);
+		bSuccess = (result.ec == std::errc());
 	}
 
 	return bSuccess;
@@ -1199,11 +1666,11 @@ inline std::string to_binary(const integer<nbits>& number) {
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // integer - integer binary logic operators
 
-// equal: precondition is that the byte-storage is properly nulled in all arithmetic paths
+// equal: precondition is that the limb storage is properly nulled in all arithmetic paths
 template<size_t nbits>
 inline bool operator==(const integer<nbits>& lhs, const integer<nbits>& rhs) {
-	for (unsigned i = 0; i < lhs.nrBytes; ++i) {
-		if (lhs.b[i] != rhs.b[i]) return false;
+	for (unsigned i = 0; i < lhs.nrLimbs; ++i) {
+		if (lhs._limb[i] != rhs._limb[i]) return false;
 	}
 	return true;
 }
@@ -1217,18 +1684,9 @@ inline bool operator< (const integer<nbits>& lhs, const integer<nbits>& rhs) {
 	bool rhs_is_negative = rhs.sign();
 	if (lhs_is_negative && !rhs_is_negative) return true;
 	if (rhs_is_negative && !lhs_is_negative) return false;
-	// arguments have the same sign
-	for (int i = nbits - 1; i >= 0; --i) {
-		bool a = lhs.at(i);
-		bool b = rhs.at(i);
-		if (a ^ b) {
-			if (a == false) {
-				return true; 
-			}
-			else {
-				return false;
-			}
-		}
+	// arguments have the same sign: the two's complement encodings order as unsigned limbs
+	for (int i = int(lhs.nrLimbs) - 1; i >= 0; --i) {
+		if (lhs._limb[i] != rhs._limb[i]) return lhs._limb[i] < rhs._limb[i];
 	}
 	return false; // lhs and rhs are the same
 }
@@ -1247,7 +1705,7 @@ inline bool operator>=(const integer<nbits>& lhs, const integer<nbits>& rhs) {
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // integer - literal binary logic operators
-// equal: precondition is that the byte-storage is properly nulled in all arithmetic paths
+// equal: precondition is that the limb storage is properly nulled in all arithmetic paths
 template<size_t nbits>
 inline bool operator==(const integer<nbits>& lhs, const long long rhs) {
 	return operator==(lhs, integer<nbits>(rhs));
@@ -1275,7 +1733,7 @@ inline bool operator>=(const integer<nbits>& lhs, const long long rhs) {
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // literal - integer binary logic operators
-// precondition is that the byte-storage is properly nulled in all arithmetic paths
+// precondition is that the limb storage is properly nulled in all arithmetic paths
 
 template<size_t nbits>
 inline bool operator==(const long long lhs, const integer<nbits>& rhs) {
@@ -1327,6 +1785,37 @@ inline integer<nbits> operator*(const integer<nbits>& lhs, const integer<nbits>&
 	mul *= rhs;
 	return mul;
 }
+// widening multiplication: the exact product of two integer<nbits> values as an integer<2*nbits>, which cannot overflow
+template<size_t nbits>
+inline integer<2 * nbits> multiply(const integer<nbits>& lhs, const integer<nbits>& rhs) {
+	constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+	// the magnitudes fit the nbits unsigned bit patterns, including the magnitude of the largest negative number
+	bool negative = (lhs.sign() != rhs.sign());
+	integer<nbits> a = (lhs.sign() ? twos_complement(lhs) : lhs);
+	integer<nbits> b = (rhs.sign() ? twos_complement(rhs) : rhs);
+	uint64_t x[nrLimbs], y[nrLimbs], product[2 * nrLimbs];
+	for (unsigned i = 0; i < nrLimbs; ++i) {
+		x[i] = a.limb(i);
+		y[i] = b.limb(i);
+	}
+	if (nrLimbs < impl::KARATSUBA_THRESHOLD) {
+		impl::mul_schoolbook(x, nrLimbs, y, nrLimbs, product);
+	}
+	else if (nrLimbs >= impl::NTT_THRESHOLD) {
+		// a square transforms its operand once
+		impl::ntt_multiply(x, nrLimbs, (&lhs == &rhs ? x : y), nrLimbs, product);
+	}
+	else {
+		uint64_t scratch[impl::multiply_scratch(nrLimbs)];
+		impl::karatsuba(x, y, nrLimbs, product, scratch);
+	}
+	// the product of the magnitudes is smaller than 2^(2*nbits - 2), so the limbs beyond integer<2*nbits> are zero
+	integer<2 * nbits> result;
+	for (unsigned i = 0; i < result.nrLimbs; ++i) {
+		result.setlimb(i, product[i]);
+	}
+	return (negative ? twos_complement(result) : result);
+}
 // BINARY DIVISION
 template<size_t nbits>
 inline integer<nbits> operator/(const integer<nbits>& lhs, const integer<nbits>& rhs) {
@@ -1401,3 +1890,6 @@ inline integer<nbits> operator%(const long long lhs, const integer<nbits>& rhs)
 
 } // namespace unum
 } // namespace sw
+
+// fast specializations of integer<nbits> for the native register widths
+#include "specializations.hpp"
@@ -5,6 +5,8 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <exception>
+#include <cmath>
+#include <vector>
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -39,6 +41,402 @@
 namespace sw {
 namespace unum {
 
+namespace impl {
+
+// -m0^-1 mod 2^64 of an odd limb m0: Newton's iteration x = x * (2 - m0 * x) doubles the correct low bits of x = m0, which has 3
+inline uint64_t montgomery_inverse(uint64_t m0) {
+	uint64_t x = m0;
+	for (int i = 0; i < 5; ++i) x *= 2 - m0 * x;
+	return 0 - x;
+}
+
+// -1, 0, or 1 when the n limb magnitude a is less than, equal to, or greater than b
+inline int compare_limbs(const uint64_t* a, const uint64_t* b, size_t n) {
+	for (size_t i = n; i > 0; --i) {
+		if (a[i - 1] != b[i - 1]) return (a[i - 1] < b[i - 1] ? -1 : 1);
+	}
+	return 0;
+}
+
+// r[0, n) = a * b / 2^(64n) mod m of a, b < m and odd m, with the coarsely integrated operand scanning of Koc, Acar, and Kaliski:
+// each limb of b adds a * b[i] and the multiple u * m of m that zeroes the low limb, which the shift of one limb then drops.
+// minv is montgomery_inverse(m[0]), t is a scratch of n + 2 limbs, and r may alias a or b
+inline void montgomery_multiply(const uint64_t* a, const uint64_t* b, const uint64_t* m, size_t n, uint64_t minv, uint64_t* r, uint64_t* t) {
+	for (size_t i = 0; i < n + 2; ++i) t[i] = 0;
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t carry = 0;
+		for (size_t j = 0; j < n; ++j) carry = muladd(a[j], b[i], t[j], carry);
+		unsigned char c = 0;
+		t[n] = addcarry(t[n], carry, c);
+		t[n + 1] = c;
+		uint64_t u = t[0] * minv;
+		uint64_t low = t[0];
+		carry = muladd(u, m[0], low, 0);
+		for (size_t j = 1; j < n; ++j) {
+			uint64_t limb = t[j];
+			carry = muladd(u, m[j], limb, carry);
+			t[j - 1] = limb;
+		}
+		c = 0;
+		t[n - 1] = addcarry(t[n], carry, c);
+		t[n] = t[n + 1] + c;
+	}
+	// t < 2m, and a carry into limb n is cancelled by the borrow of the subtraction
+	if (t[n] != 0 || compare_limbs(t, m, n) >= 0) sub_limbs(t, n, m, n);
+	for (size_t i = 0; i < n; ++i) r[i] = t[i];
+}
+
+} // namespace impl
+
+// greatest common divisor of the magnitudes of a and b, gcd(0, 0) = 0, and the magnitude 2^(nbits-1) of two largest negative numbers wraps
+// binary gcd of Stein: shifts and subtractions replace the divisions of Euclid's algorithm
+template<size_t nbits>
+integer<nbits> gcd(const integer<nbits>& a, const integer<nbits>& b) {
+	// the magnitudes as unsigned bit patterns: the magnitude of the largest negative number is 2^(nbits-1)
+	integer<nbits> u = (a.sign() ? twos_complement(a) : a);
+	integer<nbits> v = (b.sign() ? twos_complement(b) : b);
+	if (u.iszero()) return v;
+	if (v.iszero()) return u;
+	signed uz = findLsb(u), vz = findLsb(v);
+	signed k = (uz < vz ? uz : vz);
+	u >>= uz;
+	do {
+		v >>= findLsb(v);
+		// both odd, and below 2^(nbits-1): the difference is even, and the gcd of the smaller and the difference is the gcd of both
+		if (v < u) std::swap(u, v);
+		v -= u;
+	} while (!v.iszero());
+	u <<= k;
+	return u;
+}
+
+// least common multiple of the magnitudes of a and b, lcm(0, b) = 0
+template<size_t nbits>
+integer<nbits> lcm(const integer<nbits>& a, const integer<nbits>& b) {
+	if (a.iszero() || b.iszero()) return integer<nbits>(0);
+	integer<nbits> u = (a.sign() ? twos_complement(a) : a);
+	integer<nbits> v = (b.sign() ? twos_complement(b) : b);
+	return (u / gcd(u, v)) * v;
+}
+
+// integer square root floor(sqrt(a)) of a non-negative a
+// Newton's iteration x = (x + a / x) / 2 decreases to floor(sqrt(a)) from the double precision root of the leading bits of a
+template<size_t nbits>
+integer<nbits> isqrt(const integer<nbits>& a) {
+	if (a.sign()) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+		throw integer_negative_sqrt_arg{};
+#else
+		std::cerr << "integer_negative_sqrt_arg\n";
+		return integer<nbits>(0);
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+	}
+	signed msb = findMsb(a);
+	if (msb < 0) return a;
+	// the leading 62 bits of a at an even shift s, and a start above the root: the double root is within one of the exact root
+	unsigned s = (msb > 61 ? unsigned(msb - 61) : 0u);
+	s += (s & 1);
+	integer<nbits> t(a);
+	t >>= signed(s);
+	integer<nbits> x((unsigned long long)std::sqrt(double(t.limb(0))) + (s > 0 ? 2ull : 1ull));
+	x <<= signed(s / 2);
+	for (;;) {
+		integer<nbits> y = x + a / x;
+		y >>= 1;
+		if (!(y < x)) return x;
+		x = y;
+	}
+}
+
+/*
+montgomery<nbits> holds the constants of the Montgomery multiplication modulo an odd modulus m > 1. With R = 2^(64n),
+and n the number of significant limbs of m, the Montgomery form of x is x * R mod m, and the product of the forms of
+x and y reduces to the form of x * y with limb multiplies and shifts, without a division. The powers of a fixed modulus
+stay in the Montgomery domain, and pay for the conversions only once.
+*/
+template<size_t nbits>
+class montgomery {
+public:
+	static constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+
+	explicit montgomery(const integer<nbits>& modulus) : _modulus(modulus), _n(0) {
+		if (modulus.sign() || !modulus.at(0) || modulus == integer<nbits>(1)) throw integer_even_modulus{};
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			_m[i] = modulus.limb(i);
+			if (_m[i] != 0) _n = i + 1;
+		}
+		_minv = impl::montgomery_inverse(_m[0]);
+		// R^2 mod m by 128n modular doublings of 1, which stay below 2m
+		integer<nbits + 1> r2(1), m;
+		m.bitcopy(modulus);
+		for (size_t i = 0; i < 128 * _n; ++i) {
+			r2 <<= 1;
+			if (!(r2 < m)) r2 -= m;
+		}
+		for (unsigned i = 0; i < nrLimbs; ++i) _r2[i] = r2.limb(i);
+	}
+
+	// the Montgomery form x * R mod m of x, of any sign
+	integer<nbits> to_montgomery(const integer<nbits>& x) const {
+		uint64_t a[nrLimbs], t[nrLimbs + 2];
+		load(reduce(x), a);
+		impl::montgomery_multiply(a, _r2, _m, _n, _minv, a, t);
+		return store(a);
+	}
+	// the value x / R mod m of the Montgomery form x
+	integer<nbits> from_montgomery(const integer<nbits>& x) const {
+		uint64_t a[nrLimbs], one[nrLimbs], t[nrLimbs + 2];
+		load(x, a);
+		unit(one);
+		impl::montgomery_multiply(a, one, _m, _n, _minv, a, t);
+		return store(a);
+	}
+	// the Montgomery form of x * y of the Montgomery forms of x and y
+	integer<nbits> multiply(const integer<nbits>& x, const integer<nbits>& y) const {
+		uint64_t a[nrLimbs], b[nrLimbs], t[nrLimbs + 2];
+		load(x, a);
+		load(y, b);
+		impl::montgomery_multiply(a, b, _m, _n, _minv, a, t);
+		return store(a);
+	}
+	// base^exponent mod m of a non-negative exponent, with fixed windows of 4 bits of the exponent
+	integer<nbits> power(const integer<nbits>& base, const integer<nbits>& exponent) const {
+		if (exponent.sign()) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+			throw integer_negative_exponent{};
+#else
+			std::cerr << "integer_negative_exponent\n";
+			return integer<nbits>(0);
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+		}
+		signed msb = findMsb(exponent);
+		if (msb < 0) return integer<nbits>(1);
+		// the Montgomery forms of base^d for the digits d of the windows
+		std::vector<uint64_t> table(16 * size_t(_n));
+		uint64_t acc[nrLimbs], t[nrLimbs + 2];
+		unit(acc);
+		impl::montgomery_multiply(acc, _r2, _m, _n, _minv, &table[0], t);
+		load(to_montgomery(base), acc);
+		for (size_t i = 0; i < _n; ++i) table[_n + i] = acc[i];
+		for (size_t d = 2; d < 16; ++d) impl::montgomery_multiply(&table[(d - 1) * _n], &table[_n], _m, _n, _minv, &table[d * _n], t);
+		// the windows are aligned on multiples of 4 bits, and never straddle two limbs
+		for (signed window = msb / 4; window >= 0; --window) {
+			unsigned bit = unsigned(4 * window);
+			size_t digit = size_t((exponent.limb(bit / 64) >> (bit % 64)) & 0xF);
+			if (window == msb / 4) {
+				for (size_t i = 0; i < _n; ++i) acc[i] = table[digit * _n + i];
+				continue;
+			}
+			for (int i = 0; i < 4; ++i) impl::montgomery_multiply(acc, acc, _m, _n, _minv, acc, t);
+			if (digit) impl::montgomery_multiply(acc, &table[digit * _n], _m, _n, _minv, acc, t);
+		}
+		return from_montgomery(store(acc));
+	}
+
+	const integer<nbits>& modulus() const { return _modulus; }
+
+private:
+	integer<nbits> _modulus;
+	size_t         _n;
+	uint64_t       _minv;
+	uint64_t       _m[nrLimbs];
+	uint64_t       _r2[nrLimbs];
+
+	// x mod m in [0, m)
+	integer<nbits> reduce(const integer<nbits>& x) const {
+		integer<nbits> r = x % _modulus;
+		if (r.sign()) r += _modulus;
+		return r;
+	}
+	void load(const integer<nbits>& x, uint64_t* a) const {
+		for (unsigned i = 0; i < nrLimbs; ++i) a[i] = x.limb(i);
+	}
+	integer<nbits> store(const uint64_t* a) const {
+		integer<nbits> x;
+		for (unsigned i = 0; i < nrLimbs; ++i) x.setlimb(i, a[i]);
+		return x;
+	}
+	void unit(uint64_t* a) const {
+		for (unsigned i = 0; i < nrLimbs; ++i) a[i] = 0;
+		a[0] = 1;
+	}
+};
+
+// modular exponentiation base^exponent mod |modulus| in [0, |modulus|) of a non-negative exponent
+// odd moduli use Montgomery multiplication, even moduli the remainders of the products in twice the width
+template<size_t nbits>
+integer<nbits> powmod(const integer<nbits>& base, const integer<nbits>& exponent, const integer<nbits>& modulus) {
+	if (modulus.iszero()) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+		throw integer_divide_by_zero{};
+#else
+		std::cerr << "integer_divide_by_zero\n";
+		return integer<nbits>(0);
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+	}
+	if (exponent.sign()) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+		throw integer_negative_exponent{};
+#else
+		std::cerr << "integer_negative_exponent\n";
+		return integer<nbits>(0);
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+	}
+	integer<nbits> m = (modulus.sign() ? twos_complement(modulus) : modulus);
+	if (m == integer<nbits>(1)) return integer<nbits>(0);
+	if (m.at(0) && !m.sign()) return montgomery<nbits>(m).power(base, exponent);
+	// the residues as unsigned bit patterns in twice the width, so that their products are exact
+	integer<2 * nbits> wm, power, result(1);
+	wm.bitcopy(m);
+	power.bitcopy(base);
+	if (base.sign()) for (unsigned i = nbits; i < 2 * nbits; ++i) power.set(i);
+	power %= wm;
+	if (power.sign()) power += wm;
+	signed msb = findMsb(exponent);
+	for (signed i = 0; i <= msb; ++i) {
+		if (exponent.at(unsigned(i))) result = (result * power) % wm;
+		if (i < msb) power = (power * power) % wm;
+	}
+	integer<nbits> r;
+	r.bitcopy(result);
+	return r;
+}
+
+// the factorials 0!, 1!, ... that are within the range of integer<nbits>, computed once
+template<size_t nbits>
+const std::vector< integer<nbits> >& factorial_table() {
+	static const std::vector< integer<nbits> > table = []() {
+		std::vector< integer<nbits> > t(1, integer<nbits>(1));
+		for (;;) {
+			integer<2 * nbits> next = multiply(t.back(), integer<nbits>((unsigned long long)t.size()));
+			if (findMsb(next) >= signed(nbits) - 1) break;
+			integer<nbits> v;
+			v.bitcopy(next);
+			t.push_back(v);
+		}
+		return t;
+	}();
+	return table;
+}
+
+namespace impl {
+
+// the value of a non-negative integer as an index into a table of the given size, or the size when it is out of range
+template<size_t nbits>
+size_t table_index(const integer<nbits>& n, size_t size) {
+	if (findMsb(n) >= 32) return size;
+	unsigned long long index = (unsigned long long)n;
+	return (index < size ? size_t(index) : size);
+}
+
+// (n over j) modulo 2^nbits of 0 <= j <= n: the odd parts of the factors n, n - 1, ..., n - j + 1 of the numerator and
+// of the factors 1, 2, ..., j of the denominator are invertible modulo 2^nbits, and their factors of two are counted apart,
+// so that the multiplicative formula takes j steps for any width of n
+template<size_t nbits>
+integer<nbits> wrapped_binomial(const integer<nbits>& n, const integer<nbits>& j) {
+	integer<nbits> numerator(1), denominator(1);
+	long long twos = 0;
+	for (integer<nbits> i(0); i < j; ++i) {
+		integer<nbits> a = n - i, b = i + 1;
+		signed za = findLsb(a), zb = findLsb(b);
+		a >>= za;
+		b >>= zb;
+		twos += za - zb;
+		numerator *= a;
+		denominator *= b;
+	}
+	if (twos >= (long long)nbits) return integer<nbits>(0);
+	// the inverse of the odd denominator by Newton's iteration x = x * (2 - d * x), which doubles the correct low bits:
+	// an odd d is its own inverse modulo 8
+	integer<nbits> inverse(denominator);
+	for (size_t bits = 3; bits < nbits; bits *= 2) inverse *= integer<nbits>(2) - denominator * inverse;
+	integer<nbits> c = numerator * inverse;
+	c <<= signed(twos);
+	return c;
+}
+
+} // namespace impl
+
+// n! of a non-negative n, a lookup when n! is in the range of integer<nbits>: the empty product 1 for n < 2
+// a larger n! throws integer_overflow when INTEGER_THROW_OVERFLOW_EXCEPTION is set, and wraps around modulo 2^nbits otherwise
+template<size_t nbits>
+integer<nbits> factorial(const integer<nbits>& n) {
+	const std::vector< integer<nbits> >& table = factorial_table<nbits>();
+	if (n.sign()) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+		throw integer_negative_factorial_arg{};
+#else
+		std::cerr << "integer_negative_factorial_arg\n";
+		return integer<nbits>(0);
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+	}
+	size_t index = impl::table_index(n, table.size());
+	if (index < table.size()) return table[index];
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+	throw integer_overflow{};
+#else
+	// the wrapped product is zero once it holds nbits factors of two
+	unsigned long long last = (findMsb(n) >= 64 ? ~0ull : (unsigned long long)n);
+	integer<nbits> v = table.back();
+	for (unsigned long long i = table.size(); i <= last && !v.iszero(); ++i) v *= integer<nbits>(i);
+	return v;
+#endif // INTEGER_THROW_OVERFLOW_EXCEPTION
+}
+
+// binomial coefficient (n over k) of a non-negative n, and 0 when k < 0 or k > n
+// the quotient of the factorial table when n! is in range, and the exact multiplicative formula in twice the width otherwise
+// a result outside of the range of integer<nbits> throws integer_overflow when INTEGER_THROW_OVERFLOW_EXCEPTION is set,
+// and wraps around modulo 2^nbits otherwise, like the sums of Pascal's triangle: both take min(k, n - k) steps
+template<size_t nbits>
+integer<nbits> binomial(const integer<nbits>& n, const integer<nbits>& k) {
+	if (n.sign() || k.sign() || n < k) return integer<nbits>(0);
+	integer<nbits> j = n - k;
+	if (k < j) j = k;
+	const std::vector< integer<nbits> >& table = factorial_table<nbits>();
+	size_t nindex = impl::table_index(n, table.size());
+	if (nindex < table.size()) {
+		size_t jindex = impl::table_index(j, table.size());
+		return table[nindex] / (table[jindex] * table[nindex - jindex]);
+	}
+	// (n over i + 1) = (n over i) * (n - i) / (i + 1) is exact, and (n over i) <= (n over j) for i <= j <= n / 2
+	integer<nbits> c(1);
+	for (integer<nbits> i(0); i < j; ++i) {
+		integer<2 * nbits> w = multiply(c, n - i), d;
+		d.bitcopy(i + 1);
+		w /= d;
+		if (findMsb(w) >= signed(nbits) - 1) {
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+			throw integer_overflow{};
+#else
+			return impl::wrapped_binomial(n, j);
+#endif // INTEGER_THROW_OVERFLOW_EXCEPTION
+		}
+		c.bitcopy(w);
+	}
+	return c;
+}
 
 } // namespace unum
 } // namespace sw
+
+namespace sw {
+namespace function {
+
+// the integer<nbits> overloads of the generic factorial and binomial functions look up the factorial table of integer<nbits>
+template<size_t nbits>
+sw::unum::integer<nbits> factorial(const sw::unum::integer<nbits>& n) {
+	return sw::unum::factorial(n);
+}
+
+template<size_t nbits>
+sw::unum::integer<nbits> factoriali(const sw::unum::integer<nbits>& n) {
+	return sw::unum::factorial(n);
+}
+
+template<size_t nbits>
+sw::unum::integer<nbits> BinomialCoefficient(const sw::unum::integer<nbits>& n, const sw::unum::integer<nbits>& k) {
+	return sw::unum::binomial(n, k);
+}
+
+}  // namespace function
+}  // namespace sw
@@ -0,0 +1,29 @@
+#pragma once
+// specializations.hpp: header to include and configure any integer specializations
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// enable fast implementations of the integers of the native register widths
+// INTEGER_FAST_SPECIALIZATION when set will turn on all fast implementations
+// Each implementation defines a macro INTEGER_FAST_INTEGER_`nbits`,
+// and includes the fast implementation if set to 1.
+// For example, INTEGER_FAST_INTEGER_32, when set to 1, will enable the fast implementation of integer<32>.
+// The individual INTEGER_FAST_### macros enable fine grain control over which configurations
+// use fast code.
+#ifdef INTEGER_FAST_SPECIALIZATION
+#define INTEGER_FAST_INTEGER_8   1
+#define INTEGER_FAST_INTEGER_16  1
+#define INTEGER_FAST_INTEGER_32  1
+#define INTEGER_FAST_INTEGER_64  1
+#define INTEGER_FAST_INTEGER_128 1
+#endif
+
+// fast specializations for the native register widths
+#include "specialized/native_integer.hpp"
+#include "specialized/integer_8.hpp"
+#include "specialized/integer_16.hpp"
+#include "specialized/integer_32.hpp"
+#include "specialized/integer_64.hpp"
+#include "specialized/integer_128.hpp"
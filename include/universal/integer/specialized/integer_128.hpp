@@ -0,0 +1,26 @@
+#pragma once
+// integer_128.hpp: specialized 128-bit integer that computes in a native __int128 register pair
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+// the 128-bit native integer is a GCC and Clang extension: other compilers use the limb implementation
+#if INTEGER_FAST_INTEGER_128 && defined(__SIZEOF_INT128__)
+#pragma message("Fast specialization of integer<128>")
+
+	// fast specialized integer<128>
+	template<>
+	class integer<128> : public native_integer<128, native_int128, native_uint128> {
+	public:
+		using native_integer<128, native_int128, native_uint128>::native_integer;
+		using native_integer<128, native_int128, native_uint128>::operator=;
+	};
+
+#endif // INTEGER_FAST_INTEGER_128
+
+} // namespace unum
+} // namespace sw
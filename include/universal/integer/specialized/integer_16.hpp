@@ -0,0 +1,25 @@
+#pragma once
+// integer_16.hpp: specialized 16-bit integer that computes in a native int16_t register
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if INTEGER_FAST_INTEGER_16
+#pragma message("Fast specialization of integer<16>")
+
+	// fast specialized integer<16>
+	template<>
+	class integer<16> : public native_integer<16, int16_t, uint16_t> {
+	public:
+		using native_integer<16, int16_t, uint16_t>::native_integer;
+		using native_integer<16, int16_t, uint16_t>::operator=;
+	};
+
+#endif // INTEGER_FAST_INTEGER_16
+
+} // namespace unum
+} // namespace sw
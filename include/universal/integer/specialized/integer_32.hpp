@@ -0,0 +1,25 @@
+#pragma once
+// integer_32.hpp: specialized 32-bit integer that computes in a native int32_t register
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if INTEGER_FAST_INTEGER_32
+#pragma message("Fast specialization of integer<32>")
+
+	// fast specialized integer<32>
+	template<>
+	class integer<32> : public native_integer<32, int32_t, uint32_t> {
+	public:
+		using native_integer<32, int32_t, uint32_t>::native_integer;
+		using native_integer<32, int32_t, uint32_t>::operator=;
+	};
+
+#endif // INTEGER_FAST_INTEGER_32
+
+} // namespace unum
+} // namespace sw
@@ -0,0 +1,25 @@
+#pragma once
+// integer_64.hpp: specialized 64-bit integer that computes in a native int64_t register
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if INTEGER_FAST_INTEGER_64
+#pragma message("Fast specialization of integer<64>")
+
+	// fast specialized integer<64>
+	template<>
+	class integer<64> : public native_integer<64, int64_t, uint64_t> {
+	public:
+		using native_integer<64, int64_t, uint64_t>::native_integer;
+		using native_integer<64, int64_t, uint64_t>::operator=;
+	};
+
+#endif // INTEGER_FAST_INTEGER_64
+
+} // namespace unum
+} // namespace sw
@@ -0,0 +1,25 @@
+#pragma once
+// integer_8.hpp: specialized 8-bit integer that computes in a native int8_t register
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if INTEGER_FAST_INTEGER_8
+#pragma message("Fast specialization of integer<8>")
+
+	// fast specialized integer<8>
+	template<>
+	class integer<8> : public native_integer<8, int8_t, uint8_t> {
+	public:
+		using native_integer<8, int8_t, uint8_t>::native_integer;
+		using native_integer<8, int8_t, uint8_t>::operator=;
+	};
+
+#endif // INTEGER_FAST_INTEGER_8
+
+} // namespace unum
+} // namespace sw
@@ -0,0 +1,414 @@
+#pragma once
+// native_integer.hpp: implementation of the integer<nbits> specializations that compute in a native integer register
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+
+namespace sw {
+namespace unum {
+
+/*
+native_integer is the implementation of the specializations of integer<nbits> for the register widths 8, 16, 32, 64, and 128.
+The value is held in the native signed integer type Native, so that the operators compile down to single machine instructions,
+and the behavior is that of the limb implementation of integer<nbits>: two's complement arithmetic modulo 2^nbits,
+logical right shifts, and the same bit, byte, and limb accessors. The modulo arithmetic is carried out in the unsigned
+type Bits, or its integer promotion, which wrap around without undefined behavior.
+
+A specialization derives from native_integer<nbits, Native, Bits>, and inherits its constructors and assignment operators.
+The operators of native_integer return the specialization integer<nbits>, and the free functions that need the storage,
+the comparisons, findMsb, findLsb, and divmod, are non-template friends that overload resolution prefers over the templates.
+*/
+template<size_t _nbits, typename Native, typename Bits>
+class native_integer {
+	typedef integer<_nbits> Integer;
+	// the unsigned type of the arithmetic: the integer promotion of Bits, so that 8 and 16 bit operands do not promote to signed int
+	typedef decltype(Bits(0) + 0u) Arithmetic;
+public:
+	static constexpr size_t nbits = _nbits;
+	static constexpr unsigned nrBytes = (1 + ((nbits - 1) / 8));
+	static constexpr unsigned nrLimbs = (1 + ((nbits - 1) / 64));
+	static constexpr unsigned MS_LIMB = nrLimbs - 1;
+	static constexpr uint64_t MS_LIMB_MASK = (0xFFFFFFFFFFFFFFFFull >> (nrLimbs * 64 - nbits));
+
+	native_integer() : _value(0) {}
+
+	/// Construct a new integer from another: the same precondition as the limb implementation
+	template<size_t srcbits>
+	native_integer(const integer<srcbits>& a) {
+		static_assert(srcbits > nbits, "Source integer is bigger than target: potential loss of precision"); // TODO: do we want this?
+		bitcopy(a);
+	}
+
+	// initializers for native types
+	native_integer(const signed char initial_value) { *this = initial_value; }
+	native_integer(const short initial_value) { *this = initial_value; }
+	native_integer(const int initial_value) { *this = initial_value; }
+	native_integer(const long initial_value) { *this = initial_value; }
+	native_integer(const long long initial_value) { *this = initial_value; }
+	native_integer(const char initial_value) { *this = initial_value; }
+	native_integer(const unsigned short initial_value) { *this = initial_value; }
+	native_integer(const unsigned int initial_value) { *this = initial_value; }
+	native_integer(const unsigned long initial_value) { *this = initial_value; }
+	native_integer(const unsigned long long initial_value) { *this = initial_value; }
+	native_integer(const float initial_value) { *this = initial_value; }
+	native_integer(const double initial_value) { *this = initial_value; }
+	native_integer(const long double initial_value) { *this = initial_value; }
+
+	// assignment operators for native types: the signed types sign extend and the unsigned types zero extend from 64 bits
+	Integer& operator=(const signed char rhs) { return signed_assign(rhs); }
+	Integer& operator=(const short rhs) { return signed_assign(rhs); }
+	Integer& operator=(const int rhs) { return signed_assign(rhs); }
+	Integer& operator=(const long rhs) { return signed_assign(rhs); }
+	Integer& operator=(const long long rhs) { return signed_assign(rhs); }
+	Integer& operator=(const char rhs) { return unsigned_assign(uint64_t(rhs)); }
+	Integer& operator=(const unsigned short rhs) { return unsigned_assign(rhs); }
+	Integer& operator=(const unsigned int rhs) { return unsigned_assign(rhs); }
+	Integer& operator=(const unsigned long rhs) { return unsigned_assign(rhs); }
+	Integer& operator=(const unsigned long long rhs) { return unsigned_assign(rhs); }
+	Integer& operator=(const float rhs) { return float_assign(rhs); }
+	Integer& operator=(const double rhs) { return float_assign(rhs); }
+	Integer& operator=(const long double rhs) { return float_assign(rhs); }
+
+	// prefix operators
+	Integer operator-() const {
+		Integer negated;
+		negated -= self();
+		return negated;
+	}
+	// one's complement
+	Integer operator~() const {
+		Integer complement(self());
+		complement.flip();
+		return complement;
+	}
+	// increment
+	Integer operator++(int) {
+		Integer tmp(self());
+		operator++();
+		return tmp;
+	}
+	Integer& operator++() {
+		_value = wrap(bits() + 1u);
+		return self();
+	}
+	// decrement
+	Integer operator--(int) {
+		Integer tmp(self());
+		operator--();
+		return tmp;
+	}
+	Integer& operator--() {
+		_value = wrap(bits() - 1u);
+		return self();
+	}
+	// conversion operators
+	explicit operator unsigned short() const { return (unsigned short)Bits(_value); }
+	explicit operator unsigned int() const { return (unsigned int)Bits(_value); }
+	explicit operator unsigned long() const { return (unsigned long)Bits(_value); }
+	explicit operator unsigned long long() const { return (unsigned long long)Bits(_value); }
+	explicit operator short() const { return short(to_long_long()); }
+	explicit operator int() const { return int(to_long_long()); }
+	explicit operator long() const { return long(to_long_long()); }
+	explicit operator long long() const { return to_long_long(); }
+	explicit operator float() const { return float(to_long_long()); }
+	explicit operator double() const { return double(to_long_long()); }
+	explicit operator long double() const { return (long double)(to_long_long()); }
+
+	// arithmetic operators
+	Integer& operator+=(const Integer& rhs) {
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		if (add_overflow(_value, rhs._value, _value)) throw integer_overflow{};
+#else
+		_value = wrap(bits() + rhs.bits());
+#endif
+		return self();
+	}
+	Integer& operator-=(const Integer& rhs) {
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		if (sub_overflow(_value, rhs._value, _value)) throw integer_overflow{};
+#else
+		_value = wrap(bits() - rhs.bits());
+#endif
+		return self();
+	}
+	Integer& operator*=(const Integer& rhs) {
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		if (mul_overflow(_value, rhs._value, _value)) throw integer_overflow{};
+#else
+		_value = wrap(bits() * rhs.bits());
+#endif
+		return self();
+	}
+	Integer& operator/=(const Integer& rhs) {
+		idiv_t<nbits> divresult = divmod(self(), rhs);
+		_value = divresult.quot._value;
+		return self();
+	}
+	Integer& operator%=(const Integer& rhs) {
+		idiv_t<nbits> divresult = divmod(self(), rhs);
+		_value = divresult.rem._value;
+		return self();
+	}
+	Integer& operator<<=(const signed shift) {
+		if (shift == 0) return self();
+		if (shift < 0) return operator>>=(-shift);
+		if (nbits <= unsigned(shift)) {
+			clear();
+			return self();
+		}
+		_value = wrap(bits() << shift);
+		return self();
+	}
+	// logical shift right, like the limb implementation
+	Integer& operator>>=(const signed shift) {
+		if (shift == 0) return self();
+		if (shift < 0) return operator<<=(-shift);
+		if (nbits <= unsigned(shift)) {
+			clear();
+			return self();
+		}
+		_value = wrap(bits() >> shift);
+		return self();
+	}
+
+	// modifiers
+	inline void clear() { _value = 0; }
+	inline void setzero() { clear(); }
+	inline void set(unsigned int i) {
+		if (i < nbits) {
+			_value = wrap(bits() | (Arithmetic(1) << i));
+			return;
+		}
+		throw "integer<nbits> bit index out of bounds";
+	}
+	inline void reset(unsigned int i) {
+		if (i < nbits) {
+			_value = wrap(bits() & ~(Arithmetic(1) << i));
+			return;
+		}
+		throw "integer<nbits> bit index out of bounds";
+	}
+	inline void set(unsigned i, bool v) {
+		if (i < nbits) {
+			Arithmetic mask = (Arithmetic(1) << i);
+			_value = wrap(v ? (bits() | mask) : (bits() & ~mask));
+			return;
+		}
+		throw "integer<nbits> bit index out of bounds";
+	}
+	inline void setbyte(unsigned i, uint8_t value) {
+		if (i < nrBytes) {
+			unsigned shift = 8 * i;
+			_value = wrap((bits() & ~(Arithmetic(0xFF) << shift)) | (Arithmetic(value) << shift));
+			return;
+		}
+		throw integer_byte_index_out_of_bounds{};
+	}
+	inline void setlimb(unsigned i, uint64_t value) {
+		if (i < nrLimbs) {
+			// the bits of value above nbits are dropped, like the nulling of the most significant limb
+			unsigned shift = 64 * i;
+			_value = wrap((bits() & ~(Arithmetic(0xFFFFFFFFFFFFFFFFull) << shift)) | (Arithmetic(value) << shift));
+			return;
+		}
+		throw integer_limb_index_out_of_bounds{};
+	}
+	// use un-interpreted raw bits to set the bits of the integer
+	inline void set_raw_bits(unsigned long long value) {
+		_value = wrap(Arithmetic(uint64_t(value)));
+	}
+	inline Integer& assign(const std::string& txt) {
+		if (!parse(txt, self())) {
+			std::cerr << "Unable to parse: " << txt << std::endl;
+		}
+		return self();
+	}
+	// pure bit copy of source integer, no sign extension
+	template<size_t src_nbits>
+	inline void bitcopy(const integer<src_nbits>& src) {
+		unsigned lastLimb = (nrLimbs < src.nrLimbs ? nrLimbs : src.nrLimbs);
+		clear();
+		for (unsigned i = 0; i < lastLimb; ++i) {
+			setlimb(i, src.limb(i));
+		}
+	}
+	// in-place one's complement
+	inline Integer& flip() {
+		_value = wrap(~bits());
+		return self();
+	}
+	// in-place rotation of the nbits to the left, the bits shifted out at the top come back in at the bottom
+	inline Integer& rotl(unsigned k) {
+		k %= unsigned(nbits);
+		if (k == 0) return self();
+		_value = wrap((bits() << k) | (bits() >> (nbits - k)));
+		return self();
+	}
+	// in-place rotation of the nbits to the right, the bits shifted out at the bottom come back in at the top
+	inline Integer& rotr(unsigned k) {
+		k %= unsigned(nbits);
+		return (k == 0 ? self() : rotl(unsigned(nbits) - k));
+	}
+
+	// selectors
+	inline bool iszero() const { return _value == 0; }
+	// the number of set bits
+	inline unsigned popcount() const {
+		unsigned count = 0;
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			count += impl::popcount64(limb_bits(i));
+		}
+		return count;
+	}
+	inline bool sign() const { return _value < 0; }
+	inline bool at(unsigned int i) const {
+		if (i < nbits) {
+			return ((bits() >> i) & 1u) != 0;
+		}
+		throw "bit index out of bounds";
+	}
+	inline uint8_t byte(unsigned int i) const {
+		if (i < nrBytes) return uint8_t(bits() >> (8 * i));
+		throw integer_byte_index_out_of_bounds{};
+	}
+	inline uint64_t limb(unsigned int i) const {
+		if (i < nrLimbs) return limb_bits(i);
+		throw integer_limb_index_out_of_bounds{};
+	}
+
+protected:
+	// HELPER methods
+	Integer& self() { return static_cast<Integer&>(*this); }
+	const Integer& self() const { return static_cast<const Integer&>(*this); }
+
+	// the bit pattern of the value in the arithmetic type, and the value of an arithmetic result modulo 2^nbits
+	Arithmetic bits() const { return Arithmetic(Bits(_value)); }
+	static Native wrap(Arithmetic v) { return Native(Bits(v)); }
+	uint64_t limb_bits(unsigned i) const { return uint64_t(bits() >> (64 * i)); }
+
+	Integer& signed_assign(int64_t rhs) {
+		_value = Native(Bits(rhs));
+		return self();
+	}
+	Integer& unsigned_assign(uint64_t rhs) {
+		_value = Native(Bits(rhs));
+		return self();
+	}
+	// truncate toward zero, and reduce modulo 2^nbits like the arithmetic: NaN and the infinities have no integer value
+	template<typename Ty>
+	Integer& float_assign(const Ty& rhs) {
+		Ty magnitude = std::trunc(std::fabs(rhs));
+		if (!std::isfinite(magnitude)) {
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+			throw integer_overflow{};
+#endif
+			_value = 0;
+			return self();
+		}
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+		Ty limit = std::ldexp(Ty(1), int(nbits) - 1);
+		if (rhs < 0 ? magnitude > limit : magnitude >= limit) throw integer_overflow{};
+#endif
+		magnitude = std::fmod(magnitude, std::ldexp(Ty(1), int(nbits)));
+		// the integer part in 64-bit digits, from the most significant: scaling by powers of 2 and the subtractions are exact
+		Arithmetic v = 0;
+		for (unsigned i = nrLimbs; i-- > 0; ) {
+			Ty digit = std::floor(std::ldexp(magnitude, -int(64 * i)));
+			magnitude -= std::ldexp(digit, int(64 * i));
+			v |= Arithmetic(uint64_t(digit)) << (64 * i);
+		}
+		_value = wrap(rhs < 0 ? Arithmetic(0) - v : v);
+		return self();
+	}
+	// the least significant limb, sign extended when nbits is smaller than the native type
+	long long to_long_long() const { return (long long)_value; }
+
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+	// the wrapped result in r, and whether the exact result of the operation is outside of the range of Native
+	static bool add_overflow(Native a, Native b, Native& r) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_add_overflow(a, b, &r);
+#else
+		r = wrap(Arithmetic(Bits(a)) + Arithmetic(Bits(b)));
+		return (a < 0) == (b < 0) && (r < 0) != (a < 0);
+#endif
+	}
+	static bool sub_overflow(Native a, Native b, Native& r) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_sub_overflow(a, b, &r);
+#else
+		r = wrap(Arithmetic(Bits(a)) - Arithmetic(Bits(b)));
+		return (a < 0) != (b < 0) && (r < 0) != (a < 0);
+#endif
+	}
+	static bool mul_overflow(Native a, Native b, Native& r) {
+#if defined(__GNUC__) && !defined(__clang__)
+		return __builtin_mul_overflow(a, b, &r);
+#else
+		// clang lowers the 128-bit overflow multiply to a compiler-rt call that libgcc does not provide
+		r = wrap(Arithmetic(Bits(a)) * Arithmetic(Bits(b)));
+		const Native minimum = wrap(Arithmetic(1) << (nbits - 1));
+		if ((a == -1 && b == minimum) || (b == -1 && a == minimum)) return true;
+		return a != 0 && r / a != b;
+#endif
+	}
+#endif // INTEGER_THROW_OVERFLOW_EXCEPTION
+
+private:
+	Native _value;
+
+	// integer - integer logic comparisons
+	friend bool operator==(const Integer& lhs, const Integer& rhs) { return lhs._value == rhs._value; }
+	friend bool operator!=(const Integer& lhs, const Integer& rhs) { return lhs._value != rhs._value; }
+	friend bool operator< (const Integer& lhs, const Integer& rhs) { return lhs._value <  rhs._value; }
+	friend bool operator> (const Integer& lhs, const Integer& rhs) { return lhs._value >  rhs._value; }
+	friend bool operator<=(const Integer& lhs, const Integer& rhs) { return lhs._value <= rhs._value; }
+	friend bool operator>=(const Integer& lhs, const Integer& rhs) { return lhs._value >= rhs._value; }
+
+	// find the most significant bit set
+	friend signed findMsb(const Integer& v) {
+		for (signed i = nrLimbs - 1; i >= 0; --i) {
+			uint64_t limb = v.limb_bits(unsigned(i));
+			if (limb != 0) return i * 64 + 63 - signed(impl::clz64(limb));
+		}
+		return -1; // no significant bit found, all bits are zero
+	}
+	friend signed findLsb(const Integer& v) {
+		for (unsigned i = 0; i < nrLimbs; ++i) {
+			uint64_t limb = v.limb_bits(i);
+			if (limb != 0) return signed(i * 64 + impl::ctz64(limb));
+		}
+		return -1; // no significant bit found, all bits are zero
+	}
+
+	// the native division, with the two cases of the limb implementation that the hardware does not handle
+	friend idiv_t<nbits> divmod(const Integer& a, const Integer& b) {
+		idiv_t<nbits> divresult;
+		if (b._value == 0) {
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+			throw integer_divide_by_zero{};
+#else
+			std::cerr << "integer_divide_by_zero\n";
+			divresult.rem = a;
+			return divresult;
+#endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
+		}
+		if (b._value == -1) {
+			// the largest negative number divided by -1 wraps around to itself, where the native division traps
+			divresult.quot._value = wrap(Arithmetic(0) - a.bits());
+#if INTEGER_THROW_OVERFLOW_EXCEPTION
+			if (a.sign() && divresult.quot.sign()) throw integer_overflow{};
+#endif
+			return divresult;
+		}
+		divresult.quot._value = Native(a._value / b._value);
+		divresult.rem._value = Native(a._value % b._value);
+		return divresult;
+	}
+};
+
+} // namespace unum
+} // namespace sw
@@ -0,0 +1,142 @@
+#pragma once
+// complex_array.hpp: definition of an array of complex posits with interleaved or split storage
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <vector>
+
+namespace sw {
+namespace unum {
+
+/*
+A complex_array stores N complex posits in one contiguous block of 2N posits:
+	interleaved: re0 im0 re1 im1 ... , the layout of std::complex arrays and of most FFT libraries
+	split      : re0 re1 ... re(N-1) im0 im1 ... im(N-1), unit stride components for vectorized kernels
+The components are addressed through real_data()/imag_data() and stride(), so that kernels
+can be written once for both layouts. The kernels round each component of a complex
+product or multiply-accumulate once, like complex<posit<nbits, es>>.
+*/
+enum class complex_layout { interleaved, split };
+
+template<size_t nbits, size_t es, complex_layout layout = complex_layout::interleaved>
+class complex_array {
+public:
+	using Posit = posit<nbits, es>;
+	using value_type = complex<Posit>;
+
+	complex_array() : _size(0) {}
+	explicit complex_array(size_t n) : _size(n), _data(2 * n, Posit(0)) {}
+	complex_array(const std::vector<value_type>& v) : _size(v.size()), _data(2 * v.size()) {
+		for (size_t i = 0; i < _size; ++i) set(i, v[i]);
+	}
+	complex_array(const complex_array&) = default;
+	complex_array(complex_array&&) = default;
+	complex_array& operator=(const complex_array&) = default;
+	complex_array& operator=(complex_array&&) = default;
+
+	// selectors
+	size_t size() const { return _size; }
+	bool empty() const { return _size == 0; }
+	static constexpr complex_layout storage() { return layout; }
+	// distance between consecutive real, or imaginary, components
+	static constexpr size_t stride() { return layout == complex_layout::interleaved ? 2 : 1; }
+	const Posit& real(size_t i) const { return _data[re_index(i)]; }
+	const Posit& imag(size_t i) const { return _data[im_index(i)]; }
+	value_type operator[](size_t i) const { return value_type(real(i), imag(i)); }
+
+	// raw component access for kernels: element i has its real part at real_data()[i * stride()]
+	Posit* real_data() { return _data.data(); }
+	Posit* imag_data() { return _data.data() + im_index(0); }
+	const Posit* real_data() const { return _data.data(); }
+	const Posit* imag_data() const { return _data.data() + im_index(0); }
+
+	// modifiers
+	Posit& real(size_t i) { return _data[re_index(i)]; }
+	Posit& imag(size_t i) { return _data[im_index(i)]; }
+	void set(size_t i, const value_type& c) {
+		_data[re_index(i)] = c.real();
+		_data[im_index(i)] = c.imag();
+	}
+	void resize(size_t n) {
+		complex_array resized(n);
+		for (size_t i = 0; i < (n < _size ? n : _size); ++i) resized.set(i, operator[](i));
+		*this = std::move(resized);
+	}
+	void setzero() { for (Posit& p : _data) p.setzero(); }
+
+private:
+	size_t _size;
+	std::vector<Posit> _data;
+
+	size_t re_index(size_t i) const { return layout == complex_layout::interleaved ? 2 * i : i; }
+	size_t im_index(size_t i) const { return layout == complex_layout::interleaved ? 2 * i + 1 : _size + i; }
+};
+
+////////////////// complex_array kernels
+
+// c[i] = a[i] * b[i]
+template<size_t nbits, size_t es, complex_layout layout>
+void multiply(const complex_array<nbits, es, layout>& a, const complex_array<nbits, es, layout>& b, complex_array<nbits, es, layout>& c) {
+	if (a.size() != b.size()) throw std::runtime_error("complex_array multiply: operand sizes do not match");
+	if (c.size() != a.size()) c = complex_array<nbits, es, layout>(a.size());
+	constexpr size_t s = complex_array<nbits, es, layout>::stride();
+	const posit<nbits, es>* ar = a.real_data(); const posit<nbits, es>* ai = a.imag_data();
+	const posit<nbits, es>* br = b.real_data(); const posit<nbits, es>* bi = b.imag_data();
+	posit<nbits, es>* cr = c.real_data(); posit<nbits, es>* ci = c.imag_data();
+	for (size_t i = 0, k = 0; i < a.size(); ++i, k += s) {
+		posit<nbits, es> re = fmma(ar[k], br[k], ai[k], bi[k], false);
+		ci[k] = fmma(ar[k], bi[k], ai[k], br[k], true);
+		cr[k] = re;
+	}
+}
+
+// acc[i] = acc[i] + a[i] * b[i]
+template<size_t nbits, size_t es, complex_layout layout>
+void multiply_accumulate(complex_array<nbits, es, layout>& acc, const complex_array<nbits, es, layout>& a, const complex_array<nbits, es, layout>& b) {
+	if (a.size() != b.size() || acc.size() != a.size()) throw std::runtime_error("complex_array multiply_accumulate: operand sizes do not match");
+	constexpr size_t s = complex_array<nbits, es, layout>::stride();
+	const posit<nbits, es>* ar = a.real_data(); const posit<nbits, es>* ai = a.imag_data();
+	const posit<nbits, es>* br = b.real_data(); const posit<nbits, es>* bi = b.imag_data();
+	posit<nbits, es>* cr = acc.real_data(); posit<nbits, es>* ci = acc.imag_data();
+	for (size_t i = 0, k = 0; i < a.size(); ++i, k += s) {
+		posit<nbits, es> re = internal::fmma_accumulate(ar[k], br[k], -ai[k], bi[k], cr[k]);
+		ci[k] = internal::fmma_accumulate(ar[k], bi[k], ai[k], br[k], ci[k]);
+		cr[k] = re;
+	}
+}
+
+// a[i] = alpha * a[i]
+template<size_t nbits, size_t es, complex_layout layout>
+void scale(const complex<posit<nbits, es>>& alpha, complex_array<nbits, es, layout>& a) {
+	constexpr size_t s = complex_array<nbits, es, layout>::stride();
+	posit<nbits, es>* ar = a.real_data(); posit<nbits, es>* ai = a.imag_data();
+	for (size_t i = 0, k = 0; i < a.size(); ++i, k += s) {
+		posit<nbits, es> re = fmma(alpha.real(), ar[k], alpha.imag(), ai[k], false);
+		ai[k] = fmma(alpha.real(), ai[k], alpha.imag(), ar[k], true);
+		ar[k] = re;
+	}
+}
+
+// exact complex dot product sum(x[i] * y[i]) accumulated in two quires, rounded once per component
+template<size_t nbits, size_t es, complex_layout layout>
+complex<posit<nbits, es>> cdot(const complex_array<nbits, es, layout>& x, const complex_array<nbits, es, layout>& y) {
+	if (x.size() != y.size()) throw std::runtime_error("complex_array cdot: operand sizes do not match");
+	constexpr size_t s = complex_array<nbits, es, layout>::stride();
+	const posit<nbits, es>* xr = x.real_data(); const posit<nbits, es>* xi = x.imag_data();
+	const posit<nbits, es>* yr = y.real_data(); const posit<nbits, es>* yi = y.imag_data();
+	quire<nbits, es> qr, qi;
+	for (size_t i = 0, k = 0; i < x.size(); ++i, k += s) {
+		qr += quire_mul(xr[k], yr[k]);
+		qr -= quire_mul(xi[k], yi[k]);
+		qi += quire_mul(xr[k], yi[k]);
+		qi += quire_mul(xi[k], yr[k]);
+	}
+	posit<nbits, es> re, im;
+	convert(qr.to_value(), re);
+	convert(qi.to_value(), im);
+	return complex<posit<nbits, es>>(re, im);
+}
+
+}  // namespace unum
+}  // namespace sw
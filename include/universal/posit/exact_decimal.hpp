@@ -0,0 +1,275 @@
+#pragma once
+// exact_decimal.hpp: exact decimal expansion of posits, quires, and values on base 10^19 limb arithmetic
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "uint128.hpp"
+#include "../utility/int128.hpp"
+
+namespace sw {
+namespace unum {
+
+/*
+Every posit, quire, and value is a binary fraction m * 2^e, and so has a finite decimal expansion:
+m * 2^e for e >= 0 is an integer, and m * 2^-k = m * 5^k / 10^k is the integer m * 5^k with the
+decimal point k digits from the right. The expansion of a posit<256,5> or of a quire runs into
+thousands of digits, so the arithmetic works on limbs of 19 decimal digits, the largest power of
+ten that fits a 64-bit word, and converts the binary integer with divide-and-conquer: the upper
+and lower halves of the binary words are converted independently and combined with the decimal
+limbs of 2^(64*h), which are computed once by repeated squaring.
+*/
+
+namespace internal {
+
+// little-endian limbs in radix 10^19
+using decimal_limbs = std::vector<uint64_t>;
+static constexpr uint64_t decimal_limb_radix = 10000000000000000000ull;
+static constexpr int decimal_limb_digits = 19;
+
+// little-endian 64-bit words of a binary integer, with the bit interface of the posit decoders
+struct binary_words {
+	std::vector<uint64_t> word;
+
+	void setzero() { word.clear(); }
+	void set_bit(size_t n) {
+		if (word.size() <= n / 64) word.resize(n / 64 + 1, 0);
+		word[n / 64] |= uint64_t(1) << (n % 64);
+	}
+	void trim() { while (!word.empty() && word.back() == 0) word.pop_back(); }
+	// remove the trailing zero bits and return their number
+	size_t normalize() {
+		trim();
+		if (word.empty()) return 0;
+		size_t words = 0;
+		while (word[words] == 0) ++words;
+		unsigned bits = countTrailingZeros(word[words]);
+		shift_right(words, bits);
+		return 64 * words + bits;
+	}
+	void shift_left(size_t n) {
+		if (word.empty() || n == 0) return;
+		size_t words = n / 64;
+		unsigned bits = unsigned(n % 64);
+		word.insert(word.begin(), words, 0);
+		if (bits != 0) {
+			word.push_back(0);
+			for (size_t i = word.size() - 1; i > words; --i) word[i] = (word[i] << bits) | (word[i - 1] >> (64 - bits));
+			word[words] <<= bits;
+		}
+		trim();
+	}
+
+private:
+	void shift_right(size_t words, unsigned bits) {
+		word.erase(word.begin(), word.begin() + words);
+		if (bits != 0) {
+			for (size_t i = 0; i + 1 < word.size(); ++i) word[i] = (word[i] >> bits) | (word[i + 1] << (64 - bits));
+			word.back() >>= bits;
+		}
+		trim();
+	}
+};
+
+inline void trim(decimal_limbs& a) { while (!a.empty() && a.back() == 0) a.pop_back(); }
+
+// quotient and remainder of the 128-bit (upper, lower) by the limb radix, requires upper < radix
+inline uint64_t divide_limb_radix(uint64_t upper, uint64_t lower, uint64_t& remainder) {
+#if defined(__SIZEOF_INT128__)
+	native_uint128 t = ((native_uint128)upper << 64) | lower;
+	remainder = uint64_t(t % decimal_limb_radix);
+	return uint64_t(t / decimal_limb_radix);
+#else
+	uint64_t q = 0, r = upper;
+	for (int i = 63; i >= 0; --i) {
+		bool top = (r >> 63) != 0;
+		r = (r << 1) | ((lower >> i) & 1);
+		if (top || r >= decimal_limb_radix) {
+			r -= decimal_limb_radix;
+			q |= uint64_t(1) << i;
+		}
+	}
+	remainder = r;
+	return q;
+#endif
+}
+
+// a += b
+inline void add_limbs(decimal_limbs& a, const decimal_limbs& b) {
+	if (a.size() < b.size()) a.resize(b.size(), 0);
+	uint64_t carry = 0;
+	size_t i = 0;
+	for (size_t j = 0; j < b.size(); ++i, ++j) {
+		// two limbs can sum past 2^64, and the wrapped sum minus the radix is still the right limb
+		uint64_t t = a[i] + (b[j] + carry);
+		carry = (t < a[i] || t >= decimal_limb_radix) ? 1 : 0;
+		a[i] = t - carry * decimal_limb_radix;
+	}
+	for (; carry != 0 && i < a.size(); ++i) {
+		uint64_t t = a[i] + carry;
+		carry = t >= decimal_limb_radix ? 1 : 0;
+		a[i] = t - carry * decimal_limb_radix;
+	}
+	if (carry != 0) a.push_back(carry);
+}
+
+// product by columns: the 192-bit column sum is reduced by the radix once per column instead of once per limb product
+inline decimal_limbs multiply_limbs(const decimal_limbs& a, const decimal_limbs& b) {
+	decimal_limbs r;
+	if (a.empty() || b.empty()) return r;
+	size_t n = a.size() + b.size();
+	r.resize(n, 0);
+	uint64_t c0 = 0, c1 = 0;  // carry into the column, 128 bits
+	for (size_t k = 0; k + 1 < n; ++k) {
+		uint64_t s0 = c0, s1 = c1, s2 = 0;
+		size_t i = k < b.size() ? 0 : k - b.size() + 1;
+		size_t last = k < a.size() ? k : a.size() - 1;
+		for (; i <= last; ++i) {
+			uint128 p = multiply(a[i], b[k - i]);
+			s0 += p.lower;
+			uint64_t c = s0 < p.lower ? 1 : 0;
+			s1 += p.upper;
+			uint64_t d = s1 < p.upper ? 1 : 0;
+			s1 += c;
+			d += s1 < c ? 1 : 0;
+			s2 += d;
+		}
+		// (s2:s1:s0) / radix: s2 is far below the radix for any limb count that fits in memory
+		uint64_t rem;
+		uint64_t q1 = divide_limb_radix(s2, s1, rem);
+		uint64_t q0 = divide_limb_radix(rem, s0, rem);
+		r[k] = rem;
+		c0 = q0;
+		c1 = q1;
+	}
+	// the last column holds no products, and its carry is below the radix
+	r[n - 1] = c0;
+	trim(r);
+	return r;
+}
+
+// decimal limbs of the binary integer in words [first, first + n), with powers[j] the limbs of 2^(64 * 2^j)
+inline decimal_limbs convert_words(const uint64_t* first, size_t n, std::vector<decimal_limbs>& powers) {
+	if (n == 1) {
+		decimal_limbs r = { first[0] % decimal_limb_radix, first[0] / decimal_limb_radix };
+		trim(r);
+		return r;
+	}
+	size_t level = 0, h = 1;
+	while (2 * h < n) {
+		h *= 2;
+		++level;
+	}
+	while (powers.size() <= level) powers.push_back(multiply_limbs(powers.back(), powers.back()));
+	decimal_limbs r = multiply_limbs(convert_words(first + h, n - h, powers), powers[level]);
+	add_limbs(r, convert_words(first, h, powers));
+	return r;
+}
+
+inline decimal_limbs convert_binary(const binary_words& b) {
+	if (b.word.empty()) return decimal_limbs();
+	std::vector<decimal_limbs> powers;
+	powers.push_back(decimal_limbs{ 8446744073709551616ull, 1 });  // 2^64
+	return convert_words(b.word.data(), b.word.size(), powers);
+}
+
+// decimal limbs of 5^k by repeated squaring
+inline decimal_limbs power_of_five(size_t k) {
+	decimal_limbs r = { 1 };
+	decimal_limbs base = { 7450580596923828125ull };  // 5^27, the largest power of five below the radix
+	for (size_t i = 0; i < k % 27; ++i) r[0] *= 5;
+	for (k /= 27; k != 0; k >>= 1) {
+		if (k & 1) r = multiply_limbs(r, base);
+		if (k > 1) base = multiply_limbs(base, base);
+	}
+	return r;
+}
+
+// the exact decimal text of (negative ? -1 : 1) * m * 2^exponent, in positional notation without trailing zeros
+inline std::string exact_decimal_string(bool negative, binary_words m, int exponent) {
+	exponent += int(m.normalize());
+	if (m.word.empty()) return std::string("0");
+	size_t fractionDigits = 0;
+	decimal_limbs d;
+	if (exponent >= 0) {
+		m.shift_left(size_t(exponent));
+		d = convert_binary(m);
+	}
+	else {
+		fractionDigits = size_t(-exponent);
+		d = multiply_limbs(convert_binary(m), power_of_five(fractionDigits));
+	}
+
+	// the digits of the integer d, most significant limb without leading zeros
+	std::string digits = std::to_string(d.back());
+	digits.reserve(digits.size() + decimal_limb_digits * (d.size() - 1));
+	char limb[decimal_limb_digits];
+	for (size_t i = d.size() - 1; i-- > 0; ) {
+		uint64_t v = d[i];
+		for (int j = decimal_limb_digits - 1; j >= 0; --j) {
+			limb[j] = char('0' + v % 10);
+			v /= 10;
+		}
+		digits.append(limb, decimal_limb_digits);
+	}
+
+	std::string s;
+	s.reserve(digits.size() + fractionDigits + 3);
+	if (negative) s += '-';
+	if (fractionDigits == 0) {
+		s += digits;
+	}
+	else if (digits.size() > fractionDigits) {
+		s.append(digits, 0, digits.size() - fractionDigits);
+		s += '.';
+		s.append(digits, digits.size() - fractionDigits, std::string::npos);
+	}
+	else {
+		s += "0.";
+		s.append(fractionDigits - digits.size(), '0');
+		s += digits;
+	}
+	return s;
+}
+
+}  // namespace internal
+
+// the exact decimal expansion of a posit: every digit of its binary fraction, "nar" for NaR
+template<size_t nbits, size_t es>
+std::string exact_decimal_format(const posit<nbits, es>& p) {
+	if (p.isnar()) return std::string("nar");
+	if (p.iszero()) return std::string("0");
+	posit<nbits, es> a = p.isneg() ? -p : p;
+	internal::binary_words m;
+	int exponent;
+	internal::decode_magnitude<nbits, es>(a.get(), m, exponent);
+	return internal::exact_decimal_string(p.isneg(), m, exponent);
+}
+
+// the exact decimal expansion of the contents of a quire
+template<size_t nbits, size_t es, size_t capacity>
+std::string exact_decimal_format(const quire<nbits, es, capacity>& q) {
+	using Quire = quire<nbits, es, capacity>;
+	bitblock<Quire::qbits + 1> bits = q.get();
+	internal::binary_words m;
+	for (size_t i = 0; i < Quire::qbits + 1; ++i) if (bits[i]) m.set_bit(i);
+	return internal::exact_decimal_string(q.isneg(), m, -int(Quire::radix_point));
+}
+
+// the exact decimal expansion of a value: "inf" and "nan" for the exceptional values
+template<size_t fbits>
+std::string exact_decimal_format(const value<fbits>& v) {
+	if (v.isnan()) return std::string("nan");
+	if (v.isinf()) return std::string(v.sign() ? "-inf" : "inf");
+	if (v.iszero()) return std::string("0");
+	bitblock<fbits + 1> bits = v.get_fixed_point();
+	internal::binary_words m;
+	for (size_t i = 0; i < fbits + 1; ++i) if (bits[i]) m.set_bit(i);
+	return internal::exact_decimal_string(v.sign(), m, v.scale() - int(fbits));
+}
+
+}  // namespace unum
+}  // namespace sw
@@ -163,3 +163,14 @@ struct operand_too_small_for_quire
 	operand_too_small_for_quire(const std::string& error = "operand value too small for quire") : quire_exception(error) {}
 };
 
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// POSIT FILE EXCEPTIONS
+
+// is thrown when a binary posit array file cannot be opened, read, or written, or does not hold the expected posits
+struct posit_file_exception
+	: public std::runtime_error
+{
+	posit_file_exception(const std::string& error) : std::runtime_error(std::string("posit file exception: ") + error) {};
+};
@@ -42,7 +42,8 @@ public:
 		return _Bits.to_ulong();
 	}
 	double value() const {
-		return double(uint64_t(1) << scale());
+		int e = scale();
+		return e > 63 ? std::pow(2.0, e) : double(uint64_t(1) << e);
 	}
 	bitblock<es> get() const {
 		return _Bits;
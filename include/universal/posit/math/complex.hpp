@@ -1,16 +1,19 @@
 #pragma once
-// complex.hpp: functions for complex posits
+// complex.hpp: complex posits and functions for complex posits
 //
-// Copyright (C) 2017-2018 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <complex>
+#include "fma.hpp"
 
 namespace sw {
 	namespace unum {
 
 		// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
 		// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+		// std::complex is only specified for float, double, and long double: the sw::unum::complex type below
+		// is the complex posit type of the library, the shims are kept for existing code.
 
 		// Real component of a complex posit
 		template<size_t nbits, size_t es>
@@ -30,6 +33,182 @@ namespace sw {
 			return std::conj(x);
 		}
 
+		/*
+		complex<posit<nbits, es>> is a complex number with posit components.
+
+		The product of two complex numbers computes each component with a single rounding:
+			re = fmma(a.re, b.re, a.im, b.im, subtract)
+			im = fmma(a.re, b.im, a.im, b.re, add)
+		so that the real part does not suffer from the cancellation of two separately rounded
+		products. The multiply-accumulate fmac(acc, a, b) = acc + a * b rounds each component
+		of the three-term sum once as well.
+		Division rounds the numerator components and the denominator |b|^2 once each, and then
+		rounds the quotient, which is two roundings instead of the six of the textbook formula.
+		*/
+		template<typename T> class complex;
+
+		template<size_t nbits, size_t es>
+		class complex< posit<nbits, es> > {
+		public:
+			using value_type = posit<nbits, es>;
+
+			complex() : _re(0), _im(0) {}
+			complex(const complex&) = default;
+			complex(complex&&) = default;
+			complex& operator=(const complex&) = default;
+			complex& operator=(complex&&) = default;
+
+			complex(const value_type& re, const value_type& im = value_type(0)) : _re(re), _im(im) {}
+			complex(int re, int im = 0) : _re(re), _im(im) {}
+			complex(double re, double im = 0.0) : _re(re), _im(im) {}
+			complex(const std::complex<double>& rhs) : _re(rhs.real()), _im(rhs.imag()) {}
+			complex(const std::complex<long double>& rhs) : _re(rhs.real()), _im(rhs.imag()) {}
+
+			// selectors
+			const value_type& real() const { return _re; }
+			const value_type& imag() const { return _im; }
+			bool isnar() const { return _re.isnar() || _im.isnar(); }
+			bool iszero() const { return _re.iszero() && _im.iszero(); }
+
+			// modifiers
+			void real(const value_type& re) { _re = re; }
+			void imag(const value_type& im) { _im = im; }
+			void setnar() { _re.setnar(); _im.setnar(); }
+			void setzero() { _re.setzero(); _im.setzero(); }
+
+			// conversion operators
+			explicit operator std::complex<double>() const { return std::complex<double>(double(_re), double(_im)); }
+			explicit operator std::complex<long double>() const { return std::complex<long double>((long double)_re, (long double)_im); }
+
+			complex operator-() const { return complex(-_re, -_im); }
+
+			complex& operator+=(const complex& rhs) {
+				_re += rhs._re;
+				_im += rhs._im;
+				return *this;
+			}
+			complex& operator-=(const complex& rhs) {
+				_re -= rhs._re;
+				_im -= rhs._im;
+				return *this;
+			}
+			complex& operator*=(const complex& rhs) {
+				value_type re = fmma(_re, rhs._re, _im, rhs._im, false);
+				_im = fmma(_re, rhs._im, _im, rhs._re, true);
+				_re = re;
+				return *this;
+			}
+			complex& operator/=(const complex& rhs) {
+				value_type denominator = fmma(rhs._re, rhs._re, rhs._im, rhs._im, true);
+				if (denominator.iszero() || denominator.isnar() || isnar()) {
+					setnar();
+					return *this;
+				}
+				value_type re = fmma(_re, rhs._re, _im, rhs._im, true);
+				_im = fmma(_im, rhs._re, _re, rhs._im, false) / denominator;
+				_re = re / denominator;
+				return *this;
+			}
+			complex& operator*=(const value_type& rhs) {
+				_re *= rhs;
+				_im *= rhs;
+				return *this;
+			}
+			complex& operator/=(const value_type& rhs) {
+				_re /= rhs;
+				_im /= rhs;
+				return *this;
+			}
+
+		private:
+			value_type _re;
+			value_type _im;
+		};
+
+		////////////////// complex posit operators
+
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > operator+(const complex< posit<nbits, es> >& lhs, const complex< posit<nbits, es> >& rhs) {
+			complex< posit<nbits, es> > sum(lhs);
+			sum += rhs;
+			return sum;
+		}
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > operator-(const complex< posit<nbits, es> >& lhs, const complex< posit<nbits, es> >& rhs) {
+			complex< posit<nbits, es> > diff(lhs);
+			diff -= rhs;
+			return diff;
+		}
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > operator*(const complex< posit<nbits, es> >& lhs, const complex< posit<nbits, es> >& rhs) {
+			complex< posit<nbits, es> > mul(lhs);
+			mul *= rhs;
+			return mul;
+		}
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > operator/(const complex< posit<nbits, es> >& lhs, const complex< posit<nbits, es> >& rhs) {
+			complex< posit<nbits, es> > ratio(lhs);
+			ratio /= rhs;
+			return ratio;
+		}
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > operator*(const posit<nbits, es>& lhs, const complex< posit<nbits, es> >& rhs) {
+			complex< posit<nbits, es> > mul(rhs);
+			mul *= lhs;
+			return mul;
+		}
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > operator*(const complex< posit<nbits, es> >& lhs, const posit<nbits, es>& rhs) {
+			complex< posit<nbits, es> > mul(lhs);
+			mul *= rhs;
+			return mul;
+		}
+
+		template<size_t nbits, size_t es>
+		inline bool operator==(const complex< posit<nbits, es> >& lhs, const complex< posit<nbits, es> >& rhs) { return lhs.real() == rhs.real() && lhs.imag() == rhs.imag(); }
+		template<size_t nbits, size_t es>
+		inline bool operator!=(const complex< posit<nbits, es> >& lhs, const complex< posit<nbits, es> >& rhs) { return !operator==(lhs, rhs); }
+
+		template<size_t nbits, size_t es>
+		inline std::ostream& operator<<(std::ostream& ostr, const complex< posit<nbits, es> >& c) {
+			return ostr << '(' << c.real() << ',' << c.imag() << ')';
+		}
+
+		////////////////// complex posit functions
+
+		template<size_t nbits, size_t es>
+		inline posit<nbits, es> real(const complex< posit<nbits, es> >& x) { return x.real(); }
+
+		template<size_t nbits, size_t es>
+		inline posit<nbits, es> imag(const complex< posit<nbits, es> >& x) { return x.imag(); }
+
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > conj(const complex< posit<nbits, es> >& x) {
+			return complex< posit<nbits, es> >(x.real(), -x.imag());
+		}
+
+		// squared magnitude re^2 + im^2 with a single rounding
+		template<size_t nbits, size_t es>
+		inline posit<nbits, es> norm(const complex< posit<nbits, es> >& x) {
+			return fmma(x.real(), x.real(), x.imag(), x.imag(), true);
+		}
+
+		// fused complex multiply-accumulate acc + a * b, each component rounded once
+		template<size_t nbits, size_t es>
+		inline complex< posit<nbits, es> > fmac(const complex< posit<nbits, es> >& acc, const complex< posit<nbits, es> >& a, const complex< posit<nbits, es> >& b) {
+			return complex< posit<nbits, es> >(
+				internal::fmma_accumulate(a.real(), b.real(), -a.imag(), b.imag(), acc.real()),
+				internal::fmma_accumulate(a.real(), b.imag(), a.imag(), b.real(), acc.imag()));
+		}
+
+		// radix-2 butterfly (a, b) <- (a + w * b, a - w * b), each output component rounded once
+		template<size_t nbits, size_t es>
+		inline void butterfly(complex< posit<nbits, es> >& a, complex< posit<nbits, es> >& b, const complex< posit<nbits, es> >& w) {
+			complex< posit<nbits, es> > sum = fmac(a, w, b);
+			b = fmac(a, -w, b);
+			a = sum;
+		}
+
 	}  // namespace unum
 
 }  // namespace sw
@@ -1,51 +1,48 @@
 #pragma once
 // exponent.hpp: exponent functions for posits
 //
-// Copyright (C) 2017-2018 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "log2_exp2_core.hpp"
 
 namespace sw {
 	namespace unum {
 
-		// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-		// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+		// exp, exp2, and exp10 split the argument in an exact integer part, which becomes the scale of the result,
+		// and a fraction that is raised in 128-bit fixed-point, see log2_exp2_core.hpp.
+		// Posits do not overflow or underflow: results saturate to maxpos and minpos.
 
-		// Base-e exponential function
+		// Base-2 exponential function
 		template<size_t nbits, size_t es>
-		posit<nbits,es> exp(posit<nbits,es> x) {
+		posit<nbits,es> exp2(posit<nbits,es> x) {
 			if (isnar(x)) return x;
-			posit<nbits, es> p;
-			double d = std::exp(double(x));
-			if (d == 0.0) {
-				p = minpos<nbits, es>();
-			}
-			else {
-				p = d;
-			}
-			return p;
+			posit<nbits, es> p(1);
+			if (x.iszero()) return p;
+			constexpr unsigned iterations = internal::log2_exp2_iterations(nbits);
+			return internal::round_to(internal::exp2(internal::unpack(x), iterations), p);
 		}
 
-		// Base-2 exponential function
+		// Base-e exponential function
 		template<size_t nbits, size_t es>
-		posit<nbits,es> exp2(posit<nbits,es> x) {
+		posit<nbits,es> exp(posit<nbits,es> x) {
 			if (isnar(x)) return x;
-			posit<nbits, es> p;
-			double d = std::exp2(double(x));
-			if (d == 0.0) {
-				p = minpos<nbits, es>();
-			}
-			else {
-				p = d;
-			}
-			return p;
+			posit<nbits, es> p(1);
+			if (x.iszero()) return p;
+			constexpr unsigned iterations = internal::log2_exp2_iterations(nbits);
+			internal::extended_value log2e = internal::make_extended(false, 0, internal::log2e_significand(), true);
+			return internal::round_to(internal::exp2(internal::multiply(internal::unpack(x), log2e), iterations), p);
 		}
 
 		// Base-10 exponential function
 		template<size_t nbits, size_t es>
 		posit<nbits, es> exp10(posit<nbits, es> x) {
-			return posit<nbits, es>(std::pow(10.0, double(x)));
+			if (isnar(x)) return x;
+			posit<nbits, es> p(1);
+			if (x.iszero()) return p;
+			constexpr unsigned iterations = internal::log2_exp2_iterations(nbits);
+			internal::extended_value ten = internal::to_extended(10ll);
+			return internal::round_to(internal::pow(ten, internal::unpack(x), iterations), p);
 		}
 		
 		// Base-e exponential function exp(x)-1
@@ -0,0 +1,204 @@
+#pragma once
+// extended_value.hpp: sign, scale and 128-bit significand representation used by the native posit functions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <type_traits>
+#include "../uint128.hpp"
+
+namespace sw {
+namespace unum {
+namespace internal {
+
+// a finite, non-zero real value: (-1)^sign * 2^scale * significand
+// the significand is in Q1.127 format, so bit 127 is the hidden bit
+// inexact marks that the true value has non-zero bits below the significand
+struct extended_value {
+	bool     sign;
+	int      scale;
+	uint128  significand;
+	bool     inexact;
+};
+
+// scale used to signal that a value is outside the dynamic range of any posit configuration
+static constexpr int EXTENDED_SCALE_SATURATION = (1 << 30);
+
+inline extended_value make_extended(bool sign, int scale, const uint128& significand, bool inexact) {
+	extended_value v;
+	v.sign = sign;
+	v.scale = scale;
+	v.significand = significand;
+	v.inexact = inexact;
+	return v;
+}
+
+// product of two extended values
+inline extended_value multiply(const extended_value& a, const extended_value& b) {
+	extended_value v;
+	uint128 upper, lower;
+	multiply(a.significand, b.significand, upper, lower);
+	v.sign = a.sign ^ b.sign;
+	v.scale = a.scale + b.scale;
+	if (upper.upper & 0x8000000000000000ull) {
+		v.scale += 1;
+		v.significand = upper;
+		v.inexact = !iszero(lower);
+	}
+	else {
+		v.significand = (upper << 1) | (lower >> 127);
+		v.inexact = !iszero(lower << 1);
+	}
+	v.inexact = v.inexact || a.inexact || b.inexact;
+	return v;
+}
+
+// sum of two extended values
+// The operands are aligned in a 128-bit window with two bits of headroom for the carry, and the bits that
+// are shifted out of the window are folded into the inexact flag: the true sum then lies strictly between
+// the window result and the next window value, which is all that round_to() needs to round correctly.
+// Returns false when the sum is exactly zero.
+inline bool add(const extended_value& a, const extended_value& b, extended_value& sum) {
+	// order the operands by magnitude
+	bool swap = (b.scale > a.scale) || (b.scale == a.scale && a.significand < b.significand);
+	const extended_value& big = swap ? b : a;
+	const extended_value& small = swap ? a : b;
+	long long distance = (long long)big.scale - (long long)small.scale;
+	unsigned shift = distance > 126 ? 128u : unsigned(distance) + 2;
+	uint128 x = big.significand >> 2;
+	uint128 y = small.significand >> shift;
+	bool sticky = small.inexact || anyAfter(small.significand, shift);
+	uint128 r;
+	if (big.sign == small.sign) {
+		r = x + y;
+	}
+	else {
+		// x - y - epsilon, with 0 < epsilon < 1 in the last position of the window
+		r = x - y;
+		if (sticky) r = r - uint128{ 1, 0 };
+	}
+	sticky = sticky || big.inexact || anyAfter(big.significand, 2);
+	if (iszero(r) && !sticky) return false;
+	unsigned lz = countLeadingZeros(r);
+	sum.sign = big.sign;
+	sum.scale = big.scale + 2 - int(lz);
+	sum.significand = r << lz;
+	sum.inexact = sticky;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// posit unpacking and rounding
+
+// unpack a finite non-zero posit of at most 64 bits directly from its encoding
+template<size_t nbits, size_t es>
+inline extended_value unpack(const posit<nbits, es>& p, std::true_type) {
+	extended_value v;
+	uint64_t bits = uint64_t(p.encoding());
+	v.sign = ((bits >> (nbits - 1)) & 1) != 0;
+	if (v.sign) bits = ~bits + 1;
+	// left-align the bits following the sign bit
+	uint64_t x = bits << (64 - nbits + 1);
+	unsigned run;
+	int k;
+	if (x & 0x8000000000000000ull) {
+		run = countLeadingZeros(~x);
+		k = int(run) - 1;
+	}
+	else {
+		run = countLeadingZeros(x);
+		k = -int(run);
+	}
+	// consume the regime and its terminating bit
+	x = (run + 1 >= 64) ? 0 : (x << (run + 1));
+	int e = int((x >> (63 - es)) >> 1);
+	x <<= es;
+	v.scale = k * (1 << es) + e;
+	v.significand = uint128{ x << 63, (x >> 1) | 0x8000000000000000ull };
+	v.inexact = false;
+	return v;
+}
+
+// unpack a finite non-zero posit of more than 64 bits through the bitblock decoder
+template<size_t nbits, size_t es>
+inline extended_value unpack(const posit<nbits, es>& p, std::false_type) {
+	constexpr size_t fbits = nbits - 3 - es;
+	extended_value v;
+	v.sign = sign(p);
+	v.scale = scale(p);
+	bitblock<fbits> f = extract_fraction<nbits, es, fbits>(p);
+	uint128 significand = { 0, 0x8000000000000000ull };
+	bool inexact = false;
+	for (size_t i = 0; i < fbits; ++i) {
+		if (!f[fbits - 1 - i]) continue;
+		if (i < 127) significand = significand | (uint128{ 1, 0 } << unsigned(126 - i));
+		else inexact = true;
+	}
+	v.significand = significand;
+	v.inexact = inexact;
+	return v;
+}
+
+template<size_t nbits, size_t es>
+inline extended_value unpack(const posit<nbits, es>& p) {
+	return unpack(p, std::integral_constant<bool, (nbits <= 64)>());
+}
+
+// round an extended value to a posit of at most 64 bits, following the rounding rules of convert_()
+template<size_t nbits, size_t es>
+inline posit<nbits, es>& round_to(const extended_value& v, posit<nbits, es>& p, std::true_type) {
+	const uint64_t mask = (nbits == 64) ? ~uint64_t(0) : ((uint64_t(1) << (nbits & 63)) - 1);
+	uint64_t bits;
+	if (check_inward_projection_range<nbits, es>(v.scale)) {
+		// project to minpos/maxpos
+		bits = (v.scale < 0) ? uint64_t(1) : ((uint64_t(1) << (nbits - 1)) - 1);
+	}
+	else {
+		int scale = v.scale;
+		bool r = (scale >= 0);
+		unsigned run = unsigned(r ? 1 + (scale >> es) : -(scale >> es));
+		uint64_t regime = r ? (((uint64_t(1) << run) - 1) << 1) : uint64_t(1);
+		uint64_t esval = uint64_t(scale) & ((uint64_t(1) << es) - 1);
+		int avail = int(nbits) - 1 - int(run + 1);      // bits left for exponent and fraction
+		if (avail < 0) {
+			// the regime fills the posit and the terminating bit is the rounding bit: maxpos
+			bits = (uint64_t(1) << (nbits - 1)) - 1;
+		}
+		else {
+			// exponent and fraction bits, left-aligned, followed by everything that is cut off
+			uint128 fraction = v.significand << 1;
+			uint64_t tail = es > 0 ? ((esval << (63 - es)) << 1) | (fraction.upper >> es) : fraction.upper;
+			bool sticky = v.inexact || (fraction.lower != 0) || (es > 0 && ((fraction.upper << (63 - es)) << 1) != 0);
+			bits = (regime << avail) | (avail > 0 ? (tail >> (64 - avail)) : 0);
+			bool round = ((tail >> (63 - avail)) & 1) != 0;
+			sticky = sticky || (tail & ((uint64_t(1) << (63 - avail)) - 1)) != 0;
+			if (round && (sticky || (bits & 1))) ++bits;
+		}
+	}
+	if (v.sign) bits = ~bits + 1;
+	p.set_raw_bits(bits & mask);
+	return p;
+}
+
+// round an extended value to a posit of more than 64 bits through the bitblock conversion
+template<size_t nbits, size_t es>
+inline posit<nbits, es>& round_to(const extended_value& v, posit<nbits, es>& p, std::false_type) {
+	bitblock<128> fraction;
+	uint128 f = v.significand << 1;
+	for (unsigned i = 0; i < 64; ++i) {
+		fraction[i] = ((f.lower >> i) & 1) != 0;
+		fraction[64 + i] = ((f.upper >> i) & 1) != 0;
+	}
+	// the hidden bit shifted out leaves room for a sticky bit
+	fraction[0] = v.inexact;
+	return convert_<nbits, es, 128>(v.sign, v.scale, fraction, p);
+}
+
+template<size_t nbits, size_t es>
+inline posit<nbits, es>& round_to(const extended_value& v, posit<nbits, es>& p) {
+	return round_to(v, p, std::integral_constant<bool, (nbits <= 64)>());
+}
+
+}  // namespace internal
+}  // namespace unum
+}  // namespace sw
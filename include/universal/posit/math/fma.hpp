@@ -0,0 +1,284 @@
+#pragma once
+// fma.hpp: fused multiply-add functions for posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include "extended_value.hpp"
+#include "../quire.hpp"
+
+namespace sw {
+namespace unum {
+
+// fma(a, b, c) = a * b + c with a single rounding: the product of the significands is exact,
+// the addend is aligned to it without rounding, and only the sum is rounded to the posit.
+//   posits of at most 64 bits use 128-bit integer arithmetic, the product of two 62-bit significands fits exactly
+//   posits of more than 64 bits use bitblock arithmetic on a window that holds the product and the addend
+//   the fast posit<16,1> and posit<32,2> specializations use a 64-bit integer window
+// NaR in any argument yields NaR
+//
+// fmma(a, b, c, d) = a * b + c * d, or a * b - c * d, with a single rounding
+//   posits of at most 64 bits add the two exact products in the 128-bit extended_value kernel
+//   posits of more than 64 bits accumulate the products in a quire
+namespace internal {
+
+// fused multiply-add for posits of at most 64 bits
+template<size_t nbits, size_t es>
+posit<nbits, es> fma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, std::true_type) {
+	posit<nbits, es> p;
+	extended_value product = multiply(unpack(a), unpack(b));
+	if (c.iszero()) return round_to(product, p);
+	extended_value sum;
+	if (!add(product, unpack(c), sum)) return p;  // exact cancellation
+	return round_to(sum, p);
+}
+
+// place the bits of a significand in an accumulation window starting at position lsb, collecting the bits below the window
+template<size_t sbits, size_t wbits>
+void place_in_window(const bitblock<sbits>& significand, int lsb, bitblock<wbits>& window, bool& sticky) {
+	window.reset();
+	for (int i = 0; i < int(sbits); ++i) {
+		int position = lsb + i;
+		if (position < 0) {
+			sticky = sticky || significand[size_t(i)];
+		}
+		else if (position < int(wbits)) {
+			window[size_t(position)] = significand[size_t(i)];
+		}
+	}
+}
+
+// fused multiply-add for posits of more than 64 bits
+template<size_t nbits, size_t es>
+posit<nbits, es> fma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, std::false_type) {
+	constexpr size_t fbits = nbits - 3 - es;
+	constexpr size_t fhbits = fbits + 1;             // fraction plus hidden bit
+	constexpr size_t mbits = 2 * fhbits;             // exact product of the significands
+	constexpr size_t wbits = mbits + fhbits + 4;     // window for product and addend, with room for the carry and guard bits
+
+	posit<nbits, es> p;
+	bitblock<fhbits> sa, sb;
+	copy_into<fbits, fhbits>(extract_fraction<nbits, es, fbits>(a), 0, sa);
+	sa.set(fbits);
+	copy_into<fbits, fhbits>(extract_fraction<nbits, es, fbits>(b), 0, sb);
+	sb.set(fbits);
+	bitblock<mbits> product;
+	multiply_unsigned(sa, sb, product);
+	bool productSign = sign(a) ^ sign(b);
+	int productScale = scale(a) + scale(b);           // the product is in [1,4)
+	if (c.iszero()) {
+		bitblock<mbits> fraction;
+		int msb = product.test(mbits - 1) ? int(mbits) - 1 : int(mbits) - 2;
+		for (int i = 1; i <= msb; ++i) fraction[mbits - size_t(i)] = product[size_t(msb - i)];
+		return convert_<nbits, es, mbits>(productSign, productScale + msb - int(mbits - 2), fraction, p);
+	}
+	bitblock<fhbits> sc;
+	copy_into<fbits, fhbits>(extract_fraction<nbits, es, fbits>(c), 0, sc);
+	sc.set(fbits);
+	bool addendSign = sign(c);
+	int addendScale = scale(c);
+
+	// align both operands below the larger of the two leading bits, leaving one bit for the carry
+	int top = std::max(productScale + 1, addendScale) + 1;
+	int window_lsb = top - int(wbits - 1);
+	bool sticky = false;
+	bitblock<wbits> x, y;
+	place_in_window(product, productScale - 2 * int(fbits) - window_lsb, x, sticky);
+	place_in_window(sc, addendScale - int(fbits) - window_lsb, y, sticky);
+	// only the operand with the smaller magnitude can lose bits
+	bool swap = x < y;
+	const bitblock<wbits>& big = swap ? y : x;
+	const bitblock<wbits>& small = swap ? x : y;
+	bool resultSign = swap ? addendSign : productSign;
+	bitblock<wbits + 1> r;
+	if (productSign == addendSign) {
+		add_unsigned(big, small, r);
+	}
+	else {
+		// big - small - epsilon, with 0 < epsilon < 1 in the last position of the window
+		subtract_unsigned(big, small, r);
+		if (sticky) decrement_bitset(r);
+	}
+	int msb = findMostSignificantBit(r);
+	if (msb < 0 && !sticky) return p;  // exact cancellation
+	bitblock<wbits> fraction;
+	for (int i = 1; i <= msb; ++i) fraction[wbits - size_t(i)] = r[size_t(msb - i)];
+	fraction[0] = sticky;
+	return convert_<nbits, es, wbits>(resultSign, window_lsb + msb, fraction, p);
+}
+
+// fused multiply-add in a 64-bit integer window, for posits with a significand product of at most 56 bits
+template<size_t nbits, size_t es>
+posit<nbits, es> fma_window64(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
+	constexpr unsigned fbits = unsigned(nbits - 3 - es);
+	static_assert(2 * fbits <= 54, "fma_window64 requires a significand product of at most 56 bits");
+	posit<nbits, es> p;
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		p.setnar();
+		return p;
+	}
+	if (a.iszero() || b.iszero()) return c;
+	// significands in the window have the hidden bit at position 60
+	extended_value va = unpack(a), vb = unpack(b);
+	uint64_t product = (va.significand.upper >> (63 - fbits)) * (vb.significand.upper >> (63 - fbits));
+	product <<= (60 - 2 * fbits);
+	bool productSign = va.sign ^ vb.sign;
+	int productScale = va.scale + vb.scale;
+	if (product >> 61) {
+		product >>= 1;  // exact: the low bits of the product are zero
+		++productScale;
+	}
+	uint64_t x = product, y = 0;
+	int bigScale = productScale;
+	bool resultSign = productSign, sticky = false;
+	if (!c.iszero()) {
+		extended_value vc = unpack(c);
+		uint64_t addend = (vc.significand.upper >> (63 - fbits)) << (60 - fbits);
+		int smallScale = vc.scale;
+		if (vc.scale > productScale || (vc.scale == productScale && addend > product)) {
+			x = addend;
+			y = product;
+			bigScale = vc.scale;
+			smallScale = productScale;
+			resultSign = vc.sign;
+		}
+		else {
+			y = addend;
+		}
+		int distance = bigScale - smallScale;
+		if (distance >= 64) {
+			sticky = true;
+			y = 0;
+		}
+		else {
+			sticky = (y & ((uint64_t(1) << distance) - 1)) != 0;
+			y >>= distance;
+		}
+		if (vc.sign == productSign) {
+			x += y;
+		}
+		else {
+			// x - y - epsilon, with 0 < epsilon < 1 in the last position of the window
+			x -= y;
+			if (sticky) --x;
+			if (x == 0 && !sticky) return p;  // exact cancellation
+		}
+	}
+	unsigned lz = countLeadingZeros(x);
+	return round_to(make_extended(resultSign, bigScale + 3 - int(lz), uint128{ 0, x << lz }, sticky), p);
+}
+
+// a * b + c * d with a single rounding for posits of at most 64 bits, the products must be non-zero
+template<size_t nbits, size_t es>
+posit<nbits, es> fmma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, const posit<nbits, es>& d, std::true_type) {
+	posit<nbits, es> p;
+	extended_value sum;
+	if (!add(multiply(unpack(a), unpack(b)), multiply(unpack(c), unpack(d)), sum)) return p;  // exact cancellation
+	return round_to(sum, p);
+}
+
+// a * b + c * d with a single rounding for posits of more than 64 bits
+template<size_t nbits, size_t es>
+posit<nbits, es> fmma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, const posit<nbits, es>& d, std::false_type) {
+	posit<nbits, es> p;
+	quire<nbits, es, 2> q;
+	q += quire_mul(a, b);
+	q += quire_mul(c, d);
+	return convert(q.to_value(), p);
+}
+
+// a * b + c * d + e with a single rounding, used by the complex multiply-accumulate
+// The two exact products are added first: when that sum is exact, adding e in the
+// extended_value kernel rounds once. Otherwise the three terms go through the quire.
+template<size_t nbits, size_t es>
+posit<nbits, es> fmma_accumulate(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, const posit<nbits, es>& d, const posit<nbits, es>& e) {
+	posit<nbits, es> p;
+	if (a.isnar() || b.isnar() || c.isnar() || d.isnar() || e.isnar()) {
+		p.setnar();
+		return p;
+	}
+	bool abZero = a.iszero() || b.iszero();
+	bool cdZero = c.iszero() || d.iszero();
+	if (abZero && cdZero) return e;
+	if (abZero) return fma(c, d, e);
+	if (cdZero) return fma(a, b, e);
+	if (e.iszero()) return internal::fmma(a, b, c, d, std::integral_constant<bool, (nbits <= 64)>());
+	if (nbits <= 64) {
+		extended_value products;
+		if (!add(multiply(unpack(a), unpack(b)), multiply(unpack(c), unpack(d)), products)) return e;
+		if (!products.inexact) {
+			extended_value sum;
+			if (!add(products, unpack(e), sum)) return p;  // exact cancellation
+			return round_to(sum, p);
+		}
+	}
+	quire<nbits, es, 2> q;
+	q += quire_mul(a, b);
+	q += quire_mul(c, d);
+	q += quire_mul(e, posit<nbits, es>(1));
+	return convert(q.to_value(), p);
+}
+
+}  // namespace internal
+
+template<size_t nbits, size_t es>
+posit<nbits, es> fma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
+	posit<nbits, es> p;
+	if (a.isnar() || b.isnar() || c.isnar()) {
+		p.setnar();
+		return p;
+	}
+	if (a.iszero() || b.iszero()) return c;
+	return internal::fma(a, b, c, std::integral_constant<bool, (nbits <= 64)>());
+}
+
+// fms(a, b, c) = a * b - c with a single rounding
+template<size_t nbits, size_t es>
+posit<nbits, es> fms(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
+	return fma(a, b, -c);
+}
+
+// fnma(a, b, c) = -(a * b) + c with a single rounding
+template<size_t nbits, size_t es>
+posit<nbits, es> fnma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
+	return fma(-a, b, c);
+}
+
+// fmma(a, b, c, d) = a * b + c * d, or a * b - c * d when opIsAdd is false, with a single rounding
+template<size_t nbits, size_t es>
+posit<nbits, es> fmma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, const posit<nbits, es>& d, bool opIsAdd = true) {
+	posit<nbits, es> p;
+	if (a.isnar() || b.isnar() || c.isnar() || d.isnar()) {
+		p.setnar();
+		return p;
+	}
+	posit<nbits, es> cc = opIsAdd ? c : -c;
+	bool abZero = a.iszero() || b.iszero();
+	bool cdZero = c.iszero() || d.iszero();
+	if (abZero && cdZero) return p;
+	if (abZero) return cc * d;
+	if (cdZero) return a * b;
+	return internal::fmma(a, b, cc, d, std::integral_constant<bool, (nbits <= 64)>());
+}
+
+///////////////////////////////////////////////////////////////////
+// specialized fma configurations
+
+#if POSIT_FAST_POSIT_16_1
+// fast fma for posit<16,1>: the 26-bit product of the significands fits in a 64-bit window
+template<>
+inline posit<16, 1> fma(const posit<16, 1>& a, const posit<16, 1>& b, const posit<16, 1>& c) {
+	return internal::fma_window64(a, b, c);
+}
+#endif // POSIT_FAST_POSIT_16_1
+
+#if POSIT_FAST_POSIT_32_2
+// fast fma for posit<32,2>: the 56-bit product of the significands fits in a 64-bit window
+template<>
+inline posit<32, 2> fma(const posit<32, 2>& a, const posit<32, 2>& b, const posit<32, 2>& c) {
+	return internal::fma_window64(a, b, c);
+}
+#endif // POSIT_FAST_POSIT_32_2
+
+}  // namespace unum
+}  // namespace sw
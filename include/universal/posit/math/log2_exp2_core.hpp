@@ -0,0 +1,344 @@
+#pragma once
+// log2_exp2_core.hpp: extended precision binary logarithm and exponential kernels for posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <climits>
+#include <type_traits>
+#include "extended_value.hpp"
+
+/*
+The posit pow/exp/exp2/log/log2/log10/exp10 functions all funnel through two integer kernels:
+ 
+   log2(m) for a significand m in [1,2)       -> fixed-point fraction in [0,1)
+   exp2(f) for a fixed-point fraction in [0,1) -> significand in [1,2)
+
+The scale of the posit (regime plus exponent) is carried exactly as an integer, and only the
+fractional part is approximated, using 128-bit fixed-point arithmetic. Both kernels use
+multiplicative normalization with the factors (1 - 2^-i) and (1 + 2^-i), which only requires
+shifts and adds, and finish with a short series for the residual which is smaller than 2^-iterations.
+The truncation error of the kernels is in the order of 2^-120, which is sufficient to round
+correctly for posits up to 64 bits. Larger posits are decoded and rounded through the bitblock
+path, and are accurate to the precision of the kernels.
+*/
+
+namespace sw {
+namespace unum {
+namespace internal {
+
+// number of normalization steps needed to reach an absolute error of 2^-(2*nbits+12) in the kernels
+constexpr unsigned log2_exp2_iterations(size_t nbits) {
+	return ((2 * nbits + 12) / 3 + 1) < 44 ? unsigned((2 * nbits + 12) / 3 + 1) : 44u;
+}
+
+inline uint128 saturating_add(const uint128& a, const uint128& b) {
+	uint128 sum = a + b;
+	return (sum < a) ? uint128{ ~uint64_t(0), ~uint64_t(0) } : sum;
+}
+
+// -log2(1 - 2^-i) for i = 0..44 in Q0.128 as { lower, upper }, entries 0 and 1 are not used
+inline const uint128* log2_reduction_table() {
+	static const uint128 table[45] = {
+		{ 0, 0 },
+		{ 0, 0 },
+		{ 0x5ff4edf5f974522full, 0x6a3fe5c604297860ull },  // i = 2
+		{ 0xd536fc5bec1a57b9ull, 0x315130157f7a64ccull },  // i = 3
+		{ 0x3b4511f8c2b4e4fbull, 0x17d60496cfbb4c67ull },  // i = 4
+		{ 0xf2e1c07f0438ebacull, 0x0bb9ca64ecac6aaeull },  // i = 5
+		{ 0x9520d847df02fc16ull, 0x05d0fba187cd558dull },  // i = 6
+		{ 0x6ba309458c2b6e16ull, 0x02e58f7441ee64ebull },  // i = 7
+		{ 0x6ef18f977e5d8a38ull, 0x01720d9c06a835eaull },  // i = 8
+		{ 0x30edde8d24c7a99aull, 0x00b8d8752172fed1ull },  // i = 9
+		{ 0x57de4833a858671cull, 0x005c60aa252da716ull },  // i = 10
+		{ 0xa6cd1f5328c427f9ull, 0x002e2d71b0d7850aull },  // i = 11
+		{ 0xf996dfc37ec03dc5ull, 0x001716001718cb2aull },  // i = 12
+		{ 0x6a51511cba2fb214ull, 0x000b8ad1de1ac9eaull },  // i = 13
+		{ 0x79dc13455d01858dull, 0x0005c55d640d5abbull },  // i = 14
+		{ 0x3431129f10cc3b80ull, 0x0002e2abcf5235ecull },  // i = 15
+		{ 0xc155bd4e4ed94f5aull, 0x000171552efd6e75ull },  // i = 16
+		{ 0xd2752be1268dcee4ull, 0x0000b8aa6953fa45ull },  // i = 17
+		{ 0xff19772007463442ull, 0x00005c55291f53aaull },  // i = 18
+		{ 0x2fb8cd2b63af762dull, 0x00002e2a91ad0030ull },  // i = 19
+		{ 0xd93663255eca7ba8ull, 0x00001715481dd5c5ull },  // i = 20
+		{ 0x3f9b168bd0facdf1ull, 0x00000b8aa3e0c051ull },  // i = 21
+		{ 0x90e2a9abdad52562ull, 0x000005c551e4d584ull },  // i = 22
+		{ 0x5041409b2f7c9dfaull, 0x000002e2a8ef8819ull },  // i = 23
+		{ 0x6b85efbccdf68d2full, 0x0000017154770b62ull },  // i = 24
+		{ 0xa6ca7649781013e5ull, 0x000000b8aa3b5786ull },  // i = 25
+		{ 0xaface011612b197bull, 0x0000005c551da038ull },  // i = 26
+		{ 0xaee911ee1580dc6eull, 0x0000002e2a8ecd39ull },  // i = 27
+		{ 0x2d394885ab6800a2ull, 0x00000017154765e4ull },  // i = 28
+		{ 0xec0dd70926cb038cull, 0x0000000b8aa3b2c3ull },  // i = 29
+		{ 0x6b6338927cc8ded6ull, 0x00000005c551d956ull },  // i = 30
+		{ 0x5308af984360f9beull, 0x00000002e2a8eca8ull },  // i = 31
+		{ 0x70da1ca1544415ceull, 0x0000000171547653ull },  // i = 32
+		{ 0x8a427f8624f17fedull, 0x00000000b8aa3b29ull },  // i = 33
+		{ 0xb9969c1076f1ef12ull, 0x000000005c551d94ull },  // i = 34
+		{ 0x59e8a51b954fed8bull, 0x000000002e2a8ecaull },  // i = 35
+		{ 0x2c3ba852a134c98dull, 0x0000000017154765ull },  // i = 36
+		{ 0x95efa99a86407c22ull, 0x000000000b8aa3b2ull },  // i = 37
+		{ 0x4aec4a29908a203dull, 0x0000000005c551d9ull },  // i = 38
+		{ 0xa573426bdb9f9434ull, 0x0000000002e2a8ecull },  // i = 39
+		{ 0x52b8e88bb2a66c91ull, 0x0000000001715476ull },  // i = 40
+		{ 0x295c461b4a88df14ull, 0x0000000000b8aa3bull },  // i = 41
+		{ 0x94ae17830191d9c3ull, 0x00000000005c551dull },  // i = 42
+		{ 0xca5708ded7dc4770ull, 0x00000000002e2a8eull },  // i = 43
+		{ 0x652b83b6c1b2fa5cull, 0x0000000000171547ull },  // i = 44
+	};
+	return table;
+}
+
+// log2(1 + 2^-i) for i = 0..44 in Q0.128 as { lower, upper }, entry 0 is not used
+inline const uint128* exp2_reduction_table() {
+	static const uint128 table[45] = {
+		{ 0, 0 },
+		{ 0xa00b120a068badd1ull, 0x95c01a39fbd6879full },  // i = 1
+		{ 0x24afdbfd36bf6d33ull, 0x5269e12f346e2bf9ull },  // i = 2
+		{ 0x401624140d175ba2ull, 0x2b803473f7ad0f3full },  // i = 3
+		{ 0xcc53826144575ac4ull, 0x1663f6fac913167cull },  // i = 4
+		{ 0x9b03784b5be08490ull, 0x0b5d69bac77ec398ull },  // i = 5
+		{ 0x9b89f8846042be52ull, 0x05b9e5a170b48a62ull },  // i = 6
+		{ 0xf1c6f6002f29e888ull, 0x02dfca16dde10a2full },  // i = 7
+		{ 0xad9bd2492f843adeull, 0x01709c46d7aac774ull },  // i = 8
+		{ 0x31d4676d1d817558ull, 0x00b87c1ff853ab26ull },  // i = 9
+		{ 0x7ea7e50e498deb73ull, 0x005c4994dd0fd150ull },  // i = 10
+		{ 0x15ea75a74def0297ull, 0x002e27ac5ef2af86ull },  // i = 11
+		{ 0x8e10f006b0c9b096ull, 0x0017148ec2a1bfc8ull },  // i = 12
+		{ 0xbaa4710b59049899ull, 0x000b8a7588fd29b1ull },  // i = 13
+		{ 0x4ca2cabfb19984ecull, 0x0005c5464ec5f4d7ull },  // i = 14
+		{ 0xc8cdda0c94035caaull, 0x0002e2a60a005c95ull },  // i = 15
+		{ 0x507ba0acfa95398cull, 0x00017153bda8f822ull },  // i = 16
+		{ 0x18de8fd0af9bdfd2ull, 0x0000b8aa0cfedcb1ull },  // i = 17
+		{ 0xd2ddcecd66116ab5ull, 0x00005c55120a0c45ull },  // i = 18
+		{ 0xe4cc8301d32555f0ull, 0x00002e2a8be7ae56ull },  // i = 19
+		{ 0x867d7a99ac240f17ull, 0x0000171546ac814full },  // i = 20
+		{ 0xaaecff08cf68f42eull, 0x00000b8aa3846b33ull },  // i = 21
+		{ 0x2bb725f519222b06ull, 0x000005c551cdc03dull },  // i = 22
+		{ 0x76f65fd01efaf724ull, 0x000002e2a8e9c2c7ull },  // i = 23
+		{ 0xf533378c33d4d4f5ull, 0x0000017154759a0dull },  // i = 24
+		{ 0x8935c83d742790efull, 0x000000b8aa3afb31ull },  // i = 25
+		{ 0x6847b48e625af76eull, 0x0000005c551d8923ull },  // i = 26
+		{ 0x5d0fc70d55ef73d6ull, 0x0000002e2a8ec774ull },  // i = 27
+		{ 0xd8c2f5cd7b85d07aull, 0x0000001715476472ull },  // i = 28
+		{ 0x96f0425b1ad29a22ull, 0x0000000b8aa3b267ull },  // i = 29
+		{ 0x561bd366f9cac6a5ull, 0x00000005c551d93full },  // i = 30
+		{ 0x8db6d64d62a173d4ull, 0x00000002e2a8eca2ull },  // i = 31
+		{ 0xff85a64e9c143456ull, 0x0000000171547651ull },  // i = 32
+		{ 0x2ded61f176e58790ull, 0x00000000b8aa3b29ull },  // i = 33
+		{ 0xa28154ab4b6ef0faull, 0x000000005c551d94ull },  // i = 34
+		{ 0x542353424a6f2e05ull, 0x000000002e2a8ecaull },  // i = 35
+		{ 0x2aca53dc4e7c99acull, 0x0000000017154765ull },  // i = 36
+		{ 0x9593547cf1927029ull, 0x000000000b8aa3b2ull },  // i = 37
+		{ 0x4ad534e22b5e9d3full, 0x0000000005c551d9ull },  // i = 38
+		{ 0xa56d7d1a0254b374ull, 0x0000000002e2a8ecull },  // i = 39
+		{ 0x52b777373c53b461ull, 0x0000000001715476ull },  // i = 40
+		{ 0x295be9c62cf43108ull, 0x0000000000b8aa3bull },  // i = 41
+		{ 0x94ae006dba2cae40ull, 0x00000000005c551dull },  // i = 42
+		{ 0xca5703198602fc90ull, 0x00000000002e2a8eull },  // i = 43
+		{ 0x652b82456d3ca7a4ull, 0x0000000000171547ull },  // i = 44
+	};
+	return table;
+}
+
+// constants as significands in Q1.127 format, the scale is given in the comment
+inline uint128 ln2_significand()     { return uint128{ 0xc9e3b39803f2f6afull, 0xb17217f7d1cf79abull }; }  // 2^-1
+inline uint128 log2e_significand()   { return uint128{ 0xbe87fed0691d3e89ull, 0xb8aa3b295c17f0bbull }; }  // 2^0
+inline uint128 log10_2_significand() { return uint128{ 0x8f8959ac0b7c9178ull, 0x9a209a84fbcff798ull }; }  // 2^-2
+inline uint128 log2_10_significand() { return uint128{ 0x492bf6ff4dafdb4dull, 0xd49a784bcd1b8afeull }; }  // 2^1
+
+// binary logarithm of a significand m in [1,2) given in Q1.127, returned as a Q0.128 fraction in [0,1)
+inline uint128 log2_significand(uint128 m, unsigned iterations) {
+	const uint128* L = log2_reduction_table();
+	const uint128 one = { 0, 0x8000000000000000ull };
+	uint128 y = { 0, 0 };
+	// drive m down to 1 with factors (1 - 2^-i) and accumulate -log2(1 - 2^-i)
+	for (unsigned i = 2; i <= iterations; ++i) {
+		uint128 t = m - (m >> i);
+		while (t >= one) {
+			m = t;
+			y = saturating_add(y, L[i]);
+			t = m - (m >> i);
+		}
+	}
+	// m = 1 + r, r < 2^-iterations: log2(1 + r) = log2(e) * (r - r^2/2 + r^3/3 - ...)
+	uint128 r = (m - one) << 1;
+	if (!iszero(r)) {
+		uint128 r2 = multiply_upper(r, r);
+		uint128 t = r - (r2 >> 1) + (multiply_upper(r2, r) >> 2);  // r^3/4 is within 2^-3*iterations of r^3/3
+		y = saturating_add(y, multiply_upper(t, log2e_significand()) << 1);
+	}
+	return y;
+}
+
+// binary exponential of a Q0.128 fraction f in [0,1), returned as a significand in [1,2) in Q1.127
+inline uint128 exp2_fraction(uint128 f, unsigned iterations) {
+	const uint128* E = exp2_reduction_table();
+	const uint128 max_significand = { ~uint64_t(0), ~uint64_t(0) };
+	uint128 m = { 0, 0x8000000000000000ull };
+	// drive f down to 0 with log2(1 + 2^-i) and accumulate the factors (1 + 2^-i)
+	for (unsigned i = 1; i <= iterations; ++i) {
+		while (f >= E[i]) {
+			f = f - E[i];
+			uint128 t = m + (m >> i);
+			m = (t < m) ? max_significand : t;
+		}
+	}
+	// f < 2^-iterations: 2^f = 1 + g + g^2/2 + g^3/6 with g = f * ln(2)
+	if (!iszero(f)) {
+		uint128 g = multiply_upper(f, ln2_significand());  // ln(2) significand is 2*ln(2) in Q1.127, which is ln(2) in Q0.128
+		uint128 g2 = multiply_upper(g, g);
+		uint128 t = g + (g2 >> 1) + (multiply_upper(g2, g) >> 3);  // g^3/8 is within 2^-3*iterations of g^3/6
+		uint128 s = m + multiply_upper(m, t);
+		m = (s < m) ? max_significand : s;
+	}
+	return m;
+}
+
+// construct an extended value from a non-zero fixed-point value integer + fraction/2^128
+inline extended_value normalize_fixed(bool sign, uint64_t integer, const uint128& fraction, bool inexact) {
+	extended_value v;
+	v.sign = sign;
+	if (integer != 0) {
+		unsigned msb = 63 - countLeadingZeros(integer);
+		v.scale = int(msb);
+		v.significand = (uint128{ integer, 0 } << (127 - msb)) | (fraction >> (msb + 1));
+		v.inexact = inexact || anyAfter(fraction, msb + 1);
+	}
+	else {
+		unsigned lz = countLeadingZeros(fraction);
+		v.scale = -int(lz) - 1;
+		v.significand = fraction << lz;
+		v.inexact = inexact;
+	}
+	return v;
+}
+
+// log2(x) for x > 0, x != 1
+inline extended_value log2(const extended_value& x, unsigned iterations) {
+	uint128 y = log2_significand(x.significand, iterations);
+	bool inexact = x.inexact || !iszero(y);  // log2 of a significand other than 1 is irrational
+	if (x.scale == 0 && iszero(y)) {
+		// significand within 2^-127 of 1: only reachable for inexact posits wider than 64 bits
+		return make_extended(false, -128, uint128{ 0, 0x8000000000000000ull }, true);
+	}
+	if (x.scale >= 0) return normalize_fixed(false, uint64_t(x.scale), y, inexact);
+	// negative result: log2(x) = -((-scale - 1) + (1 - y))
+	if (iszero(y)) return normalize_fixed(true, uint64_t(-(long long)x.scale), y, inexact);
+	return normalize_fixed(true, uint64_t(-(long long)x.scale - 1), ~y + uint128{ 1, 0 }, inexact);
+}
+
+// 2^t for an extended value t, saturating the scale when t is outside of the range of any posit
+inline extended_value exp2(const extended_value& t, unsigned iterations) {
+	const uint128 one = { 0, 0x8000000000000000ull };
+	if (t.scale >= 30) {
+		return make_extended(false, (t.sign ? -EXTENDED_SCALE_SATURATION : EXTENDED_SCALE_SATURATION), one, true);
+	}
+	// split |t| into an integer and a Q0.128 fraction
+	uint64_t integer;
+	uint128 fraction;
+	bool inexact = t.inexact;
+	if (t.scale >= 0) {
+		integer = t.significand.upper >> (63 - t.scale);
+		fraction = t.significand << unsigned(t.scale + 1);
+	}
+	else {
+		unsigned shift = unsigned(-(t.scale + 1));
+		integer = 0;
+		fraction = t.significand >> shift;
+		inexact = inexact || anyAfter(t.significand, shift);
+	}
+	// 2^-(n + f) = 2^(-n - 1) * 2^(1 - f)
+	long long n = (long long)integer;
+	if (t.sign) {
+		if (!iszero(fraction) || inexact) {
+			n = -n - 1;
+			fraction = inexact ? ~fraction : ~fraction + uint128{ 1, 0 };
+		}
+		else {
+			n = -n;
+		}
+	}
+	uint128 m = iszero(fraction) ? one : exp2_fraction(fraction, iterations);
+	return make_extended(false, int(n), m, inexact || !iszero(fraction));
+}
+
+// x^y for a positive integer y, when the result fits exactly in the 128-bit significand
+// returns false when the exact result is too wide
+inline bool integer_power_exact(const extended_value& x, unsigned long long y, extended_value& result) {
+	// x = M * 2^(scale - width + 1) with M odd
+	uint128 M = x.significand;
+	unsigned tz = countTrailingZeros(M);
+	M = M >> tz;
+	unsigned width = 128 - tz;
+	if (x.inexact || y == 0 || y > 128 || (unsigned long long)(width) * y > 128) return false;
+	uint128 power = M;
+	for (unsigned long long i = 1; i < y; ++i) {
+		uint128 upper, lower;
+		multiply(power, M, upper, lower);
+		power = lower;
+	}
+	unsigned msb = 127 - countLeadingZeros(power);
+	long long scale = (long long)(y) * (long long)(x.scale - int(width) + 1) + (long long)(msb);
+	if (scale > EXTENDED_SCALE_SATURATION) scale = EXTENDED_SCALE_SATURATION;
+	if (scale < -EXTENDED_SCALE_SATURATION) scale = -EXTENDED_SCALE_SATURATION;
+	result = make_extended(x.sign && (y & 1), int(scale), power << (127 - msb), false);
+	return true;
+}
+
+// classify an extended value as an integer: returns true if integer, and sets odd if it is an odd integer
+inline bool is_integer(const extended_value& v, bool& odd) {
+	odd = false;
+	if (v.inexact || v.scale < 0) return false;
+	if (v.scale > 127) return true;
+	unsigned fraction_bits = unsigned(127 - v.scale);
+	if (anyAfter(v.significand, fraction_bits)) return false;
+	odd = ((v.significand >> fraction_bits).lower & 1) != 0;
+	return true;
+}
+
+// decompose an exact, positive, non-integer y as p / 2^k with p odd
+// returns false when p or 2^k are too large for integer_power_exact()
+inline bool dyadic_fraction(const extended_value& y, unsigned long long& p, unsigned& k) {
+	if (y.sign || y.inexact) return false;
+	unsigned tz = countTrailingZeros(y.significand);
+	int width = 128 - int(tz);
+	int fraction_bits = width - 1 - y.scale;
+	if (fraction_bits < 1 || fraction_bits > 7 || width > 8) return false;
+	p = (y.significand >> tz).lower;
+	k = unsigned(fraction_bits);
+	return true;
+}
+
+// |x|^y for x != 0, x != 1, y != 0; the sign of the result is set by the caller
+inline extended_value pow(const extended_value& x, const extended_value& y, unsigned iterations) {
+	bool odd;
+	extended_value ax = x;
+	ax.sign = false;
+	if (!y.sign && is_integer(y, odd) && y.scale < 8) {
+		// small positive integer exponent: the product may be exact
+		unsigned long long n = (y.significand.upper >> (63 - y.scale));
+		extended_value result;
+		if (integer_power_exact(ax, n, result)) return result;
+	}
+	return exp2(multiply(y, log2(ax, iterations)), iterations);
+}
+
+// convert an int to an extended value
+inline extended_value to_extended(long long i) {
+	bool sign = i < 0;
+	uint64_t magnitude = sign ? uint64_t(0) - uint64_t(i) : uint64_t(i);
+	return normalize_fixed(sign, magnitude, uint128{ 0, 0 }, false);
+}
+
+// convert a finite non-zero double to an extended value
+inline extended_value to_extended(double d) {
+	int exponent;
+	double fr = std::frexp(std::abs(d), &exponent);  // fr in [0.5, 1)
+	uint64_t bits = uint64_t(std::ldexp(fr, 64));      // exact: 53 significant bits
+	return make_extended(d < 0, exponent - 1, uint128{ 0, bits }, false);
+}
+
+}  // namespace internal
+}  // namespace unum
+}  // namespace sw
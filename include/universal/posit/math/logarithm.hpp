@@ -1,33 +1,68 @@
 #pragma once
 // logarithm.hpp: logarithm functions for posits
 //
-// Copyright (C) 2017-2018 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "log2_exp2_core.hpp"
 
 namespace sw {
 	namespace unum {
 
-		// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-		// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+		// log, log2, and log10 carry the scale of the posit exactly and compute the logarithm of the significand
+		// in 128-bit fixed-point, see log2_exp2_core.hpp. The logarithm of zero or of a negative value is NaR.
 
-		// Natural logarithm of x
+		// Binary logarithm of x
 		template<size_t nbits, size_t es>
-		posit<nbits,es> log(posit<nbits,es> x) {
-			return posit<nbits,es>(std::log(double(x)));
+		posit<nbits,es> log2(posit<nbits,es> x) {
+			posit<nbits, es> p;
+			if (x.isnar() || x.iszero() || x.isneg()) {
+				p.setnar();
+				return p;
+			}
+			if (x.isone()) return p;  // p is zero
+			constexpr unsigned iterations = internal::log2_exp2_iterations(nbits);
+			return internal::round_to(internal::log2(internal::unpack(x), iterations), p);
 		}
 
-		// Binary logarithm of x
+		// Natural logarithm of x
 		template<size_t nbits, size_t es>
-		posit<nbits,es> log2(posit<nbits,es> x) {
-			return posit<nbits,es>(std::log2(double(x)));
+		posit<nbits,es> log(posit<nbits,es> x) {
+			posit<nbits, es> p;
+			if (x.isnar() || x.iszero() || x.isneg()) {
+				p.setnar();
+				return p;
+			}
+			if (x.isone()) return p;
+			constexpr unsigned iterations = internal::log2_exp2_iterations(nbits);
+			internal::extended_value ln2 = internal::make_extended(false, -1, internal::ln2_significand(), true);
+			return internal::round_to(internal::multiply(internal::log2(internal::unpack(x), iterations), ln2), p);
 		}
 
 		// Decimal logarithm of x
 		template<size_t nbits, size_t es>
 		posit<nbits,es> log10(posit<nbits,es> x) {
-			return posit<nbits,es>(std::log10(double(x)));
+			posit<nbits, es> p;
+			if (x.isnar() || x.iszero() || x.isneg()) {
+				p.setnar();
+				return p;
+			}
+			if (x.isone()) return p;
+			constexpr unsigned iterations = internal::log2_exp2_iterations(nbits);
+			internal::extended_value v = internal::unpack(x);
+			// exact powers of ten have an exact logarithm
+			int k = 0;
+			if (v.scale > 0) {
+				// 10^k = 5^k * 2^k, so the odd part of the significand must be 5^k
+				uint128 odd = v.significand >> countTrailingZeros(v.significand);
+				unsigned width = 128 - countLeadingZeros(odd);
+				uint64_t power = 1;
+				while (k < 27 && power < odd.lower) { power *= 5; ++k; }
+				if (odd.upper != 0 || power != odd.lower || v.scale != k + int(width) - 1) k = 0;
+			}
+			if (k > 0) return p = k;
+			internal::extended_value log10_2 = internal::make_extended(false, -2, internal::log10_2_significand(), true);
+			return internal::round_to(internal::multiply(internal::log2(v, iterations), log10_2), p);
 		}
 		
 		// Natural logarithm of 1+x
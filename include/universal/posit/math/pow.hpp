@@ -1,30 +1,87 @@
 #pragma once
 // pow.hpp: pow functions for posits
 //
-// Copyright (C) 2017-2019 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "log2_exp2_core.hpp"
 
 namespace sw {
 namespace unum {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// pow(x, y) is evaluated as 2^(y * log2(|x|)) with the scale of log2(|x|) carried exactly, see log2_exp2_core.hpp.
+// Small positive integer powers whose result fits in 128 bits are computed exactly.
+// The special cases follow std::pow, except that NaR propagates and that results saturate to minpos/maxpos:
+//   pow(x, 0)          = 1 for any x that is not NaR
+//   pow(1, y)          = 1 for any y that is not NaR
+//   pow(0, y)          = 0 for y > 0, NaR for y < 0
+//   pow(x, y) for x < 0 is NaR when y is not an integer, and takes the sign of x when y is odd
+namespace internal {
+// The approximation of x^y can only round incorrectly when the exact result sits on the midpoint between
+// two posits, which requires y = p/2^k and a short significand, as in pow(36, 1.5) = 216.
+// The candidate midpoint c is found by rounding to a posit with one more bit, and verified exactly as c^(2^k) == x^p.
+template<size_t nbits, size_t es>
+void resolve_midpoint(const extended_value& ax, const extended_value& y, extended_value& r) {
+	unsigned long long numerator;
+	unsigned k;
+	if (!dyadic_fraction(y, numerator, k)) return;
+	posit<nbits + 1, es> candidate;
+	round_to(r, candidate);
+	if (candidate.isnar() || !candidate.get()[0]) return;  // not a midpoint encoding
+	extended_value c = unpack(candidate), lhs, rhs;
+	if (!integer_power_exact(c, 1ull << k, lhs) || !integer_power_exact(ax, numerator, rhs)) return;
+	if (lhs.scale == rhs.scale && lhs.significand == rhs.significand) r = c;
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> posit_pow(const posit<nbits, es>& x, const extended_value& y, bool yIsZero) {
+	posit<nbits, es> p;
+	if (x.isnar()) {
+		p.setnar();
+		return p;
+	}
+	if (yIsZero || x.isone()) return p = 1;
+	if (x.iszero()) {
+		if (y.sign) p.setnar();
+		return p;
+	}
+	bool odd = false;
+	if (x.isneg() && !is_integer(y, odd)) {
+		p.setnar();
+		return p;
+	}
+	constexpr unsigned iterations = log2_exp2_iterations(nbits);
+	extended_value ax = unpack(x);
+	ax.sign = false;
+	extended_value r = pow(ax, y, iterations);
+	if (r.inexact) resolve_midpoint<nbits, es>(ax, y, r);
+	r.sign = x.isneg() && odd;
+	return round_to(r, p);
+}
+}  // namespace internal
 
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, posit<nbits, es> y) {
-	return posit<nbits,es>(std::pow(double(x), double(y)));
+	if (y.isnar()) return y;
+	if (y.iszero()) return internal::posit_pow(x, internal::extended_value(), true);
+	return internal::posit_pow(x, internal::unpack(y), false);
 }
 		
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, int y) {
-	return posit<nbits,es>(std::pow(double(x), double(y)));
+	if (y == 0) return internal::posit_pow(x, internal::extended_value(), true);
+	return internal::posit_pow(x, internal::to_extended((long long)y), false);
 }
 		
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, double y) {
-	return posit<nbits,es>(std::pow(double(x), y));
+	if (std::isnan(y) || std::isinf(y)) {
+		posit<nbits, es> p;
+		p.setnar();
+		return p;
+	}
+	if (y == 0.0) return internal::posit_pow(x, internal::extended_value(), true);
+	return internal::posit_pow(x, internal::to_extended(y), false);
 }
 
 // calculate an integer power function base^int
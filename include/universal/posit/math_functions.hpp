@@ -20,6 +20,7 @@ An algebraic treatment of elementary functions was started by Joseph Fels Ritt i
 #include "math/constants.hpp"
 #include "math/error_and_gamma.hpp"
 #include "math/exponent.hpp"
+#include "math/fma.hpp"
 #include "math/fractional.hpp"
 #include "math/hyperbolic.hpp"
 #include "math/hypot.hpp"
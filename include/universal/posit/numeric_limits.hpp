@@ -156,7 +156,7 @@ namespace std {
 
 		static constexpr int digits = (es + 2 > nbits ? 0 : nbits - 3 - es);
 		static constexpr int digits10 = int((digits) / 3.3);
-		static constexpr int max_digits10 = 0;
+		static constexpr int max_digits10 = 2 + (digits + 1) * 301 / 1000;  // decimal digits that distinguish the posits of the highest precision
 		static constexpr bool is_signed = true;
 		static constexpr bool is_integer = false;
 		static constexpr bool is_exact = false;
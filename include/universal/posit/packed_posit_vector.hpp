@@ -0,0 +1,258 @@
+#pragma once
+// packed_posit_vector.hpp: a container that stores posits densely at a stride of nbits bits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace sw {
+namespace unum {
+
+/*
+A std::vector<posit<10,0>> stores each posit in a 64-bit word: streaming it through a kernel moves
+six times the bytes that the encodings occupy. The packed_posit_vector stores the encodings back to
+back in 64-bit words, element i at bit offset i*nbits, so that an element straddles at most two
+words. One padding word past the end lets every read and write touch both words without a branch.
+
+Element access goes through a proxy reference, like std::vector<bool>; the const operator[] returns
+the posit by value, which makes the container usable with the fused dot products of fdp.hpp. Kernels
+that want the posits at their register width move them in blocks with unpack() and pack().
+*/
+
+template<size_t nbits, size_t es>
+class packed_posit_vector {
+	static_assert(nbits >= 2 && nbits <= 64, "packed_posit_vector stores posits of 2 to 64 bits");
+public:
+	using value_type = posit<nbits, es>;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+
+	static constexpr uint64_t mask = (nbits == 64 ? ~uint64_t(0) : ((uint64_t(1) << (nbits % 64)) - 1));
+	// 64 elements span exactly nbits words
+	static constexpr size_t block_size = 64;
+
+	// proxy to an element of the container
+	class reference {
+	public:
+		reference(const reference&) = default;
+		operator value_type() const { return _v->get(_i); }
+		reference& operator=(const value_type& p) { _v->set(_i, p); return *this; }
+		reference& operator=(const reference& r) { _v->set_bits(_i, r._v->get_bits(r._i)); return *this; }
+		reference& operator+=(const value_type& p) { return *this = value_type(*this) + p; }
+		reference& operator-=(const value_type& p) { return *this = value_type(*this) - p; }
+		reference& operator*=(const value_type& p) { return *this = value_type(*this) * p; }
+		reference& operator/=(const value_type& p) { return *this = value_type(*this) / p; }
+		uint64_t bits() const { return _v->get_bits(_i); }
+
+		friend void swap(reference a, reference b) {
+			uint64_t t = a.bits();
+			a._v->set_bits(a._i, b.bits());
+			b._v->set_bits(b._i, t);
+		}
+
+	private:
+		friend class packed_posit_vector;
+		reference(packed_posit_vector* v, size_t i) : _v(v), _i(i) {}
+		packed_posit_vector* _v;
+		size_t _i;
+	};
+
+	// random access iterator over the elements, yielding proxies, or posits by value when constant
+	template<bool isConst>
+	class basic_iterator {
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = posit<nbits, es>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = typename std::conditional<isConst, value_type, typename packed_posit_vector::reference>::type;
+		using container = typename std::conditional<isConst, const packed_posit_vector, packed_posit_vector>::type;
+
+		basic_iterator() : _v(nullptr), _i(0) {}
+		basic_iterator(container* v, size_t i) : _v(v), _i(i) {}
+		// a mutable iterator converts to a constant one
+		template<bool c = isConst, typename = typename std::enable_if<c>::type>
+		basic_iterator(const basic_iterator<false>& it) : _v(it._v), _i(it._i) {}
+
+		reference operator*() const { return (*_v)[_i]; }
+		reference operator[](difference_type n) const { return (*_v)[size_t(difference_type(_i) + n)]; }
+
+		basic_iterator& operator++() { ++_i; return *this; }
+		basic_iterator& operator--() { --_i; return *this; }
+		basic_iterator operator++(int) { basic_iterator t(*this); ++_i; return t; }
+		basic_iterator operator--(int) { basic_iterator t(*this); --_i; return t; }
+		basic_iterator& operator+=(difference_type n) { _i = size_t(difference_type(_i) + n); return *this; }
+		basic_iterator& operator-=(difference_type n) { _i = size_t(difference_type(_i) - n); return *this; }
+		friend basic_iterator operator+(basic_iterator it, difference_type n) { return it += n; }
+		friend basic_iterator operator+(difference_type n, basic_iterator it) { return it += n; }
+		friend basic_iterator operator-(basic_iterator it, difference_type n) { return it -= n; }
+		friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) { return difference_type(a._i) - difference_type(b._i); }
+
+		friend bool operator==(const basic_iterator& a, const basic_iterator& b) { return a._i == b._i; }
+		friend bool operator!=(const basic_iterator& a, const basic_iterator& b) { return a._i != b._i; }
+		friend bool operator< (const basic_iterator& a, const basic_iterator& b) { return a._i <  b._i; }
+		friend bool operator> (const basic_iterator& a, const basic_iterator& b) { return a._i >  b._i; }
+		friend bool operator<=(const basic_iterator& a, const basic_iterator& b) { return a._i <= b._i; }
+		friend bool operator>=(const basic_iterator& a, const basic_iterator& b) { return a._i >= b._i; }
+
+	private:
+		friend class basic_iterator<true>;
+		container* _v;
+		size_t _i;
+	};
+	using iterator = basic_iterator<false>;
+	using const_iterator = basic_iterator<true>;
+
+	packed_posit_vector() : _size(0), _words(1, 0) {}
+	explicit packed_posit_vector(size_t n, const value_type& p = value_type(0)) : _size(0), _words(1, 0) { resize(n, p); }
+	packed_posit_vector(std::initializer_list<value_type> list) : _size(0), _words(1, 0) { assign(list.begin(), list.end()); }
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	packed_posit_vector(InputIterator first, InputIterator last) : _size(0), _words(1, 0) { assign(first, last); }
+
+	template<typename InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		clear();
+		for (; first != last; ++first) push_back(value_type(*first));
+	}
+
+	// capacity
+	size_t size() const { return _size; }
+	bool empty() const { return _size == 0; }
+	// the bytes that hold the encodings
+	size_t storage_bytes() const { return (_size * nbits + 7) / 8; }
+	void reserve(size_t n) { _words.reserve(words_for(n)); }
+	void clear() {
+		_size = 0;
+		_words.assign(1, 0);
+	}
+	void resize(size_t n, const value_type& p = value_type(0)) {
+		size_t old = _size;
+		_words.resize(words_for(n), 0);
+		if (n < old) {
+			// clear the bits past the new end, so that the padding stays zero
+			size_t bit = n * nbits;
+			_words[bit / 64] &= (bit % 64 == 0 ? 0 : ~uint64_t(0) >> (64 - bit % 64));
+			for (size_t w = bit / 64 + 1; w < _words.size(); ++w) _words[w] = 0;
+		}
+		_size = n;
+		uint64_t bits = encoding_of(p);
+		if (bits != 0) for (size_t i = old; i < n; ++i) set_bits(i, bits);
+	}
+	void push_back(const value_type& p) {
+		_words.resize(words_for(_size + 1), 0);
+		set_bits(_size++, encoding_of(p));
+	}
+	void pop_back() { resize(_size - 1); }
+
+	// element access
+	reference operator[](size_t i) { return reference(this, i); }
+	value_type operator[](size_t i) const { return get(i); }
+	reference at(size_t i) {
+		if (i >= _size) throw std::out_of_range("packed_posit_vector index out of range");
+		return reference(this, i);
+	}
+	value_type at(size_t i) const {
+		if (i >= _size) throw std::out_of_range("packed_posit_vector index out of range");
+		return get(i);
+	}
+	reference front() { return reference(this, 0); }
+	reference back() { return reference(this, _size - 1); }
+	value_type front() const { return get(0); }
+	value_type back() const { return get(_size - 1); }
+
+	iterator begin() { return iterator(this, 0); }
+	iterator end() { return iterator(this, _size); }
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, _size); }
+	const_iterator cbegin() const { return begin(); }
+	const_iterator cend() const { return end(); }
+
+	// the encoding of element i
+	uint64_t get_bits(size_t i) const {
+		size_t bit = i * nbits;
+		size_t w = bit / 64;
+		unsigned s = unsigned(bit % 64);
+		// the second shift is split so that it stays below 64 when the element starts at a word boundary
+		return ((_words[w] >> s) | ((_words[w + 1] << 1) << (63 - s))) & mask;
+	}
+	void set_bits(size_t i, uint64_t bits) {
+		size_t bit = i * nbits;
+		size_t w = bit / 64;
+		unsigned s = unsigned(bit % 64);
+		bits &= mask;
+		_words[w] = (_words[w] & ~(mask << s)) | (bits << s);
+		_words[w + 1] = (_words[w + 1] & ~((mask >> 1) >> (63 - s))) | ((bits >> 1) >> (63 - s));
+	}
+	value_type get(size_t i) const {
+		value_type p;
+		p.set_raw_bits(get_bits(i));
+		return p;
+	}
+	void set(size_t i, const value_type& p) { set_bits(i, encoding_of(p)); }
+
+	// block moves between the packed elements [first, first + n) and posits at their register width
+	void unpack(size_t first, size_t n, value_type* dst) const {
+		stream_out(first, n, [dst](size_t i, uint64_t bits) { dst[i].set_raw_bits(bits); });
+	}
+	void pack(size_t first, size_t n, const value_type* src) {
+		stream_in(first, n, [src](size_t i) { return encoding_of(src[i]); });
+	}
+	// block moves of the raw encodings
+	void unpack_bits(size_t first, size_t n, uint64_t* dst) const {
+		stream_out(first, n, [dst](size_t i, uint64_t bits) { dst[i] = bits; });
+	}
+	void pack_bits(size_t first, size_t n, const uint64_t* src) {
+		stream_in(first, n, [src](size_t i) { return src[i] & mask; });
+	}
+
+	// the packed words, followed by one zero padding word
+	const uint64_t* data() const { return _words.data(); }
+
+	friend bool operator==(const packed_posit_vector& a, const packed_posit_vector& b) { return a._size == b._size && a._words == b._words; }
+	friend bool operator!=(const packed_posit_vector& a, const packed_posit_vector& b) { return !(a == b); }
+
+private:
+	size_t _size;
+	std::vector<uint64_t> _words;
+
+	static size_t words_for(size_t n) { return (n * nbits + 63) / 64 + 1; }
+
+	// read the elements [first, first + n) in order: every element is an independent two word extract
+	template<typename Sink>
+	void stream_out(size_t first, size_t n, Sink sink) const {
+		for (size_t i = 0; i < n; ++i) sink(i, get_bits(first + i));
+	}
+	// write the elements [first, first + n) in order, assembling each word in a register before it is stored
+	template<typename Source>
+	void stream_in(size_t first, size_t n, Source source) {
+		size_t bit = first * nbits;
+		size_t w = bit / 64;
+		unsigned s = unsigned(bit % 64);
+		uint64_t below = s == 0 ? 0 : ~uint64_t(0) >> (64 - s);  // the bits of the elements before first
+		uint64_t word = _words[w] & below;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t bits = source(i);
+			word |= bits << s;
+			s += unsigned(nbits);
+			if (s >= 64) {
+				_words[w++] = word;
+				s -= 64;
+				word = s == 0 ? 0 : bits >> (nbits - s);
+			}
+		}
+		// merge the last partial word with the elements after the range
+		below = s == 0 ? 0 : ~uint64_t(0) >> (64 - s);
+		_words[w] = (_words[w] & ~below) | word;
+	}
+	static uint64_t encoding_of(const value_type& p) { return uint64_t(p.encoding()) & mask; }
+};
+
+}  // namespace unum
+}  // namespace sw
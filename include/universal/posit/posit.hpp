@@ -1113,14 +1113,8 @@ public:
 	}
 	// Set the raw bits of the posit given an unsigned value starting from the lsb. Handy for enumerating a posit state space
 	posit<nbits,es>& set_raw_bits(uint64_t value) {
-		clear();
-		bitblock<nbits> raw_bits;
-		uint64_t mask = 1;
-		for ( size_t i = 0; i < nbits; i++ ) {
-			raw_bits.set(i,(value & mask));
-			mask <<= 1;
-		}
-		_raw_bits = raw_bits;
+		// the bitset assignment keeps the nbits least significant bits, and zeros the bits beyond 64
+		_raw_bits = (unsigned long long)value;
 		return *this;
 	}
 
@@ -1754,7 +1748,9 @@ inline std::ostream& operator<<(std::ostream& ostr, const posit<nbits, es>& p) {
 	ff = ostr.flags();
 	ss.flags(ff);
 //	ss << std::showpos << std::setw(width) << std::setprecision(prec) << (long double)p;
-	ss << std::setw(width) << std::setprecision(prec) << (long double)p;  // TODO: we need a true native serialization function
+	// the stream formats the value with its precision and flags: the shortest decimal that reads back
+	// to the posit, which ignores them, is to_chars(first, last, p) of posit_charconv.hpp
+	ss << std::setw(width) << std::setprecision(prec) << (long double)p;
 #endif
 	return ostr << ss.str();
 }
@@ -2662,55 +2658,6 @@ posit<nbits, es> maxpos() {
 
 // Atomic fused operators
 
-// FMA: fused multiply-add:  a*b + c
-template<size_t nbits, size_t es>
-value<1 + 2 * (nbits - es)> fma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
-	constexpr size_t fbits = nbits - 3 - es;
-	constexpr size_t fhbits = fbits + 1;      // size of fraction + hidden bit
-	constexpr size_t mbits = 2 * fhbits;      // size of the multiplier output
-	constexpr size_t abits = mbits + 4;       // size of the addend
-
-	value<mbits> product;
-	value<abits + 1> sum;
-	value<fbits> va, vb, ctmp;
-
-	// special case handling of input arguments
-	if (a.isnar() || b.isnar() || c.isnar()) {
-		sum.setnan();
-		return sum;
-	}
-
-	if (a.iszero() || b.iszero()) {  // product will only become non-zero if neither a and b are zero
-		if (c.iszero()) {
-			sum.setzero();
-		}
-		else {
-			ctmp.set(sign(c), scale(c), extract_fraction<nbits, es, fbits>(c), c.iszero(), c.isnar());
-			sum.template right_extend<fbits, abits + 1>(ctmp); // right-extend the c input argument and assign to sum
-		}
-	}
-	else { // else clause guarantees that the product is non-zero	
-		// first, the multiply: transform the inputs into (sign,scale,fraction) triples
-		va.set(sign(a), scale(a), extract_fraction<nbits, es, fbits>(a), a.iszero(), a.isnar());;
-		vb.set(sign(b), scale(b), extract_fraction<nbits, es, fbits>(b), b.iszero(), b.isnar());;
-
-		module_multiply(va, vb, product);    // multiply the two inputs
-
-		// second, the add : at this point we are guaranteed that product is non-zero and non-nar
-		if (c.iszero()) {				
-			sum.template right_extend<mbits, abits + 1>(product);   // right-extend the product and assign to sum
-		}
-		else {
-			ctmp.set(sign(c), scale(c), extract_fraction<nbits, es, fbits>(c), c.iszero(), c.isnar());
-			value<mbits> vc;
-			vc.template right_extend<fbits, mbits>(ctmp); // right-extend the c argument and assign to adder input
-			module_add<mbits, abits>(product, vc, sum);
-		}
-	}
-
-	return sum;
-}
-
 // FAM: fused add-multiply: (a + b) * c
 template<size_t nbits, size_t es>
 value<2 * (nbits - 2 - es)> fam(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c) {
@@ -2741,14 +2688,7 @@ value<2 * (nbits - 2 - es)> fam(const posit<nbits, es>& a, const posit<nbits, es
 	return product;
 }
 
-// FMMA: fused multiply-multiply-add: (a * b) +/- (c * d)
-template<size_t nbits, size_t es>
-value<nbits> fmma(const posit<nbits, es>& a, const posit<nbits, es>& b, const posit<nbits, es>& c, const posit<nbits, es>& d, bool opIsAdd = true)
-{
-	// todo: implement
-	value<nbits> result;
-	return result;
-}
+// FMA, FMS, FNMA, and FMMA, fused multiply-multiply-add, are defined in math/fma.hpp
 
 // Type traits
 template<typename Ty, Ty val>
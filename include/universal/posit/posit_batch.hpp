@@ -0,0 +1,394 @@
+#pragma once
+// posit_batch.hpp: batch arithmetic over contiguous arrays of posits with runtime SIMD dispatch
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "simd/batch_op.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////
+// enable/disable the SIMD batch kernels: the scalar loops are always available
+#if !defined(POSIT_BATCH_SIMD)
+#if defined(__x86_64__) || defined(_M_X64)
+#define POSIT_BATCH_SIMD 1
+#else
+#define POSIT_BATCH_SIMD 0
+#endif
+#endif
+
+#if POSIT_BATCH_SIMD
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include "simd/lanes_avx2.hpp"
+#include "simd/lanes_avx512.hpp"
+#endif
+
+namespace sw {
+namespace unum {
+
+/*
+The batch functions apply an operation elementwise to contiguous arrays of n posits:
+	batch_add(a, b, c, n)      c[i] = a[i] + b[i]
+	batch_sub(a, b, c, n)      c[i] = a[i] - b[i]
+	batch_mul(a, b, c, n)      c[i] = a[i] * b[i]
+	batch_div(a, b, c, n)      c[i] = a[i] / b[i]
+	batch_fma(a, b, c, d, n)   d[i] = fma(a[i], b[i], c[i])
+	batch_negate(a, c, n)      c[i] = -a[i]
+	batch_less(a, b, r, n)     r[i] = a[i] < b[i]
+	batch_equal(a, b, r, n)    r[i] = a[i] == b[i]
+	convert(f, p, n)           p[i] = f[i], from float or double, rounded to nearest even
+	convert(p, f, n)           f[i] = p[i], to float or double, rounded to nearest even
+The fast specializations of posit<8,0>, posit<16,1>, and posit<32,2> run on SIMD lanes,
+selected at runtime for the processor in use: posit<8,0> computes in 16-bit lanes, thirty-two
+per AVX-512 register and sixteen per AVX2 register, the other two in 64-bit lanes, eight and
+four per register. The results are identical to the scalar operators. All other
+configurations, and processors without AVX2, run the scalar loop.
+*/
+
+// the instruction sets of the batch kernels, in increasing capability
+enum class batch_isa { scalar = 0, avx2 = 1, avx512 = 2 };
+
+inline const char* to_string(batch_isa isa) {
+	switch (isa) {
+	case batch_isa::avx512: return "avx512";
+	case batch_isa::avx2:   return "avx2";
+	default:                return "scalar";
+	}
+}
+
+// the most capable instruction set of the processor, including the operating system support for its registers
+inline batch_isa batch_detect_isa() {
+#if POSIT_BATCH_SIMD
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512bw")) return batch_isa::avx512;
+	if (__builtin_cpu_supports("avx2")) return batch_isa::avx2;
+#elif defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) return batch_isa::scalar;
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	if (!osxsave) return batch_isa::scalar;
+	unsigned long long xcr0 = _xgetbv(0);
+	__cpuidex(info, 7, 0);
+	bool avx2 = (info[1] & (1 << 5)) != 0;
+	bool avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 28)) != 0 && (info[1] & (1 << 30)) != 0;
+	if (avx512 && (xcr0 & 0xE6) == 0xE6) return batch_isa::avx512;
+	if (avx2 && (xcr0 & 0x6) == 0x6) return batch_isa::avx2;
+#endif
+#endif
+	return batch_isa::scalar;
+}
+
+namespace internal {
+
+inline batch_isa& batch_isa_setting() {
+	static batch_isa isa = batch_detect_isa();
+	return isa;
+}
+
+}  // namespace internal
+
+// the instruction set the batch functions use
+inline batch_isa batch_active_isa() {
+	return internal::batch_isa_setting();
+}
+
+// select the instruction set of the batch functions, limited to what the processor supports, and return the selection
+inline batch_isa batch_select_isa(batch_isa isa) {
+	batch_isa best = batch_detect_isa();
+	internal::batch_isa_setting() = (int(isa) < int(best)) ? isa : best;
+	return internal::batch_isa_setting();
+}
+
+// the posit configurations with SIMD batch kernels: the fast specializations hold nothing but their encoding
+template<size_t nbits, size_t es>
+struct batch_encoding {
+	static constexpr bool simd = false;
+	using type = void;
+};
+#if POSIT_FAST_POSIT_8_0
+template<>
+struct batch_encoding<8, 0> {
+	static constexpr bool simd = true;
+	using type = uint8_t;
+};
+#endif
+#if POSIT_FAST_POSIT_16_1
+template<>
+struct batch_encoding<16, 1> {
+	static constexpr bool simd = true;
+	using type = uint16_t;
+};
+#endif
+#if POSIT_FAST_POSIT_32_2
+template<>
+struct batch_encoding<32, 2> {
+	static constexpr bool simd = true;
+	using type = uint32_t;
+};
+#endif
+
+namespace internal {
+
+// the SIMD dispatch returns false when the caller needs to run the scalar loop
+template<batch_op op, size_t nbits, size_t es>
+inline bool batch_binary(const posit<nbits, es>*, const posit<nbits, es>*, posit<nbits, es>*, size_t, std::false_type) {
+	return false;
+}
+template<size_t nbits, size_t es>
+inline bool batch_fma(const posit<nbits, es>*, const posit<nbits, es>*, const posit<nbits, es>*, posit<nbits, es>*, size_t, std::false_type) {
+	return false;
+}
+template<size_t nbits, size_t es>
+inline bool batch_negate(const posit<nbits, es>*, posit<nbits, es>*, size_t, std::false_type) {
+	return false;
+}
+template<batch_op op, size_t nbits, size_t es>
+inline bool batch_compare(const posit<nbits, es>*, const posit<nbits, es>*, bool*, size_t, std::false_type) {
+	return false;
+}
+template<typename Real, size_t nbits, size_t es>
+inline bool batch_from_ieee(const Real*, posit<nbits, es>*, size_t, std::false_type) {
+	return false;
+}
+template<typename Real, size_t nbits, size_t es>
+inline bool batch_to_ieee(const posit<nbits, es>*, Real*, size_t, std::false_type) {
+	return false;
+}
+
+#if POSIT_BATCH_SIMD
+template<batch_op op, size_t nbits, size_t es>
+inline bool batch_binary(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n, std::true_type) {
+	using Encoding = typename batch_encoding<nbits, es>::type;
+	static_assert(sizeof(posit<nbits, es>) == sizeof(Encoding), "batch kernels require posits that hold nothing but their encoding");
+	const Encoding* ea = reinterpret_cast<const Encoding*>(a);
+	const Encoding* eb = reinterpret_cast<const Encoding*>(b);
+	Encoding* ec = reinterpret_cast<Encoding*>(c);
+	switch (batch_active_isa()) {
+	case batch_isa::avx512:
+		avx512::batch_kernels<nbits, es, Encoding>::template binary<op>(ea, eb, ec, n);
+		return true;
+	case batch_isa::avx2:
+		avx2::batch_kernels<nbits, es, Encoding>::template binary<op>(ea, eb, ec, n);
+		return true;
+	default:
+		return false;
+	}
+}
+template<size_t nbits, size_t es>
+inline bool batch_fma(const posit<nbits, es>* a, const posit<nbits, es>* b, const posit<nbits, es>* c, posit<nbits, es>* d, size_t n, std::true_type) {
+	using Encoding = typename batch_encoding<nbits, es>::type;
+	static_assert(sizeof(posit<nbits, es>) == sizeof(Encoding), "batch kernels require posits that hold nothing but their encoding");
+	const Encoding* ea = reinterpret_cast<const Encoding*>(a);
+	const Encoding* eb = reinterpret_cast<const Encoding*>(b);
+	const Encoding* ec = reinterpret_cast<const Encoding*>(c);
+	Encoding* ed = reinterpret_cast<Encoding*>(d);
+	switch (batch_active_isa()) {
+	case batch_isa::avx512:
+		avx512::batch_kernels<nbits, es, Encoding>::fma(ea, eb, ec, ed, n);
+		return true;
+	case batch_isa::avx2:
+		avx2::batch_kernels<nbits, es, Encoding>::fma(ea, eb, ec, ed, n);
+		return true;
+	default:
+		return false;
+	}
+}
+template<size_t nbits, size_t es>
+inline bool batch_negate(const posit<nbits, es>* a, posit<nbits, es>* c, size_t n, std::true_type) {
+	using Encoding = typename batch_encoding<nbits, es>::type;
+	static_assert(sizeof(posit<nbits, es>) == sizeof(Encoding), "batch kernels require posits that hold nothing but their encoding");
+	const Encoding* ea = reinterpret_cast<const Encoding*>(a);
+	Encoding* ec = reinterpret_cast<Encoding*>(c);
+	switch (batch_active_isa()) {
+	case batch_isa::avx512:
+		avx512::batch_kernels<nbits, es, Encoding>::negate(ea, ec, n);
+		return true;
+	case batch_isa::avx2:
+		avx2::batch_kernels<nbits, es, Encoding>::negate(ea, ec, n);
+		return true;
+	default:
+		return false;
+	}
+}
+template<batch_op op, size_t nbits, size_t es>
+inline bool batch_compare(const posit<nbits, es>* a, const posit<nbits, es>* b, bool* r, size_t n, std::true_type) {
+	using Encoding = typename batch_encoding<nbits, es>::type;
+	static_assert(sizeof(posit<nbits, es>) == sizeof(Encoding), "batch kernels require posits that hold nothing but their encoding");
+	static_assert(sizeof(bool) == sizeof(uint8_t), "batch comparisons write bools as bytes");
+	const Encoding* ea = reinterpret_cast<const Encoding*>(a);
+	const Encoding* eb = reinterpret_cast<const Encoding*>(b);
+	uint8_t* er = reinterpret_cast<uint8_t*>(r);
+	switch (batch_active_isa()) {
+	case batch_isa::avx512:
+		avx512::batch_kernels<nbits, es, Encoding>::template compare<op>(ea, eb, er, n);
+		return true;
+	case batch_isa::avx2:
+		avx2::batch_kernels<nbits, es, Encoding>::template compare<op>(ea, eb, er, n);
+		return true;
+	default:
+		return false;
+	}
+}
+
+// the bits of the IEEE-754 formats of float and double
+template<typename Real>
+using ieee_bits = typename std::conditional<sizeof(Real) == sizeof(uint32_t), uint32_t, uint64_t>::type;
+
+template<typename Real, size_t nbits, size_t es>
+inline bool batch_from_ieee(const Real* f, posit<nbits, es>* p, size_t n, std::true_type) {
+	using Encoding = typename batch_encoding<nbits, es>::type;
+	using Bits = ieee_bits<Real>;
+	constexpr unsigned ieee_fbits = unsigned(std::numeric_limits<Real>::digits - 1);
+	static_assert(sizeof(posit<nbits, es>) == sizeof(Encoding), "batch kernels require posits that hold nothing but their encoding");
+	static_assert(sizeof(Real) == sizeof(Bits) && std::numeric_limits<Real>::is_iec559, "batch conversions require IEEE-754 float and double");
+	const Bits* ef = reinterpret_cast<const Bits*>(f);
+	Encoding* ep = reinterpret_cast<Encoding*>(p);
+	switch (batch_active_isa()) {
+	case batch_isa::avx512:
+		avx512::batch_kernels<nbits, es, Encoding>::template from_ieee<Bits, ieee_fbits>(ef, ep, n);
+		return true;
+	case batch_isa::avx2:
+		avx2::batch_kernels<nbits, es, Encoding>::template from_ieee<Bits, ieee_fbits>(ef, ep, n);
+		return true;
+	default:
+		return false;
+	}
+}
+template<typename Real, size_t nbits, size_t es>
+inline bool batch_to_ieee(const posit<nbits, es>* p, Real* f, size_t n, std::true_type) {
+	using Encoding = typename batch_encoding<nbits, es>::type;
+	using Bits = ieee_bits<Real>;
+	constexpr unsigned ieee_fbits = unsigned(std::numeric_limits<Real>::digits - 1);
+	static_assert(sizeof(posit<nbits, es>) == sizeof(Encoding), "batch kernels require posits that hold nothing but their encoding");
+	static_assert(sizeof(Real) == sizeof(Bits) && std::numeric_limits<Real>::is_iec559, "batch conversions require IEEE-754 float and double");
+	const Encoding* ep = reinterpret_cast<const Encoding*>(p);
+	Bits* ef = reinterpret_cast<Bits*>(f);
+	switch (batch_active_isa()) {
+	case batch_isa::avx512:
+		avx512::batch_kernels<nbits, es, Encoding>::template to_ieee<Bits, ieee_fbits>(ep, ef, n);
+		return true;
+	case batch_isa::avx2:
+		avx2::batch_kernels<nbits, es, Encoding>::template to_ieee<Bits, ieee_fbits>(ep, ef, n);
+		return true;
+	default:
+		return false;
+	}
+}
+#else
+template<batch_op op, size_t nbits, size_t es>
+inline bool batch_binary(const posit<nbits, es>*, const posit<nbits, es>*, posit<nbits, es>*, size_t, std::true_type) {
+	return false;
+}
+template<size_t nbits, size_t es>
+inline bool batch_fma(const posit<nbits, es>*, const posit<nbits, es>*, const posit<nbits, es>*, posit<nbits, es>*, size_t, std::true_type) {
+	return false;
+}
+template<size_t nbits, size_t es>
+inline bool batch_negate(const posit<nbits, es>*, posit<nbits, es>*, size_t, std::true_type) {
+	return false;
+}
+template<batch_op op, size_t nbits, size_t es>
+inline bool batch_compare(const posit<nbits, es>*, const posit<nbits, es>*, bool*, size_t, std::true_type) {
+	return false;
+}
+template<typename Real, size_t nbits, size_t es>
+inline bool batch_from_ieee(const Real*, posit<nbits, es>*, size_t, std::true_type) {
+	return false;
+}
+template<typename Real, size_t nbits, size_t es>
+inline bool batch_to_ieee(const posit<nbits, es>*, Real*, size_t, std::true_type) {
+	return false;
+}
+#endif // POSIT_BATCH_SIMD
+
+template<size_t nbits, size_t es>
+using batch_simd = std::integral_constant<bool, batch_encoding<nbits, es>::simd>;
+
+}  // namespace internal
+
+template<size_t nbits, size_t es>
+void batch_add(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n) {
+	if (internal::batch_binary<internal::batch_op::add>(a, b, c, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) c[i] = a[i] + b[i];
+}
+
+template<size_t nbits, size_t es>
+void batch_sub(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n) {
+	if (internal::batch_binary<internal::batch_op::sub>(a, b, c, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) c[i] = a[i] - b[i];
+}
+
+template<size_t nbits, size_t es>
+void batch_mul(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n) {
+	if (internal::batch_binary<internal::batch_op::mul>(a, b, c, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) c[i] = a[i] * b[i];
+}
+
+template<size_t nbits, size_t es>
+void batch_div(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n) {
+	if (internal::batch_binary<internal::batch_op::div>(a, b, c, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) c[i] = a[i] / b[i];
+}
+
+template<size_t nbits, size_t es>
+void batch_fma(const posit<nbits, es>* a, const posit<nbits, es>* b, const posit<nbits, es>* c, posit<nbits, es>* d, size_t n) {
+	if (internal::batch_fma(a, b, c, d, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) d[i] = fma(a[i], b[i], c[i]);
+}
+
+template<size_t nbits, size_t es>
+void batch_negate(const posit<nbits, es>* a, posit<nbits, es>* c, size_t n) {
+	if (internal::batch_negate(a, c, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) c[i] = -a[i];
+}
+
+template<size_t nbits, size_t es>
+void batch_less(const posit<nbits, es>* a, const posit<nbits, es>* b, bool* r, size_t n) {
+	if (internal::batch_compare<internal::batch_op::less>(a, b, r, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) r[i] = a[i] < b[i];
+}
+
+template<size_t nbits, size_t es>
+void batch_equal(const posit<nbits, es>* a, const posit<nbits, es>* b, bool* r, size_t n) {
+	if (internal::batch_compare<internal::batch_op::equal>(a, b, r, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) r[i] = a[i] == b[i];
+}
+
+// convert an array of floats to posits: the scalar loop rounds through value<> with the rules of convert(),
+// which the SIMD kernels reproduce
+template<size_t nbits, size_t es>
+void convert(const float* f, posit<nbits, es>* p, size_t n) {
+	if (internal::batch_from_ieee(f, p, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) convert(value<std::numeric_limits<float>::digits - 1>(f[i]), p[i]);
+}
+
+// convert an array of doubles to posits
+template<size_t nbits, size_t es>
+void convert(const double* f, posit<nbits, es>* p, size_t n) {
+	if (internal::batch_from_ieee(f, p, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) convert(value<std::numeric_limits<double>::digits - 1>(f[i]), p[i]);
+}
+
+// convert an array of posits to floats
+template<size_t nbits, size_t es>
+void convert(const posit<nbits, es>* p, float* f, size_t n) {
+	if (internal::batch_to_ieee(p, f, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) f[i] = float(p[i]);
+}
+
+// convert an array of posits to doubles
+template<size_t nbits, size_t es>
+void convert(const posit<nbits, es>* p, double* f, size_t n) {
+	if (internal::batch_to_ieee(p, f, n, internal::batch_simd<nbits, es>())) return;
+	for (size_t i = 0; i < n; ++i) f[i] = double(p[i]);
+}
+
+}  // namespace unum
+}  // namespace sw
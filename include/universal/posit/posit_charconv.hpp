@@ -0,0 +1,369 @@
+#pragma once
+// posit_charconv.hpp: allocation-free conversion between posits and character sequences
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include "uint128.hpp"
+#include "posit_shortest.hpp"
+
+namespace sw {
+namespace unum {
+
+/*
+to_chars and from_chars convert posits to and from text in caller provided buffers, without the
+heap allocations of the stream operators and the regular expression of parse():
+
+	to_chars(first, last, p)                      the shortest decimal that reads back to the posit
+	to_chars(first, last, p, format)              decimal or the native posit format nbits.esxHH..Hp
+	to_chars(first, last, p, format, precision)   decimal with precision significant digits
+	from_chars(first, last, p)                    decimal, or the native posit format, as parse() accepts them
+
+to_chars writes no terminating null character: the result points one past the last character
+written, or holds std::errc::value_too_large with ptr == last when the buffer is too small.
+from_chars consumes the longest prefix that forms a posit, and holds std::errc::invalid_argument
+with ptr == first when there is none. NaR is written as "nar", and read from "nar", "nan", or "inf".
+*/
+
+// the text formats of to_chars
+enum class posit_chars_format { decimal, hex };
+
+struct posit_to_chars_result {
+	char* ptr;
+	std::errc ec;
+};
+
+struct posit_from_chars_result {
+	const char* ptr;
+	std::errc ec;
+};
+
+namespace internal {
+
+// longest decimal text that the formatter produces
+constexpr int max_decimal_precision = 64;
+constexpr size_t decimal_chars_capacity = 128;
+
+inline posit_to_chars_result copy_chars(char* first, char* last, const char* text, size_t length) {
+	if (size_t(last - first) < length) return { last, std::errc::value_too_large };
+	std::memcpy(first, text, length);
+	return { first + length, std::errc() };
+}
+
+// write an unsigned integer in decimal
+inline posit_to_chars_result unsigned_to_chars(char* first, char* last, size_t v) {
+	char digits[std::numeric_limits<size_t>::digits10 + 1];
+	char* d = digits + sizeof(digits);
+	do {
+		*--d = char('0' + v % 10);
+		v /= 10;
+	} while (v > 0);
+	return copy_chars(first, last, d, size_t(digits + sizeof(digits) - d));
+}
+
+inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+inline int hex_value(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+// case-insensitive match of a lower case keyword at the start of [first, last)
+inline bool match_keyword(const char* first, const char* last, const char* keyword) {
+	size_t length = std::strlen(keyword);
+	if (size_t(last - first) < length) return false;
+	for (size_t i = 0; i < length; ++i) {
+		char c = first[i];
+		if (c >= 'A' && c <= 'Z') c = char(c - 'A' + 'a');
+		if (c != keyword[i]) return false;
+	}
+	return true;
+}
+
+// the native posit format nbits.esxHH..Hp, the same text as hex_format()
+template<size_t nbits, size_t es>
+posit_to_chars_result to_hex_chars(char* first, char* last, const posit<nbits, es>& p) {
+	const char* hexits = "0123456789abcdef";
+	constexpr size_t nrHexits = (nbits + 3) / 4;
+	posit_to_chars_result r = unsigned_to_chars(first, last, nbits);
+	if (r.ec != std::errc()) return r;
+	r = copy_chars(r.ptr, last, ".", 1);
+	if (r.ec != std::errc()) return r;
+	r = unsigned_to_chars(r.ptr, last, es);
+	if (r.ec != std::errc()) return r;
+	if (size_t(last - r.ptr) < nrHexits + 2) return { last, std::errc::value_too_large };
+	char* t = r.ptr;
+	*t++ = 'x';
+	bitblock<nbits> bits = p.get();
+	for (size_t i = nrHexits; i-- > 0; ) {
+		unsigned hexit = 0;
+		for (size_t b = 4; b-- > 0; ) {
+			size_t bit = 4 * i + b;
+			hexit = (hexit << 1) | ((bit < nbits && bits[bit]) ? 1u : 0u);
+		}
+		*t++ = hexits[hexit];
+	}
+	*t++ = 'p';
+	return { t, std::errc() };
+}
+
+// the native posit format: the hex digits are right-aligned in the encoding, and a text of a larger
+// posit keeps its most significant bits, as parse() does
+template<size_t nbits, size_t es>
+posit_from_chars_result from_hex_chars(const char* first, const char* last, posit<nbits, es>& p) {
+	const char* t = first;
+	size_t nbits_in = 0;
+	for (; t != last && is_digit(*t); ++t) nbits_in = 10 * nbits_in + size_t(*t - '0');
+	++t;                                            // '.'
+	while (t != last && is_digit(*t)) ++t;          // es
+	++t;                                            // 'x'
+	const char* hexits = t;
+	while (t != last && hex_value(*t) >= 0) ++t;
+	size_t nrHexits = size_t(t - hexits);
+	if (nrHexits == 0) return { first, std::errc::invalid_argument };
+	size_t shift = nbits_in > nbits ? nbits_in - nbits : 0;
+	bitblock<nbits> bits;
+	for (size_t i = 0; i < nrHexits; ++i) {
+		unsigned hexit = unsigned(hex_value(hexits[nrHexits - 1 - i]));
+		for (size_t b = 0; b < 4; ++b) {
+			size_t bit = 4 * i + b;
+			if (bit >= shift && bit - shift < nbits && (hexit & (1u << b))) bits.set(bit - shift);
+		}
+	}
+	if (t != last && *t == 'p') ++t;
+	p.set(bits);
+	return { t, std::errc() };
+}
+
+// a decimal floating-point literal: sign, digits with an optional decimal point, and an optional exponent
+inline const char* scan_decimal(const char* first, const char* last) {
+	const char* t = first;
+	if (t != last && (*t == '+' || *t == '-')) ++t;
+	const char* digits = t;
+	while (t != last && is_digit(*t)) ++t;
+	size_t nrDigits = size_t(t - digits);
+	if (t != last && *t == '.') {
+		const char* fraction = ++t;
+		while (t != last && is_digit(*t)) ++t;
+		nrDigits += size_t(t - fraction);
+	}
+	if (nrDigits == 0) return first;
+	if (t != last && (*t == 'e' || *t == 'E')) {
+		const char* e = t + 1;
+		if (e != last && (*e == '+' || *e == '-')) ++e;
+		if (e != last && is_digit(*e)) {
+			while (e != last && is_digit(*e)) ++e;
+			t = e;
+		}
+	}
+	return t;
+}
+
+// the value of a posit of at most 64 bits, decoded from its encoding: exact in a long double of 64 significant bits
+template<size_t nbits, size_t es>
+long double decimal_value(const posit<nbits, es>& p, std::true_type) {
+	constexpr uint64_t mask = nbits == 64 ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1;
+	uint64_t bits = uint64_t(p.encoding()) & mask;
+	bool sign = (bits >> (nbits - 1)) & 1;
+	if (sign) bits = (~bits + 1) & mask;
+	// left-align the bits following the sign bit, and measure the regime run
+	uint64_t x = bits << (64 - nbits + 1);
+	bool ones = (x >> 63) != 0;
+	unsigned run = countLeadingZeros(ones ? ~x : x);
+	int k = ones ? int(run) - 1 : -int(run);
+	x = run + 1 < 64 ? x << (run + 1) : 0;
+	int e = es > 0 ? int(x >> (64 - es)) : 0;
+	x = es > 0 ? x << es : x;
+	long double v = std::ldexp(1.0l + std::ldexp((long double)x, -64), k * (1 << es) + e);
+	return sign ? -v : v;
+}
+template<size_t nbits, size_t es>
+long double decimal_value(const posit<nbits, es>& p, std::false_type) {
+	return (long double)p;
+}
+
+// the significant digits of the decimal literal [first, last) that scan_decimal accepted, without leading and trailing zeros,
+// and the exponent k of its value digits * 10^k: beyond capacity digits, the rest is represented by a sticky digit 1
+inline size_t decimal_significand(const char* first, const char* last, char* digits, size_t capacity, int& k) {
+	const char* t = first;
+	if (*t == '+' || *t == '-') ++t;
+	size_t n = 0;
+	long scale = 0;
+	bool fraction = false, sticky = false;
+	for (; t != last && *t != 'e' && *t != 'E'; ++t) {
+		if (*t == '.') {
+			fraction = true;
+		}
+		else if (n < capacity && (n > 0 || *t != '0')) {
+			digits[n++] = *t;
+			if (fraction) --scale;
+		}
+		else if (n == 0) {
+			if (fraction) --scale;   // a leading zero
+		}
+		else {
+			if (*t != '0') sticky = true;
+			if (!fraction) ++scale;  // an integer digit beyond the capacity
+		}
+		// beyond any dynamic range, and small enough to not overflow
+		if (scale < -1000000) scale = -1000000;
+		if (scale > 1000000) scale = 1000000;
+	}
+	while (n > 0 && digits[n - 1] == '0') {
+		--n;
+		++scale;
+	}
+	if (sticky) {
+		digits[n++] = '1';
+		--scale;
+	}
+	long exponent = 0;
+	if (t != last) {
+		bool negative = *++t == '-';
+		if (*t == '+' || *t == '-') ++t;
+		for (; t != last; ++t) {
+			if (exponent < 1000000) exponent = 10 * exponent + (*t - '0');
+		}
+		if (negative) exponent = -exponent;
+	}
+	k = int(exponent + scale);
+	return n;
+}
+
+// write the shortest decimal of the posit in the notation of %g for the number of digits
+template<size_t nbits, size_t es>
+posit_to_chars_result shortest_to_chars(char* first, char* last, const posit<nbits, es>& p) {
+	if (p.iszero()) return copy_chars(first, last, "0", 1);
+	char digits[decimal_chars_capacity];
+	int k;
+	size_t n = shortest_digits(p.isneg() ? -p : p, digits, k);
+	char text[2 * decimal_chars_capacity];
+	char* t = text;
+	if (p.isneg()) *t++ = '-';
+	int x = k - 1;  // the exponent of the scientific notation
+	if (x < -4 || x >= int(n)) {
+		*t++ = digits[0];
+		if (n > 1) {
+			*t++ = '.';
+			for (size_t i = 1; i < n; ++i) *t++ = digits[i];
+		}
+		*t++ = 'e';
+		*t++ = x < 0 ? '-' : '+';
+		unsigned e = unsigned(x < 0 ? -x : x);
+		char exponent[8];
+		int m = 0;
+		do {
+			exponent[m++] = char('0' + e % 10);
+			e /= 10;
+		} while (e > 0);
+		if (m < 2) exponent[m++] = '0';
+		while (m > 0) *t++ = exponent[--m];
+	}
+	else if (x >= 0) {
+		for (size_t i = 0; i < n; ++i) {
+			*t++ = digits[i];
+			if (int(i) == x && i + 1 < n) *t++ = '.';
+		}
+	}
+	else {
+		*t++ = '0';
+		*t++ = '.';
+		for (int i = -1; i > x; --i) *t++ = '0';
+		for (size_t i = 0; i < n; ++i) *t++ = digits[i];
+	}
+	return copy_chars(first, last, text, size_t(t - text));
+}
+
+}  // namespace internal
+
+// write the posit as text into [first, last), the decimal format with precision significant digits
+template<size_t nbits, size_t es>
+posit_to_chars_result to_chars(char* first, char* last, const posit<nbits, es>& p, posit_chars_format format, int precision) {
+	if (format == posit_chars_format::hex) return internal::to_hex_chars(first, last, p);
+	if (p.isnar()) return internal::copy_chars(first, last, "nar", 3);
+	if (precision < 1) precision = 1;
+	if (precision > internal::max_decimal_precision) precision = internal::max_decimal_precision;
+	// the posits of up to 64 bits are exact in the long double of x86 and in the binary128 of other platforms
+	char text[internal::decimal_chars_capacity];
+	long double v = p.iszero() ? 0.0l : internal::decimal_value(p, std::integral_constant<bool, (nbits <= 64)>());
+	int length = std::snprintf(text, sizeof(text), "%.*Lg", precision, v);
+	return internal::copy_chars(first, last, text, size_t(length));
+}
+
+// write the posit as text into [first, last), the decimal format is the shortest decimal that reads back to the posit
+template<size_t nbits, size_t es>
+posit_to_chars_result to_chars(char* first, char* last, const posit<nbits, es>& p, posit_chars_format format = posit_chars_format::decimal) {
+	if (format == posit_chars_format::hex) return internal::to_hex_chars(first, last, p);
+	if (p.isnar()) return internal::copy_chars(first, last, "nar", 3);
+	return internal::shortest_to_chars(first, last, p);
+}
+
+// read a posit from the text in [first, last)
+template<size_t nbits, size_t es>
+posit_from_chars_result from_chars(const char* first, const char* last, posit<nbits, es>& p) {
+	using namespace internal;
+	// the native posit format starts with digits, a point, digits, and an x
+	const char* t = first;
+	while (t != last && is_digit(*t)) ++t;
+	if (t != first && t != last && *t == '.') {
+		const char* e = ++t;
+		while (t != last && is_digit(*t)) ++t;
+		if (t != e && t != last && (*t == 'x' || *t == 'X')) return from_hex_chars(first, last, p);
+	}
+
+	const char* sign = first;
+	const char* keyword = (sign != last && (*sign == '+' || *sign == '-')) ? sign + 1 : sign;
+	if (match_keyword(keyword, last, "nar") || match_keyword(keyword, last, "nan")) {
+		p.setnar();
+		return { keyword + 3, std::errc() };
+	}
+	if (match_keyword(keyword, last, "inf")) {
+		p.setnar();
+		return { keyword + (match_keyword(keyword, last, "infinity") ? 8 : 3), std::errc() };
+	}
+
+	t = scan_decimal(first, last);
+	if (t == first) return { first, std::errc::invalid_argument };
+	bool negative = *first == '-';
+	constexpr size_t capacity = rounding_digits<nbits, es>::digits;
+	char digits[capacity + 1];
+	int k;
+	size_t nrDigits = decimal_significand(first, t, digits, capacity, k);
+	// decimals beyond the dynamic range of the posit project to maxpos and minpos
+	constexpr int range10 = int(((nbits - 2) << es) * 0.30102999566398120) + 2;
+	int magnitude = k + int(nrDigits);
+	if (nrDigits == 0) {
+		p.setzero();
+	}
+	else if (magnitude > range10) {
+		p = maxpos<nbits, es>();
+		if (negative) p = -p;
+	}
+	else if (magnitude < -range10) {
+		p = minpos<nbits, es>();
+		if (negative) p = -p;
+	}
+	else {
+		// a first approximation from the leading digits, independent of the locale, that round_decimal corrects
+		// with the exact bounds of the posit intervals
+		size_t lead = nrDigits < 19 ? nrDigits : 19;
+		long double v = 0;
+		for (size_t i = 0; i < lead; ++i) v = 10 * v + (digits[i] - '0');
+		v *= std::pow(10.0l, k + int(nrDigits - lead));
+		if (std::isfinite(v) && v != 0) convert(value<std::numeric_limits<long double>::digits - 1>(v), p); else p.setzero();
+		round_decimal(digits, nrDigits, k, negative, p);
+	}
+	return { t, std::errc() };
+}
+
+}  // namespace unum
+}  // namespace sw
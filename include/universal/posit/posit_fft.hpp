@@ -0,0 +1,304 @@
+#pragma once
+// posit_fft.hpp: in-place radix-2/radix-4 fast Fourier transform of complex posits with an exact butterfly option
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "posit_filters.hpp"
+
+namespace sw {
+namespace unum {
+
+/*
+fft_plan<Posit> holds the twiddle factors W^j = exp(-2 pi i j / n) of a power of two size n, each
+component rounded once from long double into the posit format, and the bit reversal permutation.
+The transform is an iterative decimation in time: the input is permuted into bit reversed order,
+followed by radix-4 stages, and one radix-2 stage first when log2(n) is odd.
+
+	forward   X[k] = sum_j x[j] W^(jk)
+	inverse   x[j] = 1/n sum_k X[k] W^(-jk), the scaling by 1/n is one more rounding
+
+The butterflies come in two flavors:
+	fft_butterfly::rounded  every twiddle product is a fused complex multiply that rounds each
+	                        component once, and the sums of the butterfly are rounded posit additions
+	fft_butterfly::exact    every output component of a butterfly is the exact sum of its input and
+	                        the twiddle products, accumulated as in a quire and rounded once, which
+	                        is one rounding per radix-4 stage instead of the four of the rounded path
+
+The plan works on complex_array in either layout, on separate real and imaginary component arrays
+at a stride, and on vectors of complex<Posit>. A NaR component makes the outputs it reaches NaR.
+*/
+enum class fft_butterfly { rounded, exact };
+
+template<typename Posit, size_t capacity = 10>
+class fft_plan {
+public:
+	using value_type = Posit;
+	using complex_type = complex<Posit>;
+	using accumulator_type = internal::filter_accumulator<Posit, capacity>;
+
+	explicit fft_plan(size_t n, fft_butterfly butterfly = fft_butterfly::rounded) : _n(n), _log2n(0), _butterfly(butterfly) {
+		if (n == 0 || (n & (n - 1)) != 0) throw std::runtime_error("fft_plan: the size must be a power of two");
+		while ((size_t(1) << _log2n) < n) ++_log2n;
+		_reversed.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			size_t r = 0;
+			for (unsigned b = 0; b < _log2n; ++b) r |= ((i >> b) & 1) << (_log2n - 1 - b);
+			_reversed[i] = r;
+		}
+		compute_twiddles();
+	}
+
+	// selectors
+	size_t size() const { return _n; }
+	fft_butterfly butterfly() const { return _butterfly; }
+	// the twiddle factor W^j of the forward transform, 0 <= j < 3n/4
+	complex_type twiddle(size_t j) const { return complex_type(_cos[j], -_sin[j]); }
+
+	// transforms of complex_arrays in place
+	template<complex_layout layout>
+	void forward(complex_array<Posit::nbits, Posit::es, layout>& x) const {
+		check_size(x.size());
+		transform<false>(x.real_data(), x.imag_data(), x.stride());
+	}
+	template<complex_layout layout>
+	void inverse(complex_array<Posit::nbits, Posit::es, layout>& x) const {
+		check_size(x.size());
+		transform<true>(x.real_data(), x.imag_data(), x.stride());
+	}
+	// transforms of n complex numbers with component k at re[k * stride] and im[k * stride]
+	void forward(Posit* re, Posit* im, size_t stride = 1) const { transform<false>(re, im, stride); }
+	void inverse(Posit* re, Posit* im, size_t stride = 1) const { transform<true>(re, im, stride); }
+	// transforms of vectors of complex posits, through a split copy
+	void forward(std::vector<complex_type>& x) const { transform_copy<false>(x); }
+	void inverse(std::vector<complex_type>& x) const { transform_copy<true>(x); }
+
+private:
+	size_t _n;
+	unsigned _log2n;
+	fft_butterfly _butterfly;
+	std::vector<size_t> _reversed;
+	// W^j = _cos[j] - i _sin[j]
+	std::vector<Posit> _cos, _sin;
+
+	void check_size(size_t n) const {
+		if (n != _n) throw std::runtime_error("fft_plan: the size of the array does not match the size of the plan");
+	}
+
+	// cos and sin of 2 pi j / n from the first octant, so that the table is symmetric and 0 and 1 are exact
+	void compute_twiddles() {
+		size_t entries = _n < 4 ? 1 : 3 * _n / 4;
+		std::vector<long double> c(entries), s(entries);
+		const long double two_pi = 6.283185307179586476925286766559005768L;
+		size_t quarter = _n / 4;
+		for (size_t j = 0; j < entries; ++j) {
+			if (j < quarter || _n < 4) {
+				if (8 * j <= _n) {
+					c[j] = std::cos(two_pi * (long double)j / (long double)_n);
+					s[j] = std::sin(two_pi * (long double)j / (long double)_n);
+				}
+				else {
+					long double angle = two_pi * (long double)(quarter - j) / (long double)_n;
+					c[j] = std::sin(angle);
+					s[j] = std::cos(angle);
+				}
+			}
+			else if (j < 2 * quarter) {
+				c[j] = -s[j - quarter];
+				s[j] = c[j - quarter];
+			}
+			else {
+				c[j] = -c[j - 2 * quarter];
+				s[j] = -s[j - 2 * quarter];
+			}
+		}
+		_cos.resize(entries);
+		_sin.resize(entries);
+		for (size_t j = 0; j < entries; ++j) {
+			_cos[j] = c[j];
+			_sin[j] = s[j];
+		}
+	}
+
+	template<bool inverse>
+	void transform(Posit* re, Posit* im, size_t stride) const {
+		for (size_t i = 0; i < _n; ++i) {
+			size_t r = _reversed[i];
+			if (i < r) {
+				std::swap(re[i * stride], re[r * stride]);
+				std::swap(im[i * stride], im[r * stride]);
+			}
+		}
+		size_t m = 1;
+		if (_log2n % 2 == 1) {
+			radix2<inverse>(re, im, stride, m);
+			m = 2;
+		}
+		for (; m < _n; m *= 4) radix4<inverse>(re, im, stride, m);
+		if (inverse && _n > 1) {
+			Posit scale = Posit(1) / Posit(double(_n));
+			for (size_t i = 0; i < _n; ++i) {
+				re[i * stride] *= scale;
+				im[i * stride] *= scale;
+			}
+		}
+	}
+
+	template<bool inverse>
+	void transform_copy(std::vector<complex_type>& x) const {
+		check_size(x.size());
+		std::vector<Posit> re(_n), im(_n);
+		for (size_t i = 0; i < _n; ++i) {
+			re[i] = x[i].real();
+			im[i] = x[i].imag();
+		}
+		transform<inverse>(re.data(), im.data(), 1);
+		for (size_t i = 0; i < _n; ++i) x[i] = complex_type(re[i], im[i]);
+	}
+
+	// the twiddle of the forward transform, or its conjugate for the inverse
+	template<bool inverse>
+	void load_twiddle(size_t j, Posit& wr, Posit& wi) const {
+		wr = _cos[j];
+		wi = inverse ? _sin[j] : -_sin[j];
+	}
+
+	// x[g] +- W_2m^k x[g + m] for the pairs at distance m
+	template<bool inverse>
+	void radix2(Posit* re, Posit* im, size_t stride, size_t m) const {
+		size_t step = _n / (2 * m);
+		for (size_t k = 0; k < m; ++k) {
+			Posit wr, wi;
+			load_twiddle<inverse>(k * step, wr, wi);
+			if (_butterfly == fft_butterfly::exact) {
+				// rows of the coefficients of a.re, a.im, b.re, b.im for the components of a + w b and a - w b
+				const Posit one(1), zero(0);
+				const Posit rows[4][4] = {
+					{ one, zero,  wr, -wi },
+					{ zero, one,  wi,  wr },
+					{ one, zero, -wr,  wi },
+					{ zero, one, -wi, -wr },
+				};
+				accumulator_type q;
+				for (size_t g = k; g < _n; g += 2 * m) {
+					size_t i0 = g * stride, i1 = (g + m) * stride;
+					const Posit x[4] = { re[i0], im[i0], re[i1], im[i1] };
+					Posit y[4];
+					for (int r = 0; r < 4; ++r) {
+						q.reset();
+						bool nar = internal::accumulate_products(q, rows[r], x, 4);
+						y[r] = internal::round_accumulator<Posit>(q, nar);
+					}
+					re[i0] = y[0]; im[i0] = y[1];
+					re[i1] = y[2]; im[i1] = y[3];
+				}
+			}
+			else {
+				for (size_t g = k; g < _n; g += 2 * m) {
+					size_t i0 = g * stride, i1 = (g + m) * stride;
+					Posit tr = fmma(wr, re[i1], wi, im[i1], false);
+					Posit ti = fmma(wr, im[i1], wi, re[i1], true);
+					Posit ar = re[i0], ai = im[i0];
+					re[i0] = ar + tr; im[i0] = ai + ti;
+					re[i1] = ar - tr; im[i1] = ai - ti;
+				}
+			}
+		}
+	}
+
+	// the radix-4 butterfly on a = x[g], b = x[g + m], c = x[g + 2m], d = x[g + 3m], with
+	// w1 = W_4m^k, w2 = w1^2, w3 = w1^3, and sigma = -1 for the forward and +1 for the inverse transform:
+	//   X[g]      = a + w2 b + (w1 c + w3 d)
+	//   X[g + m]  = a - w2 b + sigma i (w1 c - w3 d)
+	//   X[g + 2m] = a + w2 b - (w1 c + w3 d)
+	//   X[g + 3m] = a - w2 b - sigma i (w1 c - w3 d)
+	template<bool inverse>
+	void radix4(Posit* re, Posit* im, size_t stride, size_t m) const {
+		size_t step = _n / (4 * m);
+		for (size_t k = 0; k < m; ++k) {
+			Posit w1r, w1i, w2r, w2i, w3r, w3i;
+			load_twiddle<inverse>(k * step, w1r, w1i);
+			load_twiddle<inverse>(2 * k * step, w2r, w2i);
+			load_twiddle<inverse>(3 * k * step, w3r, w3i);
+			if (_butterfly == fft_butterfly::exact) {
+				radix4_exact<inverse>(re, im, stride, m, k, w1r, w1i, w2r, w2i, w3r, w3i);
+			}
+			else {
+				for (size_t g = k; g < _n; g += 4 * m) {
+					size_t i0 = g * stride, i1 = (g + m) * stride, i2 = (g + 2 * m) * stride, i3 = (g + 3 * m) * stride;
+					Posit t2r = fmma(w2r, re[i1], w2i, im[i1], false), t2i = fmma(w2r, im[i1], w2i, re[i1], true);
+					Posit t1r = fmma(w1r, re[i2], w1i, im[i2], false), t1i = fmma(w1r, im[i2], w1i, re[i2], true);
+					Posit t3r = fmma(w3r, re[i3], w3i, im[i3], false), t3i = fmma(w3r, im[i3], w3i, re[i3], true);
+					Posit sr = re[i0] + t2r, si = im[i0] + t2i;   // a + w2 b
+					Posit dr = re[i0] - t2r, di = im[i0] - t2i;   // a - w2 b
+					Posit ur = t1r + t3r, ui = t1i + t3i;         // w1 c + w3 d
+					Posit vr = t1r - t3r, vi = t1i - t3i;         // w1 c - w3 d
+					re[i0] = sr + ur; im[i0] = si + ui;
+					re[i2] = sr - ur; im[i2] = si - ui;
+					if (inverse) {
+						re[i1] = dr - vi; im[i1] = di + vr;
+						re[i3] = dr + vi; im[i3] = di - vr;
+					}
+					else {
+						re[i1] = dr + vi; im[i1] = di - vr;
+						re[i3] = dr - vi; im[i3] = di + vr;
+					}
+				}
+			}
+		}
+	}
+
+	// every output component of the radix-4 butterfly is a row of coefficients applied to the
+	// components a.re, a.im, b.re, b.im, c.re, c.im, d.re, d.im, and accumulated exactly
+	template<bool inverse>
+	void radix4_exact(Posit* re, Posit* im, size_t stride, size_t m, size_t k,
+		const Posit& w1r, const Posit& w1i, const Posit& w2r, const Posit& w2i, const Posit& w3r, const Posit& w3i) const {
+		const Posit one(1), zero(0);
+		// the real part of w z has the coefficients (wr, -wi) on (z.re, z.im), the imaginary part (wi, wr)
+		// sigma i z has the real part -sigma z.im and the imaginary part sigma z.re
+		const Posit s1r = inverse ? -w1r : w1r, s1i = inverse ? -w1i : w1i;
+		const Posit s3r = inverse ? -w3r : w3r, s3i = inverse ? -w3i : w3i;
+		const Posit rows[8][8] = {
+			{ one, zero,  w2r, -w2i,  w1r, -w1i,  w3r, -w3i },   // X[g].re
+			{ zero, one,  w2i,  w2r,  w1i,  w1r,  w3i,  w3r },   // X[g].im
+			{ one, zero, -w2r,  w2i,  s1i,  s1r, -s3i, -s3r },   // X[g + m].re
+			{ zero, one, -w2i, -w2r, -s1r,  s1i,  s3r, -s3i },   // X[g + m].im
+			{ one, zero,  w2r, -w2i, -w1r,  w1i, -w3r,  w3i },   // X[g + 2m].re
+			{ zero, one,  w2i,  w2r, -w1i, -w1r, -w3i, -w3r },   // X[g + 2m].im
+			{ one, zero, -w2r,  w2i, -s1i, -s1r,  s3i,  s3r },   // X[g + 3m].re
+			{ zero, one, -w2i, -w2r,  s1r, -s1i, -s3r,  s3i },   // X[g + 3m].im
+		};
+		accumulator_type q;
+		for (size_t g = k; g < _n; g += 4 * m) {
+			size_t index[4] = { g * stride, (g + m) * stride, (g + 2 * m) * stride, (g + 3 * m) * stride };
+			const Posit x[8] = { re[index[0]], im[index[0]], re[index[1]], im[index[1]], re[index[2]], im[index[2]], re[index[3]], im[index[3]] };
+			Posit y[8];
+			for (int r = 0; r < 8; ++r) {
+				q.reset();
+				bool nar = internal::accumulate_products(q, rows[r], x, 8);
+				y[r] = internal::round_accumulator<Posit>(q, nar);
+			}
+			for (int p = 0; p < 4; ++p) {
+				re[index[p]] = y[2 * p];
+				im[index[p]] = y[2 * p + 1];
+			}
+		}
+	}
+};
+
+// in place forward and inverse transforms of a complex_array with a plan of its size
+template<size_t nbits, size_t es, complex_layout layout>
+void fft(complex_array<nbits, es, layout>& x, fft_butterfly butterfly = fft_butterfly::rounded) {
+	fft_plan< posit<nbits, es> >(x.size(), butterfly).forward(x);
+}
+template<size_t nbits, size_t es, complex_layout layout>
+void ifft(complex_array<nbits, es, layout>& x, fft_butterfly butterfly = fft_butterfly::rounded) {
+	fft_plan< posit<nbits, es> >(x.size(), butterfly).inverse(x);
+}
+
+}  // namespace unum
+}  // namespace sw
@@ -0,0 +1,494 @@
+#pragma once
+// posit_file.hpp: self-describing binary file format for arrays of posits, with a memory-mapped reader and streaming reader/writer
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <initializer_list>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POSIT_FILE_MMAP 1
+#else
+#define POSIT_FILE_MMAP 0
+#endif
+
+namespace sw {
+namespace unum {
+
+/*
+A posit array file is a 64-byte header followed by the encodings of the posits.
+
+	offset  size  field
+	     0     8  magic "UNIPOSIT"
+	     8     4  byte order mark 0x01020304, written in the byte order of every field and encoding that follows
+	    12     2  format version, 1
+	    14     2  nbits
+	    16     2  es
+	    18     1  packing: 0 = word, 1 = bit
+	    19     1  rank, 1 to 4
+	    20     4  reserved, 0
+	    24    32  shape: four 64-bit extents, row major, the unused extents are 1
+	    56     8  offset of the encodings from the start of the file, a multiple of 64
+
+Word packing stores each encoding in the smallest of 1, 2, 4, or 8 bytes that holds nbits bits,
+so that the encodings of posit<16,1> and posit<32,2> map onto uint16_t and uint32_t arrays.
+Bit packing stores the encodings at a stride of nbits bits in 64-bit words, the layout of the
+packed_posit_vector, followed by one zero padding word.
+
+The mapped reader exposes the encodings in place, without decoding or copying, and requires the byte
+order of the machine. The streaming reader reads the file in chunks and swaps the byte order when
+the file comes from a machine of the other endianness.
+*/
+
+enum class posit_file_packing : uint8_t { word = 0, bit = 1 };
+
+struct posit_file_header {
+	char     magic[8];
+	uint32_t byte_order;
+	uint16_t version;
+	uint16_t nbits;
+	uint16_t es;
+	uint8_t  packing;
+	uint8_t  rank;
+	uint32_t reserved;
+	uint64_t shape[4];
+	uint64_t data_offset;
+
+	// number of posits in the array
+	uint64_t size() const { return shape[0] * shape[1] * shape[2] * shape[3]; }
+	// bytes of an encoding in word packing
+	size_t element_bytes() const { return nbits <= 8 ? 1 : nbits <= 16 ? 2 : nbits <= 32 ? 4 : 8; }
+	// bytes of the encodings, including the padding word of bit packing
+	uint64_t data_bytes() const {
+		if (packing == uint8_t(posit_file_packing::bit)) return ((size() * nbits + 63) / 64 + 1) * 8;
+		return size() * element_bytes();
+	}
+};
+static_assert(sizeof(posit_file_header) == 64, "the posit file header is 64 bytes");
+
+namespace internal {
+
+static constexpr char posit_file_magic[8] = { 'U', 'N', 'I', 'P', 'O', 'S', 'I', 'T' };
+static constexpr uint32_t posit_file_byte_order = 0x01020304u;
+static constexpr uint32_t posit_file_swapped_byte_order = 0x04030201u;
+static constexpr uint16_t posit_file_version = 1;
+
+inline uint16_t byteswap(uint16_t v) { return uint16_t((v >> 8) | (v << 8)); }
+inline uint32_t byteswap(uint32_t v) { return (v >> 24) | ((v >> 8) & 0xFF00u) | ((v << 8) & 0xFF0000u) | (v << 24); }
+inline uint64_t byteswap(uint64_t v) { return (uint64_t(byteswap(uint32_t(v))) << 32) | byteswap(uint32_t(v >> 32)); }
+
+// the header of a file of the other endianness in the byte order of this machine
+inline void byteswap(posit_file_header& h) {
+	h.byte_order = byteswap(h.byte_order);
+	h.version = byteswap(h.version);
+	h.nbits = byteswap(h.nbits);
+	h.es = byteswap(h.es);
+	h.reserved = byteswap(h.reserved);
+	for (uint64_t& extent : h.shape) extent = byteswap(extent);
+	h.data_offset = byteswap(h.data_offset);
+}
+
+// true if this machine stores the least significant byte of a word first
+inline bool little_endian_host() {
+	const uint32_t one = 1;
+	unsigned char first;
+	std::memcpy(&first, &one, 1);
+	return first == 1;
+}
+
+// check the header against the configuration of the reader and the length of the file, and return true if the file has the other byte order
+template<size_t nbits, size_t es>
+bool validate_header(posit_file_header& h, const std::string& path, uint64_t length) {
+	if (std::memcmp(h.magic, posit_file_magic, sizeof(h.magic)) != 0) throw posit_file_exception(path + " is not a posit array file");
+	bool swapped = false;
+	if (h.byte_order == posit_file_swapped_byte_order) {
+		byteswap(h);
+		swapped = true;
+	}
+	if (h.byte_order != posit_file_byte_order) throw posit_file_exception(path + " has an unknown byte order");
+	if (h.version != posit_file_version) throw posit_file_exception(path + " has unsupported format version " + std::to_string(h.version));
+	if (h.nbits != nbits || h.es != es) {
+		throw posit_file_exception(path + " holds posit<" + std::to_string(h.nbits) + "," + std::to_string(h.es) + ">, not posit<" + std::to_string(nbits) + "," + std::to_string(es) + ">");
+	}
+	// the encodings start on a 64-byte boundary, so that the words of the view of a mapped file are aligned
+	if (h.packing > uint8_t(posit_file_packing::bit) || h.rank < 1 || h.rank > 4 || h.data_offset < sizeof(posit_file_header) || h.data_offset % 64 != 0) {
+		throw posit_file_exception(path + " has a corrupt header");
+	}
+	for (unsigned dimension = h.rank; dimension < 4; ++dimension) {
+		if (h.shape[dimension] != 1) throw posit_file_exception(path + " has a corrupt header");
+	}
+	// the extents of a crafted header can wrap size() and data_bytes(): bound each term by the length before it is multiplied or added
+	if (h.data_offset > length) throw posit_file_exception(path + " is truncated");
+	uint64_t available = length - h.data_offset;
+	uint64_t capacity = h.packing == uint8_t(posit_file_packing::bit) ? available / nbits * 8 + available % nbits * 8 / nbits : available / h.element_bytes();
+	uint64_t count = 1;
+	for (uint64_t extent : h.shape) {
+		if (extent != 0 && count > capacity / extent) throw posit_file_exception(path + " is truncated");
+		count *= extent;
+	}
+	if (h.data_bytes() > available) throw posit_file_exception(path + " is truncated");
+	return swapped;
+}
+
+}  // namespace internal
+
+// read the header of a posit array file, in the byte order of this machine, to find the configuration it holds
+inline posit_file_header read_posit_file_header(const std::string& path) {
+	posit_file_header h;
+	FILE* f = std::fopen(path.c_str(), "rb");
+	if (f == nullptr) throw posit_file_exception("cannot open " + path);
+	size_t n = std::fread(&h, sizeof(h), 1, f);
+	std::fclose(f);
+	if (n != 1 || std::memcmp(h.magic, internal::posit_file_magic, sizeof(h.magic)) != 0) throw posit_file_exception(path + " is not a posit array file");
+	if (h.byte_order == internal::posit_file_swapped_byte_order) internal::byteswap(h);
+	return h;
+}
+
+// read-only view of n posit encodings in either packing, in the byte order of this machine
+template<size_t nbits, size_t es>
+class posit_array_view {
+	static_assert(nbits >= 2 && nbits <= 64, "posit array files hold posits of 2 to 64 bits");
+public:
+	using value_type = posit<nbits, es>;
+	static constexpr uint64_t mask = (nbits == 64 ? ~uint64_t(0) : ((uint64_t(1) << (nbits % 64)) - 1));
+	static constexpr size_t element_bytes = nbits <= 8 ? 1 : nbits <= 16 ? 2 : nbits <= 32 ? 4 : 8;
+
+	posit_array_view() : _data(nullptr), _size(0), _packing(posit_file_packing::word) {}
+	posit_array_view(const void* data, size_t n, posit_file_packing packing) : _data(data), _size(n), _packing(packing) {}
+
+	size_t size() const { return _size; }
+	posit_file_packing packing() const { return _packing; }
+
+	uint64_t encoding(size_t i) const {
+		if (_packing == posit_file_packing::bit) {
+			const uint64_t* words = static_cast<const uint64_t*>(_data);
+			size_t bit = i * nbits;
+			size_t w = bit / 64;
+			unsigned s = unsigned(bit % 64);
+			return ((words[w] >> s) | ((words[w + 1] << 1) << (63 - s))) & mask;
+		}
+		switch (element_bytes) {
+		case 1: return static_cast<const uint8_t*>(_data)[i];
+		case 2: return static_cast<const uint16_t*>(_data)[i];
+		case 4: return static_cast<const uint32_t*>(_data)[i];
+		default: return static_cast<const uint64_t*>(_data)[i] & mask;
+		}
+	}
+	value_type operator[](size_t i) const {
+		value_type p;
+		p.set_raw_bits(encoding(i));
+		return p;
+	}
+	void unpack(size_t first, size_t n, value_type* dst) const {
+		for (size_t i = 0; i < n; ++i) dst[i].set_raw_bits(encoding(first + i));
+	}
+
+	// the encodings of a word packed array as an array of the unsigned integer of element_bytes bytes
+	template<typename Unsigned>
+	const Unsigned* encodings() const {
+		static_assert(sizeof(Unsigned) == element_bytes, "the encodings are stored in element_bytes bytes");
+		if (_packing != posit_file_packing::word) throw posit_file_exception("the encodings of a bit packed array are not addressable");
+		return static_cast<const Unsigned*>(_data);
+	}
+
+private:
+	const void* _data;
+	size_t _size;
+	posit_file_packing _packing;
+};
+
+// a posit array file mapped into memory: the encodings are used in place
+template<size_t nbits, size_t es>
+class mapped_posit_file {
+public:
+	explicit mapped_posit_file(const std::string& path) : _base(nullptr), _length(0) {
+#if POSIT_FILE_MMAP
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) throw posit_file_exception("cannot open " + path);
+		struct stat st;
+		if (::fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(posit_file_header)) {
+			::close(fd);
+			throw posit_file_exception(path + " is not a posit array file");
+		}
+		_length = size_t(st.st_size);
+		void* base = ::mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED) throw posit_file_exception("cannot map " + path);
+		_base = base;
+#else
+		// without mmap the file is read into memory once
+		FILE* f = std::fopen(path.c_str(), "rb");
+		if (f == nullptr) throw posit_file_exception("cannot open " + path);
+		std::fseek(f, 0, SEEK_END);
+		_length = size_t(std::ftell(f));
+		std::fseek(f, 0, SEEK_SET);
+		_buffer.resize((_length + 7) / 8);
+		size_t n = std::fread(_buffer.data(), 1, _length, f);
+		std::fclose(f);
+		if (n != _length || _length < sizeof(posit_file_header)) throw posit_file_exception(path + " is not a posit array file");
+		_base = _buffer.data();
+#endif
+		try {
+			std::memcpy(&_header, _base, sizeof(_header));
+			if (internal::validate_header<nbits, es>(_header, path, _length)) throw posit_file_exception(path + " has the byte order of another machine, use the posit_file_reader");
+		}
+		catch (...) {
+			unmap();
+			throw;
+		}
+	}
+	~mapped_posit_file() { unmap(); }
+	mapped_posit_file(const mapped_posit_file&) = delete;
+	mapped_posit_file& operator=(const mapped_posit_file&) = delete;
+
+	const posit_file_header& header() const { return _header; }
+	size_t size() const { return size_t(_header.size()); }
+	size_t rank() const { return _header.rank; }
+	size_t extent(size_t dimension) const { return size_t(_header.shape[dimension]); }
+	posit_file_packing packing() const { return posit_file_packing(_header.packing); }
+	posit_array_view<nbits, es> view() const {
+		return posit_array_view<nbits, es>(static_cast<const char*>(_base) + _header.data_offset, size(), packing());
+	}
+
+private:
+	void unmap() {
+#if POSIT_FILE_MMAP
+		if (_base != nullptr) ::munmap(_base, _length);
+#endif
+		_base = nullptr;
+	}
+
+	void* _base;
+	size_t _length;
+	posit_file_header _header;
+#if !POSIT_FILE_MMAP
+	std::vector<uint64_t> _buffer;
+#endif
+};
+
+// chunked writer of a posit array file: the shape is given up front, or the array is one dimensional with the number of posits written
+template<size_t nbits, size_t es>
+class posit_file_writer {
+	static_assert(nbits >= 2 && nbits <= 64, "posit array files hold posits of 2 to 64 bits");
+public:
+	using value_type = posit<nbits, es>;
+	static constexpr uint64_t mask = posit_array_view<nbits, es>::mask;
+	static constexpr size_t element_bytes = posit_array_view<nbits, es>::element_bytes;
+	static constexpr size_t chunk_bytes = size_t(1) << 20;
+
+	posit_file_writer(const std::string& path, posit_file_packing packing = posit_file_packing::word, std::initializer_list<uint64_t> shape = {})
+		: _path(path), _file(nullptr), _packing(packing), _count(0), _word(0), _bits(0) {
+		if (shape.size() > 4) throw posit_file_exception("posit array files hold up to 4 dimensions");
+		std::memset(&_header, 0, sizeof(_header));
+		std::memcpy(_header.magic, internal::posit_file_magic, sizeof(_header.magic));
+		_header.byte_order = internal::posit_file_byte_order;
+		_header.version = internal::posit_file_version;
+		_header.nbits = uint16_t(nbits);
+		_header.es = uint16_t(es);
+		_header.packing = uint8_t(packing);
+		_header.rank = uint8_t(shape.size() == 0 ? 1 : shape.size());
+		for (uint64_t& extent : _header.shape) extent = 1;
+		_shaped = shape.size() != 0;
+		size_t d = 0;
+		for (uint64_t extent : shape) _header.shape[d++] = extent;
+		_header.data_offset = sizeof(posit_file_header);
+
+		_file = std::fopen(path.c_str(), "wb");
+		if (_file == nullptr) throw posit_file_exception("cannot create " + path);
+		// the header is rewritten with the final shape when the writer is closed
+		if (std::fwrite(&_header, sizeof(_header), 1, _file) != 1) fail("cannot write the header of ");
+		_chunk.reserve(chunk_bytes);
+	}
+	~posit_file_writer() {
+		if (_file != nullptr) {
+			try { close(); } catch (...) {}
+		}
+	}
+	posit_file_writer(const posit_file_writer&) = delete;
+	posit_file_writer& operator=(const posit_file_writer&) = delete;
+
+	void write(const value_type* p, size_t n) {
+		for (size_t i = 0; i < n; ++i) append(uint64_t(p[i].encoding()) & mask);
+		_count += n;
+	}
+	void write(const value_type& p) { write(&p, 1); }
+	// encodings in the low bits of the words
+	void write_encodings(const uint64_t* bits, size_t n) {
+		for (size_t i = 0; i < n; ++i) append(bits[i] & mask);
+		_count += n;
+	}
+	uint64_t size() const { return _count; }
+
+	// flush the encodings and the final header
+	void close() {
+		if (_file == nullptr) return;
+		if (_packing == posit_file_packing::bit) {
+			if (_bits != 0) put_word(_word);
+			put_word(0);  // padding
+		}
+		flush();
+		if (_shaped && _header.size() != _count) {
+			fail("the number of posits written differs from the shape of ");
+		}
+		if (!_shaped) _header.shape[0] = _count;
+		if (std::fseek(_file, 0, SEEK_SET) != 0 || std::fwrite(&_header, sizeof(_header), 1, _file) != 1) fail("cannot write the header of ");
+		int rc = std::fclose(_file);
+		_file = nullptr;
+		if (rc != 0) throw posit_file_exception("cannot close " + _path);
+	}
+
+private:
+	void append(uint64_t bits) {
+		if (_packing == posit_file_packing::word) {
+			switch (element_bytes) {
+			case 1: { uint8_t v = uint8_t(bits); put(&v, 1); } break;
+			case 2: { uint16_t v = uint16_t(bits); put(&v, 2); } break;
+			case 4: { uint32_t v = uint32_t(bits); put(&v, 4); } break;
+			default: put(&bits, 8); break;
+			}
+			return;
+		}
+		_word |= bits << _bits;
+		_bits += unsigned(nbits);
+		if (_bits >= 64) {
+			put_word(_word);
+			_bits -= 64;
+			_word = _bits == 0 ? 0 : bits >> (nbits - _bits);
+		}
+	}
+	void put_word(uint64_t w) { put(&w, 8); }
+	void put(const void* bytes, size_t n) {
+		const char* b = static_cast<const char*>(bytes);
+		_chunk.insert(_chunk.end(), b, b + n);
+		if (_chunk.size() >= chunk_bytes) flush();
+	}
+	void flush() {
+		if (!_chunk.empty() && std::fwrite(_chunk.data(), 1, _chunk.size(), _file) != _chunk.size()) fail("cannot write ");
+		_chunk.clear();
+	}
+	void fail(const std::string& what) {
+		std::fclose(_file);
+		_file = nullptr;
+		throw posit_file_exception(what + _path);
+	}
+
+	std::string _path;
+	FILE* _file;
+	posit_file_packing _packing;
+	posit_file_header _header;
+	bool _shaped;
+	uint64_t _count;
+	uint64_t _word;     // the partial word of bit packing
+	unsigned _bits;     // and the number of bits in it
+	std::vector<char> _chunk;
+};
+
+// chunked reader of a posit array file, in either byte order
+template<size_t nbits, size_t es>
+class posit_file_reader {
+public:
+	using value_type = posit<nbits, es>;
+	static constexpr uint64_t mask = posit_array_view<nbits, es>::mask;
+	static constexpr size_t element_bytes = posit_array_view<nbits, es>::element_bytes;
+	static constexpr size_t chunk_words = size_t(1) << 17;
+
+	explicit posit_file_reader(const std::string& path) : _path(path), _file(nullptr), _remaining(0), _next(0), _word(0), _bits(0) {
+		_file = std::fopen(path.c_str(), "rb");
+		if (_file == nullptr) throw posit_file_exception("cannot open " + path);
+		try {
+			if (std::fread(&_header, sizeof(_header), 1, _file) != 1) throw posit_file_exception(path + " is not a posit array file");
+			if (std::fseek(_file, 0, SEEK_END) != 0) throw posit_file_exception("cannot read " + path);
+			long length = std::ftell(_file);
+			if (length < 0) throw posit_file_exception("cannot read " + path);
+			_little_endian = internal::validate_header<nbits, es>(_header, path, uint64_t(length)) != internal::little_endian_host();
+			if (std::fseek(_file, long(_header.data_offset), SEEK_SET) != 0) throw posit_file_exception(path + " is truncated");
+		}
+		catch (...) {
+			std::fclose(_file);
+			throw;
+		}
+		_remaining = _header.size();
+	}
+	~posit_file_reader() { if (_file != nullptr) std::fclose(_file); }
+	posit_file_reader(const posit_file_reader&) = delete;
+	posit_file_reader& operator=(const posit_file_reader&) = delete;
+
+	const posit_file_header& header() const { return _header; }
+	uint64_t size() const { return _header.size(); }
+
+	// read up to n posits, and return the number read: 0 at the end of the array
+	size_t read(value_type* p, size_t n) {
+		if (n > _remaining) n = size_t(_remaining);
+		for (size_t i = 0; i < n; ++i) p[i].set_raw_bits(next_encoding());
+		_remaining -= n;
+		return n;
+	}
+
+private:
+	uint64_t next_encoding() {
+		if (_header.packing == uint8_t(posit_file_packing::word)) {
+			switch (element_bytes) {
+			case 8: return next_bytes() & mask;
+			default: return next_bytes();
+			}
+		}
+		// bit packing: the encoding continues in the next word when the current one runs out
+		if (_bits >= nbits) {
+			uint64_t bits = (_word >> (64 - _bits)) & mask;
+			_bits -= unsigned(nbits);
+			return bits;
+		}
+		uint64_t lower = _bits == 0 ? 0 : (_word >> (64 - _bits));
+		_word = next_bytes();
+		uint64_t bits = (lower | (_word << _bits)) & mask;
+		_bits = 64 - unsigned(nbits - _bits);
+		return bits;
+	}
+	// the next element_bytes bytes of word packing, or the next 64-bit word of bit packing, from the chunk,
+	// assembled in the byte order of the file so that the value does not depend on the byte order of this machine
+	uint64_t next_bytes() {
+		size_t n = _header.packing == uint8_t(posit_file_packing::word) ? element_bytes : 8;
+		if (_next + n > _chunk.size()) refill();
+		if (_next + n > _chunk.size()) throw posit_file_exception(_path + " is truncated");
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(_chunk.data() + _next);
+		uint64_t v = 0;
+		if (_little_endian) {
+			for (size_t i = n; i > 0; --i) v = (v << 8) | bytes[i - 1];
+		}
+		else {
+			for (size_t i = 0; i < n; ++i) v = (v << 8) | bytes[i];
+		}
+		_next += n;
+		return v;
+	}
+	void refill() {
+		_chunk.erase(_chunk.begin(), _chunk.begin() + std::ptrdiff_t(_next));
+		_next = 0;
+		size_t have = _chunk.size();
+		_chunk.resize(have + 8 * chunk_words);
+		size_t n = std::fread(_chunk.data() + have, 1, 8 * chunk_words, _file);
+		_chunk.resize(have + n);
+		if (n == 0) throw posit_file_exception(_path + " is truncated");
+	}
+
+	std::string _path;
+	FILE* _file;
+	posit_file_header _header;
+	bool _little_endian;  // the byte order of the file
+	uint64_t _remaining;
+	std::vector<char> _chunk;
+	size_t _next;
+	uint64_t _word;    // the current word of bit packing
+	unsigned _bits;    // and the number of its bits that are not consumed, at the top of the word
+};
+
+}  // namespace unum
+}  // namespace sw
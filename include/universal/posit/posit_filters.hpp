@@ -0,0 +1,378 @@
+#pragma once
+// posit_filters.hpp: streaming FIR, biquad IIR, and polyphase decimation filters with exact, quire-equivalent accumulation
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "math/extended_value.hpp"
+
+namespace sw {
+namespace unum {
+
+/*
+The filters are templated on the posit type and accumulate every output sample exactly, as a quire
+does: the products of the taps and the delayed samples are exact, and the output is the one and
+only rounding of the exact sum, which makes the output independent of the order of the taps.
+Posits of at most 64 bits accumulate in a fixed-point register of 64-bit limbs, wider posits in the
+quire of the configuration.
+
+The delay lines are circular buffers that store every sample twice, at position i and i + length,
+so that the newest length samples are always contiguous and the tap accumulation is a straight
+dot product without a wrap-around test.
+
+	fir_filter<Posit>            y[n] = sum_k h[k] x[n-k]
+	biquad<Posit>                y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2], direct form I
+	biquad_cascade<Posit>        second order sections in series
+	polyphase_decimator<Posit>   the FIR output at every factor-th input sample, with factor subfilters
+
+A NaR tap or sample makes every output whose sum includes it NaR.
+*/
+
+namespace internal {
+
+// delay line of the newest length samples, stored twice so that they are contiguous, newest first
+template<typename Posit>
+class delay_line {
+public:
+	explicit delay_line(size_t length = 1) : _length(length == 0 ? 1 : length), _next(_length - 1), _samples(2 * _length, Posit(0)) {}
+
+	size_t length() const { return _length; }
+	void push(const Posit& x) {
+		_next = (_next == 0 ? _length : _next) - 1;
+		_samples[_next] = x;
+		_samples[_next + _length] = x;
+	}
+	// the newest sample followed by the older ones
+	const Posit* newest() const { return &_samples[_next]; }
+	void reset() { std::fill(_samples.begin(), _samples.end(), Posit(0)); }
+
+private:
+	size_t _length;
+	size_t _next;
+	std::vector<Posit> _samples;
+};
+
+// Exact accumulator of the products of posits of at most 64 bits: a two's complement fixed-point
+// number on 64-bit limbs that spans the products of minpos * minpos to maxpos * maxpos, with capacity
+// bits of headroom. It holds the same value as the quire of the configuration, but a product is a
+// 64x64-bit multiply and an add of three limbs instead of the bit by bit arithmetic of the quire.
+template<size_t nbits, size_t es, size_t capacity>
+class product_accumulator {
+	static constexpr int max_scale = int(nbits - 2) << es;
+	// the weight of the least significant bit: a product of the 64-bit significands has 126 fraction bits
+	static constexpr int lsb = -2 * max_scale - 126;
+	// up to the largest product, the capacity, and the sign, with room for the three limbs of the top product
+	static constexpr size_t limbs = (4 * size_t(max_scale) + 192 + capacity + 1 + 63) / 64;
+public:
+	product_accumulator() { reset(); }
+	void reset() { for (uint64_t& limb : _limbs) limb = 0; }
+
+	// add the exact product of two finite posits
+	void add_product(const posit<nbits, es>& a, const posit<nbits, es>& b) {
+		if (a.iszero() || b.iszero()) return;
+		extended_value x = unpack(a), y = unpack(b);
+		uint128 product = sw::unum::multiply(x.significand.upper, y.significand.upper);
+		unsigned offset = unsigned(x.scale + y.scale - 126 - lsb);
+		size_t w = offset / 64;
+		unsigned s = offset % 64;
+		uint64_t v0 = product.lower << s;
+		uint64_t v1 = s == 0 ? product.upper : (product.upper << s) | (product.lower >> (64 - s));
+		uint64_t v2 = s == 0 ? 0 : product.upper >> (64 - s);
+		if (x.sign == y.sign) {
+			uint64_t carry = add_limb(w, v0, 0);
+			carry = add_limb(w + 1, v1, carry);
+			carry = add_limb(w + 2, v2, carry);
+			for (size_t i = w + 3; carry != 0 && i < limbs; ++i) carry = add_limb(i, 0, carry);
+		}
+		else {
+			uint64_t borrow = subtract_limb(w, v0, 0);
+			borrow = subtract_limb(w + 1, v1, borrow);
+			borrow = subtract_limb(w + 2, v2, borrow);
+			for (size_t i = w + 3; borrow != 0 && i < limbs; ++i) borrow = subtract_limb(i, 0, borrow);
+		}
+	}
+
+	// the one rounding of the sum
+	template<typename Posit>
+	Posit round() const {
+		Posit p(0);
+		uint64_t m[limbs];
+		bool negative = (_limbs[limbs - 1] >> 63) != 0;
+		uint64_t carry = 1;
+		for (size_t i = 0; i < limbs; ++i) {
+			if (negative) {
+				uint64_t t = ~_limbs[i] + carry;
+				carry = (carry != 0 && t == 0) ? 1 : 0;
+				m[i] = t;
+			}
+			else {
+				m[i] = _limbs[i];
+			}
+		}
+		size_t top = limbs;
+		while (top > 0 && m[top - 1] == 0) --top;
+		if (top == 0) return p;
+		--top;
+		unsigned lz = countLeadingZeros(m[top]);
+		// the 128 bits below and including the leading one, and whether any bit below them is set
+		uint64_t w0 = m[top], w1 = top >= 1 ? m[top - 1] : 0, w2 = top >= 2 ? m[top - 2] : 0;
+		uint128 significand;
+		significand.upper = lz == 0 ? w0 : (w0 << lz) | (w1 >> (64 - lz));
+		significand.lower = lz == 0 ? w1 : (w1 << lz) | (w2 >> (64 - lz));
+		bool inexact = (w2 << lz) != 0;
+		for (size_t i = 0; !inexact && i + 2 < top; ++i) inexact = m[i] != 0;
+		int scale = int(64 * top + 63 - lz) + lsb;
+		round_to(make_extended(negative, scale, significand, inexact), p);
+		return p;
+	}
+
+private:
+	uint64_t add_limb(size_t i, uint64_t v, uint64_t carry) {
+		if (i >= limbs) return 0;
+		uint64_t t = _limbs[i] + v;
+		uint64_t c = t < v ? 1 : 0;
+		_limbs[i] = t + carry;
+		return c | (_limbs[i] < t ? 1 : 0);
+	}
+	uint64_t subtract_limb(size_t i, uint64_t v, uint64_t borrow) {
+		if (i >= limbs) return 0;
+		uint64_t t = _limbs[i] - v;
+		uint64_t b = _limbs[i] < v ? 1 : 0;
+		_limbs[i] = t - borrow;
+		return b | (t < borrow ? 1 : 0);
+	}
+
+	uint64_t _limbs[limbs];
+};
+
+// the quire of the configuration, for posits of more than 64 bits
+template<size_t nbits, size_t es, size_t capacity>
+class quire_accumulator {
+public:
+	void reset() { _q.reset(); }
+	void add_product(const posit<nbits, es>& a, const posit<nbits, es>& b) { _q += quire_mul(a, b); }
+	template<typename Posit>
+	Posit round() const {
+		Posit p;
+		convert(_q.to_value(), p);
+		return p;
+	}
+
+private:
+	quire<nbits, es, capacity> _q;
+};
+
+template<typename Posit, size_t capacity>
+using filter_accumulator = typename std::conditional<(Posit::nbits <= 64),
+	product_accumulator<Posit::nbits, Posit::es, capacity>,
+	quire_accumulator<Posit::nbits, Posit::es, capacity>>::type;
+
+// add the exact products of h[0, n) and x[0, n) to the accumulator, and return true if any of them is NaR
+template<typename Accumulator, typename Posit>
+bool accumulate_products(Accumulator& q, const Posit* h, const Posit* x, size_t n) {
+	bool nar = false;
+	for (size_t i = 0; i < n; ++i) {
+		if (h[i].isnar() || x[i].isnar()) {
+			nar = true;
+		}
+		else {
+			q.add_product(h[i], x[i]);
+		}
+	}
+	return nar;
+}
+
+// the one rounding of the accumulator
+template<typename Posit, typename Accumulator>
+Posit round_accumulator(const Accumulator& q, bool nar) {
+	Posit y;
+	if (nar) {
+		y.setnar();
+	}
+	else {
+		y = q.template round<Posit>();
+	}
+	return y;
+}
+
+}  // namespace internal
+
+// finite impulse response filter
+template<typename Posit, size_t capacity = 10>
+class fir_filter {
+public:
+	using value_type = Posit;
+	using accumulator_type = internal::filter_accumulator<Posit, capacity>;
+
+	template<typename Taps>
+	explicit fir_filter(const Taps& taps) : _taps(std::begin(taps), std::end(taps)), _delay(_taps.size()) {
+		if (_taps.empty()) throw std::invalid_argument("fir_filter requires at least one tap");
+	}
+	fir_filter(std::initializer_list<Posit> taps) : fir_filter(std::vector<Posit>(taps)) {}
+
+	size_t order() const { return _taps.size() - 1; }
+	const std::vector<Posit>& taps() const { return _taps; }
+	void reset() { _delay.reset(); }
+
+	// filter one sample
+	Posit process(const Posit& x) {
+		_delay.push(x);
+		_q.reset();
+		bool nar = internal::accumulate_products(_q, _taps.data(), _delay.newest(), _taps.size());
+		return internal::round_accumulator<Posit>(_q, nar);
+	}
+	// filter a block of samples, out may be in
+	void process(const Posit* in, Posit* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) out[i] = process(in[i]);
+	}
+
+private:
+	std::vector<Posit> _taps;
+	internal::delay_line<Posit> _delay;
+	accumulator_type _q;
+};
+
+// second order section of an infinite impulse response filter, with a0 normalized to 1
+template<typename Posit, size_t capacity = 10>
+class biquad {
+public:
+	using value_type = Posit;
+	using accumulator_type = internal::filter_accumulator<Posit, capacity>;
+
+	biquad(const Posit& b0, const Posit& b1, const Posit& b2, const Posit& a1, const Posit& a2)
+		// the feedback coefficients are stored negated, so that the section is a single sum of products
+		: _b{ b0, b1, b2 }, _a{ -a1, -a2 }, _x{ Posit(0), Posit(0), Posit(0) }, _y{ Posit(0), Posit(0) } {}
+
+	void reset() {
+		_x[0] = _x[1] = _x[2] = Posit(0);
+		_y[0] = _y[1] = Posit(0);
+	}
+
+	// filter one sample: the feed forward and the feedback products are accumulated in one quire
+	Posit process(const Posit& x) {
+		_x[2] = _x[1];
+		_x[1] = _x[0];
+		_x[0] = x;
+		_q.reset();
+		bool nar = internal::accumulate_products(_q, _b, _x, 3);
+		nar = internal::accumulate_products(_q, _a, _y, 2) || nar;
+		Posit y = internal::round_accumulator<Posit>(_q, nar);
+		_y[1] = _y[0];
+		_y[0] = y;
+		return y;
+	}
+	void process(const Posit* in, Posit* out, size_t n) {
+		for (size_t i = 0; i < n; ++i) out[i] = process(in[i]);
+	}
+
+private:
+	Posit _b[3];
+	Posit _a[2];
+	Posit _x[3];    // x[n], x[n-1], x[n-2]
+	Posit _y[2];    // y[n-1], y[n-2]
+	accumulator_type _q;
+};
+
+// second order sections in series: every section rounds its output once
+template<typename Posit, size_t capacity = 10>
+class biquad_cascade {
+public:
+	using value_type = Posit;
+	using section = biquad<Posit, capacity>;
+
+	biquad_cascade() = default;
+	explicit biquad_cascade(const std::vector<section>& sections) : _sections(sections) {}
+
+	// append a section with the coefficients b0, b1, b2, a1, a2
+	void add_section(const Posit& b0, const Posit& b1, const Posit& b2, const Posit& a1, const Posit& a2) {
+		_sections.emplace_back(b0, b1, b2, a1, a2);
+	}
+	size_t sections() const { return _sections.size(); }
+	void reset() { for (section& s : _sections) s.reset(); }
+
+	Posit process(const Posit& x) {
+		Posit y = x;
+		for (section& s : _sections) y = s.process(y);
+		return y;
+	}
+	// filter a block section by section, so that the state of a section stays in registers for the block
+	void process(const Posit* in, Posit* out, size_t n) {
+		if (_sections.empty()) {
+			if (out != in) std::copy(in, in + n, out);
+			return;
+		}
+		_sections[0].process(in, out, n);
+		for (size_t s = 1; s < _sections.size(); ++s) _sections[s].process(out, out, n);
+	}
+
+private:
+	std::vector<section> _sections;
+};
+
+// decimation by an integer factor: the FIR output at every factor-th input sample, starting with the first one.
+// The taps are split into factor subfilters h_p[j] = h[j*factor + p], and the commutator feeds every input sample
+// to one subfilter, so that each input sample costs order/factor products instead of order.
+template<typename Posit, size_t capacity = 10>
+class polyphase_decimator {
+public:
+	using value_type = Posit;
+	using accumulator_type = internal::filter_accumulator<Posit, capacity>;
+
+	template<typename Taps>
+	polyphase_decimator(const Taps& taps, size_t factor) : _factor(factor), _phase(0) {
+		std::vector<Posit> h(std::begin(taps), std::end(taps));
+		if (h.empty() || factor == 0) throw std::invalid_argument("polyphase_decimator requires at least one tap and a factor of at least one");
+		size_t length = (h.size() + factor - 1) / factor;
+		_subfilters.assign(factor, std::vector<Posit>(length, Posit(0)));
+		for (size_t k = 0; k < h.size(); ++k) _subfilters[k % factor][k / factor] = h[k];
+		_delays.assign(factor, internal::delay_line<Posit>(length));
+	}
+
+	size_t factor() const { return _factor; }
+	void reset() {
+		for (internal::delay_line<Posit>& d : _delays) d.reset();
+		_phase = 0;
+	}
+
+	// feed one sample, and return true when it completes an output sample
+	bool process(const Posit& x, Posit& y) {
+		_delays[_phase].push(x);
+		bool complete = _phase == 0;
+		if (complete) {
+			_q.reset();
+			bool nar = false;
+			for (size_t p = 0; p < _factor; ++p) {
+				nar = internal::accumulate_products(_q, _subfilters[p].data(), _delays[p].newest(), _subfilters[p].size()) || nar;
+			}
+			y = internal::round_accumulator<Posit>(_q, nar);
+		}
+		// the commutator runs from the oldest sample of a block, in subfilter factor-1, to the newest, in subfilter 0
+		_phase = (_phase == 0 ? _factor : _phase) - 1;
+		return complete;
+	}
+	// filter a block, and return the number of output samples: out holds room for n / factor + 1 samples
+	size_t process(const Posit* in, size_t n, Posit* out) {
+		size_t m = 0;
+		for (size_t i = 0; i < n; ++i) {
+			if (process(in[i], out[m])) ++m;
+		}
+		return m;
+	}
+
+private:
+	size_t _factor;
+	size_t _phase;
+	std::vector<std::vector<Posit>> _subfilters;
+	std::vector<internal::delay_line<Posit>> _delays;
+	accumulator_type _q;
+};
+
+}  // namespace unum
+}  // namespace sw
@@ -0,0 +1,211 @@
+#pragma once
+// posit_pair.hpp: definition of a double-word posit number, the unevaluated sum of two posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include "../functions/twoprod.hpp"
+
+namespace sw {
+namespace unum {
+
+/*
+A posit_pair represents the unevaluated sum hi + lo of two posits, with |lo| at most
+half an ulp of hi, to carry roughly twice the precision of the posit near 1.0.
+It is a cheaper alternative to the quire for moderately conditioned computations.
+
+The algorithms are the double-word algorithms of Joldes, Muller, and Popescu,
+"Tight and rigorous error bounds for basic building blocks of double-word arithmetic",
+ACM TOMS 44(2), 2017: addition is Algorithm 6, multiplication Algorithm 12, and
+division Algorithm 17. They build on the twoSum error-free transformation and on
+the twoProd of twoprod.hpp, which recovers the rounding error of a product with a fused multiply-add.
+
+The error bounds of those algorithms assume a constant relative precision: with posits
+they hold in the region of the regime where the fraction is widest, and degrade
+gracefully as the tapered precision of the regime shortens the fraction.
+*/
+
+namespace internal {
+
+// fastTwoSum requires |a| >= |b|, and yields s = RoundToNearest(a + b) and r with a + b = s + r
+template<size_t nbits, size_t es>
+inline std::pair< posit<nbits, es>, posit<nbits, es> > fastTwoSum(const posit<nbits, es>& a, const posit<nbits, es>& b) {
+	posit<nbits, es> s = a + b;
+	posit<nbits, es> z = s - a;
+	return std::pair< posit<nbits, es>, posit<nbits, es> >(s, b - z);
+}
+
+}  // namespace internal
+
+template<size_t nbits, size_t es>
+class posit_pair {
+public:
+	using Posit = posit<nbits, es>;
+
+	posit_pair() : _hi(0), _lo(0) {}
+	posit_pair(const posit_pair&) = default;
+	posit_pair(posit_pair&&) = default;
+	posit_pair& operator=(const posit_pair&) = default;
+	posit_pair& operator=(posit_pair&&) = default;
+
+	posit_pair(const Posit& hi) : _hi(hi), _lo(0) {}
+	// construct from two posits, normalizing so that lo is below half an ulp of hi
+	posit_pair(const Posit& hi, const Posit& lo) {
+		std::pair<Posit, Posit> sr = twoSum(hi, lo);
+		_hi = sr.first;
+		_lo = sr.second;
+	}
+	posit_pair(int rhs) : _hi(rhs), _lo(0) {}
+	// the residual of the conversion is captured in the low posit
+	posit_pair(long double rhs) {
+		_hi = rhs;
+		_lo = _hi.isnar() ? Posit(0) : Posit(rhs - (long double)_hi);
+	}
+	posit_pair(double rhs) : posit_pair((long double)rhs) {}
+
+	// selectors
+	const Posit& high() const { return _hi; }
+	const Posit& low() const { return _lo; }
+	bool isnar() const { return _hi.isnar() || _lo.isnar(); }
+	bool iszero() const { return _hi.iszero(); }
+	bool isneg() const { return _hi.isneg(); }
+
+	// modifiers
+	void setnar() { _hi.setnar(); _lo = 0; }
+	void setzero() { _hi = 0; _lo = 0; }
+
+	// conversion operators
+	explicit operator Posit() const { return _hi + _lo; }
+	explicit operator long double() const { return (long double)_hi + (long double)_lo; }
+	explicit operator double() const { return double((long double)_hi + (long double)_lo); }
+
+	posit_pair operator-() const {
+		posit_pair negated;
+		negated._hi = -_hi;
+		negated._lo = -_lo;
+		return negated;
+	}
+
+	// double-word + double-word, Algorithm 6 (AccurateDWPlusDW)
+	posit_pair& operator+=(const posit_pair& rhs) {
+		if (isnar() || rhs.isnar()) {
+			setnar();
+			return *this;
+		}
+		std::pair<Posit, Posit> s = twoSum(_hi, rhs._hi);
+		std::pair<Posit, Posit> t = twoSum(_lo, rhs._lo);
+		Posit c = s.second + t.first;
+		std::pair<Posit, Posit> v = internal::fastTwoSum(s.first, c);
+		Posit w = t.second + v.second;
+		std::pair<Posit, Posit> z = internal::fastTwoSum(v.first, w);
+		_hi = z.first;
+		_lo = z.second;
+		return *this;
+	}
+	posit_pair& operator-=(const posit_pair& rhs) {
+		return operator+=(-rhs);
+	}
+	// double-word * double-word, Algorithm 12 (DWTimesDW3)
+	posit_pair& operator*=(const posit_pair& rhs) {
+		if (isnar() || rhs.isnar()) {
+			setnar();
+			return *this;
+		}
+		std::pair<Posit, Posit> c = sw::function::twoProd(_hi, rhs._hi);
+		Posit tl0 = _lo * rhs._lo;
+		Posit tl1 = fma(_hi, rhs._lo, tl0);
+		Posit cl2 = fma(_lo, rhs._hi, tl1);
+		Posit cl3 = c.second + cl2;
+		std::pair<Posit, Posit> z = internal::fastTwoSum(c.first, cl3);
+		_hi = z.first;
+		_lo = z.second;
+		return *this;
+	}
+	// double-word / double-word, Algorithm 17 (DWDivDW2)
+	posit_pair& operator/=(const posit_pair& rhs) {
+		if (isnar() || rhs.isnar() || rhs.iszero()) {
+			setnar();
+			return *this;
+		}
+		Posit th = _hi / rhs._hi;
+		// r = rhs * th, Algorithm 9 (DWTimesFP3)
+		std::pair<Posit, Posit> c = sw::function::twoProd(rhs._hi, th);
+		Posit cl3 = fma(rhs._lo, th, c.second);
+		std::pair<Posit, Posit> r = internal::fastTwoSum(c.first, cl3);
+		Posit pi = _hi - r.first;
+		Posit dl = _lo - r.second;
+		Posit d = pi + dl;
+		Posit tl = d / rhs._hi;
+		std::pair<Posit, Posit> z = internal::fastTwoSum(th, tl);
+		_hi = z.first;
+		_lo = z.second;
+		return *this;
+	}
+
+private:
+	Posit _hi;
+	Posit _lo;
+};
+
+////////////////// posit_pair operators
+
+template<size_t nbits, size_t es>
+inline posit_pair<nbits, es> operator+(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) {
+	posit_pair<nbits, es> sum(lhs);
+	sum += rhs;
+	return sum;
+}
+template<size_t nbits, size_t es>
+inline posit_pair<nbits, es> operator-(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) {
+	posit_pair<nbits, es> diff(lhs);
+	diff -= rhs;
+	return diff;
+}
+template<size_t nbits, size_t es>
+inline posit_pair<nbits, es> operator*(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) {
+	posit_pair<nbits, es> mul(lhs);
+	mul *= rhs;
+	return mul;
+}
+template<size_t nbits, size_t es>
+inline posit_pair<nbits, es> operator/(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) {
+	posit_pair<nbits, es> ratio(lhs);
+	ratio /= rhs;
+	return ratio;
+}
+
+template<size_t nbits, size_t es>
+inline bool operator==(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) { return lhs.high() == rhs.high() && lhs.low() == rhs.low(); }
+template<size_t nbits, size_t es>
+inline bool operator!=(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) { return !operator==(lhs, rhs); }
+template<size_t nbits, size_t es>
+inline bool operator< (const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) {
+	return lhs.high() < rhs.high() || (lhs.high() == rhs.high() && lhs.low() < rhs.low());
+}
+template<size_t nbits, size_t es>
+inline bool operator> (const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) { return  operator< (rhs, lhs); }
+template<size_t nbits, size_t es>
+inline bool operator<=(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) { return !operator> (lhs, rhs); }
+template<size_t nbits, size_t es>
+inline bool operator>=(const posit_pair<nbits, es>& lhs, const posit_pair<nbits, es>& rhs) { return !operator< (lhs, rhs); }
+
+template<size_t nbits, size_t es>
+inline std::ostream& operator<<(std::ostream& ostr, const posit_pair<nbits, es>& p) {
+	if (p.isnar()) return ostr << "nar";
+	return ostr << (long double)p;
+}
+
+// the error-free transformations of the posit_pair type: the sum and product of two posits as an exact pair
+template<size_t nbits, size_t es>
+inline posit_pair<nbits, es> add_pair(const posit<nbits, es>& a, const posit<nbits, es>& b) {
+	std::pair< posit<nbits, es>, posit<nbits, es> > sr = twoSum(a, b);
+	return posit_pair<nbits, es>(sr.first, sr.second);
+}
+template<size_t nbits, size_t es>
+inline posit_pair<nbits, es> mul_pair(const posit<nbits, es>& a, const posit<nbits, es>& b) {
+	std::pair< posit<nbits, es>, posit<nbits, es> > pr = sw::function::twoProd(a, b);
+	return posit_pair<nbits, es>(pr.first, pr.second);
+}
+
+}  // namespace unum
+}  // namespace sw
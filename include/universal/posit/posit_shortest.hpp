@@ -0,0 +1,386 @@
+#pragma once
+// posit_shortest.hpp: shortest round-trip decimal representation of posits, and the exact decimal rounding of the parser
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstring>
+
+namespace sw {
+namespace unum {
+
+/*
+The shortest decimal of a posit p is the decimal with the fewest significant digits that rounds
+back to p, and among those the one closest to p. The decimals that round to p form an interval
+bounded by the points where the rounding switches to the neighbors of p, --p and ++p. These points
+are not the arithmetic midpoints: where the tapered encoding drops exponent bits, the rounding of
+the encoding is geometric. They are exactly the posits of nbits+1 bits between p and its neighbors,
+the encodings 2*encoding(--p)+1 and 2*encoding(p)+1, which round to the even encoding of the two
+when a decimal hits them. The interval of minpos and maxpos is closed at the posit itself, so that
+the decimal stays within the dynamic range.
+
+The digits are generated with the free-format algorithm of Steele and White, in the formulation of
+Burger and Dybvig, on integers that hold the value and the distances to the bounds over a common
+denominator. The parser rounds exactly with the same bounds: it checks a first approximation, and
+bisects the encodings above or below it for the posit whose interval contains the decimal.
+*/
+
+namespace internal {
+
+// unsigned integer of a fixed capacity of bits in 32-bit limbs, without heap allocation
+template<size_t capacity_bits>
+class decimal_bignum {
+public:
+	static constexpr size_t capacity = (capacity_bits + 31) / 32;
+
+	decimal_bignum() : used(0) {}
+
+	void setzero() { used = 0; }
+	void set(uint64_t v) {
+		used = 0;
+		while (v != 0) {
+			limb[used++] = uint32_t(v);
+			v >>= 32;
+		}
+	}
+	void set_bit(size_t n) {
+		size_t i = n / 32;
+		while (used <= i) limb[used++] = 0;
+		limb[i] |= uint32_t(1) << (n % 32);
+	}
+	bool iszero() const { return used == 0; }
+	size_t bit_length() const {
+		if (used == 0) return 0;
+		size_t n = 32 * (used - 1);
+		for (uint32_t top = limb[used - 1]; top != 0; top >>= 1) ++n;
+		return n;
+	}
+
+	void shift_left(size_t n) {
+		if (used == 0 || n == 0) return;
+		size_t words = n / 32, bits = n % 32;
+		// the capacity of a configuration bounds its shifts: exceeding it is an error in shortest_capacity
+		if (used + words + (bits != 0 ? 1 : 0) > capacity) throw shift_too_large{};
+		if (bits == 0) {
+			for (size_t i = used; i-- > 0; ) limb[i + words] = limb[i];
+		}
+		else {
+			limb[used + words] = limb[used - 1] >> (32 - bits);
+			for (size_t i = used - 1; i > 0; --i) limb[i + words] = (limb[i] << bits) | (limb[i - 1] >> (32 - bits));
+			limb[words] = limb[0] << bits;
+			++used;
+		}
+		for (size_t i = 0; i < words; ++i) limb[i] = 0;
+		used += words;
+		trim();
+	}
+	void multiply(uint32_t m) {
+		uint64_t carry = 0;
+		for (size_t i = 0; i < used; ++i) {
+			uint64_t t = uint64_t(limb[i]) * m + carry;
+			limb[i] = uint32_t(t);
+			carry = t >> 32;
+		}
+		if (carry != 0) limb[used++] = uint32_t(carry);
+	}
+	void multiply_pow10(unsigned k) {
+		for (; k >= 9; k -= 9) multiply(1000000000u);
+		static const uint32_t pow10[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+		if (k > 0) multiply(pow10[k]);
+	}
+	decimal_bignum& operator+=(const decimal_bignum& b) {
+		uint64_t carry = 0;
+		size_t n = used > b.used ? used : b.used;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t t = uint64_t(i < used ? limb[i] : 0) + (i < b.used ? b.limb[i] : 0) + carry;
+			limb[i] = uint32_t(t);
+			carry = t >> 32;
+		}
+		used = n;
+		if (carry != 0) limb[used++] = uint32_t(carry);
+		return *this;
+	}
+	// requires *this >= b
+	decimal_bignum& operator-=(const decimal_bignum& b) {
+		int64_t borrow = 0;
+		for (size_t i = 0; i < used; ++i) {
+			int64_t t = int64_t(limb[i]) - (i < b.used ? b.limb[i] : 0) - borrow;
+			borrow = t < 0 ? 1 : 0;
+			limb[i] = uint32_t(t + (borrow << 32));
+		}
+		trim();
+		return *this;
+	}
+	// the quotient of a division that is known to be less than ten, the remainder stays in *this
+	unsigned divide_digit(const decimal_bignum& s) {
+		unsigned q = 0;
+		while (compare(*this, s) >= 0) {
+			*this -= s;
+			++q;
+		}
+		return q;
+	}
+
+	friend int compare(const decimal_bignum& a, const decimal_bignum& b) {
+		if (a.used != b.used) return a.used < b.used ? -1 : 1;
+		for (size_t i = a.used; i-- > 0; ) {
+			if (a.limb[i] != b.limb[i]) return a.limb[i] < b.limb[i] ? -1 : 1;
+		}
+		return 0;
+	}
+
+private:
+	void trim() { while (used > 0 && limb[used - 1] == 0) --used; }
+
+	uint32_t limb[capacity];
+	size_t used;
+};
+
+// bits to hold the scaled value, bounds, and decimal powers of a posit configuration
+template<size_t nbits, size_t es>
+struct shortest_capacity {
+	static constexpr size_t bits = 3 * (nbits + 1) * (size_t(1) << es) + 2 * nbits + 1024;
+};
+
+// significant digits of a decimal that decide its rounding: the exact decimal of a rounding bound m * 2^e has
+// at most 0.302 * bits(m) + 0.699 * |e| + 1 of them, so a longer decimal rounds like these digits followed by
+// a sticky 1 that stands for the digits beyond them
+template<size_t nbits, size_t es>
+struct rounding_digits {
+	static constexpr size_t digits = (nbits + 1) * (size_t(1) << es) * 7 / 10 + 2 * nbits + 8;
+};
+
+// bits to hold a decimal of rounding_digits and a sticky digit, scaled to the rounding bounds it is compared with
+template<size_t nbits, size_t es>
+struct rounding_capacity {
+	static constexpr size_t bits = 4 * (nbits + 1) * (size_t(1) << es) + 10 * nbits + 1024;
+};
+
+// the magnitude of a positive posit encoding of N bits as significand * 2^exponent
+template<size_t N, size_t es, typename Bignum>
+void decode_magnitude(const bitblock<N>& bits, Bignum& significand, int& exponent) {
+	int i = int(N) - 2;
+	bool r0 = bits[size_t(i)];
+	int run = 0;
+	while (i >= 0 && bits[size_t(i)] == r0) {
+		++run;
+		--i;
+	}
+	int k = r0 ? run - 1 : -run;
+	--i;  // the regime terminating bit
+	int e = 0;
+	for (size_t j = 0; j < es; ++j) {
+		e <<= 1;
+		if (i >= 0) e |= bits[size_t(i--)] ? 1 : 0;
+	}
+	int nf = i >= 0 ? i + 1 : 0;
+	significand.setzero();
+	significand.set_bit(size_t(nf));
+	for (int j = 0; j < nf; ++j) if (bits[size_t(j)]) significand.set_bit(size_t(j));
+	exponent = k * (1 << es) + e - nf;
+}
+
+// the encoding 2*bits+1 of N+1 bits: the rounding bound above the posit with encoding bits
+template<size_t N>
+bitblock<N + 1> rounding_bound(const bitblock<N>& bits) {
+	bitblock<N + 1> bound;
+	for (size_t j = 0; j < N; ++j) bound[j + 1] = bits[j];
+	bound[0] = true;
+	return bound;
+}
+
+// the bounds of the decimals that round to the positive posit p: lower and upper as significand * 2^exponent,
+// a flag for minpos and maxpos whose interval is closed at the posit, and inclusive when the bounds round to p
+template<size_t nbits, size_t es, typename Bignum>
+struct rounding_interval {
+	Bignum value, lower, upper;
+	int valueExponent, lowerExponent, upperExponent;
+	bool isMinpos, isMaxpos, inclusive;
+
+	explicit rounding_interval(const posit<nbits, es>& p) {
+		bitblock<nbits> bits = p.get();
+		decode_magnitude<nbits, es>(bits, value, valueExponent);
+		inclusive = !bits[0];
+		posit<nbits, es> below(p), above(p);
+		--below;
+		++above;
+		isMinpos = below.iszero();
+		isMaxpos = above.isnar();
+		if (!isMinpos) decode_magnitude<nbits + 1, es>(rounding_bound<nbits>(below.get()), lower, lowerExponent);
+		if (!isMaxpos) decode_magnitude<nbits + 1, es>(rounding_bound<nbits>(bits), upper, upperExponent);
+	}
+};
+
+// compare the decimal digits * 10^k with significand * 2^exponent
+template<typename Bignum>
+int compare_decimal(const Bignum& digits, int k, const Bignum& significand, int exponent) {
+	Bignum a(digits), b(significand);
+	if (k >= 0) a.multiply_pow10(unsigned(k)); else b.multiply_pow10(unsigned(-k));
+	if (exponent >= 0) b.shift_left(size_t(exponent)); else a.shift_left(size_t(-exponent));
+	return compare(a, b);
+}
+
+// the shortest decimal digits of a positive posit, the value is 0.d1d2..dn * 10^k; returns the number of digits
+template<size_t nbits, size_t es>
+size_t shortest_digits(const posit<nbits, es>& p, char* digits, int& k) {
+	using Bignum = decimal_bignum<shortest_capacity<nbits, es>::bits>;
+	rounding_interval<nbits, es, Bignum> interval(p);
+	bool lowOk = interval.isMinpos || interval.inclusive;
+	bool highOk = interval.isMaxpos || interval.inclusive;
+
+	// the value r/s, and the distances to the bounds mlow/s and mhigh/s, over the common denominator 2^-emin
+	int emin = interval.valueExponent;
+	if (!interval.isMinpos && interval.lowerExponent < emin) emin = interval.lowerExponent;
+	if (!interval.isMaxpos && interval.upperExponent < emin) emin = interval.upperExponent;
+	Bignum r(interval.value), s, mlow, mhigh;
+	r.shift_left(size_t(interval.valueExponent - emin));
+	if (interval.isMinpos) {
+		mlow.setzero();
+	}
+	else {
+		mlow = interval.lower;
+		mlow.shift_left(size_t(interval.lowerExponent - emin));
+		Bignum t(r);
+		t -= mlow;
+		mlow = t;
+	}
+	if (interval.isMaxpos) {
+		mhigh.setzero();
+	}
+	else {
+		mhigh = interval.upper;
+		mhigh.shift_left(size_t(interval.upperExponent - emin));
+		mhigh -= r;
+	}
+	s.set(1);
+	if (emin < 0) {
+		s.shift_left(size_t(-emin));
+	}
+	else {
+		r.shift_left(size_t(emin));
+		mlow.shift_left(size_t(emin));
+		mhigh.shift_left(size_t(emin));
+	}
+
+	// estimate the decimal exponent from the binary magnitude, and correct it so that 0.1 <= upper bound < 1
+	int binaryMagnitude = interval.valueExponent + int(interval.value.bit_length());
+	k = int(binaryMagnitude * 0.30102999566398120) + (binaryMagnitude > 0 ? 1 : 0);
+	if (k >= 0) s.multiply_pow10(unsigned(k)); else { r.multiply_pow10(unsigned(-k)); mlow.multiply_pow10(unsigned(-k)); mhigh.multiply_pow10(unsigned(-k)); }
+	for (;;) {
+		Bignum high(r);
+		high += mhigh;
+		int c = compare(high, s);
+		if (c > 0 || (c == 0 && highOk)) {
+			s.multiply(10);
+			++k;
+			continue;
+		}
+		high.multiply(10);
+		c = compare(high, s);
+		if (c < 0 || (c == 0 && !highOk)) {
+			r.multiply(10);
+			mlow.multiply(10);
+			mhigh.multiply(10);
+			--k;
+			continue;
+		}
+		break;
+	}
+
+	size_t n = 0;
+	for (;;) {
+		r.multiply(10);
+		mlow.multiply(10);
+		mhigh.multiply(10);
+		unsigned d = r.divide_digit(s);
+		int c = compare(r, mlow);
+		bool low = c < 0 || (c == 0 && lowOk);
+		Bignum high(r);
+		high += mhigh;
+		c = compare(high, s);
+		bool up = c > 0 || (c == 0 && highOk);
+		if (!low && !up) {
+			digits[n++] = char('0' + d);
+			continue;
+		}
+		if (low && up) {
+			// both digits are within the interval: the closer one, or the even one when they are equally close
+			Bignum twice(r);
+			twice.multiply(2);
+			c = compare(twice, s);
+			up = c > 0 || (c == 0 && (d & 1));
+		}
+		digits[n++] = char('0' + d + (up ? 1 : 0));
+		return n;
+	}
+}
+
+// round the decimal digits * 10^k, of at most rounding_digits + 1 digits, to the posit whose rounding interval contains it,
+// starting from the approximation p
+template<size_t nbits, size_t es>
+void round_decimal(const char* digits, size_t nrDigits, int k, bool negative, posit<nbits, es>& p) {
+	using Bignum = decimal_bignum<rounding_capacity<nbits, es>::bits>;
+	Bignum d;
+	for (size_t i = 0; i < nrDigits; ++i) {
+		d.multiply(10);
+		Bignum digit;
+		digit.set(uint64_t(digits[i] - '0'));
+		d += digit;
+	}
+	if (d.iszero()) {
+		p.setzero();
+		return;
+	}
+	if (p.isnar() || p.iszero()) p = minpos<nbits, es>();
+	if (p.isneg()) p = -p;
+	// the approximation is the rounding, or the rounding is above or below it
+	bitblock<nbits> lo, hi;
+	{
+		rounding_interval<nbits, es, Bignum> interval(p);
+		int c = interval.isMaxpos ? -1 : compare_decimal(d, k, interval.upper, interval.upperExponent);
+		if (c > 0 || (c == 0 && !interval.inclusive)) {
+			posit<nbits, es> above(p);
+			++above;
+			lo = above.get();
+			hi = maxpos<nbits, es>().get();
+		}
+		else {
+			c = interval.isMinpos ? 1 : compare_decimal(d, k, interval.lower, interval.lowerExponent);
+			if (c > 0 || (c == 0 && interval.inclusive)) {
+				if (negative) p = -p;
+				return;
+			}
+			posit<nbits, es> below(p);
+			--below;
+			lo = minpos<nbits, es>().get();
+			hi = below.get();
+		}
+	}
+	// bisection on the encodings in [lo, hi], which are ordered like their values: the rounding is the largest
+	// encoding whose interval does not start above the decimal, and lo is one of them
+	while (lo != hi) {
+		bitblock<nbits + 1> sum;
+		add_unsigned(lo, hi, sum);
+		increment_bitset(sum);
+		bitblock<nbits> mid;
+		for (size_t i = 0; i < nbits; ++i) mid[i] = sum[i + 1];
+		p.set(mid);
+		rounding_interval<nbits, es, Bignum> interval(p);
+		int c = interval.isMinpos ? 1 : compare_decimal(d, k, interval.lower, interval.lowerExponent);
+		if (c > 0 || (c == 0 && interval.inclusive)) {
+			lo = mid;
+		}
+		else {
+			decrement_bitset(mid);
+			hi = mid;
+		}
+	}
+	p.set(lo);
+	if (negative) p = -p;
+}
+
+}  // namespace internal
+
+}  // namespace unum
+}  // namespace sw
@@ -0,0 +1,16 @@
+#pragma once
+// batch_op.hpp: the operations of the posit batch kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+namespace internal {
+
+enum class batch_op { add, sub, mul, div, negate, less, equal };
+
+}  // namespace internal
+}  // namespace unum
+}  // namespace sw
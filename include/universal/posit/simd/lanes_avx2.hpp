@@ -0,0 +1,214 @@
+#pragma once
+// lanes_avx2.hpp: 16-bit and 64-bit integer lanes in AVX2 registers for the posit batch kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <type_traits>
+#include <immintrin.h>
+#include "posit_lanes.hpp"
+
+// the code in this file is compiled for AVX2 independent of the compiler flags, the batch
+// dispatch only calls into it when the processor supports AVX2
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace sw {
+namespace unum {
+namespace internal {
+namespace avx2 {
+
+// four 64-bit lanes, predicates are registers with all bits set in the lanes where they hold
+struct lanes64 {
+	using reg = __m256i;
+	using mask = __m256i;
+	static constexpr size_t width = 4;
+	static constexpr unsigned bits = 64;
+	static constexpr unsigned mul_bits = 32;
+
+	static inline reg zero() { return _mm256_setzero_si256(); }
+	static inline reg set1(uint64_t v) { return _mm256_set1_epi64x(int64_t(v)); }
+
+	static inline reg add(reg a, reg b) { return _mm256_add_epi64(a, b); }
+	static inline reg sub(reg a, reg b) { return _mm256_sub_epi64(a, b); }
+	static inline reg band(reg a, reg b) { return _mm256_and_si256(a, b); }
+	static inline reg bor(reg a, reg b) { return _mm256_or_si256(a, b); }
+	static inline reg bxor(reg a, reg b) { return _mm256_xor_si256(a, b); }
+	// shifts by 64 or more yield zero
+	static inline reg slli(reg a, unsigned n) { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg srli(reg a, unsigned n) { return _mm256_srl_epi64(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg sllv(reg a, reg n) { return _mm256_sllv_epi64(a, n); }
+	static inline reg srlv(reg a, reg n) { return _mm256_srlv_epi64(a, n); }
+	// low 32 bits of each lane multiplied into a 64-bit product
+	static inline reg mul(reg a, reg b) { return _mm256_mul_epu32(a, b); }
+
+	static inline mask eq(reg a, reg b) { return _mm256_cmpeq_epi64(a, b); }
+	// signed comparison
+	static inline mask gt(reg a, reg b) { return _mm256_cmpgt_epi64(a, b); }
+	static inline mask mand(mask a, mask b) { return _mm256_and_si256(a, b); }
+	static inline mask mor(mask a, mask b) { return _mm256_or_si256(a, b); }
+	static inline mask mandnot(mask a, mask b) { return _mm256_andnot_si256(b, a); }  // a and not b
+	// a where m holds, b elsewhere
+	static inline reg select(mask m, reg a, reg b) { return _mm256_blendv_epi8(b, a, m); }
+
+	// count leading zeros by a branch-free binary search, clz(0) = 64
+	static inline reg clz(reg x) {
+		reg n = zero();
+		const unsigned steps[] = { 32, 16, 8, 4, 2, 1 };
+		for (unsigned s : steps) {
+			mask m = eq(srli(x, 64 - s), zero());
+			n = add(n, band(m, set1(s)));
+			x = select(m, slli(x, s), x);
+		}
+		return add(n, band(eq(x, zero()), set1(1)));
+	}
+
+	// trunc(a * 2^s / b) for a, b < 2^52, possibly one too large: the caller corrects it with the remainder
+	static inline reg quotient(reg a, reg b, unsigned s) {
+		const __m256d magic = _mm256_set1_pd(4503599627370496.0);  // 2^52
+		const reg magicBits = _mm256_castpd_si256(magic);
+		__m256d da = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(a, magicBits)), magic);
+		__m256d db = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(b, magicBits)), magic);
+		__m256d q = _mm256_mul_pd(_mm256_div_pd(da, db), _mm256_set1_pd(std::ldexp(1.0, int(s))));
+		q = _mm256_round_pd(q, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+		return _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd(q, magic)), magicBits);
+	}
+
+	// load width encodings, zero extended into the lanes
+	static inline reg load(const uint8_t* p) {
+		int32_t v;
+		std::memcpy(&v, p, sizeof(v));
+		return _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(v));
+	}
+	static inline reg load(const uint16_t* p) { return _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))); }
+	static inline reg load(const uint32_t* p) { return _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+	static inline reg load(const uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	// store the low bits of the lanes as width encodings: gather the low halves of the lanes and pack them
+	static inline __m128i narrow32(reg v) {
+		return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+	}
+	static inline void store(uint8_t* p, reg v) {
+		__m128i w = narrow32(v);
+		w = _mm_packus_epi16(_mm_packus_epi32(w, w), w);
+		int32_t e = _mm_cvtsi128_si32(w);
+		std::memcpy(p, &e, sizeof(e));
+	}
+	static inline void store(uint16_t* p, reg v) {
+		__m128i w = narrow32(v);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi32(w, w));
+	}
+	static inline void store(uint32_t* p, reg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), narrow32(v)); }
+	static inline void store(uint64_t* p, reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+
+// sixteen 16-bit lanes for the posits of at most 8 bits, predicates are registers with all bits set in the lanes where they hold
+struct lanes16 {
+	using reg = __m256i;
+	using mask = __m256i;
+	static constexpr size_t width = 16;
+	static constexpr unsigned bits = 16;
+	static constexpr unsigned mul_bits = 16;
+
+	static inline reg zero() { return _mm256_setzero_si256(); }
+	static inline reg set1(uint64_t v) { return _mm256_set1_epi16(int16_t(v)); }
+
+	static inline reg add(reg a, reg b) { return _mm256_add_epi16(a, b); }
+	static inline reg sub(reg a, reg b) { return _mm256_sub_epi16(a, b); }
+	static inline reg band(reg a, reg b) { return _mm256_and_si256(a, b); }
+	static inline reg bor(reg a, reg b) { return _mm256_or_si256(a, b); }
+	static inline reg bxor(reg a, reg b) { return _mm256_xor_si256(a, b); }
+	// shifts by 16 or more yield zero
+	static inline reg slli(reg a, unsigned n) { return _mm256_sll_epi16(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg srli(reg a, unsigned n) { return _mm256_srl_epi16(a, _mm_cvtsi32_si128(int(n))); }
+	// AVX2 has no variable 16-bit shifts: the even and odd lanes shift separately in the 32-bit lanes that hold them
+	static inline reg sllv(reg a, reg n) {
+		const reg low = _mm256_set1_epi32(0xFFFF);
+		reg even = _mm256_and_si256(_mm256_sllv_epi32(a, _mm256_and_si256(n, low)), low);
+		reg odd = _mm256_sllv_epi32(_mm256_andnot_si256(low, a), _mm256_srli_epi32(n, 16));
+		return _mm256_or_si256(even, odd);
+	}
+	static inline reg srlv(reg a, reg n) {
+		const reg low = _mm256_set1_epi32(0xFFFF);
+		reg even = _mm256_srlv_epi32(_mm256_and_si256(a, low), _mm256_and_si256(n, low));
+		reg odd = _mm256_andnot_si256(low, _mm256_srlv_epi32(a, _mm256_srli_epi32(n, 16)));
+		return _mm256_or_si256(even, odd);
+	}
+	// low 16 bits of the product
+	static inline reg mul(reg a, reg b) { return _mm256_mullo_epi16(a, b); }
+
+	static inline mask eq(reg a, reg b) { return _mm256_cmpeq_epi16(a, b); }
+	// signed comparison
+	static inline mask gt(reg a, reg b) { return _mm256_cmpgt_epi16(a, b); }
+	static inline mask mand(mask a, mask b) { return _mm256_and_si256(a, b); }
+	static inline mask mor(mask a, mask b) { return _mm256_or_si256(a, b); }
+	static inline mask mandnot(mask a, mask b) { return _mm256_andnot_si256(b, a); }  // a and not b
+	// a where m holds, b elsewhere
+	static inline reg select(mask m, reg a, reg b) { return _mm256_blendv_epi8(b, a, m); }
+
+	// count leading zeros by a branch-free binary search, clz(0) = 16
+	static inline reg clz(reg x) {
+		reg n = zero();
+		const unsigned steps[] = { 8, 4, 2, 1 };
+		for (unsigned s : steps) {
+			mask m = eq(srli(x, 16 - s), zero());
+			n = add(n, band(m, set1(s)));
+			x = select(m, slli(x, s), x);
+		}
+		return add(n, band(eq(x, zero()), set1(1)));
+	}
+
+	// trunc(a * 2^s / b) for a, b < 2^16, possibly one too large: the caller corrects it with the remainder
+	static inline __m256i quotient32(__m256i a, __m256i b, __m256 scale) {
+		return _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_div_ps(_mm256_cvtepi32_ps(a), _mm256_cvtepi32_ps(b)), scale));
+	}
+	static inline reg quotient(reg a, reg b, unsigned s) {
+		const reg low = _mm256_set1_epi32(0xFFFF);
+		const __m256 scale = _mm256_set1_ps(std::ldexp(1.0f, int(s)));
+		reg even = _mm256_and_si256(quotient32(_mm256_and_si256(a, low), _mm256_and_si256(b, low), scale), low);
+		reg odd = quotient32(_mm256_srli_epi32(a, 16), _mm256_srli_epi32(b, 16), scale);
+		return _mm256_or_si256(even, _mm256_slli_epi32(odd, 16));
+	}
+
+	// load width encodings, zero extended into the lanes
+	static inline reg load(const uint8_t* p) { return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+	// store the low bits of the lanes as width encodings
+	static inline void store(uint8_t* p, reg v) {
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+	}
+};
+
+// the entry points of the batch kernels, compiled for AVX2 with the kernels inlined: the posits of at most
+// 8 bits compute in 16-bit lanes, all other posits and the conversions from and to IEEE-754 in 64-bit lanes
+template<size_t nbits, size_t es, typename Encoding>
+struct batch_kernels {
+	using K = internal::posit_batch_kernels<typename std::conditional<(nbits <= 8), lanes16, lanes64>::type, lanes64, nbits, es, Encoding>;
+
+	template<batch_op op>
+	static void binary(const Encoding* a, const Encoding* b, Encoding* c, size_t n) { K::template binary<op>(a, b, c, n); }
+	static void fma(const Encoding* a, const Encoding* b, const Encoding* c, Encoding* d, size_t n) { K::fma(a, b, c, d, n); }
+	static void negate(const Encoding* a, Encoding* c, size_t n) { K::negate(a, c, n); }
+	template<batch_op op>
+	static void compare(const Encoding* a, const Encoding* b, uint8_t* r, size_t n) { K::template compare<op>(a, b, r, n); }
+	template<typename Bits, unsigned ieee_fbits>
+	static void from_ieee(const Bits* f, Encoding* p, size_t n) { K::template from_ieee<Bits, ieee_fbits>(f, p, n); }
+	template<typename Bits, unsigned ieee_fbits>
+	static void to_ieee(const Encoding* p, Bits* f, size_t n) { K::template to_ieee<Bits, ieee_fbits>(p, f, n); }
+};
+
+}  // namespace avx2
+}  // namespace internal
+}  // namespace unum
+}  // namespace sw
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,179 @@
+#pragma once
+// lanes_avx512.hpp: 16-bit and 64-bit integer lanes in AVX-512 registers for the posit batch kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <type_traits>
+#include <immintrin.h>
+#include "posit_lanes.hpp"
+
+// the code in this file is compiled for AVX-512F, AVX-512CD, and AVX-512BW independent of the compiler
+// flags, the batch dispatch only calls into it when the processor supports all three
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f,avx512cd,avx512bw"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512cd,avx512bw")
+// the unmasked AVX-512 intrinsics of gcc pass an intentionally undefined operand, which -Wall reports once inlined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace sw {
+namespace unum {
+namespace internal {
+namespace avx512 {
+
+// eight 64-bit lanes, predicates are mask registers
+struct lanes64 {
+	using reg = __m512i;
+	using mask = __mmask8;
+	static constexpr size_t width = 8;
+	static constexpr unsigned bits = 64;
+	static constexpr unsigned mul_bits = 32;
+
+	static inline reg zero() { return _mm512_setzero_si512(); }
+	static inline reg set1(uint64_t v) { return _mm512_set1_epi64(int64_t(v)); }
+
+	static inline reg add(reg a, reg b) { return _mm512_add_epi64(a, b); }
+	static inline reg sub(reg a, reg b) { return _mm512_sub_epi64(a, b); }
+	static inline reg band(reg a, reg b) { return _mm512_and_si512(a, b); }
+	static inline reg bor(reg a, reg b) { return _mm512_or_si512(a, b); }
+	static inline reg bxor(reg a, reg b) { return _mm512_xor_si512(a, b); }
+	// shifts by 64 or more yield zero
+	static inline reg slli(reg a, unsigned n) { return _mm512_sll_epi64(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg srli(reg a, unsigned n) { return _mm512_srl_epi64(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg sllv(reg a, reg n) { return _mm512_sllv_epi64(a, n); }
+	static inline reg srlv(reg a, reg n) { return _mm512_srlv_epi64(a, n); }
+	// low 32 bits of each lane multiplied into a 64-bit product
+	static inline reg mul(reg a, reg b) { return _mm512_mul_epu32(a, b); }
+
+	static inline mask eq(reg a, reg b) { return _mm512_cmpeq_epi64_mask(a, b); }
+	// signed comparison
+	static inline mask gt(reg a, reg b) { return _mm512_cmpgt_epi64_mask(a, b); }
+	static inline mask mand(mask a, mask b) { return mask(a & b); }
+	static inline mask mor(mask a, mask b) { return mask(a | b); }
+	static inline mask mandnot(mask a, mask b) { return mask(a & ~b); }
+	// a where m holds, b elsewhere
+	static inline reg select(mask m, reg a, reg b) { return _mm512_mask_blend_epi64(m, b, a); }
+
+	// clz(0) = 64
+	static inline reg clz(reg x) { return _mm512_lzcnt_epi64(x); }
+
+	// trunc(a * 2^s / b) for a, b < 2^52, possibly one too large: the caller corrects it with the remainder
+	static inline reg quotient(reg a, reg b, unsigned s) {
+		const __m512d magic = _mm512_set1_pd(4503599627370496.0);  // 2^52
+		const reg magicBits = _mm512_castpd_si512(magic);
+		__m512d da = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(a, magicBits)), magic);
+		__m512d db = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(b, magicBits)), magic);
+		__m512d q = _mm512_mul_pd(_mm512_div_pd(da, db), _mm512_set1_pd(std::ldexp(1.0, int(s))));
+		q = _mm512_roundscale_pd(q, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+		return _mm512_xor_si512(_mm512_castpd_si512(_mm512_add_pd(q, magic)), magicBits);
+	}
+
+	// load width encodings, zero extended into the lanes
+	static inline reg load(const uint8_t* p) { return _mm512_cvtepu8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))); }
+	static inline reg load(const uint16_t* p) { return _mm512_cvtepu16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+	static inline reg load(const uint32_t* p) { return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); }
+	static inline reg load(const uint64_t* p) { return _mm512_loadu_si512(p); }
+	// store the low bits of the lanes as width encodings
+	static inline void store(uint8_t* p, reg v) { _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm512_cvtepi64_epi8(v)); }
+	static inline void store(uint16_t* p, reg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm512_cvtepi64_epi16(v)); }
+	static inline void store(uint32_t* p, reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi64_epi32(v)); }
+	static inline void store(uint64_t* p, reg v) { _mm512_storeu_si512(p, v); }
+};
+
+// thirty-two 16-bit lanes for the posits of at most 8 bits, predicates are mask registers
+struct lanes16 {
+	using reg = __m512i;
+	using mask = __mmask32;
+	static constexpr size_t width = 32;
+	static constexpr unsigned bits = 16;
+	static constexpr unsigned mul_bits = 16;
+
+	static inline reg zero() { return _mm512_setzero_si512(); }
+	static inline reg set1(uint64_t v) { return _mm512_set1_epi16(int16_t(v)); }
+
+	static inline reg add(reg a, reg b) { return _mm512_add_epi16(a, b); }
+	static inline reg sub(reg a, reg b) { return _mm512_sub_epi16(a, b); }
+	static inline reg band(reg a, reg b) { return _mm512_and_si512(a, b); }
+	static inline reg bor(reg a, reg b) { return _mm512_or_si512(a, b); }
+	static inline reg bxor(reg a, reg b) { return _mm512_xor_si512(a, b); }
+	// shifts by 16 or more yield zero
+	static inline reg slli(reg a, unsigned n) { return _mm512_sll_epi16(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg srli(reg a, unsigned n) { return _mm512_srl_epi16(a, _mm_cvtsi32_si128(int(n))); }
+	static inline reg sllv(reg a, reg n) { return _mm512_sllv_epi16(a, n); }
+	static inline reg srlv(reg a, reg n) { return _mm512_srlv_epi16(a, n); }
+	// low 16 bits of the product
+	static inline reg mul(reg a, reg b) { return _mm512_mullo_epi16(a, b); }
+
+	static inline mask eq(reg a, reg b) { return _mm512_cmpeq_epi16_mask(a, b); }
+	// signed comparison
+	static inline mask gt(reg a, reg b) { return _mm512_cmpgt_epi16_mask(a, b); }
+	static inline mask mand(mask a, mask b) { return mask(a & b); }
+	static inline mask mor(mask a, mask b) { return mask(a | b); }
+	static inline mask mandnot(mask a, mask b) { return mask(a & ~b); }
+	// a where m holds, b elsewhere
+	static inline reg select(mask m, reg a, reg b) { return _mm512_mask_blend_epi16(m, b, a); }
+
+	// clz(0) = 16: the 32-bit count of leading zeros of the even lanes shifted to the top and of the odd lanes in place
+	static inline reg clz(reg x) {
+		const reg low = _mm512_set1_epi32(0xFFFF);
+		const reg sixteen = _mm512_set1_epi32(16);
+		reg even = _mm512_min_epu32(_mm512_lzcnt_epi32(_mm512_slli_epi32(x, 16)), sixteen);
+		reg odd = _mm512_min_epu32(_mm512_lzcnt_epi32(_mm512_andnot_si512(low, x)), sixteen);
+		return _mm512_or_si512(even, _mm512_slli_epi32(odd, 16));
+	}
+
+	// trunc(a * 2^s / b) for a, b < 2^16, possibly one too large: the caller corrects it with the remainder
+	static inline __m512i quotient32(__m512i a, __m512i b, __m512 scale) {
+		return _mm512_cvttps_epi32(_mm512_mul_ps(_mm512_div_ps(_mm512_cvtepi32_ps(a), _mm512_cvtepi32_ps(b)), scale));
+	}
+	static inline reg quotient(reg a, reg b, unsigned s) {
+		const reg low = _mm512_set1_epi32(0xFFFF);
+		const __m512 scale = _mm512_set1_ps(std::ldexp(1.0f, int(s)));
+		reg even = _mm512_and_si512(quotient32(_mm512_and_si512(a, low), _mm512_and_si512(b, low), scale), low);
+		reg odd = quotient32(_mm512_srli_epi32(a, 16), _mm512_srli_epi32(b, 16), scale);
+		return _mm512_or_si512(even, _mm512_slli_epi32(odd, 16));
+	}
+
+	// load width encodings, zero extended into the lanes
+	static inline reg load(const uint8_t* p) { return _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); }
+	// store the low bits of the lanes as width encodings
+	static inline void store(uint8_t* p, reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi16_epi8(v)); }
+};
+
+// the entry points of the batch kernels, compiled for AVX-512 with the kernels inlined: the posits of at
+// most 8 bits compute in 16-bit lanes, all other posits and the conversions from and to IEEE-754 in 64-bit lanes
+template<size_t nbits, size_t es, typename Encoding>
+struct batch_kernels {
+	using K = internal::posit_batch_kernels<typename std::conditional<(nbits <= 8), lanes16, lanes64>::type, lanes64, nbits, es, Encoding>;
+
+	template<batch_op op>
+	static void binary(const Encoding* a, const Encoding* b, Encoding* c, size_t n) { K::template binary<op>(a, b, c, n); }
+	static void fma(const Encoding* a, const Encoding* b, const Encoding* c, Encoding* d, size_t n) { K::fma(a, b, c, d, n); }
+	static void negate(const Encoding* a, Encoding* c, size_t n) { K::negate(a, c, n); }
+	template<batch_op op>
+	static void compare(const Encoding* a, const Encoding* b, uint8_t* r, size_t n) { K::template compare<op>(a, b, r, n); }
+	template<typename Bits, unsigned ieee_fbits>
+	static void from_ieee(const Bits* f, Encoding* p, size_t n) { K::template from_ieee<Bits, ieee_fbits>(f, p, n); }
+	template<typename Bits, unsigned ieee_fbits>
+	static void to_ieee(const Encoding* p, Bits* f, size_t n) { K::template to_ieee<Bits, ieee_fbits>(p, f, n); }
+};
+
+}  // namespace avx512
+}  // namespace internal
+}  // namespace unum
+}  // namespace sw
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
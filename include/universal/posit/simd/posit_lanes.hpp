@@ -0,0 +1,382 @@
+#pragma once
+// posit_lanes.hpp: lane-parallel posit arithmetic on integer lanes
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstring>
+#include "batch_op.hpp"
+
+// the kernels are generic in the lanes and are forced inline into the entry points of the lanes_<isa>.hpp
+// headers, which are compiled for their instruction set: that is where the lane operations inline and where
+// the kernels get their code generation
+#if defined(_MSC_VER)
+#define POSIT_BATCH_INLINE __forceinline
+#else
+#define POSIT_BATCH_INLINE inline __attribute__((always_inline))
+#endif
+// gcc reports the calls of the lane operations in these generic functions as an ABI change, while every
+// call is inlined into code compiled for the instruction set of the lanes
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace sw {
+namespace unum {
+namespace internal {
+
+/*
+Every lane holds one posit of at most half the lane width. The decode measures the regime with a
+count of leading zeros, and the encode rounds to nearest even with the same rules as convert_(), so
+the kernels yield the same posits as the scalar operators. The special cases zero and NaR run
+through the general path on garbage values and are patched in with lane selects at the end.
+
+	decoded posit: sign mask, biased scale, and the fraction bits left-aligned without the hidden bit
+	add/sub/fma  : significands with the hidden bit four bits below the top of a lane-wide window, the
+	               smaller term is shifted right with a sticky bit, and a difference subtracts one more
+	               when the sticky bit is set, to represent x - y - epsilon exactly in the window
+	mul          : exact product of the significands
+	div          : floating-point quotient estimate, corrected with the exact integer remainder
+	from_ieee    : IEEE-754 bits decoded to sign, scale, and fraction, and rounded with the posit encode
+	to_ieee      : decoded posit assembled into IEEE-754 bits, rounded to nearest even when the posit
+	               has more fraction bits than the format
+
+The lanes L provide the lane width in bits, and a multiply of operands of at most mul_bits bits that
+is exact in the lane.
+*/
+template<typename L, size_t nbits, size_t es>
+struct posit_lanes {
+	using reg = typename L::reg;
+	using mask = typename L::mask;
+
+	static constexpr unsigned W = L::bits;
+	static constexpr unsigned fbits = unsigned(nbits - 3 - es);
+	// the significand products fit the window, the quotients fit the multiply, and the dividends the signed lanes
+	static_assert(2 * nbits <= W && nbits >= 3 + es && 2 * fbits + 2 <= W - 4 && fbits + 5 <= L::mul_bits && 2 * fbits + 5 <= W - 1,
+	              "posit_lanes requires posits of at most half the lane width whose significand products and quotients fit the lanes");
+	// scales are biased to stay positive in the lanes, the sum of two biased scales still fits a signed 16-bit lane
+	static constexpr uint64_t bias = uint64_t(1) << 12;
+	static constexpr uint64_t kbias = bias >> es;
+	static constexpr uint64_t sign_bit = uint64_t(1) << (nbits - 1);
+	static constexpr uint64_t encoding_mask = (uint64_t(1) << nbits) - 1;
+	static constexpr uint64_t maxpos = sign_bit - 1;
+	static constexpr uint64_t maxscale = uint64_t(nbits - 2) << es;
+	static constexpr uint64_t window_hidden_bit = uint64_t(1) << (W - 4);
+
+	struct decoded {
+		reg sign;         // all ones for negative posits
+		reg magnitude;    // encoding of the absolute value, which orders the posits by magnitude
+		reg scale;        // scale + bias
+		reg fraction;     // fraction bits without the hidden bit, left-aligned
+		reg significand;  // significand with the hidden bit at position fbits
+		reg window;       // significand with the hidden bit at position W - 4 of the window
+		mask zero;
+		mask nar;
+	};
+
+	// the kernels return their lanes through the first argument: a generic function that returns a vector
+	// register draws an ABI warning from gcc, even when it is always inlined
+	static POSIT_BATCH_INLINE decoded decode(const reg& bits) {
+		const reg one = L::set1(1);
+		decoded d;
+		d.zero = L::eq(bits, L::zero());
+		d.nar = L::eq(bits, L::set1(sign_bit));
+		d.sign = L::sub(L::zero(), L::srli(bits, nbits - 1));
+		d.magnitude = L::band(L::sub(L::bxor(bits, d.sign), d.sign), L::set1(encoding_mask));
+		// left-align the bits following the sign bit
+		reg x = L::slli(d.magnitude, W - nbits + 1);
+		mask ones = L::gt(L::zero(), x);
+		reg run = L::clz(L::select(ones, L::bxor(x, L::set1(~uint64_t(0))), x));
+		reg k = L::select(ones, L::add(L::set1(kbias - 1), run), L::sub(L::set1(kbias), run));
+		// consume the regime and its terminating bit
+		x = L::sllv(x, L::add(run, one));
+		d.scale = L::add(L::slli(k, es), L::srli(x, W - es));
+		d.fraction = L::slli(x, es);
+		d.significand = L::bor(L::srli(d.fraction, W - fbits), L::set1(uint64_t(1) << fbits));
+		d.window = L::bor(L::srli(d.fraction, 4), L::set1(window_hidden_bit));
+		return d;
+	}
+
+	// round sign * 1.fraction * 2^(scale - bias) to a posit encoding, sticky is non-zero when bits below the fraction were lost
+	static POSIT_BATCH_INLINE void encode(reg& r, const reg& sign, const reg& scale, const reg& fraction, const reg& lost) {
+		const reg one = L::set1(1);
+		// project to maxpos and minpos
+		mask over = L::gt(scale, L::set1(bias + maxscale));
+		mask under = L::gt(L::set1(bias - maxscale), scale);
+		mask positive = L::gt(scale, L::set1(bias - 1));
+		reg k = L::srli(scale, es);
+		reg run = L::select(positive, L::sub(k, L::set1(kbias - 1)), L::sub(L::set1(kbias), k));
+		reg regime = L::select(positive, L::slli(L::sub(L::sllv(one, run), one), 1), one);
+		// the regime fills the posit and the terminating bit is the rounding bit: maxpos
+		mask full = L::gt(run, L::set1(nbits - 2));
+		reg avail = L::select(full, L::zero(), L::sub(L::set1(nbits - 2), run));
+		// exponent and fraction bits, left-aligned, followed by everything that is cut off
+		reg esval = L::band(scale, L::set1((uint64_t(1) << es) - 1));
+		reg tail = L::bor(L::slli(esval, W - es), L::srli(fraction, es));
+		reg sticky = L::bor(lost, L::slli(fraction, W - es));
+		reg bits = L::bor(L::sllv(regime, avail), L::srlv(tail, L::sub(L::set1(W), avail)));
+		reg round = L::band(L::srlv(tail, L::sub(L::set1(W - 1), avail)), one);
+		sticky = L::bor(sticky, L::sllv(tail, L::add(avail, one)));
+		reg lsb = L::select(L::eq(sticky, L::zero()), L::band(bits, one), one);
+		bits = L::add(bits, L::band(round, lsb));
+		bits = L::select(L::mor(over, full), L::set1(maxpos), bits);
+		bits = L::select(under, one, bits);
+		r = L::band(L::sub(L::bxor(bits, sign), sign), L::set1(encoding_mask));
+	}
+
+	// round x * 2^(scale - bias - W + 4) + y * 2^(yscale - bias - W + 4), with signs, for |x| >= |y|:
+	// x and y have the hidden bit at position W - 4, or y is zero
+	static POSIT_BATCH_INLINE void sum(reg& r, const reg& sign, const reg& scale, const reg& x, const reg& ysign, const reg& yscale, const reg& y, mask& exactZero) {
+		const reg one = L::set1(1);
+		reg distance = L::sub(scale, yscale);
+		distance = L::select(L::gt(distance, L::set1(W - 1)), L::set1(W - 1), distance);
+		reg sticky = L::sllv(y, L::sub(L::set1(W), distance));
+		reg aligned = L::srlv(y, distance);
+		reg borrow = L::select(L::eq(sticky, L::zero()), L::zero(), one);
+		reg s = L::select(L::eq(sign, ysign), L::add(x, aligned), L::sub(L::sub(x, aligned), borrow));
+		exactZero = L::mand(L::eq(s, L::zero()), L::eq(sticky, L::zero()));
+		reg lz = L::clz(s);
+		encode(r, sign, L::sub(L::add(scale, L::set1(3)), lz), L::sllv(s, L::add(lz, one)), sticky);
+	}
+
+	static POSIT_BATCH_INLINE void negate(reg& r, const reg& a) {
+		r = L::band(L::sub(L::zero(), a), L::set1(encoding_mask));
+	}
+
+	static POSIT_BATCH_INLINE void add(reg& r, const reg& a, const reg& b) {
+		decoded da = decode(a), db = decode(b);
+		mask swap = L::gt(db.magnitude, da.magnitude);
+		mask exactZero;
+		sum(r, L::select(swap, db.sign, da.sign), L::select(swap, db.scale, da.scale), L::select(swap, db.window, da.window),
+		    L::select(swap, da.sign, db.sign), L::select(swap, da.scale, db.scale), L::select(swap, da.window, db.window), exactZero);
+		r = L::select(exactZero, L::zero(), r);
+		r = L::select(db.zero, a, r);
+		r = L::select(da.zero, b, r);
+		r = L::select(L::mor(da.nar, db.nar), L::set1(sign_bit), r);
+	}
+
+	static POSIT_BATCH_INLINE void sub(reg& r, const reg& a, const reg& b) {
+		reg nb;
+		negate(nb, b);
+		add(r, a, nb);
+	}
+
+	static POSIT_BATCH_INLINE void mul(reg& r, const reg& a, const reg& b) {
+		const reg one = L::set1(1);
+		decoded da = decode(a), db = decode(b);
+		reg p = L::mul(da.significand, db.significand);
+		reg lz = L::clz(p);
+		reg scale = L::sub(L::sub(L::add(da.scale, db.scale), L::set1(bias + 2 * fbits - (W - 1))), lz);
+		encode(r, L::bxor(da.sign, db.sign), scale, L::sllv(p, L::add(lz, one)), L::zero());
+		r = L::select(L::mor(da.zero, db.zero), L::zero(), r);
+		r = L::select(L::mor(da.nar, db.nar), L::set1(sign_bit), r);
+	}
+
+	static POSIT_BATCH_INLINE void div(reg& r, const reg& a, const reg& b) {
+		constexpr unsigned shift = fbits + 4;  // quotient of fbits + 4 or fbits + 5 bits: fraction, rounding bit, and more
+		const reg one = L::set1(1);
+		decoded da = decode(a), db = decode(b);
+		const reg& sa = da.significand;
+		const reg& sb = db.significand;
+		reg q = L::quotient(sa, sb, shift);
+		reg remainder = L::sub(L::slli(sa, shift), L::mul(q, sb));
+		mask high = L::gt(L::zero(), remainder);
+		q = L::select(high, L::sub(q, one), q);
+		remainder = L::select(high, L::add(remainder, sb), remainder);
+		mask low = L::gt(remainder, L::sub(sb, one));
+		q = L::select(low, L::add(q, one), q);
+		remainder = L::select(low, L::sub(remainder, sb), remainder);
+		reg lz = L::clz(q);
+		reg scale = L::sub(L::add(L::sub(da.scale, db.scale), L::set1(bias + (W - 1) - shift)), lz);
+		encode(r, L::bxor(da.sign, db.sign), scale, L::sllv(q, L::add(lz, one)), remainder);
+		r = L::select(da.zero, L::zero(), r);
+		r = L::select(L::mor(L::mor(da.nar, db.nar), db.zero), L::set1(sign_bit), r);
+	}
+
+	// a * b + c with a single rounding
+	static POSIT_BATCH_INLINE void fma(reg& r, const reg& a, const reg& b, const reg& c) {
+		decoded da = decode(a), db = decode(b), dc = decode(c);
+		reg p = L::mul(da.significand, db.significand);
+		reg lz = L::clz(p);
+		reg x = L::sllv(p, L::sub(lz, L::set1(3)));
+		reg pscale = L::sub(L::sub(L::add(da.scale, db.scale), L::set1(bias + 2 * fbits - (W - 1))), lz);
+		reg psign = L::bxor(da.sign, db.sign);
+		reg y = L::select(dc.zero, L::zero(), dc.window);
+		mask swap = L::mandnot(L::mor(L::gt(dc.scale, pscale), L::mand(L::eq(dc.scale, pscale), L::gt(y, x))), dc.zero);
+		mask exactZero;
+		sum(r, L::select(swap, dc.sign, psign), L::select(swap, dc.scale, pscale), L::select(swap, y, x),
+		    L::select(swap, psign, dc.sign), L::select(swap, pscale, dc.scale), L::select(swap, x, y), exactZero);
+		r = L::select(exactZero, L::zero(), r);
+		r = L::select(L::mor(da.zero, db.zero), c, r);
+		r = L::select(L::mor(L::mor(da.nar, db.nar), dc.nar), L::set1(sign_bit), r);
+	}
+
+	// round the IEEE-754 value with the bits of an ieee_fbits fraction in the low bits of the lanes to a posit:
+	// subnormals are normalized with the count of leading zeros, infinities and NaNs become NaR
+	template<typename Bits, unsigned ieee_fbits>
+	static POSIT_BATCH_INLINE void from_ieee(reg& r, const reg& bits) {
+		constexpr unsigned ieee_nbits = 8 * sizeof(Bits);
+		constexpr unsigned ieee_ebits = ieee_nbits - 1 - ieee_fbits;
+		constexpr uint64_t ieee_bias = (uint64_t(1) << (ieee_ebits - 1)) - 1;
+		constexpr uint64_t exponent_mask = (uint64_t(1) << ieee_ebits) - 1;
+		constexpr uint64_t magnitude_mask = (uint64_t(1) << (ieee_nbits - 1)) - 1;
+		static_assert(ieee_nbits <= W, "the IEEE-754 bits need to fit the lanes");
+		const reg one = L::set1(1);
+		reg sign = L::sub(L::zero(), L::srli(bits, ieee_nbits - 1));
+		reg exponent = L::band(L::srli(bits, ieee_fbits), L::set1(exponent_mask));
+		reg f = L::band(bits, L::set1((uint64_t(1) << ieee_fbits) - 1));
+		reg lz = L::clz(f);
+		mask subnormal = L::eq(exponent, L::zero());
+		reg scale = L::select(subnormal, L::sub(L::set1(bias + W - ieee_bias - ieee_fbits), lz), L::add(exponent, L::set1(bias - ieee_bias)));
+		reg fraction = L::select(subnormal, L::sllv(f, L::add(lz, one)), L::slli(f, W - ieee_fbits));
+		encode(r, sign, scale, fraction, L::zero());
+		r = L::select(L::eq(L::band(bits, L::set1(magnitude_mask)), L::zero()), L::zero(), r);
+		r = L::select(L::eq(exponent, L::set1(exponent_mask)), L::set1(sign_bit), r);
+	}
+
+	// round the posit to the IEEE-754 format with an ieee_fbits fraction: all posits are normal values of the format,
+	// only posits with more fraction bits than the format need to round, NaR becomes a quiet NaN
+	template<typename Bits, unsigned ieee_fbits>
+	static POSIT_BATCH_INLINE void to_ieee(reg& r, const reg& a) {
+		constexpr unsigned ieee_nbits = 8 * sizeof(Bits);
+		constexpr unsigned ieee_ebits = ieee_nbits - 1 - ieee_fbits;
+		constexpr uint64_t ieee_bias = (uint64_t(1) << (ieee_ebits - 1)) - 1;
+		static_assert(maxscale < ieee_bias, "the posit dynamic range exceeds the normal range of the IEEE-754 format");
+		static_assert(ieee_nbits <= W, "the IEEE-754 bits need to fit the lanes");
+		constexpr uint64_t quiet_nan = (((uint64_t(1) << ieee_ebits) - 1) << ieee_fbits) | (uint64_t(1) << (ieee_fbits - 1));
+		const reg one = L::set1(1);
+		decoded d = decode(a);
+		reg bits = L::bor(L::slli(L::add(d.scale, L::set1(ieee_bias - bias)), ieee_fbits), L::srli(d.fraction, W - ieee_fbits));
+		reg round = L::band(L::srli(d.fraction, W - 1 - ieee_fbits), one);
+		reg sticky = L::slli(d.fraction, ieee_fbits + 1);
+		reg lsb = L::select(L::eq(sticky, L::zero()), L::band(bits, one), one);
+		// a carry out of the fraction increments the exponent
+		bits = L::add(bits, L::band(round, lsb));
+		bits = L::bor(bits, L::band(d.sign, L::set1(uint64_t(1) << (ieee_nbits - 1))));
+		bits = L::select(d.zero, L::zero(), bits);
+		r = L::select(d.nar, L::set1(quiet_nan), bits);
+	}
+};
+
+// the batch loops over contiguous arrays of encodings, the remainder of the array runs through a padded register:
+// the arithmetic computes in the lanes L, the conversions in the lanes C, which are wide enough for the IEEE-754 bits
+template<typename L, typename C, size_t nbits, size_t es, typename Encoding>
+struct posit_batch_kernels {
+	using P = posit_lanes<L, nbits, es>;
+	using PC = posit_lanes<C, nbits, es>;
+	using reg = typename L::reg;
+	static constexpr size_t width = L::width;
+	static constexpr size_t cwidth = C::width;
+
+	static POSIT_BATCH_INLINE void apply(batch_op op, reg& r, const reg& a, const reg& b) {
+		switch (op) {
+		case batch_op::add:   P::add(r, a, b); break;
+		case batch_op::sub:   P::sub(r, a, b); break;
+		case batch_op::mul:   P::mul(r, a, b); break;
+		default:              P::div(r, a, b); break;
+		}
+	}
+
+	template<batch_op op>
+	static POSIT_BATCH_INLINE void binary(const Encoding* a, const Encoding* b, Encoding* c, size_t n) {
+		reg r;
+		size_t i = 0;
+		for (; i + width <= n; i += width) {
+			apply(op, r, L::load(a + i), L::load(b + i));
+			L::store(c + i, r);
+		}
+		if (i < n) {
+			Encoding ta[width] = {}, tb[width] = {}, tc[width];
+			std::memcpy(ta, a + i, (n - i) * sizeof(Encoding));
+			std::memcpy(tb, b + i, (n - i) * sizeof(Encoding));
+			apply(op, r, L::load(ta), L::load(tb));
+			L::store(tc, r);
+			std::memcpy(c + i, tc, (n - i) * sizeof(Encoding));
+		}
+	}
+
+	// negation and comparison need no decode: these loops are left to the autovectorizer, which runs them
+	// on the encodings in their own width, with more lanes than the arithmetic, once they are inlined into
+	// the entry points compiled for the instruction set
+	static POSIT_BATCH_INLINE void negate(const Encoding* a, Encoding* c, size_t n) {
+		for (size_t i = 0; i < n; ++i) c[i] = Encoding(0u - a[i]);
+	}
+
+	static POSIT_BATCH_INLINE void fma(const Encoding* a, const Encoding* b, const Encoding* c, Encoding* d, size_t n) {
+		reg r;
+		size_t i = 0;
+		for (; i + width <= n; i += width) {
+			P::fma(r, L::load(a + i), L::load(b + i), L::load(c + i));
+			L::store(d + i, r);
+		}
+		if (i < n) {
+			Encoding ta[width] = {}, tb[width] = {}, tc[width] = {}, td[width];
+			std::memcpy(ta, a + i, (n - i) * sizeof(Encoding));
+			std::memcpy(tb, b + i, (n - i) * sizeof(Encoding));
+			std::memcpy(tc, c + i, (n - i) * sizeof(Encoding));
+			P::fma(r, L::load(ta), L::load(tb), L::load(tc));
+			L::store(td, r);
+			std::memcpy(d + i, td, (n - i) * sizeof(Encoding));
+		}
+	}
+
+	// IEEE-754 values, given by their bits, to posit encodings
+	template<typename Bits, unsigned ieee_fbits>
+	static POSIT_BATCH_INLINE void from_ieee(const Bits* f, Encoding* p, size_t n) {
+		typename C::reg r;
+		size_t i = 0;
+		for (; i + cwidth <= n; i += cwidth) {
+			PC::template from_ieee<Bits, ieee_fbits>(r, C::load(f + i));
+			C::store(p + i, r);
+		}
+		if (i < n) {
+			Bits tf[cwidth] = {};
+			Encoding tp[cwidth];
+			std::memcpy(tf, f + i, (n - i) * sizeof(Bits));
+			PC::template from_ieee<Bits, ieee_fbits>(r, C::load(tf));
+			C::store(tp, r);
+			std::memcpy(p + i, tp, (n - i) * sizeof(Encoding));
+		}
+	}
+
+	// posit encodings to the bits of IEEE-754 values
+	template<typename Bits, unsigned ieee_fbits>
+	static POSIT_BATCH_INLINE void to_ieee(const Encoding* p, Bits* f, size_t n) {
+		typename C::reg r;
+		size_t i = 0;
+		for (; i + cwidth <= n; i += cwidth) {
+			PC::template to_ieee<Bits, ieee_fbits>(r, C::load(p + i));
+			C::store(f + i, r);
+		}
+		if (i < n) {
+			Encoding tp[cwidth] = {};
+			Bits tf[cwidth];
+			std::memcpy(tp, p + i, (n - i) * sizeof(Encoding));
+			PC::template to_ieee<Bits, ieee_fbits>(r, C::load(tp));
+			C::store(tf, r);
+			std::memcpy(f + i, tf, (n - i) * sizeof(Bits));
+		}
+	}
+
+	// the comparison results are written as bytes of value 0 or 1, NaR orders below all other posits
+	template<batch_op op>
+	static POSIT_BATCH_INLINE void compare(const Encoding* a, const Encoding* b, uint8_t* r, size_t n) {
+		const Encoding flip = Encoding(P::sign_bit);
+		if (op == batch_op::less) {
+			for (size_t i = 0; i < n; ++i) r[i] = uint8_t(Encoding(a[i] ^ flip) < Encoding(b[i] ^ flip));
+		}
+		else {
+			for (size_t i = 0; i < n; ++i) r[i] = uint8_t(a[i] == b[i]);
+		}
+	}
+};
+
+}  // namespace internal
+}  // namespace unum
+}  // namespace sw
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
@@ -71,7 +71,7 @@ namespace sw {
 		explicit operator unsigned long() const { return to_long(); }
 		explicit operator unsigned int() const { return to_int(); }
 
-		posit& set(sw::unum::bitblock<NBITS_IS_16>& raw) {
+		posit& set(const sw::unum::bitblock<NBITS_IS_16>& raw) {
 			_bits = uint16_t(raw.to_ulong());
 			return *this;
 		}
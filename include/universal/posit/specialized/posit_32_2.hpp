@@ -71,7 +71,7 @@ namespace sw {
 		explicit operator unsigned long() const { return to_long(); }
 		explicit operator unsigned int() const { return to_int(); }
 
-		posit& set(sw::unum::bitblock<NBITS_IS_32>& raw) {
+		posit& set(const sw::unum::bitblock<NBITS_IS_32>& raw) {
 			_bits = uint32_t(raw.to_ulong());
 			return *this;
 		}
@@ -421,9 +421,9 @@ namespace sw {
 		inline void setzero() { clear(); }
 		inline void setnar() { _bits = 0x8000'0000; }
 		inline posit twosComplement() const {
+			// negate in unsigned arithmetic: the negation of 0x8000'0000 overflows int32_t
 			posit<NBITS_IS_32, ES_IS_2> p;
-			int32_t v = -(int32_t)_bits;
-			p.set_raw_bits(v);
+			p.set_raw_bits(uint32_t(0) - _bits);
 			return p;
 		}
 	private:
@@ -860,7 +860,7 @@ namespace sw {
 		return !operator==(lhs, rhs);
 	}
 	inline bool operator< (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
-		return long(lhs._bits) < long(rhs._bits);
+		return int32_t(lhs._bits) < int32_t(rhs._bits);
 	}
 	inline bool operator> (const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 		return operator< (rhs, lhs);
@@ -884,6 +884,11 @@ namespace sw {
 	}
 	inline posit<NBITS_IS_32, ES_IS_2> operator-(const posit<NBITS_IS_32, ES_IS_2>& lhs, const posit<NBITS_IS_32, ES_IS_2>& rhs) {
 		posit<NBITS_IS_32, ES_IS_2> result = lhs;
+		// NaR is its own two's complement: let the compound operator raise the exception or return NaR
+		if (rhs.isnar()) {
+			result -= rhs;
+			return result;
+		}
 		if (lhs.isneg() == rhs.isneg()) {  // are the posits the same sign?
 			result -= rhs.twosComplement();
 		}
@@ -73,7 +73,7 @@ namespace sw {
 			explicit operator unsigned long() const { return to_long(); }
 			explicit operator unsigned int() const { return to_int(); }
 
-			posit& set(sw::unum::bitblock<NBITS_IS_8>& raw) {
+			posit& set(const sw::unum::bitblock<NBITS_IS_8>& raw) {
 				_bits = uint8_t(raw.to_ulong());
 				return *this;
 			}
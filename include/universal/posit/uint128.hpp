@@ -0,0 +1,147 @@
+#pragma once
+// uint128.hpp: arithmetic on the portable 128-bit unsigned integer used by the extended precision posit kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include "../bitblock/bitblock.hpp"   // declares the uint128 type as a pair of 64-bit limbs
+#include "../utility/int128.hpp"
+
+// This file contains functions that DO NOT use the posit type.
+// The uint128 type is a pair of 64-bit limbs so that it compiles on every toolchain the library targets:
+// these are the handful of operations that the extended precision fixed-point kernels need.
+namespace sw {
+	namespace unum {
+
+		inline bool iszero(const uint128& a) { return (a.upper | a.lower) == 0; }
+		inline bool operator==(const uint128& a, const uint128& b) { return a.upper == b.upper && a.lower == b.lower; }
+		inline bool operator!=(const uint128& a, const uint128& b) { return !(a == b); }
+		inline bool operator< (const uint128& a, const uint128& b) { return a.upper < b.upper || (a.upper == b.upper && a.lower < b.lower); }
+		inline bool operator>=(const uint128& a, const uint128& b) { return !(a < b); }
+
+		inline uint128 operator+(const uint128& a, const uint128& b) {
+			uint128 r;
+			r.lower = a.lower + b.lower;
+			r.upper = a.upper + b.upper + (r.lower < a.lower ? 1 : 0);
+			return r;
+		}
+		inline uint128 operator-(const uint128& a, const uint128& b) {
+			uint128 r;
+			r.lower = a.lower - b.lower;
+			r.upper = a.upper - b.upper - (a.lower < b.lower ? 1 : 0);
+			return r;
+		}
+		inline uint128 operator~(const uint128& a) {
+			uint128 r = { ~a.lower, ~a.upper };
+			return r;
+		}
+		inline uint128 operator|(const uint128& a, const uint128& b) {
+			uint128 r = { a.lower | b.lower, a.upper | b.upper };
+			return r;
+		}
+
+		// logical shift right, shift counts >= 128 yield zero
+		inline uint128 operator>>(const uint128& a, unsigned n) {
+			uint128 r;
+			if (n == 0) return a;
+			if (n >= 128) { r.upper = 0; r.lower = 0; }
+			else if (n >= 64) { r.upper = 0; r.lower = a.upper >> (n - 64); }
+			else { r.upper = a.upper >> n; r.lower = (a.lower >> n) | (a.upper << (64 - n)); }
+			return r;
+		}
+		// logical shift left, shift counts >= 128 yield zero
+		inline uint128 operator<<(const uint128& a, unsigned n) {
+			uint128 r;
+			if (n == 0) return a;
+			if (n >= 128) { r.upper = 0; r.lower = 0; }
+			else if (n >= 64) { r.upper = a.lower << (n - 64); r.lower = 0; }
+			else { r.upper = (a.upper << n) | (a.lower >> (64 - n)); r.lower = a.lower << n; }
+			return r;
+		}
+
+		// true if any of the n least significant bits of a are set
+		inline bool anyAfter(const uint128& a, unsigned n) {
+			if (n == 0) return false;
+			if (n >= 128) return !iszero(a);
+			if (n > 64) return a.lower != 0 || (a.upper & (~uint64_t(0) >> (128 - n))) != 0;
+			return (a.lower & (~uint64_t(0) >> (64 - n))) != 0;
+		}
+
+		// number of leading zeros of a 64-bit word, 64 for zero
+		inline unsigned countLeadingZeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+			return x == 0 ? 64u : unsigned(__builtin_clzll(x));
+#else
+			unsigned n = 0;
+			if (x == 0) return 64;
+			if (!(x & 0xFFFFFFFF00000000ull)) { n += 32; x <<= 32; }
+			if (!(x & 0xFFFF000000000000ull)) { n += 16; x <<= 16; }
+			if (!(x & 0xFF00000000000000ull)) { n += 8;  x <<= 8; }
+			if (!(x & 0xF000000000000000ull)) { n += 4;  x <<= 4; }
+			if (!(x & 0xC000000000000000ull)) { n += 2;  x <<= 2; }
+			if (!(x & 0x8000000000000000ull)) { n += 1; }
+			return n;
+#endif
+		}
+		inline unsigned countLeadingZeros(const uint128& a) {
+			return a.upper != 0 ? countLeadingZeros(a.upper) : 64 + countLeadingZeros(a.lower);
+		}
+
+		// number of trailing zeros of a 64-bit word, 64 for zero
+		inline unsigned countTrailingZeros(uint64_t x) {
+			return x == 0 ? 64u : 63u - countLeadingZeros(x & (~x + 1));
+		}
+		inline unsigned countTrailingZeros(const uint128& a) {
+			return a.lower != 0 ? countTrailingZeros(a.lower) : 64 + countTrailingZeros(a.upper);
+		}
+
+		// full 64x64 -> 128-bit product
+		inline uint128 multiply(uint64_t a, uint64_t b) {
+			uint128 r;
+#if defined(__SIZEOF_INT128__)
+			native_uint128 p = (native_uint128)a * b;
+			r.upper = uint64_t(p >> 64);
+			r.lower = uint64_t(p);
+#else
+			uint64_t a_lo = a & 0xFFFFFFFFull, a_hi = a >> 32;
+			uint64_t b_lo = b & 0xFFFFFFFFull, b_hi = b >> 32;
+			uint64_t p0 = a_lo * b_lo;
+			uint64_t p1 = a_lo * b_hi;
+			uint64_t p2 = a_hi * b_lo;
+			uint64_t p3 = a_hi * b_hi;
+			uint64_t middle = (p0 >> 32) + (p1 & 0xFFFFFFFFull) + (p2 & 0xFFFFFFFFull);
+			r.lower = (middle << 32) | (p0 & 0xFFFFFFFFull);
+			r.upper = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+#endif
+			return r;
+		}
+
+		// full 128x128 -> 256-bit product, returned as the upper and lower 128-bit halves
+		inline void multiply(const uint128& a, const uint128& b, uint128& upper, uint128& lower) {
+			uint128 ll = multiply(a.lower, b.lower);
+			uint128 lh = multiply(a.lower, b.upper);
+			uint128 hl = multiply(a.upper, b.lower);
+			uint128 hh = multiply(a.upper, b.upper);
+			// column 1: ll.upper + lh.lower + hl.lower
+			uint128 mid = { ll.upper, 0 };
+			mid = mid + uint128{ lh.lower, 0 };
+			mid = mid + uint128{ hl.lower, 0 };
+			lower.lower = ll.lower;
+			lower.upper = mid.lower;
+			// column 2 and 3: hh + lh.upper + hl.upper + carry out of column 1
+			upper = hh + uint128{ lh.upper, 0 };
+			upper = upper + uint128{ hl.upper, 0 };
+			upper = upper + uint128{ mid.upper, 0 };
+		}
+
+		// upper 128 bits of the 128x128 product: the product of two fixed-point fractions
+		inline uint128 multiply_upper(const uint128& a, const uint128& b) {
+			uint128 upper, lower;
+			multiply(a, b, upper, lower);
+			return upper;
+		}
+
+	}  // namespace unum
+
+}  // namespace sw
@@ -0,0 +1,18 @@
+#pragma once
+// int128.hpp: the native 128-bit integer types of the compilers that provide them
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+namespace sw {
+namespace unum {
+
+#if defined(__SIZEOF_INT128__)
+// ISO C++ has no 128-bit integer: __extension__ keeps the -Wpedantic builds free of warnings
+__extension__ typedef __int128 native_int128;
+__extension__ typedef unsigned __int128 native_uint128;
+#endif
+
+}  // namespace unum
+}  // namespace sw
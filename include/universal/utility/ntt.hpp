@@ -0,0 +1,322 @@
+#pragma once
+// ntt.hpp: number theoretic transform multiplication of very long limb vectors
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+#include <cstdint>
+#include <vector>
+#include "int128.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////
+// enable/disable computing the convolutions modulo the three primes on their own threads
+#if !defined(NTT_MULTITHREADED)
+// default is to compute the convolutions on the calling thread: a program that enables
+// the thread per prime links with the threads library, Threads::Threads in CMake
+#define NTT_MULTITHREADED 0
+#endif
+
+#if NTT_MULTITHREADED
+#include <thread>
+#include <system_error>
+#endif
+
+// below this transform length the three convolutions run on the calling thread
+#ifndef NTT_THREAD_THRESHOLD
+#define NTT_THREAD_THRESHOLD 8192
+#endif
+
+namespace sw {
+namespace unum {
+
+namespace impl {
+
+// the 128-bit product of two 64-bit words: returns the low word and sets hi to the high word
+inline uint64_t ntt_mul128(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+	native_uint128 product = (native_uint128)a * b;
+	hi = uint64_t(product >> 64);
+	return uint64_t(product);
+#else
+	uint64_t a0 = a & 0xFFFFFFFFull, a1 = a >> 32;
+	uint64_t b0 = b & 0xFFFFFFFFull, b1 = b >> 32;
+	uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+	hi = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+	return (middle << 32) | (p00 & 0xFFFFFFFFull);
+#endif
+}
+
+// the quotient of hi * 2^64 + lo by d with hi < d: returns the quotient and sets rem to the remainder
+inline uint64_t ntt_div128(uint64_t hi, uint64_t lo, uint64_t d, uint64_t& rem) {
+#if defined(__SIZEOF_INT128__)
+	native_uint128 n = ((native_uint128)hi << 64) | lo;
+	uint64_t q = uint64_t(n / d);
+	rem = uint64_t(n - (native_uint128)q * d);
+	return q;
+#else
+	// restoring division, one quotient bit per step
+	for (int i = 0; i < 64; ++i) {
+		uint64_t top = hi >> 63;
+		hi = (hi << 1) | (lo >> 63);
+		lo <<= 1;
+		if (top || hi >= d) {
+			hi -= d;
+			lo |= 1;
+		}
+	}
+	rem = hi;
+	return lo;
+#endif
+}
+
+// arithmetic modulo a prime p = k * 2^e + 1 < 2^62. Products use the Montgomery reduction with R = 2^64:
+// mul(x, y) is x * y / R mod p, so that the product of a residue and a constant in Montgomery form c * R
+// is the residue x * c, and transforms of plain residues never convert in and out of Montgomery form.
+struct ntt_prime {
+	ntt_prime(uint64_t prime, unsigned twoAdicity, uint64_t generator) : p(prime), e(twoAdicity) {
+		// p^-1 mod 2^64 by Newton iteration: each step doubles the correct low bits, starting from 3 for odd p
+		uint64_t inverse = p;
+		for (int i = 0; i < 5; ++i) inverse *= 2 - p * inverse;
+		pinv = 0 - inverse;
+		one = (0 - p) % p;
+		r2 = one;
+		for (int i = 0; i < 64; ++i) r2 = add(r2, r2);
+		g = montgomery(generator);
+	}
+
+	uint64_t add(uint64_t a, uint64_t b) const { uint64_t s = a + b; return (s >= p ? s - p : s); }
+	uint64_t sub(uint64_t a, uint64_t b) const { return (a >= b ? a - b : a + p - b); }
+	// a * b / R mod p in [0, 2p) for a * b < p * R: with p < 2^62 any a < 4p times b < p
+	uint64_t mul_lazy(uint64_t a, uint64_t b) const {
+		uint64_t hi, mhi;
+		uint64_t lo = ntt_mul128(a, b, hi);
+		ntt_mul128(lo * pinv, p, mhi);
+		// lo + the low word of m * p is zero modulo 2^64, so it carries out exactly when lo is not zero
+		return hi + mhi + (lo != 0 ? 1 : 0);
+	}
+	// a * b / R mod p in [0, p)
+	uint64_t mul(uint64_t a, uint64_t b) const {
+		uint64_t t = mul_lazy(a, b);
+		return (t >= p ? t - p : t);
+	}
+	uint64_t montgomery(uint64_t a) const { return mul(a % p, r2); }
+	// base^exponent for base in Montgomery form, in Montgomery form
+	uint64_t power(uint64_t base, uint64_t exponent) const {
+		uint64_t result = one;
+		while (exponent) {
+			if (exponent & 1) result = mul(result, base);
+			base = mul(base, base);
+			exponent >>= 1;
+		}
+		return result;
+	}
+	// the inverse of a in Montgomery form, in Montgomery form
+	uint64_t inverse(uint64_t a) const { return power(a, p - 2); }
+
+	uint64_t p;     // the prime
+	unsigned e;     // 2^e divides p - 1: the longest transform
+	uint64_t pinv;  // -p^-1 mod 2^64
+	uint64_t one;   // R mod p, the Montgomery form of 1
+	uint64_t r2;    // R^2 mod p, mul(x, r2) is the Montgomery form of x
+	uint64_t g;     // a generator of the multiplicative group, in Montgomery form
+};
+
+// the three primes of the transforms and the constants of the Chinese remainder reconstruction of a coefficient:
+// x = t0 + p0 * t1 + p0 * p1 * t2 with t0 < p0, t1 < p1, and t2 < p2
+struct ntt_moduli {
+	ntt_moduli()
+		: prime{ ntt_prime(0x3A00000000000001ull, 57, 3),    // 29 * 2^57 + 1
+		         ntt_prime(0x2280000000000001ull, 55, 5),    // 69 * 2^55 + 1
+		         ntt_prime(0x1B00000000000001ull, 56, 5) } { // 27 * 2^56 + 1
+		inv01 = prime[1].inverse(prime[1].montgomery(prime[0].p));
+		inv02 = prime[2].inverse(prime[2].montgomery(prime[0].p));
+		inv12 = prime[2].inverse(prime[2].montgomery(prime[1].p));
+		p01[0] = ntt_mul128(prime[0].p, prime[1].p, p01[1]);
+	}
+
+	// the coefficient with residues r[0, 3) as three words, least significant word first
+	void reconstruct(uint64_t r0, uint64_t r1, uint64_t r2, uint64_t* x) const {
+		const ntt_prime& m1 = prime[1];
+		const ntt_prime& m2 = prime[2];
+		// the Montgomery forms of the inverses turn mul() into the plain modular product
+		uint64_t t1 = m1.mul(m1.sub(r1, r0 % m1.p), inv01);
+		uint64_t t2 = m2.mul(m2.sub(r2, r0 % m2.p), inv02);
+		t2 = m2.mul(m2.sub(t2, t1 % m2.p), inv12);
+		// t0 + p0 * t1
+		uint64_t hi;
+		uint64_t lo = ntt_mul128(prime[0].p, t1, hi);
+		lo += r0;
+		hi += (lo < r0 ? 1 : 0);
+		// + p0 * p1 * t2
+		uint64_t h0, h1;
+		uint64_t l0 = ntt_mul128(p01[0], t2, h0);
+		uint64_t l1 = ntt_mul128(p01[1], t2, h1);
+		l1 += h0;
+		h1 += (l1 < h0 ? 1 : 0);
+		x[0] = lo + l0;
+		uint64_t carry = (x[0] < lo ? 1 : 0);
+		uint64_t s = hi + l1;
+		uint64_t c = (s < hi ? 1 : 0);
+		x[1] = s + carry;
+		c += (x[1] < s ? 1 : 0);
+		x[2] = h1 + c;
+	}
+
+	ntt_prime prime[3];
+	uint64_t inv01;   // p0^-1 mod p1 in Montgomery form
+	uint64_t inv02;   // p0^-1 mod p2 in Montgomery form
+	uint64_t inv12;   // p1^-1 mod p2 in Montgomery form
+	uint64_t p01[2];  // p0 * p1
+};
+
+inline const ntt_moduli& ntt_primes() {
+	static const ntt_moduli moduli;
+	return moduli;
+}
+
+// the powers w^j, j < len, of the primitive 2len-th root of unity w at roots[len + j] for len = 1, 2, .., n / 2,
+// in Montgomery form: the twiddle factors of every level of the transform of length n, in one array of n words
+inline void ntt_roots(const ntt_prime& m, size_t n, bool inverse, uint64_t* roots) {
+	uint64_t w = m.power(m.g, (m.p - 1) / n);
+	if (inverse) w = m.inverse(w);
+	uint64_t power = m.one;
+	for (size_t j = 0; j < n / 2; ++j) {
+		roots[n / 2 + j] = power;
+		power = m.mul(power, w);
+	}
+	for (size_t len = n / 4; len >= 1; len /= 2) {
+		for (size_t j = 0; j < len; ++j) roots[len + j] = roots[2 * len + 2 * j];
+	}
+}
+
+// The butterflies of the transforms reduce lazily: their inputs and outputs are in [0, 2p), and u - v + 2p < 4p
+// is a valid operand of mul_lazy(), which saves the conditional subtractions of the fully reduced arithmetic.
+
+// decimation in frequency: the transform of a[0, n) in natural order into bit reversed order
+inline void ntt_forward(const ntt_prime& modulus, uint64_t* a, size_t n, const uint64_t* roots) {
+	const ntt_prime m = modulus;  // a local copy, which the stores into a cannot alias
+	const uint64_t p2 = 2 * m.p;
+	for (size_t len = n / 2; len >= 1; len /= 2) {
+		for (size_t i = 0; i < n; i += 2 * len) {
+			uint64_t* x = a + i;
+			uint64_t* y = x + len;
+			const uint64_t* w = roots + len;
+			for (size_t j = 0; j < len; ++j) {
+				uint64_t u = x[j], v = y[j];
+				uint64_t sum = u + v;
+				x[j] = (sum >= p2 ? sum - p2 : sum);
+				y[j] = m.mul_lazy(u + p2 - v, w[j]);
+			}
+		}
+	}
+}
+
+// decimation in time: the transform of a[0, n) in bit reversed order into natural order
+inline void ntt_inverse(const ntt_prime& modulus, uint64_t* a, size_t n, const uint64_t* roots) {
+	const ntt_prime m = modulus;  // a local copy, which the stores into a cannot alias
+	const uint64_t p2 = 2 * m.p;
+	for (size_t len = 1; len < n; len *= 2) {
+		for (size_t i = 0; i < n; i += 2 * len) {
+			uint64_t* x = a + i;
+			uint64_t* y = x + len;
+			const uint64_t* w = roots + len;
+			for (size_t j = 0; j < len; ++j) {
+				uint64_t u = x[j], v = m.mul_lazy(y[j], w[j]);
+				uint64_t sum = u + v, difference = u + p2 - v;
+				x[j] = (sum >= p2 ? sum - p2 : sum);
+				y[j] = (difference >= p2 ? difference - p2 : difference);
+			}
+		}
+	}
+}
+
+// the cyclic convolution modulo the prime of a[0, na) and b[0, nb) into r[0, n), n a power of 2 of at least na + nb - 1,
+// with fb and roots each n words of work space. A square transforms its operand once.
+inline void ntt_convolve(const ntt_prime& modulus, const uint64_t* a, size_t na, const uint64_t* b, size_t nb, size_t n, uint64_t* r, uint64_t* fb, uint64_t* roots) {
+	const ntt_prime m = modulus;
+	bool square = (a == b && na == nb);
+	// mul(x, R mod p) = x mod p for any 64-bit x, without a division
+	for (size_t i = 0; i < n; ++i) r[i] = (i < na ? m.mul(a[i], m.one) : 0);
+	if (!square) for (size_t i = 0; i < n; ++i) fb[i] = (i < nb ? m.mul(b[i], m.one) : 0);
+	ntt_roots(m, n, false, roots);
+	ntt_forward(m, r, n, roots);
+	if (!square) ntt_forward(m, fb, n, roots);
+	// mul(mul(x, y), n^-1 R^2) = x * y / R * n^-1 R = x * y / n: the pointwise product and the scale of the inverse
+	uint64_t scale = m.mul(m.inverse(m.montgomery(n)), m.r2);
+	const uint64_t* y = (square ? r : fb);
+	for (size_t i = 0; i < n; ++i) r[i] = m.mul_lazy(m.mul_lazy(r[i], y[i]), scale);
+	ntt_roots(m, n, true, roots);
+	ntt_inverse(m, r, n, roots);
+	for (size_t i = 0; i < n; ++i) r[i] = (r[i] >= m.p ? r[i] - m.p : r[i]);
+}
+
+// the na + nb - 1 coefficients of the convolution of a[0, na) and b[0, nb) of 64-bit words, as three words each,
+// least significant word first, at coefficients[3i, 3i + 3). The coefficients are exact as long as they are smaller
+// than the product of the three primes, about 2^183: that is, for min(na, nb) < 2^55 for arbitrary 64-bit words.
+inline void ntt_convolution(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, std::vector<uint64_t>& coefficients) {
+	const ntt_moduli& moduli = ntt_primes();
+	size_t length = na + nb - 1;
+	size_t n = 1;
+	while (n < length) n *= 2;
+	if (n < 2) n = 2;
+	// all memory is in place before the worker threads start, so that the convolutions cannot throw
+	std::vector<uint64_t> work(9 * n);
+	coefficients.resize(3 * length);
+	auto convolve = [&](unsigned k) {
+		uint64_t* r = work.data() + 3 * k * n;
+		ntt_convolve(moduli.prime[k], a, na, b, nb, n, r, r + n, r + 2 * n);
+	};
+	unsigned computed = 0;
+#if NTT_MULTITHREADED
+	std::vector<std::thread> workers;
+	if (n >= NTT_THREAD_THRESHOLD && std::thread::hardware_concurrency() > 1) {
+		workers.reserve(2);
+		try {
+			for (unsigned k = 1; k < 3; ++k) workers.emplace_back(convolve, k);
+		}
+		catch (const std::system_error&) {
+			// no more threads: the calling thread computes the remaining convolutions
+		}
+	}
+	computed = unsigned(workers.size());
+#endif
+	for (unsigned k = computed + 1; k < 3; ++k) convolve(k);
+	convolve(0);
+#if NTT_MULTITHREADED
+	for (std::thread& worker : workers) worker.join();
+#endif
+	const uint64_t* r0 = work.data();
+	const uint64_t* r1 = r0 + 3 * n;
+	const uint64_t* r2 = r1 + 3 * n;
+	for (size_t i = 0; i < length; ++i) moduli.reconstruct(r0[i], r1[i], r2[i], coefficients.data() + 3 * i);
+}
+
+// r[0, na + nb) = a[0, na) * b[0, nb) on 64-bit limbs: the convolution of the limbs with the carries propagated in base 2^64
+inline void ntt_multiply(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* r) {
+	std::vector<uint64_t> coefficients;
+	ntt_convolution(a, na, b, nb, coefficients);
+	uint64_t c0 = 0, c1 = 0, c2 = 0;  // the carry into limb i
+	for (size_t i = 0; i < na + nb; ++i) {
+		if (i < na + nb - 1) {
+			const uint64_t* x = coefficients.data() + 3 * i;
+			c0 += x[0];
+			uint64_t carry = (c0 < x[0] ? 1 : 0);
+			c1 += carry;
+			carry = (c1 < carry ? 1 : 0);
+			c1 += x[1];
+			carry += (c1 < x[1] ? 1 : 0);
+			c2 += x[2] + carry;
+		}
+		r[i] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	}
+}
+
+} // namespace impl
+
+} // namespace unum
+} // namespace sw
@@ -0,0 +1,108 @@
+// posit_batch.cpp: performance comparison of the SIMD batch kernels and the scalar loop over arrays of posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits that have SIMD batch kernels
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a kernel over arrays of nrElements and report it in elements per second
+template<typename Kernel>
+double MeasureElementsPerSecond(size_t nrElements, size_t nrRepetitions, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrRepetitions; ++r) kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(nrElements * nrRepetitions) / elapsed.count();
+}
+
+template<size_t nbits, size_t es>
+void CompareBatchKernels(std::ostream& ostr, const std::string& tag, size_t n, size_t nrRepetitions) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+	std::vector<Posit> a(n), b(n), c(n), d(n);
+	for (size_t i = 0; i < n; ++i) {
+		a[i] = distribution(generator);
+		b[i] = distribution(generator);
+		c[i] = distribution(generator);
+	}
+	std::unique_ptr<bool[]> r(new bool[n]);
+
+	struct Kernel {
+		const char* name;
+		std::function<void()> scalar;
+		std::function<void()> batch;
+	};
+	Kernel kernels[] = {
+		{ "add   ", [&]() { for (size_t i = 0; i < n; ++i) d[i] = a[i] + b[i]; }, [&]() { batch_add(a.data(), b.data(), d.data(), n); } },
+		{ "sub   ", [&]() { for (size_t i = 0; i < n; ++i) d[i] = a[i] - b[i]; }, [&]() { batch_sub(a.data(), b.data(), d.data(), n); } },
+		{ "mul   ", [&]() { for (size_t i = 0; i < n; ++i) d[i] = a[i] * b[i]; }, [&]() { batch_mul(a.data(), b.data(), d.data(), n); } },
+		{ "div   ", [&]() { for (size_t i = 0; i < n; ++i) d[i] = a[i] / b[i]; }, [&]() { batch_div(a.data(), b.data(), d.data(), n); } },
+		{ "fma   ", [&]() { for (size_t i = 0; i < n; ++i) d[i] = sw::unum::fma(a[i], b[i], c[i]); }, [&]() { batch_fma(a.data(), b.data(), c.data(), d.data(), n); } },
+		{ "negate", [&]() { for (size_t i = 0; i < n; ++i) d[i] = -a[i]; }, [&]() { batch_negate(a.data(), d.data(), n); } },
+		{ "less  ", [&]() { for (size_t i = 0; i < n; ++i) r[i] = a[i] < b[i]; }, [&]() { batch_less(a.data(), b.data(), r.get(), n); } },
+	};
+
+	ostr << "Performance Report: " << tag << " elements/sec of the scalar loop and the batch kernels\n";
+	ostr << "        scalar loop";
+	for (int isa = int(batch_detect_isa()); isa >= 0; --isa) ostr << std::setw(14) << to_string(batch_isa(isa));
+	ostr << '\n';
+	for (const Kernel& k : kernels) {
+		ostr << k.name << " : " << to_scientific(MeasureElementsPerSecond(n, nrRepetitions, k.scalar)) << "EPS";
+		for (int isa = int(batch_detect_isa()); isa >= 0; --isa) {
+			batch_select_isa(batch_isa(isa));
+			ostr << "   " << to_scientific(MeasureElementsPerSecond(n, nrRepetitions, k.batch)) << "EPS";
+		}
+		ostr << '\n';
+		batch_select_isa(batch_detect_isa());
+	}
+	ostr << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	cout << "Batch kernels for the instruction sets of this processor, up to " << to_string(batch_detect_isa()) << "\n\n";
+	CompareBatchKernels<8, 0>(cout, "posit<8,0>", 1 << 16, 20);
+	CompareBatchKernels<16, 1>(cout, "posit<16,1>", 1 << 16, 20);
+	CompareBatchKernels<32, 2>(cout, "posit<32,2>", 1 << 16, 10);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,142 @@
+// posit_batch_io.cpp: throughput of the batch mode of the command line tools versus per value iostream conversion
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cstdio>
+#include <universal/posit/posit>
+#include "../tools/cmd/batch_mode.hpp"
+#include "posit_performance.hpp"
+
+// a temporary file holding n random decimal values, one per line
+FILE* RandomValues(size_t n) {
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> mantissa(-10.0, 10.0);
+	std::uniform_int_distribution<int> exponent(-8, 8);
+	FILE* f = std::tmpfile();
+	for (size_t i = 0; i < n; ++i) std::fprintf(f, "%.9g\n", std::ldexp(mantissa(generator), exponent(generator)));
+	return f;
+}
+
+// the throughput of a kernel that converts n values, in values per second
+template<typename Kernel>
+double MeasureValuesPerSecond(size_t n, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(n) / elapsed.count();
+}
+
+// the conversion the way a tool does it for its single argument: atof, the posit constructor, and iostreams
+template<size_t nbits, size_t es>
+void IostreamConversion(FILE* in, FILE* out) {
+	using namespace sw::unum;
+	std::rewind(in);
+	char line[128];
+	while (std::fgets(line, sizeof(line), in) != nullptr) {
+		posit<nbits, es> p(std::atof(line));
+		std::stringstream s;
+		s << to_binary(p) << ' ' << hex_format(p) << ' ' << p << '\n';
+		std::fputs(s.str().c_str(), out);
+	}
+}
+
+template<size_t nbits, size_t es>
+void CompareBatchMode(std::ostream& ostr, const std::string& tag, size_t n) {
+	using namespace sw::unum;
+	FILE* in = RandomValues(n);
+	FILE* out = std::tmpfile();
+	batch::fields all{ true, true, true };
+	double iostreams = MeasureValuesPerSecond(n, [&]() { IostreamConversion<nbits, es>(in, out); });
+	size_t nrInvalid = 0;
+	double batchMode = MeasureValuesPerSecond(n, [&]() {
+		std::rewind(in);
+		nrInvalid += batch::convert_posit_stream<nbits, es>(in, out, all);
+	});
+	batch::fields hexOnly{ false, true, false };
+	double batchHex = MeasureValuesPerSecond(n, [&]() {
+		std::rewind(in);
+		nrInvalid += batch::convert_posit_stream<nbits, es>(in, out, hexOnly);
+	});
+	std::fclose(in);
+	std::fclose(out);
+	ostr << tag << " iostreams " << to_scientific(iostreams) << "values/s   batch " << to_scientific(batchMode) << "values/s   batch --hex " << to_scientific(batchHex) << "values/s";
+	if (nrInvalid > 0) ostr << "   (" << nrInvalid << " values did not parse)";
+	ostr << '\n';
+}
+
+template<typename Real>
+void CompareIeeeBatchMode(std::ostream& ostr, const std::string& tag, size_t n) {
+	using namespace sw::unum;
+	FILE* in = RandomValues(n);
+	FILE* out = std::tmpfile();
+	double iostreams = MeasureValuesPerSecond(n, [&]() {
+		std::rewind(in);
+		char line[128];
+		while (std::fgets(line, sizeof(line), in) != nullptr) {
+			Real v = Real(std::atof(line));
+			value<std::numeric_limits<Real>::digits - 1> c(v);
+			std::stringstream s;
+			s << std::setprecision(std::numeric_limits<Real>::max_digits10) << v << ' ' << components(c) << '\n';
+			std::fputs(s.str().c_str(), out);
+		}
+	});
+	double batchMode = MeasureValuesPerSecond(n, [&]() {
+		std::rewind(in);
+		batch::convert_stream(in, out, batch::fields{ true, true, true }, batch::convert_ieee<Real>);
+	});
+	std::fclose(in);
+	std::fclose(out);
+	ostr << tag << " iostreams " << to_scientific(iostreams) << "values/s   batch " << to_scientific(batchMode) << "values/s\n";
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr size_t n = 100000;
+	cout << "Conversion of " << n << " decimal values to bits, hex format, and shortest decimal\n";
+	CompareBatchMode<8, 0>(cout, "posit<8,0> ", n);
+	CompareBatchMode<16, 1>(cout, "posit<16,1>", n);
+	CompareBatchMode<32, 2>(cout, "posit<32,2>", n);
+	CompareBatchMode<64, 3>(cout, "posit<64,3>", n);
+	CompareIeeeBatchMode<float>(cout, "float      ", n);
+	CompareIeeeBatchMode<double>(cout, "double     ", n);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
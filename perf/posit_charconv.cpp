@@ -0,0 +1,138 @@
+// posit_charconv.cpp: performance comparison of the stream operators and to_chars/from_chars for bulk posit text, fixed precision and shortest
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a text kernel that returns the number of characters it produced or consumed, in bytes per second
+template<typename Kernel>
+double MeasureTextBytesPerSecond(size_t nrRepetitions, Kernel kernel) {
+	using namespace std::chrono;
+	size_t bytes = 0;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrRepetitions; ++r) bytes += kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(bytes) / elapsed.count();
+}
+
+// format and parse an array of posits as newline separated text, with the stream operators and with to_chars/from_chars
+template<size_t nbits, size_t es>
+void CompareTextConversions(std::ostream& ostr, const std::string& tag, size_t n, size_t nrRepetitions) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(12345);
+	std::vector<Posit> p(n), q(n);
+	for (size_t i = 0; i < n; ++i) {
+		p[i].set_raw_bits(generator());
+		if (p[i].isnar()) p[i].setzero();
+	}
+	const int precision = std::numeric_limits<Posit>::max_digits10;
+	std::vector<char> buffer(n * 96);
+	char* const first = buffer.data();
+	char* const last = first + buffer.size();
+
+	ostr << "Performance Report: " << tag << " text bytes/sec\n";
+	for (posit_chars_format format : { posit_chars_format::decimal, posit_chars_format::hex }) {
+		const char* name = (format == posit_chars_format::decimal ? "decimal" : "hex    ");
+		std::string text;
+		double streamFormat = MeasureTextBytesPerSecond(nrRepetitions, [&]() {
+			std::ostringstream ss;
+			ss << std::setprecision(precision);
+			for (size_t i = 0; i < n; ++i) {
+				if (format == posit_chars_format::hex) ss << hex_format(p[i]) << '\n'; else ss << p[i] << '\n';
+			}
+			text = ss.str();
+			return text.size();
+		});
+		// the regular expression of the stream parse is too slow to read the whole text
+		double streamParse = MeasureTextBytesPerSecond(1, [&]() {
+			std::istringstream ss(text);
+			for (size_t i = 0; i < n / 100; ++i) ss >> q[i];
+			return size_t(ss.tellg());
+		});
+		char* end = first;
+		double charsFormat = MeasureTextBytesPerSecond(nrRepetitions, [&]() {
+			char* t = first;
+			for (size_t i = 0; i < n; ++i) {
+				t = to_chars(t, last, p[i], format, precision).ptr;
+				*t++ = '\n';
+			}
+			end = t;
+			return size_t(t - first);
+		});
+		double charsParse = MeasureTextBytesPerSecond(nrRepetitions, [&]() {
+			const char* t = first;
+			for (size_t i = 0; i < n; ++i) t = from_chars(t, (const char*)end, q[i]).ptr + 1;
+			return size_t(t - first);
+		});
+		ostr << name << " format   stream " << to_scientific(streamFormat) << "B/s   to_chars   " << to_scientific(charsFormat) << "B/s\n";
+		ostr << name << " parse    stream " << to_scientific(streamParse) << "B/s   from_chars " << to_scientific(charsParse) << "B/s\n";
+	}
+
+	// the default decimal text is the shortest that reads back to the same posit
+	char* end = first;
+	double shortestFormat = MeasureTextBytesPerSecond(nrRepetitions, [&]() {
+		char* t = first;
+		for (size_t i = 0; i < n; ++i) {
+			t = to_chars(t, last, p[i]).ptr;
+			*t++ = '\n';
+		}
+		end = t;
+		return size_t(t - first);
+	});
+	double shortestParse = MeasureTextBytesPerSecond(nrRepetitions, [&]() {
+		const char* t = first;
+		for (size_t i = 0; i < n; ++i) t = from_chars(t, (const char*)end, q[i]).ptr + 1;
+		return size_t(t - first);
+	});
+	ostr << "shortest format   to_chars   " << to_scientific(shortestFormat) << "B/s   " << to_scientific(shortestFormat / double(end - first) * n) << "posits/s\n";
+	ostr << "shortest parse    from_chars " << to_scientific(shortestParse) << "B/s   " << to_scientific(shortestParse / double(end - first) * n) << "posits/s\n";
+	ostr << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	CompareTextConversions<16, 1>(cout, "posit<16,1>", 10000, 10);
+	CompareTextConversions<32, 2>(cout, "posit<32,2>", 10000, 10);
+	CompareTextConversions<64, 3>(cout, "posit<64,3>", 10000, 4);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,239 @@
+// posit_compensated.cpp: accuracy and performance of compensated and double-word sums and dot products versus the quire
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable fast specialized posit<16,1> and posit<32,2>
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include <universal/functions/compensated_sum.hpp>
+#include "posit_performance.hpp"
+
+// a dot product whose terms cancel: pairs of large products of opposite sign hide the small products
+template<typename Posit>
+void GenerateIllConditionedDot(std::vector<Posit>& x, std::vector<Posit>& y, size_t n, double magnitude) {
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> distribution(0.5, 1.0);
+	x.resize(n);
+	y.resize(n);
+	for (size_t i = 0; i + 1 < n; i += 2) {
+		x[i] = distribution(generator) * magnitude;
+		y[i] = distribution(generator);
+		x[i + 1] = x[i];
+		y[i + 1] = -y[i] * distribution(generator);   // a product that cancels most of the previous one
+	}
+	if (n & 1) { x[n - 1] = 1; y[n - 1] = 1; }
+}
+
+// the reference sums and dot products run in posit<256,5> with the plain posit operators, independent of
+// the quire: posits of at most 64 bits convert exactly through long double, their products need at most
+// 120 significand bits, and the partial sums of these test vectors span fewer binades than the 240 fraction
+// bits of posit<256,5>, so nothing rounds
+using Reference = sw::unum::posit<256, 5>;
+
+template<typename Posit>
+Reference ToReference(const Posit& p) {
+	return Reference((long double)p);
+}
+
+template<typename Posit>
+Reference ReferenceSum(const std::vector<Posit>& v) {
+	Reference sum(0);
+	for (size_t i = 0; i < v.size(); ++i) sum += ToReference(v[i]);
+	return sum;
+}
+
+template<typename Posit>
+Reference ReferenceDot(const std::vector<Posit>& x, const std::vector<Posit>& y) {
+	Reference sum(0);
+	for (size_t i = 0; i < x.size(); ++i) sum += ToReference(x[i]) * ToReference(y[i]);
+	return sum;
+}
+
+template<typename Posit>
+double RelativeError(const Posit& result, const Reference& ref) {
+	Reference error = (ToReference(result) - ref) / ref;
+	return double(error.isneg() ? -error : error);
+}
+
+// measure the time of a kernel, returning the throughput in elements per second
+template<typename Kernel>
+double MeasureThroughput(size_t n, Kernel f, int repetitions) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (int r = 0; r < repetitions; ++r) f();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(n) * repetitions / elapsed.count();
+}
+
+template<typename Posit>
+struct Kernel {
+	const char* name;
+	Posit result;
+	double throughput;
+};
+
+template<typename Posit>
+void ReportKernels(std::ostream& ostr, const char* unit, const std::vector< Kernel<Posit> >& kernels, const Reference& ref) {
+	for (const Kernel<Posit>& k : kernels) {
+		ostr << k.name << ": " << sw::unum::to_scientific(k.throughput) << unit << "  relative error "
+			<< std::setw(12) << RelativeError(k.result, ref) << '\n';
+	}
+	ostr << std::endl;
+}
+
+// the sum of the products of the ill-conditioned dot product: the plain loop, Sum2, the posit_pair, and the quire
+template<size_t nbits, size_t es>
+void CompareSums(std::ostream& ostr, const std::string& tag, size_t n, double magnitude, int repetitions) {
+	using namespace sw::unum;
+	using namespace sw::function;
+	using Posit = posit<nbits, es>;
+	std::vector<Posit> x, y, v(n);
+	GenerateIllConditionedDot(x, y, n, magnitude);
+	for (size_t i = 0; i < n; ++i) v[i] = x[i] * y[i];
+	Reference ref = ReferenceSum(v);
+
+	std::vector< Kernel<Posit> > k(4);
+	k[0].name = "plain posit loop ";
+	k[0].throughput = MeasureThroughput(n, [&]() {
+		Posit sum(0);
+		for (size_t i = 0; i < n; ++i) sum += v[i];
+		k[0].result = sum;
+	}, repetitions);
+	k[1].name = "Sum2             ";
+	k[1].throughput = MeasureThroughput(n, [&]() { k[1].result = sum2(v); }, repetitions);
+	k[2].name = "posit_pair       ";
+	k[2].throughput = MeasureThroughput(n, [&]() {
+		posit_pair<nbits, es> sum(0);
+		for (size_t i = 0; i < n; ++i) sum += posit_pair<nbits, es>(v[i]);
+		k[2].result = Posit(sum);
+	}, repetitions);
+	// the fast posits enter the quire through a product
+	k[3].name = "quire            ";
+	k[3].throughput = MeasureThroughput(n, [&]() {
+		const Posit one(1);
+		quire<nbits, es, 10> q(0);
+		for (size_t i = 0; i < n; ++i) q += quire_mul(v[i], one);
+		convert(q.to_value(), k[3].result);
+	}, repetitions);
+
+	ostr << "Performance Report: " << tag << " sum of " << n << " elements, reference " << double(ref) << '\n';
+	ReportKernels(ostr, "EPS", k, ref);
+}
+
+template<size_t nbits, size_t es>
+void CompareDotProducts(std::ostream& ostr, const std::string& tag, size_t n, double magnitude, int repetitions) {
+	using namespace sw::unum;
+	using namespace sw::function;
+	using Posit = posit<nbits, es>;
+	std::vector<Posit> x, y;
+	GenerateIllConditionedDot(x, y, n, magnitude);
+	Reference ref = ReferenceDot(x, y);
+
+	std::vector< Kernel<Posit> > k(4);
+	k[0].name = "plain posit loop ";
+	k[0].throughput = MeasureThroughput(n, [&]() {
+		Posit sum(0);
+		for (size_t i = 0; i < n; ++i) sum += x[i] * y[i];
+		k[0].result = sum;
+	}, repetitions);
+	k[1].name = "Dot2             ";
+	k[1].throughput = MeasureThroughput(n, [&]() { k[1].result = dot2(x, y); }, repetitions);
+	k[2].name = "posit_pair       ";
+	k[2].throughput = MeasureThroughput(n, [&]() {
+		posit_pair<nbits, es> sum(0);
+		for (size_t i = 0; i < n; ++i) sum += mul_pair(x[i], y[i]);
+		k[2].result = Posit(sum);
+	}, repetitions);
+	k[3].name = "fdp with quire   ";
+	k[3].throughput = MeasureThroughput(n, [&]() { k[3].result = fdp(x, y); }, repetitions);
+
+	ostr << "Performance Report: " << tag << " dot product of " << n << " elements, reference " << double(ref) << '\n';
+	ReportKernels(ostr, "MACs/sec", k, ref);
+}
+
+// the arithmetic of the posit_pair next to the posit operators and the multiply-accumulate into the quire
+template<size_t nbits, size_t es>
+void ComparePairOperators(std::ostream& ostr, const std::string& tag, size_t n, int repetitions) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	using Pair = posit_pair<nbits, es>;
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> distribution(0.5, 2.0);
+	std::vector<Posit> a(n), b(n), c(n);
+	std::vector<Pair> pa(n), pb(n), pc(n);
+	for (size_t i = 0; i < n; ++i) {
+		// pairs with a non-zero low posit: the residual of a product
+		pa[i] = mul_pair(Posit(distribution(generator)), Posit(distribution(generator)));
+		pb[i] = mul_pair(Posit(distribution(generator)), Posit(distribution(generator)));
+		a[i] = pa[i].high();
+		b[i] = pb[i].high();
+	}
+
+	struct Operator { const char* name; std::function<void()> f; };
+	Operator operators[] = {
+		{ "posit add        ", [&]() { for (size_t i = 0; i < n; ++i) c[i] = a[i] + b[i]; } },
+		{ "posit mul        ", [&]() { for (size_t i = 0; i < n; ++i) c[i] = a[i] * b[i]; } },
+		{ "posit div        ", [&]() { for (size_t i = 0; i < n; ++i) c[i] = a[i] / b[i]; } },
+		{ "posit_pair add   ", [&]() { for (size_t i = 0; i < n; ++i) pc[i] = pa[i] + pb[i]; } },
+		{ "posit_pair mul   ", [&]() { for (size_t i = 0; i < n; ++i) pc[i] = pa[i] * pb[i]; } },
+		{ "posit_pair div   ", [&]() { for (size_t i = 0; i < n; ++i) pc[i] = pa[i] / pb[i]; } },
+		{ "quire mul-add    ", [&]() { quire<nbits, es, 10> q(0); for (size_t i = 0; i < n; ++i) q += quire_mul(a[i], b[i]); convert(q.to_value(), c[0]); } },
+	};
+
+	ostr << "Performance Report: " << tag << " operators over " << n << " elements\n";
+	for (const Operator& op : operators) {
+		ostr << op.name << ": " << to_scientific(MeasureThroughput(n, op.f, repetitions)) << "OPS\n";
+	}
+	ostr << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	CompareSums<16, 1>(cout, "posit<16,1>", 1000, 64.0, 10);
+	CompareSums<32, 2>(cout, "posit<32,2>", 1000, 1.0e4, 10);
+	CompareSums<64, 3>(cout, "posit<64,3>", 1000, 1.0e8, 2);
+
+	CompareDotProducts<16, 1>(cout, "posit<16,1>", 1000, 64.0, 10);
+	CompareDotProducts<32, 2>(cout, "posit<32,2>", 1000, 1.0e4, 10);
+	CompareDotProducts<64, 3>(cout, "posit<64,3>", 1000, 1.0e8, 2);
+
+	ComparePairOperators<16, 1>(cout, "posit<16,1>", 1000, 10);
+	ComparePairOperators<32, 2>(cout, "posit<32,2>", 1000, 10);
+	ComparePairOperators<64, 3>(cout, "posit<64,3>", 1000, 2);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,99 @@
+// posit_complex.cpp: performance comparison of the fused complex posit arithmetic and std::complex of posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable fast specialized posit<16,1> and posit<32,2>
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a kernel that processes nrElements complex numbers and report it in complex operations per second
+template<typename Kernel>
+double MeasureKernel(size_t nrElements, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(nrElements) / elapsed.count();
+}
+
+template<size_t nbits, size_t es>
+void CompareComplexMultiply(std::ostream& ostr, const std::string& tag, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	using Complex = complex<Posit>;
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector<Complex> a(n), b(n), c(n);
+	std::vector< std::complex<Posit> > sa(n), sb(n), sc(n);
+	for (size_t i = 0; i < n; ++i) {
+		a[i] = Complex(distribution(generator), distribution(generator));
+		b[i] = Complex(distribution(generator), distribution(generator));
+		sa[i] = std::complex<Posit>(a[i].real(), a[i].imag());
+		sb[i] = std::complex<Posit>(b[i].real(), b[i].imag());
+	}
+	complex_array<nbits, es, complex_layout::interleaved> ia(a), ib(b), ic;
+	complex_array<nbits, es, complex_layout::split> xa(a), xb(b), xc;
+
+	double textbook = MeasureKernel(n, [&]() {
+		for (size_t i = 0; i < n; ++i) sc[i] = std::complex<Posit>(sa[i].real() * sb[i].real() - sa[i].imag() * sb[i].imag(),
+		                                                            sa[i].real() * sb[i].imag() + sa[i].imag() * sb[i].real());
+	});
+	double fused = MeasureKernel(n, [&]() { for (size_t i = 0; i < n; ++i) c[i] = a[i] * b[i]; });
+	double interleaved = MeasureKernel(n, [&]() { multiply(ia, ib, ic); });
+	double split = MeasureKernel(n, [&]() { multiply(xa, xb, xc); });
+
+	// count the products whose real part the fused multiply rounds differently from the textbook formula
+	size_t differences = 0;
+	for (size_t i = 0; i < n; ++i) if (sc[i].real() != c[i].real() || sc[i].imag() != c[i].imag()) ++differences;
+
+	ostr << "Performance Report: " << tag << " complex multiply\n";
+	ostr << "textbook (4 mul, 2 add)  : " << to_scientific(textbook) << "COPS\n";
+	ostr << "fused complex            : " << to_scientific(fused) << "COPS\n";
+	ostr << "complex_array interleaved: " << to_scientific(interleaved) << "COPS\n";
+	ostr << "complex_array split      : " << to_scientific(split) << "COPS\n";
+	ostr << "results that differ      : " << differences << " of " << n << "\n" << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	CompareComplexMultiply<16, 1>(cout, "posit<16,1>", 100000);
+	CompareComplexMultiply<32, 2>(cout, "posit<32,2>", 100000);
+	CompareComplexMultiply<64, 3>(cout, "posit<64,3>", 10000);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,97 @@
+// posit_conversion.cpp: performance comparison of the bulk conversions between IEEE-754 arrays and posit arrays
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits that have SIMD conversion kernels
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a conversion kernel over arrays of nrElements and report it in bytes read and written per second
+template<typename Kernel>
+double MeasureBytesPerSecond(size_t nrElements, size_t bytesPerElement, size_t nrRepetitions, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrRepetitions; ++r) kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(nrElements * bytesPerElement * nrRepetitions) / elapsed.count();
+}
+
+// the element by element assignment and the bulk conversion of every instruction set, to the posits and back
+template<size_t nbits, size_t es, typename Real>
+void CompareConversions(std::ostream& ostr, const std::string& tag, size_t n, size_t nrRepetitions) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<Real> distribution(Real(-100), Real(100));
+	std::vector<Real> f(n), g(n);
+	std::vector<Posit> p(n);
+	for (size_t i = 0; i < n; ++i) f[i] = distribution(generator);
+	convert(f.data(), p.data(), n);
+	const size_t bytes = sizeof(Real) + sizeof(Posit);
+
+	ostr << "Performance Report: " << tag << " bytes/sec read and written by the scalar loop and the bulk conversions\n";
+	ostr << "           scalar loop";
+	for (int isa = int(batch_detect_isa()); isa >= 0; --isa) ostr << std::setw(14) << to_string(batch_isa(isa));
+	ostr << '\n';
+	ostr << "to posit   : " << to_scientific(MeasureBytesPerSecond(n, bytes, nrRepetitions, [&]() { for (size_t i = 0; i < n; ++i) p[i] = f[i]; })) << "B/s";
+	for (int isa = int(batch_detect_isa()); isa >= 0; --isa) {
+		batch_select_isa(batch_isa(isa));
+		ostr << "   " << to_scientific(MeasureBytesPerSecond(n, bytes, nrRepetitions, [&]() { convert(f.data(), p.data(), n); })) << "B/s";
+	}
+	ostr << '\n';
+	ostr << "from posit : " << to_scientific(MeasureBytesPerSecond(n, bytes, nrRepetitions, [&]() { for (size_t i = 0; i < n; ++i) g[i] = Real(p[i]); })) << "B/s";
+	for (int isa = int(batch_detect_isa()); isa >= 0; --isa) {
+		batch_select_isa(batch_isa(isa));
+		ostr << "   " << to_scientific(MeasureBytesPerSecond(n, bytes, nrRepetitions, [&]() { convert(p.data(), g.data(), n); })) << "B/s";
+	}
+	ostr << '\n' << std::endl;
+	batch_select_isa(batch_detect_isa());
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	cout << "Bulk conversions for the instruction sets of this processor, up to " << to_string(batch_detect_isa()) << "\n\n";
+	CompareConversions<8, 0, float>(cout, "float <-> posit<8,0>", 1 << 16, 20);
+	CompareConversions<16, 1, float>(cout, "float <-> posit<16,1>", 1 << 16, 20);
+	CompareConversions<32, 2, float>(cout, "float <-> posit<32,2>", 1 << 16, 10);
+	CompareConversions<16, 1, double>(cout, "double <-> posit<16,1>", 1 << 16, 20);
+	CompareConversions<32, 2, double>(cout, "double <-> posit<32,2>", 1 << 16, 10);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
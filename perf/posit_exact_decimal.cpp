@@ -0,0 +1,129 @@
+// posit_exact_decimal.cpp: performance of the exact decimal expansion of quires and wide posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include <universal/decimal/decimal.hpp>
+#include "posit_performance.hpp"
+
+// the exact digits of a quire with the decimal class, which computes on limbs of nine decimal digits in base 10^9:
+// double and add the bits, then multiply by 5 for each fraction bit
+template<size_t nbits, size_t es, size_t capacity>
+size_t DecimalClassExpansion(const sw::unum::quire<nbits, es, capacity>& q) {
+	using Quire = sw::unum::quire<nbits, es, capacity>;
+	sw::unum::decimal d(0), one(1), five(5);
+	sw::unum::bitblock<Quire::qbits + 1> bits = q.get();
+	for (size_t i = Quire::qbits + 1; i-- > 0; ) {
+		d += d;
+		if (bits[i]) d += one;
+	}
+	for (size_t i = 0; i < Quire::radix_point; ++i) d *= five;
+	return d.size();
+}
+
+// the average time of an expansion, in seconds
+template<typename Kernel>
+double MeasureSeconds(size_t nrRepetitions, Kernel kernel) {
+	using namespace std::chrono;
+	size_t digits = 0;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrRepetitions; ++r) digits += kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	if (digits == 0) std::cerr << "no digits\n";
+	return elapsed.count() / double(nrRepetitions);
+}
+
+// a quire loaded with a dot product of random posits that spans the dynamic range
+template<size_t nbits, size_t es>
+sw::unum::quire<nbits, es> RandomQuire(size_t n) {
+	using namespace sw::unum;
+	std::mt19937_64 generator(12345);
+	quire<nbits, es> q;
+	for (size_t i = 0; i < n; ++i) {
+		posit<nbits, es> a, b;
+		a.set_raw_bits(generator());
+		b.set_raw_bits(generator());
+		if (!a.isnar() && !b.isnar()) q += quire_mul(a, b);
+	}
+	q += quire_mul(minpos<nbits, es>(), minpos<nbits, es>());
+	return q;
+}
+
+template<size_t nbits, size_t es>
+void QuireExpansion(std::ostream& ostr, const std::string& tag, bool withDecimalClass) {
+	using namespace sw::unum;
+	quire<nbits, es> q = RandomQuire<nbits, es>(100);
+	size_t digits = exact_decimal_format(q).size();
+	double limbs = MeasureSeconds(100, [&]() { return exact_decimal_format(q).size(); });
+	ostr << tag << " : " << std::setw(6) << digits << " digits   base 10^19 limbs " << to_scientific(1.0 / limbs) << "expansions/sec";
+	if (withDecimalClass) ostr << "   decimal class " << to_scientific(1.0 / MeasureSeconds(1, [&]() { return DecimalClassExpansion(q); })) << "expansions/sec";
+	ostr << '\n';
+}
+
+template<size_t nbits, size_t es>
+void PositExpansion(std::ostream& ostr, const std::string& tag, size_t n) {
+	using namespace sw::unum;
+	std::mt19937_64 generator(12345);
+	std::vector<posit<nbits, es>> p(n);
+	for (size_t i = 0; i < n; ++i) p[i].set_raw_bits(generator());
+	double seconds = MeasureSeconds(1, [&]() {
+		size_t digits = 0;
+		for (size_t i = 0; i < n; ++i) digits += exact_decimal_format(p[i]).size();
+		return digits;
+	});
+	ostr << tag << " : " << to_scientific(double(n) / seconds) << "posits/sec\n";
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	cout << "Exact decimal expansion of a quire holding a dot product\n";
+	QuireExpansion<16, 1>(cout, "quire<16,1> ", true);
+	QuireExpansion<32, 2>(cout, "quire<32,2> ", true);
+	QuireExpansion<64, 3>(cout, "quire<64,3> ", true);
+	QuireExpansion<128, 4>(cout, "quire<128,4>", false);
+	QuireExpansion<256, 5>(cout, "quire<256,5>", false);
+
+	cout << "\nExact decimal expansion of random posits\n";
+	PositExpansion<32, 2>(cout, "posit<32,2> ", 100000);
+	PositExpansion<64, 3>(cout, "posit<64,3> ", 10000);
+	PositExpansion<256, 5>(cout, "posit<256,5>", 1000);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,102 @@
+// posit_exp_log.cpp: performance comparison of the native posit exp/log/pow functions and the double precision shims
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable fast specialized posit<16,1>
+#define POSIT_FAST_POSIT_16_1 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a unary function over a set of operands and report it in POPS
+template<typename Posit, typename Function>
+double MeasureUnaryFunction(const std::vector<Posit>& operands, Function f, Posit& sink) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (const Posit& a : operands) sink += f(a);
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(operands.size()) / elapsed.count();
+}
+
+template<size_t nbits, size_t es>
+void CompareExponentialLogarithm(std::ostream& ostr, const std::string& tag, size_t nrSamples) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	// operands in the domain of the logarithm and of the exponential that does not saturate
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> logDomain(1.0e-6, 1.0e6);
+	std::uniform_real_distribution<double> expDomain(-20.0, 20.0);
+	std::vector<Posit> logOperands(nrSamples), expOperands(nrSamples);
+	for (size_t i = 0; i < nrSamples; ++i) {
+		logOperands[i] = logDomain(generator);
+		expOperands[i] = expDomain(generator);
+	}
+	Posit sink(0);
+	Posit half(0.5);
+
+	struct Measurement { const char* name; double native; double shim; };
+	Measurement m[] = {
+		{ "log2 ", MeasureUnaryFunction(logOperands, [](const Posit& a) { return sw::unum::log2(a); }, sink),
+		           MeasureUnaryFunction(logOperands, [](const Posit& a) { return Posit(std::log2(double(a))); }, sink) },
+		{ "log  ", MeasureUnaryFunction(logOperands, [](const Posit& a) { return sw::unum::log(a); }, sink),
+		           MeasureUnaryFunction(logOperands, [](const Posit& a) { return Posit(std::log(double(a))); }, sink) },
+		{ "log10", MeasureUnaryFunction(logOperands, [](const Posit& a) { return sw::unum::log10(a); }, sink),
+		           MeasureUnaryFunction(logOperands, [](const Posit& a) { return Posit(std::log10(double(a))); }, sink) },
+		{ "exp2 ", MeasureUnaryFunction(expOperands, [](const Posit& a) { return sw::unum::exp2(a); }, sink),
+		           MeasureUnaryFunction(expOperands, [](const Posit& a) { return Posit(std::exp2(double(a))); }, sink) },
+		{ "exp  ", MeasureUnaryFunction(expOperands, [](const Posit& a) { return sw::unum::exp(a); }, sink),
+		           MeasureUnaryFunction(expOperands, [](const Posit& a) { return Posit(std::exp(double(a))); }, sink) },
+		{ "exp10", MeasureUnaryFunction(expOperands, [](const Posit& a) { return sw::unum::exp10(a); }, sink),
+		           MeasureUnaryFunction(expOperands, [](const Posit& a) { return Posit(std::pow(10.0, double(a))); }, sink) },
+		{ "pow  ", MeasureUnaryFunction(logOperands, [&half](const Posit& a) { return sw::unum::pow(a, half); }, sink),
+		           MeasureUnaryFunction(logOperands, [&half](const Posit& a) { return Posit(std::pow(double(a), double(half))); }, sink) },
+	};
+
+	ostr << "Performance Report: " << tag << " native vs double shim\n";
+	for (const Measurement& r : m) {
+		ostr << r.name << "           : " << sw::unum::to_scientific(r.native) << "POPS  vs  "
+			<< sw::unum::to_scientific(r.shim) << "POPS\n";
+	}
+	ostr << "(checksum " << sink << ")\n" << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	CompareExponentialLogarithm<16, 1>(cout, "posit<16,1>", 100000);
+	CompareExponentialLogarithm<32, 2>(cout, "posit<32,2>", 10000);
+	CompareExponentialLogarithm<64, 3>(cout, "posit<64,3>", 10000);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
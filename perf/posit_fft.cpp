@@ -0,0 +1,172 @@
+// posit_fft.cpp: speed and signal to noise ratio of the posit FFT versus float and double FFTs of the same size
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cmath>
+#include <complex>
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// the same iterative radix-2 decimation in time for the IEEE types, with twiddles rounded once from long double
+template<typename Real>
+class ieee_fft {
+public:
+	explicit ieee_fft(size_t n) : _n(n), _twiddles(n / 2) {
+		const long double two_pi = 6.283185307179586476925286766559005768L;
+		for (size_t j = 0; j < n / 2; ++j) {
+			long double angle = two_pi * (long double)j / (long double)n;
+			_twiddles[j] = std::complex<Real>(Real(std::cos(angle)), Real(-std::sin(angle)));
+		}
+	}
+	void transform(std::vector< std::complex<Real> >& x, bool inverse) const {
+		for (size_t i = 1, j = 0; i < _n; ++i) {
+			size_t bit = _n >> 1;
+			for (; j & bit; bit >>= 1) j ^= bit;
+			j ^= bit;
+			if (i < j) std::swap(x[i], x[j]);
+		}
+		for (size_t half = 1; half < _n; half *= 2) {
+			size_t step = _n / (2 * half);
+			for (size_t k = 0; k < half; ++k) {
+				std::complex<Real> w = inverse ? std::conj(_twiddles[k * step]) : _twiddles[k * step];
+				for (size_t g = k; g < _n; g += 2 * half) {
+					std::complex<Real> t = w * x[g + half];
+					x[g + half] = x[g] - t;
+					x[g] += t;
+				}
+			}
+		}
+		if (inverse) for (std::complex<Real>& v : x) v /= Real(_n);
+	}
+
+private:
+	size_t _n;
+	std::vector< std::complex<Real> > _twiddles;
+};
+
+// the number of forward and inverse transforms per second of a kernel that performs nrTransforms of them
+template<typename Kernel>
+double MeasureTransformsPerSecond(size_t nrTransforms, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(nrTransforms) / elapsed.count();
+}
+
+// the signal to noise ratio in dB of a transform with respect to the reference
+template<typename Value>
+double SignalToNoise(const std::vector< std::complex<long double> >& reference, const std::vector<Value>& x) {
+	long double signal = 0, noise = 0;
+	for (size_t i = 0; i < x.size(); ++i) {
+		std::complex<long double> v((long double)x[i].real(), (long double)x[i].imag());
+		signal += std::norm(reference[i]);
+		noise += std::norm(v - reference[i]);
+	}
+	return double(10.0L * std::log10(signal / noise));
+}
+
+template<typename Real>
+void IeeeFftPerformance(std::ostream& ostr, const std::string& tag, const std::vector< std::complex<double> >& input, const std::vector< std::complex<long double> >& reference, size_t nrTransforms) {
+	size_t n = input.size();
+	ieee_fft<Real> fft(n);
+	std::vector< std::complex<Real> > x(n);
+	for (size_t i = 0; i < n; ++i) x[i] = std::complex<Real>(Real(input[i].real()), Real(input[i].imag()));
+	std::vector< std::complex<Real> > X = x;
+	fft.transform(X, false);
+	double snr = SignalToNoise(reference, X);
+	double rate = MeasureTransformsPerSecond(2 * nrTransforms, [&]() {
+		for (size_t r = 0; r < nrTransforms; ++r) {
+			fft.transform(x, false);
+			fft.transform(x, true);
+		}
+	});
+	ostr << tag << "           " << sw::unum::to_scientific(rate) << "FFT/s   SNR " << std::fixed << std::setprecision(1) << std::setw(6) << snr << " dB\n" << std::defaultfloat << std::setprecision(6);
+}
+
+template<size_t nbits, size_t es>
+void PositFftPerformance(std::ostream& ostr, const std::string& tag, const std::vector< std::complex<double> >& input, const std::vector< std::complex<long double> >& reference, size_t nrTransforms) {
+	using namespace sw::unum;
+	size_t n = input.size();
+	for (fft_butterfly butterfly : { fft_butterfly::rounded, fft_butterfly::exact }) {
+		fft_plan< posit<nbits, es> > plan(n, butterfly);
+		complex_array<nbits, es, complex_layout::split> x(n);
+		for (size_t i = 0; i < n; ++i) x.set(i, complex< posit<nbits, es> >(input[i].real(), input[i].imag()));
+		complex_array<nbits, es, complex_layout::split> X = x;
+		plan.forward(X);
+		std::vector< complex< posit<nbits, es> > > spectrum(n);
+		for (size_t i = 0; i < n; ++i) spectrum[i] = X[i];
+		double snr = SignalToNoise(reference, spectrum);
+		double rate = MeasureTransformsPerSecond(2 * nrTransforms, [&]() {
+			for (size_t r = 0; r < nrTransforms; ++r) {
+				plan.forward(x);
+				plan.inverse(x);
+			}
+		});
+		ostr << tag << (butterfly == fft_butterfly::exact ? " exact   " : " rounded ") << "  " << to_scientific(rate) << "FFT/s   SNR " << std::fixed << std::setprecision(1) << std::setw(6) << snr << " dB\n" << std::defaultfloat << std::setprecision(6);
+	}
+}
+
+void CompareFft(std::ostream& ostr, size_t n, size_t nrTransforms) {
+	std::mt19937_64 generator(n);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector< std::complex<double> > input(n);
+	for (std::complex<double>& v : input) v = std::complex<double>(distribution(generator), distribution(generator));
+	// the long double transform of the input is the reference of the signal to noise ratios
+	std::vector< std::complex<long double> > reference(n);
+	for (size_t i = 0; i < n; ++i) reference[i] = std::complex<long double>(input[i].real(), input[i].imag());
+	ieee_fft<long double>(n).transform(reference, false);
+
+	ostr << "FFT of size " << n << '\n';
+	IeeeFftPerformance<float>(ostr, "float      ", input, reference, 100 * nrTransforms);
+	IeeeFftPerformance<double>(ostr, "double     ", input, reference, 100 * nrTransforms);
+	PositFftPerformance<16, 1>(ostr, "posit<16,1>", input, reference, nrTransforms);
+	PositFftPerformance<32, 2>(ostr, "posit<32,2>", input, reference, nrTransforms);
+	ostr << '\n';
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	cout << "Forward and inverse FFTs per second, and the SNR of the forward FFT of a random signal\n";
+	CompareFft(cout, 256, 200);
+	CompareFft(cout, 1024, 40);
+	CompareFft(cout, 4096, 10);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
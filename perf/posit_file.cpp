@@ -0,0 +1,112 @@
+// posit_file.cpp: throughput of the binary posit array file format versus text serialization
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cstdio>
+#include <fstream>
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// the throughput of a kernel that processes n posits, in posits per second
+template<typename Kernel>
+double MeasurePositsPerSecond(size_t n, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(n) / elapsed.count();
+}
+
+template<size_t nbits, size_t es>
+void CompareSerialization(std::ostream& ostr, const std::string& tag, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	constexpr size_t chunk = 4096;
+	std::mt19937_64 generator(12345);
+	std::vector<Posit> v(n), w(n);
+	for (size_t i = 0; i < n; ++i) v[i].set_raw_bits(generator());
+	const std::string text = "posit_file_perf.txt", binary = "posit_file_perf.posit";
+	uint64_t checksum = 0;
+
+	// text is orders of magnitude slower, and is sampled on a prefix of the array
+	const size_t nText = std::min(n, size_t(1) << 12);
+	double textWrite = MeasurePositsPerSecond(nText, [&]() {
+		std::ofstream out(text);
+		for (size_t i = 0; i < nText; ++i) out << v[i] << '\n';
+	});
+	double textRead = MeasurePositsPerSecond(nText, [&]() {
+		std::ifstream in(text);
+		for (size_t i = 0; i < nText; ++i) in >> w[i];
+	});
+
+	ostr << tag << '\n';
+	ostr << "  text           write " << to_scientific(textWrite) << "posits/s   read " << to_scientific(textRead) << "posits/s\n";
+	for (posit_file_packing packing : { posit_file_packing::word, posit_file_packing::bit }) {
+		double binaryWrite = MeasurePositsPerSecond(n, [&]() {
+			posit_file_writer<nbits, es> writer(binary, packing);
+			for (size_t i = 0; i < n; i += chunk) writer.write(v.data() + i, std::min(chunk, n - i));
+		});
+		double binaryRead = MeasurePositsPerSecond(n, [&]() {
+			posit_file_reader<nbits, es> reader(binary);
+			for (size_t i = 0; i < n; i += chunk) reader.read(w.data() + i, std::min(chunk, n - i));
+		});
+		double mappedScan = MeasurePositsPerSecond(n, [&]() {
+			mapped_posit_file<nbits, es> file(binary);
+			posit_array_view<nbits, es> view = file.view();
+			for (size_t i = 0; i < view.size(); ++i) checksum += view.encoding(i);
+		});
+		ostr << (packing == posit_file_packing::bit ? "  bit packed " : "  word packed") << "   write " << to_scientific(binaryWrite) << "posits/s   read " << to_scientific(binaryRead) << "posits/s   mapped scan " << to_scientific(mappedScan) << "posits/s\n";
+	}
+	if (w != v) ostr << "  round trip failed\n";
+	ostr << "  (checksum " << (checksum & 0xFF) << ")\n";
+	std::remove(text.c_str());
+	std::remove(binary.c_str());
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr size_t n = size_t(1) << 20;
+	cout << "Serialization of " << n << " posits\n";
+	CompareSerialization<16, 1>(cout, "posit<16,1>", n);
+	CompareSerialization<32, 2>(cout, "posit<32,2>", n);
+	CompareSerialization<12, 1>(cout, "posit<12,1>", n);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+// posit_filters.cpp: throughput and per sample latency of the streaming FIR, biquad, and polyphase filters
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <algorithm>
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+template<typename Posit>
+std::vector<Posit> RandomSignal(size_t n, unsigned seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector<Posit> x(n);
+	for (Posit& p : x) p = distribution(generator);
+	return x;
+}
+
+// the throughput of a block kernel over n samples, in samples per second
+template<typename Kernel>
+double MeasureSamplesPerSecond(size_t n, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(n) / elapsed.count();
+}
+
+// the mean and the 99th percentile of the time of a single sample call, in nanoseconds
+template<typename Filter, typename Posit>
+void MeasureLatency(std::ostream& ostr, Filter& filter, const std::vector<Posit>& x) {
+	using namespace std::chrono;
+	std::vector<double> ns(x.size());
+	Posit sink(0);
+	for (size_t i = 0; i < x.size(); ++i) {
+		steady_clock::time_point begin = steady_clock::now();
+		sink += filter.process(x[i]);
+		steady_clock::time_point end = steady_clock::now();
+		ns[i] = duration<double, std::nano>(end - begin).count();
+	}
+	double mean = 0;
+	for (double t : ns) mean += t;
+	mean /= double(ns.size());
+	std::nth_element(ns.begin(), ns.begin() + ns.size() * 99 / 100, ns.end());
+	ostr << "   latency mean " << std::fixed << std::setprecision(0) << std::setw(7) << mean << "ns  p99 " << std::setw(7) << ns[ns.size() * 99 / 100] << "ns" << (sink.isnar() ? " (NaR)" : "") << '\n';
+	ostr << std::defaultfloat << std::setprecision(6);
+}
+
+template<typename Posit>
+void FirPerformance(std::ostream& ostr, const std::string& tag, size_t nrTaps, size_t n) {
+	using namespace sw::unum;
+	std::vector<Posit> h = RandomSignal<Posit>(nrTaps, 1), x = RandomSignal<Posit>(n, 2), y(n);
+	// the reference rounds every product and every sum, over a window that is rebuilt for every sample
+	double rounded = MeasureSamplesPerSecond(n, [&]() {
+		for (size_t i = 0; i < n; ++i) {
+			Posit sum(0);
+			for (size_t k = 0; k < nrTaps && k <= i; ++k) sum += h[k] * x[i - k];
+			y[i] = sum;
+		}
+	});
+	fir_filter<Posit> fir(h);
+	double exact = MeasureSamplesPerSecond(n, [&]() { fir.process(x.data(), y.data(), n); });
+	ostr << tag << " fir " << std::setw(3) << nrTaps << " taps   rounded " << to_scientific(rounded) << "samples/s   exact " << to_scientific(exact) << "samples/s";
+	fir.reset();
+	MeasureLatency(ostr, fir, x);
+}
+
+template<typename Posit>
+void BiquadPerformance(std::ostream& ostr, const std::string& tag, size_t nrSections, size_t n) {
+	using namespace sw::unum;
+	std::vector<Posit> x = RandomSignal<Posit>(n, 3), y(n);
+	biquad_cascade<Posit> cascade;
+	for (size_t s = 0; s < nrSections; ++s) cascade.add_section(Posit(0.0675), Posit(0.135), Posit(0.0675), Posit(-1.143), Posit(0.4128));
+	double rate = MeasureSamplesPerSecond(n, [&]() { cascade.process(x.data(), y.data(), n); });
+	ostr << tag << " biquad cascade of " << nrSections << "          exact " << to_scientific(rate) << "samples/s";
+	cascade.reset();
+	MeasureLatency(ostr, cascade, x);
+}
+
+template<typename Posit>
+void DecimatorPerformance(std::ostream& ostr, const std::string& tag, size_t nrTaps, size_t factor, size_t n) {
+	using namespace sw::unum;
+	std::vector<Posit> h = RandomSignal<Posit>(nrTaps, 4), x = RandomSignal<Posit>(n, 5), y(n);
+	fir_filter<Posit> fir(h);
+	// decimation with the full filter at every input sample, and the output downsampled
+	double full = MeasureSamplesPerSecond(n, [&]() {
+		fir.process(x.data(), y.data(), n);
+		for (size_t i = 0; i < n / factor; ++i) y[i] = y[i * factor];
+	});
+	polyphase_decimator<Posit> decimator(h, factor);
+	double polyphase = MeasureSamplesPerSecond(n, [&]() { decimator.process(x.data(), n, y.data()); });
+	ostr << tag << " decimate by " << factor << ", " << nrTaps << " taps   full filter " << to_scientific(full) << "samples/s   polyphase " << to_scientific(polyphase) << "samples/s\n";
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr size_t n = 20000;
+	cout << "Streaming filters, input samples per second\n";
+	FirPerformance<posit<16, 1>>(cout, "posit<16,1>", 16, n);
+	FirPerformance<posit<16, 1>>(cout, "posit<16,1>", 64, n);
+	FirPerformance<posit<32, 2>>(cout, "posit<32,2>", 16, n);
+	FirPerformance<posit<32, 2>>(cout, "posit<32,2>", 64, n);
+	BiquadPerformance<posit<16, 1>>(cout, "posit<16,1>", 4, n);
+	BiquadPerformance<posit<32, 2>>(cout, "posit<32,2>", 4, n);
+	DecimatorPerformance<posit<16, 1>>(cout, "posit<16,1>", 64, 4, n);
+	DecimatorPerformance<posit<32, 2>>(cout, "posit<32,2>", 64, 8, n);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,85 @@
+// posit_fma.cpp: performance comparison of the fused multiply-add and the two rounded operations it replaces
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable fast specialized posit<16,1> and posit<32,2>
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a ternary function over a set of operands and report it in POPS
+template<typename Posit, typename Function>
+double MeasureTernaryFunction(const std::vector<Posit>& a, const std::vector<Posit>& b, const std::vector<Posit>& c, Function f, Posit& sink) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t i = 0; i < a.size(); ++i) sink += f(a[i], b[i], c[i]);
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(a.size()) / elapsed.count();
+}
+
+template<size_t nbits, size_t es>
+void CompareFusedMultiplyAdd(std::ostream& ostr, const std::string& tag, size_t nrSamples) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> distribution(-1.0e3, 1.0e3);
+	std::vector<Posit> a(nrSamples), b(nrSamples), c(nrSamples);
+	for (size_t i = 0; i < nrSamples; ++i) {
+		a[i] = distribution(generator);
+		b[i] = distribution(generator);
+		c[i] = distribution(generator);
+	}
+	Posit sink(0);
+
+	double fused = MeasureTernaryFunction(a, b, c, [](const Posit& x, const Posit& y, const Posit& z) { return sw::unum::fma(x, y, z); }, sink);
+	double separate = MeasureTernaryFunction(a, b, c, [](const Posit& x, const Posit& y, const Posit& z) { return x * y + z; }, sink);
+
+	ostr << "Performance Report: " << tag << '\n';
+	ostr << "fma(a, b, c)      : " << sw::unum::to_scientific(fused) << "POPS\n";
+	ostr << "a * b + c         : " << sw::unum::to_scientific(separate) << "POPS\n";
+	ostr << "(checksum " << sink << ")\n" << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	CompareFusedMultiplyAdd<16, 1>(cout, "posit<16,1>", 100000);
+	CompareFusedMultiplyAdd<32, 2>(cout, "posit<32,2>", 100000);
+	CompareFusedMultiplyAdd<64, 3>(cout, "posit<64,3>", 10000);
+	CompareFusedMultiplyAdd<128, 4>(cout, "posit<128,4>", 1000);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
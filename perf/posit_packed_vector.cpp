@@ -0,0 +1,109 @@
+// posit_packed_vector.cpp: streaming bandwidth of the bit-packed posit container versus std::vector of posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include "posit_performance.hpp"
+
+// measure the throughput of a kernel over nrElements elements, in elements per second
+template<typename Kernel>
+double MeasureElementsPerSecond(size_t nrElements, size_t nrRepetitions, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t r = 0; r < nrRepetitions; ++r) kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(nrElements * nrRepetitions) / elapsed.count();
+}
+
+// stream the elements through a block of posits at register width: read with a checksum of the encodings, write from the block
+template<size_t nbits, size_t es>
+void CompareStreaming(std::ostream& ostr, const std::string& tag, size_t n, size_t nrRepetitions) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	constexpr size_t blockSize = 4 * packed_posit_vector<nbits, es>::block_size;
+	std::mt19937_64 generator(12345);
+	std::vector<Posit> v(n);
+	for (size_t i = 0; i < n; ++i) v[i].set_raw_bits(generator());
+	packed_posit_vector<nbits, es> packed(v.begin(), v.end());
+	Posit block[blockSize];
+	uint64_t checksum = 0;
+
+	double vectorRead = MeasureElementsPerSecond(n, nrRepetitions, [&]() {
+		for (size_t i = 0; i < n; i += blockSize) {
+			size_t count = std::min(blockSize, n - i);
+			std::copy(v.begin() + i, v.begin() + i + count, block);
+			for (size_t j = 0; j < count; ++j) checksum += block[j].encoding();
+		}
+	});
+	double packedRead = MeasureElementsPerSecond(n, nrRepetitions, [&]() {
+		for (size_t i = 0; i < n; i += blockSize) {
+			size_t count = std::min(blockSize, n - i);
+			packed.unpack(i, count, block);
+			for (size_t j = 0; j < count; ++j) checksum += block[j].encoding();
+		}
+	});
+	double vectorWrite = MeasureElementsPerSecond(n, nrRepetitions, [&]() {
+		for (size_t i = 0; i < n; i += blockSize) {
+			size_t count = std::min(blockSize, n - i);
+			std::copy(block, block + count, v.begin() + i);
+		}
+	});
+	double packedWrite = MeasureElementsPerSecond(n, nrRepetitions, [&]() {
+		for (size_t i = 0; i < n; i += blockSize) packed.pack(i, std::min(blockSize, n - i), block);
+	});
+
+	ostr << tag << " storage: std::vector " << to_scientific(double(n * sizeof(Posit))) << "B   packed " << to_scientific(double(packed.storage_bytes())) << "B   (checksum " << (checksum & 0xFF) << ")\n";
+	ostr << "  read     std::vector " << to_scientific(vectorRead) << "posits/s " << to_scientific(vectorRead * sizeof(Posit)) << "B/s   packed " << to_scientific(packedRead) << "posits/s " << to_scientific(packedRead * nbits / 8) << "B/s\n";
+	ostr << "  write    std::vector " << to_scientific(vectorWrite) << "posits/s " << to_scientific(vectorWrite * sizeof(Posit)) << "B/s   packed " << to_scientific(packedWrite) << "posits/s " << to_scientific(packedWrite * nbits / 8) << "B/s\n";
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	// arrays well beyond the last level cache
+	constexpr size_t n = size_t(1) << 23;
+	cout << "Streaming bandwidth of " << n << " posits\n";
+	CompareStreaming<10, 0>(cout, "posit<10,0>", n, 4);
+	CompareStreaming<12, 0>(cout, "posit<12,0>", n, 4);
+	CompareStreaming<14, 0>(cout, "posit<14,0>", n, 4);
+	CompareStreaming<16, 1>(cout, "posit<16,1>", n, 4);
+	CompareStreaming<48, 2>(cout, "posit<48,2>", n, 4);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
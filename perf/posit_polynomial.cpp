@@ -0,0 +1,100 @@
+// posit_polynomial.cpp: performance comparison of the polynomial evaluation schemes for posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable fast specialized posit<16,1> and posit<32,2>
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include <universal/functions/ddpoly.hpp>
+#include "posit_performance.hpp"
+
+// measure the throughput of evaluating a polynomial at a set of points and report it in points per second
+template<typename Posit, typename Function>
+double MeasurePolynomial(const std::vector<Posit>& x, Function f, Posit& sink) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	for (const Posit& v : x) sink += f(v);
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> elapsed = duration_cast<duration<double>>(end - begin);
+	return double(x.size()) / elapsed.count();
+}
+
+template<size_t nbits, size_t es>
+void ComparePolynomialEvaluation(std::ostream& ostr, const std::string& tag, size_t nrSamples) {
+	using namespace sw::unum;
+	using namespace sw::function;
+	using Posit = posit<nbits, es>;
+	// Taylor coefficients of exp(x) up to degree 8
+	std::vector<Posit> c = { 1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040, 1.0 / 40320 };
+	std::mt19937_64 generator(12345);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector<Posit> x(nrSamples);
+	for (auto& v : x) v = distribution(generator);
+	Posit sink(0);
+	std::vector<Posit> pd(1);
+
+	double plain = MeasurePolynomial(x, [&](const Posit& v) { ddpoly(v, c, pd); return pd[0]; }, sink);
+	double fused = MeasurePolynomial(x, [&](const Posit& v) { return horner(v, c); }, sink);
+	double compensated = MeasurePolynomial(x, [&](const Posit& v) { return compensated_horner(v, c); }, sink);
+	double tree = MeasurePolynomial(x, [&](const Posit& v) { return estrin(v, c); }, sink);
+	double quire = MeasurePolynomial(x, [&](const Posit& v) { return quire_estrin(v, c); }, sink);
+	polynomial_evaluator<nbits, es> polynomial(c);
+	std::vector<Posit> p;
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	polynomial(x, p);
+	steady_clock::time_point end = steady_clock::now();
+	double batch = double(x.size()) / duration_cast<duration<double>>(end - begin).count();
+	for (const Posit& v : p) sink += v;
+
+	ostr << "Performance Report: " << tag << " degree " << c.size() - 1 << " polynomial\n";
+	ostr << "ddpoly                 : " << sw::unum::to_scientific(plain) << "points/sec\n";
+	ostr << "fma Horner             : " << sw::unum::to_scientific(fused) << "points/sec\n";
+	ostr << "compensated Horner     : " << sw::unum::to_scientific(compensated) << "points/sec\n";
+	ostr << "fma Estrin             : " << sw::unum::to_scientific(tree) << "points/sec\n";
+	ostr << "quire Estrin           : " << sw::unum::to_scientific(quire) << "points/sec\n";
+	ostr << "quire Estrin batch     : " << sw::unum::to_scientific(batch) << "points/sec\n";
+	ostr << "(checksum " << sink << ")\n" << std::endl;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	ComparePolynomialEvaluation<16, 1>(cout, "posit<16,1>", 10000);
+	ComparePolynomialEvaluation<32, 2>(cout, "posit<32,2>", 10000);
+	ComparePolynomialEvaluation<64, 3>(cout, "posit<64,3>", 1000);
+
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
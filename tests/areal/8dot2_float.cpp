@@ -1,14 +1,10 @@
 // 8dot2_float.cpp: Functionality tests for 8bit precision floats
 //
-// Copyright (C) 2017-2019 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 // minimum set of include files to reflect source code dependencies
-// TODO: the dependency on posit exceptions and trace_constants need to be removed
-#include "universal/posit/exceptions.hpp"
-#include "universal/posit/trace_constants.hpp"
-#include "universal/bitblock/bitblock.hpp"
 #include "universal/areal/areal.hpp"
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
@@ -28,7 +24,7 @@ void GenerateTestCase(Ty a, Ty b) {
 	std::cout << std::setprecision(nbits - 2);
 	std::cout << std::setw(nbits) << a << " + " << std::setw(nbits) << b << " = " << std::setw(nbits) << ref << std::endl;
 	std::cout << pa.get() << " + " << pb.get() << " = " << psum.get() << " (reference: " << pref.get() << ")   ";
-	std::cout << (pref == psum ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << (Identical(pref, psum) ? "PASS" : "FAIL") << std::endl << std::endl;
 	std::cout << std::setprecision(5);
 }
 
@@ -55,7 +51,6 @@ try {
 	float b = 1.0f;
 	GenerateTestCase<nbits, es, float>(a, b);
 
-#if 0
 	bool bReportIndividualTestCases = false;
 
 	// logic tests
@@ -68,14 +63,39 @@ try {
 	// conversion tests
 	nrOfFailedTestCases += ReportTestResult( ValidateIntegerConversion<nbits, es>(tag, bReportIndividualTestCases), tag, "integer assign ");
 	nrOfFailedTestCases += ReportTestResult( ValidateConversion       <nbits, es>(tag, bReportIndividualTestCases), tag, "float assign   ");
+	// increment and decrement tests
+	nrOfFailedTestCases += ReportTestResult( ValidateIncrement        <nbits, es>(tag, bReportIndividualTestCases), tag, "increment      ");
+	nrOfFailedTestCases += ReportTestResult( ValidateDecrement        <nbits, es>(tag, bReportIndividualTestCases), tag, "decrement      ");
+	nrOfFailedTestCases += ReportTestResult( ValidatePrefix           <nbits, es>(tag, bReportIndividualTestCases), tag, "prefix         ");
+	nrOfFailedTestCases += ReportTestResult( ValidatePostfix          <nbits, es>(tag, bReportIndividualTestCases), tag, "postfix        ");
 	// arithmetic tests
 	nrOfFailedTestCases += ReportTestResult( ValidateAddition         <nbits, es>(tag, bReportIndividualTestCases), tag, "add            ");
 	nrOfFailedTestCases += ReportTestResult( ValidateSubtraction      <nbits, es>(tag, bReportIndividualTestCases), tag, "subtract       ");
 	nrOfFailedTestCases += ReportTestResult( ValidateMultiplication   <nbits, es>(tag, bReportIndividualTestCases), tag, "multiply       ");
 	nrOfFailedTestCases += ReportTestResult( ValidateDivision         <nbits, es>(tag, bReportIndividualTestCases), tag, "divide         ");
 	nrOfFailedTestCases += ReportTestResult( ValidateNegation         <nbits, es>(tag, bReportIndividualTestCases), tag, "negate         ");
-	nrOfFailedTestCases += ReportTestResult( ValidateReciprocation    <nbits, es>(tag, bReportIndividualTestCases), tag, "reciprocate    ");
-#endif
+	nrOfFailedTestCases += ReportTestResult( ValidateSqrt             <nbits, es>(tag, bReportIndividualTestCases), tag, "sqrt           ");
+	// arithmetic on uncertain operands
+	nrOfFailedTestCases += ReportTestResult( ValidateUncertainty      <nbits, es>(tag, bReportIndividualTestCases, OPCODE_ADD), tag, "uncertain add  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateUncertainty      <nbits, es>(tag, bReportIndividualTestCases, OPCODE_SUB), tag, "uncertain sub  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateUncertainty      <nbits, es>(tag, bReportIndividualTestCases, OPCODE_MUL), tag, "uncertain mul  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateUncertainty      <nbits, es>(tag, bReportIndividualTestCases, OPCODE_DIV), tag, "uncertain div  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateUncertainty      <nbits, es>(tag, bReportIndividualTestCases, OPCODE_SQRT), tag, "uncertain sqrt ");
+
+	{
+		// the ubit of an uncertain operand flags the result, which is not widened by the uncertainty:
+		// the product of the intervals of 1.5u reaches above 2.25u, and the difference of 1.0u and 0.5u below 0.5
+		int nrOfFailedFlags = 0;
+		areal<nbits, es> u, v, ref;
+		u = 1.5; u.setubit();
+		ref = 2.25; ref.setubit();
+		if (!Identical(u * u, ref)) ++nrOfFailedFlags;
+		u = 1.0; u.setubit();
+		v = 0.5; v.setubit();
+		ref = 0.5; ref.setubit();
+		if (!Identical(u - v, ref)) ++nrOfFailedFlags;
+		nrOfFailedTestCases += ReportTestResult(nrOfFailedFlags, tag, "ubit flag      ");
+	}
 
 	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
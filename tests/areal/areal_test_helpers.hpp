@@ -1,1068 +1,555 @@
 #pragma once
 //  areal_test_helpers.hpp : arbitrary real verification functions
 //
-// Copyright (C) 2017-2018 Stillwater Supercomputing, Inc.
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <vector>
 #include <iostream>
-#include <typeinfo>
+#include <iomanip>
+#include <string>
 #include <random>
 #include <limits>
+#include <cmath>
+#include <algorithm>
 
 namespace sw {
 	namespace unum {
 
 		static constexpr unsigned FLOAT_TABLE_WIDTH = 15;
 
-		template<size_t nbits, size_t es>
-		void ReportConversionError(std::string test_case, std::string op, double input, double reference, const areal<nbits, es>& presult) {
-			static_assert(nbits > 2, "component_to_string requires nbits > 2");
-			constexpr size_t fbits = nbits - 3 - es;
-
-			bool		     	 _sign;
-			exponent<nbits, es>  _exponent;
-			fraction<fbits>      _fraction;
-			decode(presult.get(), _sign, _exponent, _fraction);
-			int                  _scale =_exponent.scale();
-
-			std::cerr << test_case
-				<< " " << op << " "
-				<< std::setw(FLOAT_TABLE_WIDTH) << input
-				<< " did not convert to "
-				<< std::setw(FLOAT_TABLE_WIDTH) << reference << " instead it yielded "
-				<< std::setw(FLOAT_TABLE_WIDTH) << double(presult)
-				<< "  raw " << std::setw(nbits) << presult.get()
-				<< "   scale= " << std::setw(3) << _scale << "   k= " << "   exp= " << std::setw(3) << _exponent.scale()
-				<< std::endl;
-		}
-
-		template<size_t nbits, size_t es>
-		void ReportConversionSuccess(std::string test_case, std::string op, double input, double reference, const areal<nbits, es>& presult) {
-			static_assert(nbits > 2, "component_to_string requires nbits > 2");
-			constexpr size_t fbits = nbits - 3 - es;
-
-			bool		     	 _sign;
-			exponent<nbits, es>  _exponent;
-			fraction<fbits>      _fraction;
-			decode(presult.get(), _sign, _exponent, _fraction);
-			int                  _scale = _exponent.scale();
-
-			std::cerr << test_case
-				<< " " << op << " "
-				<< std::setw(FLOAT_TABLE_WIDTH) << input
-				<< " did     convert to "
-				<< std::setw(FLOAT_TABLE_WIDTH) << double(presult) << " reference value is "
-				<< std::setw(FLOAT_TABLE_WIDTH) << reference
-				<< "  raw " << std::setw(nbits) << presult.get()
-				<< "   scale= " << std::setw(3) << _scale << "   k= " << "   exp= " << std::setw(3) << _exponent.scale()
-				<< std::endl;
-		}
-
 		template<size_t nbits, size_t es>
 		void ReportUnaryArithmeticError(std::string test_case, std::string op, const areal<nbits, es>& rhs, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
 			std::cerr << test_case
 				<< " " << op << " "
+				<< std::setprecision(20)
 				<< std::setw(FLOAT_TABLE_WIDTH) << rhs
 				<< " != "
-				<< std::setw(FLOAT_TABLE_WIDTH) << pref << " instead it yielded "
-				<< std::setw(FLOAT_TABLE_WIDTH) << presult
-				<< " " << pref.get() << " vs " << presult.get() << std::endl;
-		}
-
-		template<size_t nbits, size_t es>
-		void ReportUnaryArithmeticSuccess(std::string test_case, std::string op, const areal<nbits, es>& rhs, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
-			std::cerr << test_case
-				<< " " << op << " "
-				<< std::setw(FLOAT_TABLE_WIDTH) << rhs
-				<< " == "
-				<< std::setw(FLOAT_TABLE_WIDTH) << presult << " reference value is "
-				<< std::setw(FLOAT_TABLE_WIDTH) << pref
-				<< " " << components_to_string(presult) << std::endl;
+				<< std::setw(FLOAT_TABLE_WIDTH) << pref << (pref.ubit() ? "..." : "   ") << " instead it yielded "
+				<< std::setw(FLOAT_TABLE_WIDTH) << presult << (presult.ubit() ? "..." : "   ")
+				<< " " << pref.get() << " vs " << presult.get()
+				<< std::setprecision(5)
+				<< std::endl;
 		}
 
 		template<size_t nbits, size_t es>
 		void ReportBinaryArithmeticError(std::string test_case, std::string op, const areal<nbits, es>& lhs, const areal<nbits, es>& rhs, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
-			std::cerr << test_case << " " 
+			std::cerr << test_case << " "
 				<< std::setprecision(20)
 				<< std::setw(FLOAT_TABLE_WIDTH) << lhs
 				<< " " << op << " "
 				<< std::setw(FLOAT_TABLE_WIDTH) << rhs
 				<< " != "
-				<< std::setw(FLOAT_TABLE_WIDTH) << pref << " instead it yielded "
-				<< std::setw(FLOAT_TABLE_WIDTH) << presult
-				<< " " << pref.get() << " vs " << presult.get() 
+				<< std::setw(FLOAT_TABLE_WIDTH) << pref << (pref.ubit() ? "..." : "   ") << " instead it yielded "
+				<< std::setw(FLOAT_TABLE_WIDTH) << presult << (presult.ubit() ? "..." : "   ")
+				<< " " << pref.get() << " vs " << presult.get()
 				<< std::setprecision(5)
 				<< std::endl;
 		}
 
-		template<size_t nbits, size_t es>
-		void ReportBinaryArithmeticErrorInBinary(std::string test_case, std::string op, const areal<nbits, es>& lhs, const areal<nbits, es>& rhs, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
-			std::cerr << test_case << " "
-				<< std::setw(nbits) << lhs.get()
-				<< " " << op << " "
-				<< std::setw(nbits) << rhs.get()
-				<< " != "
-				<< std::setw(nbits) << pref.get() << " instead it yielded "
-				<< std::setw(nbits) << presult.get()
-				<< " " << pretty_print(presult,20) << std::endl;
+		// the same encoding and ubit, where all NaNs are the same
+		template<size_t nbits, size_t es>
+		bool Identical(const areal<nbits, es>& a, const areal<nbits, es>& b) {
+			if (a.isnan() || b.isnan()) return a.isnan() && b.isnan();
+			return a.encoding() == b.encoding() && a.ubit() == b.ubit();
+		}
+
+		/*
+		The reference of an operator on areal<nbits, es> is computed in double precision: the operands are exact doubles, and
+		the round-to-nearest result r comes with the sign of its error, exact = r + error, from an error-free transformation.
+		The truncation of the exact result is the truncation of r, unless r is an areal value and the exact result is smaller in
+		magnitude, in which case it is the encoding below r: no areal value lies strictly between the exact result and r,
+		as that value would be a double closer to the exact result. The transformations are exact for the exponent ranges up to
+		es = 8, which are far from the subnormal range of double. The truncation of r is carried out on the double, independent
+		of the field arithmetic of areal, and only its exact result is assigned to the areal.
+		*/
+		template<size_t nbits, size_t es>
+		areal<nbits, es> TruncatedReference(double r, int error) {
+			static_assert(es <= 8 && nbits - 1 - es < 53, "the double precision reference requires es <= 8 and fbits < 53");
+			const int fbits = int(nbits - 1 - es);
+			const int bias = (1 << (es - 1)) - 1;
+			const int qmin = 1 - bias - fbits;    // exponent of the least significant bit of the subnormals
+			const double maxpos = std::ldexp(2.0 - std::ldexp(1.0, -fbits), bias);
+			areal<nbits, es> reference;
+			bool inexact = false;
+			if (std::isnan(r) || std::isinf(r) || r == 0) {
+				reference = r;
+			}
+			else if (std::fabs(r) > maxpos) {
+				reference = (r < 0 ? -maxpos : maxpos);
+				inexact = true;
+			}
+			else {
+				int lsb = std::ilogb(r) - fbits;
+				if (lsb < qmin) lsb = qmin;
+				double truncated = std::ldexp(std::trunc(std::ldexp(r, -lsb)), lsb);
+				reference = (truncated == 0 ? std::copysign(0.0, r) : truncated);
+				inexact = (truncated != r);
+			}
+			if (error != 0) {
+				if (!inexact && (error < 0) != (r < 0)) reference.set_raw_bits(reference.encoding() - 1);
+				inexact = true;
+			}
+			reference.setubit(inexact);
+			return reference;
 		}
 
-		template<size_t nbits, size_t es>
-		void ReportBinaryArithmeticSuccess(std::string test_case, std::string op, const areal<nbits, es>& lhs, const areal<nbits, es>& rhs, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
-			std::cerr << test_case << " "
-				<< std::setprecision(20)
-				<< std::setw(FLOAT_TABLE_WIDTH) << lhs
-				<< " " << op << " "
-				<< std::setw(FLOAT_TABLE_WIDTH) << rhs
-				<< " == "
-				<< std::setw(FLOAT_TABLE_WIDTH) << presult << " reference value is "
-				<< std::setw(FLOAT_TABLE_WIDTH) << pref
-				<< " " << pref.get() << " vs " << presult.get() 
-				<< std::setprecision(5)
-				<< std::endl;
+		inline int Sign(double v) { return (v > 0) - (v < 0); }
+		// the signs of the errors of the double precision sum, product, quotient, and square root
+		inline int SumError(double a, double b, double s) {
+			if (!std::isfinite(s)) return 0;
+			double bb = s - a;
+			return Sign((a - (s - bb)) + (b - bb));
 		}
-
-		template<size_t nbits, size_t es>
-		void ReportBinaryArithmeticSuccessInBinary(std::string test_case, std::string op, const areal<nbits, es>& lhs, const areal<nbits, es>& rhs, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
-			std::cerr << test_case << " "
-				<< std::setw(nbits) << lhs.get()
-				<< " " << op << " "
-				<< std::setw(nbits) << rhs.get()
-				<< " == "
-				<< std::setw(nbits) << presult.get() << " reference value is "
-				<< std::setw(nbits) << pref.get()
-				<< " " << pretty_print(presult,20) << std::endl;
+		inline int ProductError(double a, double b, double p) {
+			if (!std::isfinite(p)) return 0;
+			return Sign(std::fma(a, b, -p));
 		}
-		
-		template<size_t nbits, size_t es>
-		void ReportDecodeError(std::string test_case, const areal<nbits, es>& actual, double golden_value) {
-			std::cerr << test_case << " actual " << actual << " required " << golden_value << std::endl;
+		inline int QuotientError(double a, double b, double q) {
+			if (!std::isfinite(q) || q == 0) return 0;
+			return Sign(std::fma(-q, b, a)) * Sign(b);
+		}
+		inline int RootError(double a, double s) {
+			if (!std::isfinite(s) || s == 0) return 0;
+			return Sign(std::fma(-s, s, a));
 		}
 
 		/////////////////////////////// VERIFICATION TEST SUITES ////////////////////////////////
 
 		template<size_t nbits, size_t es>
-		int Compare(double input, const areal<nbits, es>& presult, double reference, bool bReportIndividualTestCases) {
-			int fail = 0;
-			double result = double(presult);
-			if (std::fabs(result - reference) > 0.000000001) {
-				fail++;
-				if (bReportIndividualTestCases)	ReportConversionError("FAIL", "=", input, reference, presult);
-			}
-			else {
-				// if (bReportIndividualTestCases) ReportConversionSuccess("PASS", "=", input, reference, presult);
-			}
-			return fail;
+		void ReportConversionError(std::string test_case, std::string op, double input, const areal<nbits, es>& pref, const areal<nbits, es>& presult) {
+			std::cerr << test_case
+				<< " " << op << " "
+				<< std::setprecision(20)
+				<< std::setw(FLOAT_TABLE_WIDTH) << input
+				<< " != "
+				<< std::setw(FLOAT_TABLE_WIDTH) << pref << (pref.ubit() ? "..." : "   ") << " instead it yielded "
+				<< std::setw(FLOAT_TABLE_WIDTH) << presult << (presult.ubit() ? "..." : "   ")
+				<< " " << pref.get() << " vs " << presult.get()
+				<< std::setprecision(5)
+				<< std::endl;
 		}
 
-		// enumerate all conversion cases for a areal configuration
 		template<size_t nbits, size_t es>
-		int ValidateConversion(std::string tag, bool bReportIndividualTestCases) {
-			// we are going to generate a test set that consists of all areal configs and their midpoints
-			// we do this by enumerating a areal that is 1-bit larger than the test areal configuration
-			// These larger posits will be at the mid-point between the smaller areal sample values
-			// and we'll enumerate the exact value, and a perturbation smaller and a perturbation larger
-			// to test the rounding logic of the conversion.
-			const int NR_TEST_CASES = (1 << (nbits + 1));
-			const int HALF = (1 << nbits);
-			areal<nbits + 1, es> pref, pprev, pnext;
+		int Compare(double input, const areal<nbits, es>& presult, const areal<nbits, es>& pref, bool bReportIndividualTestCases) {
+			if (Identical(presult, pref)) return 0;
+			if (bReportIndividualTestCases) ReportConversionError("FAIL", "=", input, pref, presult);
+			return 1;
+		}
 
-			// execute the test
+		// enumerate all conversion cases for an areal configuration
+		template<size_t nbits, size_t es>
+		int ValidateConversion(std::string tag, bool bReportIndividualTestCases) {
+			// areal<nbits + 1, es> has one more fraction bit, so that its encoding i lies at or above the encoding i >> 1
+			// of areal<nbits, es> in magnitude: an odd i is the midpoint to the neighbor away from zero.
+			// The conversion truncates the value toward zero, and a perturbation of the value by a relative eps
+			// truncates to the encoding at or below it, with the ubit set.
+			static_assert(nbits < 20, "the conversion enumerates the encodings of areal<nbits + 1, es>");
+			const uint64_t NR_TEST_CASES = (uint64_t(1) << (nbits + 1));
 			int nrOfFailedTests = 0;
-			areal<nbits+1, es> areal_minpos(0);
-			areal_minpos++;
-			double minpos = double(areal_minpos);
-			double eps;
-			double da, input;
-			areal<nbits, es> pa;
-			for (int i = 0; i < NR_TEST_CASES; i++) {
-				pref.set_raw_bits(i);
-				da = double(pref);
-				if (i == 0) {
-					eps = minpos / 2.0;
-				}
-				else {
-					eps = da > 0 ? da * 1.0e-6 : da * -1.0e-6;
-				}
-				if (i % 2) {
-					if (i == 1) {
-						// special case of projecting to +minpos
-						// even the -delta goes to +minpos
-						input = da - eps;
-						pa = input;
-						pnext.set_raw_bits(i + 1);
-						nrOfFailedTests += Compare(input, pa, (double)pnext, bReportIndividualTestCases);
-						input = da + eps;
-						pa = input;
-						nrOfFailedTests += Compare(input, pa, (double)pnext, bReportIndividualTestCases);
-
-					}
-					else if (i == HALF - 1) {
-						// special case of projecting to +maxpos
-						input = da - eps;
-						pa = input;
-						pprev.set_raw_bits(HALF - 2);
-						nrOfFailedTests += Compare(input, pa, (double)pprev, bReportIndividualTestCases);
-					}
-					else if (i == HALF + 1) {
-						// special case of projecting to -maxpos
-						input = da - eps;
-						pa = input;
-						pprev.set_raw_bits(HALF + 2);
-						nrOfFailedTests += Compare(input, pa, (double)pprev, bReportIndividualTestCases);
-					}
-					else if (i == NR_TEST_CASES - 1) {
-						// special case of projecting to -minpos
-						// even the +delta goes to -minpos
-						input = da - eps;
-						pa = input;
-						pprev.set_raw_bits(i - 1);
-						nrOfFailedTests += Compare(input, pa, (double)pprev, bReportIndividualTestCases);
-						input = da + eps;
-						pa = input;
-						nrOfFailedTests += Compare(input, pa, (double)pprev, bReportIndividualTestCases);
-					}
-					else {
-						// for odd values, we are between areal values, so we create the round-up and round-down cases
-						// round-down
-						input = da - eps;
-						pa = input;
-						pprev.set_raw_bits(i - 1);
-						nrOfFailedTests += Compare(input, pa, (double)pprev, bReportIndividualTestCases);
-						// round-up
-						input = da + eps;
-						pa = input;
-						pnext.set_raw_bits(i + 1);
-						nrOfFailedTests += Compare(input, pa, (double)pnext, bReportIndividualTestCases);
+			areal<nbits + 1, es> pvalue;
+			areal<nbits, es> pa, pref;
+			for (uint64_t i = 0; i < NR_TEST_CASES; i++) {
+				pvalue.set_raw_bits(i);
+				double da = double(pvalue);
+				if (pvalue.isnan()) {
+					pa = da;
+					if (!pa.isnan() || pa.ubit()) {
+						nrOfFailedTests++;
+						if (bReportIndividualTestCases) ReportConversionError("FAIL", "=", da, pref, pa);
 					}
+					continue;
 				}
-				else {
-					// for the even values, we generate the round-to-actual cases
-					if (i == 0) {
-						// special case of assigning to 0
-						input = 0.0;
-						pa = input;
-						nrOfFailedTests += Compare(input, pa, da, bReportIndividualTestCases);
-						// special case of projecting to +minpos
-						input = da + eps;
-						pa = input;
-						pnext.set_raw_bits(i + 2);
-						nrOfFailedTests += Compare(input, pa, (double)pnext, bReportIndividualTestCases);
-					}
-					else if (i == NR_TEST_CASES - 2) {
-						// special case of projecting to -minpos
-						input = da - eps;
-						pa = input;
-						pprev.set_raw_bits(NR_TEST_CASES - 2);
-						nrOfFailedTests += Compare(input, pa, (double)pprev, bReportIndividualTestCases);
-					}
-					else {
-						// round-up
-						input = da - eps;
-						pa = input;
-						nrOfFailedTests += Compare(input, pa, da, bReportIndividualTestCases);
-						// round-down
-						input = da + eps;
-						pa = input;
-						nrOfFailedTests += Compare(input, pa, da, bReportIndividualTestCases);
-					}
+				uint64_t truncated = i >> 1;
+				double away = pvalue.sign() ? -1.0 : 1.0;
+				double eps = (pvalue.iszero() ? std::numeric_limits<double>::denorm_min() : std::fabs(da) * 1.0e-6);
+				if (pvalue.isinf()) {
+					pa = da;
+					pref.set_raw_bits(truncated);
+					nrOfFailedTests += Compare(da, pa, pref, bReportIndividualTestCases);
+					continue;
 				}
+				// the value itself is exact at the even encodings, and uncertain at the midpoints
+				pa = da;
+				pref.set_raw_bits(truncated, (i & 1) != 0);
+				nrOfFailedTests += Compare(da, pa, pref, bReportIndividualTestCases);
+				// away from zero truncates back to the encoding at or below the value
+				pa = da + away * eps;
+				pref.set_raw_bits(truncated, true);
+				nrOfFailedTests += Compare(da + away * eps, pa, pref, bReportIndividualTestCases);
+				// toward zero truncates to the encoding below an even encoding, and stays at the encoding below a midpoint
+				if (pvalue.iszero()) continue;   // crosses zero
+				pa = da - away * eps;
+				pref.set_raw_bits((i & 1) ? truncated : truncated - 1, true);
+				nrOfFailedTests += Compare(da - away * eps, pa, pref, bReportIndividualTestCases);
 			}
 			return nrOfFailedTests;
 		}
 
-		// enumerate all conversion cases for integers
+		// enumerate the integer conversions of the small integers and the powers of two,
+		// which truncate like their exact double values
 		template<size_t nbits, size_t es>
 		int ValidateIntegerConversion(std::string& tag, bool bReportIndividualTestCases) {
-			// we generate numbers from 1 to NaR to -1 and the special case of 0
-			constexpr size_t NR_OF_TESTS = (size_t(1) << (nbits - 1)) + 1;
-			int nrOfFailedTestCases = 0;
-
-			areal<nbits, es> p(0);
-			if (!p.iszero()) nrOfFailedTestCases++;
-			p.setnar();  p = 0;
-			if (!p.iszero()) nrOfFailedTestCases++;
-
-			p = 1;
-			if (!p.isone()) nrOfFailedTestCases++;
-			for (size_t i = 0; i < NR_OF_TESTS; ++i) {
-				if (!p.isnar()) {
-					long long ref = (long long)p;
-					areal<nbits,es> presult = ref;
-					if (presult != ref) {
-						if (bReportIndividualTestCases) std::cout << tag << " FAIL " << p << " != " << ref << std::endl;
-					}
-					else {
-						if (bReportIndividualTestCases) std::cout << tag << " PASS " << p << " == " << ref << std::endl;
-					}
-				}
-				++p;
+			const long long RANGE = (1ll << (nbits + 2));
+			int nrOfFailedTests = 0;
+			areal<nbits, es> pa, pref;
+			for (long long i = -RANGE; i <= RANGE; ++i) {
+				pa = i;
+				pref = TruncatedReference<nbits, es>(double(i), 0);
+				nrOfFailedTests += Compare(double(i), pa, pref, bReportIndividualTestCases);
 			}
-			return nrOfFailedTestCases;
+			for (int shift = 0; shift < 63; ++shift) {
+				long long v = (1ll << shift);
+				pa = v;
+				pref = TruncatedReference<nbits, es>(double(v), 0);
+				nrOfFailedTests += Compare(double(v), pa, pref, bReportIndividualTestCases);
+				pa = -v;
+				pref = -pref;
+				nrOfFailedTests += Compare(double(-v), pa, pref, bReportIndividualTestCases);
+				pa = (unsigned long long)(v) << 1;
+				pref = TruncatedReference<nbits, es>(std::ldexp(1.0, shift + 1), 0);
+				nrOfFailedTests += Compare(std::ldexp(1.0, shift + 1), pa, pref, bReportIndividualTestCases);
+			}
+			if (bReportIndividualTestCases && nrOfFailedTests) std::cout << tag << " integer conversion failures: " << nrOfFailedTests << std::endl;
+			return nrOfFailedTests;
 		}
 
-		// Generate ordered set in ascending order from [-NaR, -maxpos, ..., +maxpos] for a particular areal config <nbits, es>
+		// Generate ordered set in ascending order from [-inf, -maxpos, ..., +maxpos, +inf] for a particular areal config <nbits, es>:
+		// the exact encodings without the NaNs, and without -0, which compares equal to +0
 		template<size_t nbits, size_t es>
 		void GenerateOrderedPositSet(std::vector<areal<nbits, es>>& set) {
-			const size_t NR_OF_REALS = (unsigned(1) << nbits);		// don't do this for state spaces larger than 4G
-			std::vector< areal<nbits, es> > s(NR_OF_REALS);
+			const size_t NR_OF_REALS = (size_t(1) << nbits);		// don't do this for state spaces larger than 4G
+			std::vector< areal<nbits, es> > s;
 			areal<nbits, es> p;
-			// generate raw set, which will sort later
 			for (size_t i = 0; i < NR_OF_REALS; i++) {
 				p.set_raw_bits(i);
-				s[i] = p;
+				if (p.isnan() || (p.iszero() && p.sign())) continue;
+				s.push_back(p);
 			}
-			// sort the set
 			std::sort(s.begin(), s.end());
 			set = s;
 		}
 
-		// validate the increment operator++
+		// the increment and decrement step to the neighbor in the ordered set, and clear the ubit of an uncertain operand
 		template<size_t nbits, size_t es>
-		int ValidateIncrement(std::string tag, bool bReportIndividualTestCases)
-		{
+		int ValidateStep(std::string tag, bool bReportIndividualTestCases, bool up, bool prefix) {
 			std::vector< areal<nbits, es> > set;
-			GenerateOrderedPositSet(set); // [NaR, -maxpos, ..., -minpos, 0, minpos, ..., maxpos]
+			GenerateOrderedPositSet(set); // [-inf, -maxpos, ..., -minpos, 0, minpos, ..., maxpos, inf]
 
 			int nrOfFailedTestCases = 0;
-
-			areal<nbits, es> p, ref;
-			// starting from NaR iterating from -maxpos to maxpos through zero
-			for (typename std::vector < areal<nbits, es> >::iterator it = set.begin(); it != set.end() - 1; it++) {
-				p = *it;
-				p++;
-				ref = *(it + 1);
-				if (p != ref) {
-					if (bReportIndividualTestCases) std::cout << tag << " FAIL " << p << " != " << ref << std::endl;
-					nrOfFailedTestCases++;
+			areal<nbits, es> p, ref, result;
+			for (size_t i = 0; i + 1 < set.size(); ++i) {
+				for (int ubit = 0; ubit < 2; ++ubit) {
+					p = set[up ? i : i + 1];
+					p.setubit(ubit != 0);
+					areal<nbits, es> before = p;
+					ref = set[up ? i + 1 : i];
+					if (prefix) {
+						result = (up ? ++p : --p);
+					}
+					else {
+						result = (up ? p++ : p--);
+						if (!Identical(result, before)) {
+							if (bReportIndividualTestCases) std::cout << tag << " FAIL postfix returned " << result << " instead of " << before << std::endl;
+							nrOfFailedTestCases++;
+						}
+						result = p;
+					}
+					// the step up from -minpos is -0, like the nextUp of IEEE-754, which the set holds as +0
+					if (ref.iszero() && p.iszero()) ref.set_raw_bits(p.encoding());
+					if (!Identical(p, ref) || !Identical(result, ref)) {
+						if (bReportIndividualTestCases) std::cout << tag << " FAIL " << components(p) << " != " << components(ref) << std::endl;
+						nrOfFailedTestCases++;
+					}
 				}
 			}
-
 			return nrOfFailedTestCases;
 		}
 
-		// validate the decrement operator--
+		// validate the prefix operator++ and postfix operator++
 		template<size_t nbits, size_t es>
-		int ValidateDecrement(std::string tag, bool bReportIndividualTestCases)
-		{
-			std::vector< areal<nbits, es> > set;
-			GenerateOrderedPositSet(set); // [NaR, -maxpos, ..., -minpos, 0, minpos, ..., maxpos]
-
-			int nrOfFailedTestCases = 0;
-
-			areal<nbits, es> p, ref;
-			// starting from maxpos iterating to -maxpos, and finally NaR via zero
-			for (typename std::vector < areal<nbits, es> >::iterator it = set.end() - 1; it != set.begin(); it--) {
-				p = *it;
-				p--;
-				ref = *(it - 1);
-				if (p != ref) {
-					if (bReportIndividualTestCases) std::cout << tag << " FAIL " << p << " != " << ref << std::endl;
-					nrOfFailedTestCases++;
-				}
-			}
-
-			return nrOfFailedTestCases;
+		int ValidateIncrement(std::string tag, bool bReportIndividualTestCases) {
+			return ValidateStep<nbits, es>(tag, bReportIndividualTestCases, true, true) + ValidateStep<nbits, es>(tag, bReportIndividualTestCases, true, false);
 		}
 
-		// validate the postfix operator++
+		// validate the prefix operator-- and postfix operator--
 		template<size_t nbits, size_t es>
-		int ValidatePostfix(std::string tag, bool bReportIndividualTestCases)
-		{
-			std::vector< areal<nbits, es> > set;
-			GenerateOrderedPositSet(set);  // [NaR, -maxpos, ..., -minpos, 0, minpos, ..., maxpos]
-
-			int nrOfFailedTestCases = 0;
+		int ValidateDecrement(std::string tag, bool bReportIndividualTestCases) {
+			return ValidateStep<nbits, es>(tag, bReportIndividualTestCases, false, true) + ValidateStep<nbits, es>(tag, bReportIndividualTestCases, false, false);
+		}
 
-			areal<nbits, es> p, ref;
-			// from -maxpos to maxpos through zero
-			for (typename std::vector < areal<nbits, es> >::iterator it = set.begin(); it != set.end() - 1; it++) {
-				p = *it;
-				p++;
-				ref = *(it + 1);
-				if (p != ref) {
-					if (bReportIndividualTestCases) std::cout << tag << " FAIL " << p << " != " << ref << std::endl;
-					nrOfFailedTestCases++;
-				}
-			}
+		// validate the postfix operators, which return the operand before the step
+		template<size_t nbits, size_t es>
+		int ValidatePostfix(std::string tag, bool bReportIndividualTestCases) {
+			return ValidateStep<nbits, es>(tag, bReportIndividualTestCases, true, false) + ValidateStep<nbits, es>(tag, bReportIndividualTestCases, false, false);
+		}
 
-			return nrOfFailedTestCases;
+		// validate the prefix operators, which return the operand after the step
+		template<size_t nbits, size_t es>
+		int ValidatePrefix(std::string tag, bool bReportIndividualTestCases) {
+			return ValidateStep<nbits, es>(tag, bReportIndividualTestCases, true, true) + ValidateStep<nbits, es>(tag, bReportIndividualTestCases, false, true);
 		}
 
-		// validate the prefix operator++
+		/*
+		The comparisons order the values, with the ubit as the least significant bit of the magnitude: the uncertain
+		interval that starts at a value orders next to it on the side away from zero. NaN is unordered, and -0 == +0.
+		The reference compares the double values, and breaks the ties with the side of the ubit.
+		*/
 		template<size_t nbits, size_t es>
-		int ValidatePrefix(std::string tag, bool bReportIndividualTestCases)
-		{
-			std::vector< areal<nbits, es> > set;
-			GenerateOrderedPositSet(set);  // [NaR, -maxpos, ..., -minpos, 0, minpos, ..., maxpos]
+		int UncertainSide(const areal<nbits, es>& v) { return v.ubit() ? (v.sign() ? -1 : 1) : 0; }
 
+		template<size_t nbits, size_t es>
+		int ValidateLogic(int opcode) {
+			const size_t NR_VALUES = (size_t(1) << nbits);
 			int nrOfFailedTestCases = 0;
-
-			areal<nbits, es> p, ref;
-			// from -maxpos to maxpos through zero
-			for (typename std::vector < areal<nbits, es> >::iterator it = set.begin(); it != set.end() - 1; it++) {
-				p = *it;
-				++p;
-				ref = *(it + 1);
-				if (p != ref) {
-					if (bReportIndividualTestCases) std::cout << tag << " FAIL " << p << " != " << ref << std::endl;
-					nrOfFailedTestCases++;
+			areal<nbits, es> a, b;
+			for (size_t i = 0; i < 2 * NR_VALUES; i++) {
+				a.set_raw_bits(i % NR_VALUES);
+				a.setubit(i >= NR_VALUES && !a.isnan() && !a.isinf());
+				for (size_t j = 0; j < 2 * NR_VALUES; j++) {
+					b.set_raw_bits(j % NR_VALUES);
+					b.setubit(j >= NR_VALUES && !b.isnan() && !b.isinf());
+					bool ref = false, presult = false;
+					double da = double(a), db = double(b);
+					int ta = UncertainSide(a), tb = UncertainSide(b);
+					bool unordered = a.isnan() || b.isnan();
+					bool less = !unordered && (da < db || (da == db && ta < tb));
+					bool equal = !unordered && da == db && ta == tb;
+					switch (opcode) {
+					case 0: ref = equal;                          presult = (a == b); break;
+					case 1: ref = !equal;                         presult = (a != b); break;
+					case 2: ref = less;                           presult = (a < b);  break;
+					case 3: ref = !unordered && !less && !equal;  presult = (a > b);  break;
+					case 4: ref = less || equal;                  presult = (a <= b); break;
+					case 5: ref = !unordered && !less;            presult = (a >= b); break;
+					}
+					if (ref != presult) {
+						nrOfFailedTestCases++;
+						std::cout << components(a) << " op" << opcode << " " << components(b) << " fails: reference is " << ref << " actual is " << presult << std::endl;
+					}
 				}
 			}
-
 			return nrOfFailedTestCases;
 		}
 
-		// enumerate all negation cases for a areal configuration: executes within 10 sec till about nbits = 14
 		template<size_t nbits, size_t es>
-		int ValidateNegation(std::string tag, bool bReportIndividualTestCases) {
-			constexpr size_t NR_TEST_CASES = (size_t(1) << nbits);
-			int nrOfFailedTests = 0;
-			areal<nbits, es> pa(0), pneg(0), pref(0);
+		int ValidateArealLogicEqual() { return ValidateLogic<nbits, es>(0); }
+		template<size_t nbits, size_t es>
+		int ValidateArealLogicNotEqual() { return ValidateLogic<nbits, es>(1); }
+		template<size_t nbits, size_t es>
+		int ValidateArealLogicLessThan() { return ValidateLogic<nbits, es>(2); }
+		template<size_t nbits, size_t es>
+		int ValidateArealLogicGreaterThan() { return ValidateLogic<nbits, es>(3); }
+		template<size_t nbits, size_t es>
+		int ValidateArealLogicLessOrEqualThan() { return ValidateLogic<nbits, es>(4); }
+		template<size_t nbits, size_t es>
+		int ValidateArealLogicGreaterOrEqualThan() { return ValidateLogic<nbits, es>(5); }
 
-			double da;
-			for (size_t i = 1; i < NR_TEST_CASES; i++) {
-				pa.set_raw_bits(i);
-				pneg = -pa;
-				// generate reference
-				da = double(pa);
-				pref = -da;
-				if (pneg != pref) {
-					nrOfFailedTests++;
-					if (bReportIndividualTestCases)	ReportUnaryArithmeticError("FAIL", "-", pa, pref, pneg);
-				}
-				else {
-					//if (bReportIndividualTestCases) ReportUnaryArithmeticSuccess("PASS", "-", pa, pref, pneg);
-				}
+		// operation opcodes
+		const int OPCODE_NOP = 0;
+		const int OPCODE_ADD = 1;
+		const int OPCODE_SUB = 2;
+		const int OPCODE_MUL = 3;
+		const int OPCODE_DIV = 4;
+		const int OPCODE_SQRT = 5;
+
+		inline std::string OperationString(int opcode) {
+			switch (opcode) {
+			case OPCODE_ADD:  return "+";
+			case OPCODE_SUB:  return "-";
+			case OPCODE_MUL:  return "*";
+			case OPCODE_DIV:  return "/";
+			case OPCODE_SQRT: return "sqrt";
+			default:          return "nop";
 			}
-			return nrOfFailedTests;
 		}
 
-#if SQRT_IMPLEMENTED
-		// enumerate all SQRT cases for a areal configuration: executes within 10 sec till about nbits = 14
 		template<size_t nbits, size_t es>
-		int ValidateSqrt(std::string tag, bool bReportIndividualTestCases) {
-			constexpr size_t NR_TEST_CASES = (size_t(1) << nbits);
-			int nrOfFailedTests = 0;
-			areal<nbits, es> pa, psqrt, pref;
-
-			double da;
-			for (size_t i = 1; i < NR_TEST_CASES; i++) {
-				pa.set_raw_bits(i);
-				psqrt = sw::unum::sqrt(pa);
-				// generate reference
-				da = double(pa);
-				pref = std::sqrt(da);
-				if (psqrt != pref) {
-					nrOfFailedTests++;
-					if (bReportIndividualTestCases)	ReportUnaryArithmeticError("FAIL", "sqrt", pa, pref, psqrt);
-				}
-				else {
-					//if (bReportIndividualTestCases) ReportUnaryArithmeticSuccess("PASS", "sqrt", pa, pref, psqrt);
-				}
+		void execute(int opcode, const areal<nbits, es>& pa, const areal<nbits, es>& pb, areal<nbits, es>& preference, areal<nbits, es>& presult) {
+			double da = double(pa), db = double(pb), r;
+			switch (opcode) {
+			default:
+			case OPCODE_NOP:
+				preference.setzero();
+				presult.setzero();
+				return;
+			case OPCODE_ADD:
+				presult = pa + pb;
+				r = da + db;
+				preference = TruncatedReference<nbits, es>(r, SumError(da, db, r));
+				break;
+			case OPCODE_SUB:
+				presult = pa - pb;
+				r = da - db;
+				preference = TruncatedReference<nbits, es>(r, SumError(da, -db, r));
+				break;
+			case OPCODE_MUL:
+				presult = pa * pb;
+				r = da * db;
+				preference = TruncatedReference<nbits, es>(r, ProductError(da, db, r));
+				break;
+			case OPCODE_DIV:
+				presult = pa / pb;
+				r = da / db;
+				preference = TruncatedReference<nbits, es>(r, QuotientError(da, db, r));
+				break;
+			case OPCODE_SQRT:
+				presult = sqrt(pa);
+				r = std::sqrt(da);
+				preference = TruncatedReference<nbits, es>(r, RootError(da, r));
+				break;
 			}
-			return nrOfFailedTests;
 		}
-#endif
 
-		// enumerate all addition cases for a areal configuration: is within 10sec till about nbits = 14
+		// enumerate all operand pairs of the binary operator of opcode on exact operands
 		template<size_t nbits, size_t es>
-		int ValidateAddition(std::string tag, bool bReportIndividualTestCases) {
-			const size_t NR_POSITS = (size_t(1) << nbits);
+		int ValidateBinaryOperator(std::string tag, bool bReportIndividualTestCases, int opcode) {
+			const size_t NR_VALUES = (size_t(1) << nbits);
 			int nrOfFailedTests = 0;
-			areal<nbits, es> pa, pb, psum, pref;
-
-			double da, db;
-			for (size_t i = 0; i < NR_POSITS; i++) {
+			areal<nbits, es> pa, pb, presult, preference;
+			for (size_t i = 0; i < NR_VALUES; i++) {
 				pa.set_raw_bits(i);
-				da = double(pa);
-				for (size_t j = 0; j < NR_POSITS; j++) {
+				for (size_t j = 0; j < NR_VALUES; j++) {
 					pb.set_raw_bits(j);
-					db = double(pb);
-					pref = da + db;
-#if POSIT_THROW_ARITHMETIC_EXCEPTION
-					try {
-						psum = pa + pb;
-					}
-					catch (const operand_is_nar& err) {
-						if (pa.isnar() || pb.isnar()) {
-							// correctly caught the exception
-							psum.setnar();
-						}
-						else {
-							throw err;
-						}
-					}
-
-#else
-					psum = pa + pb;
-#endif
-					if (psum != pref) {
+					execute(opcode, pa, pb, preference, presult);
+					if (!Identical(presult, preference)) {
 						nrOfFailedTests++;
-						if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "+", pa, pb, pref, psum);
-					}
-					else {
-						//if (bReportIndividualTestCases) ReportBinaryArithmeticSuccess("PASS", "+", pa, pb, pref, psum);
+						if (bReportIndividualTestCases) ReportBinaryArithmeticError(tag, OperationString(opcode), pa, pb, preference, presult);
 					}
 				}
 			}
-
 			return nrOfFailedTests;
 		}
 
-		// enumerate all subtraction cases for a areal configuration: is within 10sec till about nbits = 14
+		template<size_t nbits, size_t es>
+		int ValidateAddition(std::string tag, bool bReportIndividualTestCases) {
+			return ValidateBinaryOperator<nbits, es>(tag, bReportIndividualTestCases, OPCODE_ADD);
+		}
 		template<size_t nbits, size_t es>
 		int ValidateSubtraction(std::string tag, bool bReportIndividualTestCases) {
-			const size_t NR_POSITS = (size_t(1) << nbits);
-			int nrOfFailedTests = 0;
-			areal<nbits, es> pa, pb, pref, pdif;
-
-			double da, db;
-			for (size_t i = 0; i < NR_POSITS; i++) {
-				pa.set_raw_bits(i);
-				da = double(pa);
-				for (size_t j = 0; j < NR_POSITS; j++) {
-					pb.set_raw_bits(j);
-					db = double(pb);
-					pref = da - db;
-#if POSIT_THROW_ARITHMETIC_EXCEPTION
-					try {
-						pdif = pa - pb;
-					}
-					catch (const operand_is_nar& err) {
-						if (pa.isnar() || pb.isnar()) {
-							// correctly caught the exception
-							pdif.setnar();
-						}
-						else {
-							throw err;
-						}
-					}
-#else
-					pdif = pa - pb;
-#endif
-					if (pdif != pref) {
-						nrOfFailedTests++;
-						if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "-", pa, pb, pref, pdif);
-					}
-					else {
-						//if (bReportIndividualTestCases) ReportBinaryArithmeticSuccess("PASS", "-", pa, pb, pref, pdif);
-					}
-				}
-			}
-
-			return nrOfFailedTests;
+			return ValidateBinaryOperator<nbits, es>(tag, bReportIndividualTestCases, OPCODE_SUB);
 		}
-
-		// enumerate all multiplication cases for a areal configuration: is within 10sec till about nbits = 14
 		template<size_t nbits, size_t es>
 		int ValidateMultiplication(std::string tag, bool bReportIndividualTestCases) {
-			int nrOfFailedTests = 0;
-			const size_t NR_POSITS = (size_t(1) << nbits);
-
-			areal<nbits, es> pa, pb, pmul, pref;
-			double da, db;
-			for (size_t i = 0; i < NR_POSITS; i++) {
-				pa.set_raw_bits(i);
-				da = double(pa);
-				for (size_t j = 0; j < NR_POSITS; j++) {
-					pb.set_raw_bits(j);
-					db = double(pb);
-					pref = da * db;
-#if POSIT_THROW_ARITHMETIC_EXCEPTION
-					try {
-						pmul = pa * pb;
-					}
-					catch (const operand_is_nar& err) {
-						if (pa.isnar() || pb.isnar()) {
-							// correctly caught the exception
-							pmul.setnar();
-						}
-						else {
-							throw err;
-						}
-					}
-#else
-					pmul = pa * pb;
-#endif
-					if (pmul != pref) {
-						if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "*", pa, pb, pref, pmul);
-						nrOfFailedTests++;
-					}
-					else {
-						//if (bReportIndividualTestCases) ReportBinaryArithmeticSuccess("PASS", "*", pa, pb, pref, pmul);
-					}
-				}
-			}
-			return nrOfFailedTests;
+			return ValidateBinaryOperator<nbits, es>(tag, bReportIndividualTestCases, OPCODE_MUL);
+		}
+		template<size_t nbits, size_t es>
+		int ValidateDivision(std::string tag, bool bReportIndividualTestCases) {
+			return ValidateBinaryOperator<nbits, es>(tag, bReportIndividualTestCases, OPCODE_DIV);
 		}
 
-		// enerate all reciprocation cases for a areal configuration: executes within 10 sec till about nbits = 14
+		// enumerate all operands of the square root
 		template<size_t nbits, size_t es>
-		int ValidateReciprocation(std::string tag, bool bReportIndividualTestCases) {
-			const size_t NR_TEST_CASES = (size_t(1) << nbits);
+		int ValidateSqrt(std::string tag, bool bReportIndividualTestCases) {
+			const size_t NR_VALUES = (size_t(1) << nbits);
 			int nrOfFailedTests = 0;
-			areal<nbits, es> pa, preciprocal, preference;
-
-			double da;
-			for (size_t i = 0; i < NR_TEST_CASES; i++) {
+			areal<nbits, es> pa, presult, preference;
+			for (size_t i = 0; i < NR_VALUES; i++) {
 				pa.set_raw_bits(i);
-				// generate reference
-				if (pa.isnar()) {
-					preference.setnar();
-				}
-				else {
-					da = double(pa);
-					preference = 1.0 / da;
-				}
-				preciprocal = pa.reciprocate();
-
-				if (preciprocal != preference) {
+				execute(OPCODE_SQRT, pa, pa, preference, presult);
+				if (!Identical(presult, preference)) {
 					nrOfFailedTests++;
-					if (bReportIndividualTestCases)	ReportUnaryArithmeticError("FAIL", "reciprocate", pa, preference, preciprocal);
-				}
-				else {
-					//if (bReportIndividualTestCases) ReportUnaryArithmeticSuccess("PASS", "reciprocate", pa, preference, preciprocal);
+					if (bReportIndividualTestCases) ReportUnaryArithmeticError(tag, "sqrt", pa, preference, presult);
 				}
 			}
 			return nrOfFailedTests;
 		}
 
-		// enumerate all division cases for a areal configuration: is within 10sec till about nbits = 14
+		// the ubit of an operand is sticky: the result of uncertain operands is the result of the exact operands with the ubit set,
+		// except for the infinite and NaN results, which are exact. The ubit flags the result without widening it by the
+		// uncertainty of the operands, so that 1.5u * 1.5u is 2.25u: the uncertain lhs, rhs, and both operands take the same result
 		template<size_t nbits, size_t es>
-		int ValidateDivision(std::string tag, bool bReportIndividualTestCases) {
+		int ValidateUncertainty(std::string tag, bool bReportIndividualTestCases, int opcode) {
+			const size_t NR_VALUES = (size_t(1) << nbits);
 			int nrOfFailedTests = 0;
-			const size_t NR_POSITS = (size_t(1) << nbits);
-
-			areal<nbits, es> pa, pb, pdiv, pref;
-			double da, db;
-			for (size_t i = 0; i < NR_POSITS; i++) {
+			areal<nbits, es> pa, pb, ua, ub, presult, preference;
+			for (size_t i = 0; i < NR_VALUES; i++) {
 				pa.set_raw_bits(i);
-				da = double(pa);
-				for (size_t j = 0; j < NR_POSITS; j++) {
+				for (size_t j = 0; j < NR_VALUES; j++) {
 					pb.set_raw_bits(j);
-					db = double(pb);
-					if (pb.isnar()) {
-						pref.setnar();
-					}
-					else {
-						pref = da / db;
-					}
-#if POSIT_THROW_ARITHMETIC_EXCEPTION
-					try {
-						pdiv = pa / pb;
-					}
-					catch (const divide_by_zero& err) {
-						if (pb.iszero()) {
-							// correctly caught the divide by zero condition
-							continue;
-							//pdiv.setnar();
-						}
-						else {
-							if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "/", pa, pb, pref, pdiv);
-							throw err; // rethrow
+					execute(opcode, pa, pb, preference, presult);
+					if (!preference.isinf() && !preference.isnan()) preference.setubit(true);
+					// the square root has a single operand
+					for (int uncertain = 1; uncertain < (opcode == OPCODE_SQRT ? 2 : 4); ++uncertain) {
+						ua.set_raw_bits(i, (uncertain & 1) != 0);
+						ub.set_raw_bits(j, (uncertain & 2) != 0);
+						switch (opcode) {
+						case OPCODE_ADD:  presult = ua + ub; break;
+						case OPCODE_SUB:  presult = ua - ub; break;
+						case OPCODE_MUL:  presult = ub * ua; break;
+						case OPCODE_DIV:  presult = ua / ub; break;
+						case OPCODE_SQRT: presult = sqrt(ua); break;
 						}
-					}
-					catch (const divide_by_nar& err) {
-						if (pb.isnar()) {
-							// correctly caught the divide by nar condition
-							continue;
-							//pdiv = 0.0f;
-						}
-						else {
-							if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "/", pa, pb, pref, pdiv);
-							throw err; // rethrow
-						}
-					}
-					catch (const numerator_is_nar& err) {
-						if (pa.isnar()) {
-							// correctly caught the numerator is nar condition
-							continue;
-							//pdiv.setnar();
-						}
-						else {
-							if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "/", pa, pb, pref, pdiv);
-							throw err; // rethrow
+						if (!Identical(presult, preference)) {
+							nrOfFailedTests++;
+							if (bReportIndividualTestCases) ReportBinaryArithmeticError(tag, OperationString(opcode), ua, ub, preference, presult);
 						}
 					}
-#else
-					pdiv = pa / pb;
-#endif
-					// check against the IEEE reference
-					if (pdiv != pref) {
-						if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "/", pa, pb, pref, pdiv);
-						nrOfFailedTests++;
-					}
-					else {
-						//if (bReportIndividualTestCases) ReportBinaryArithmeticSuccess("PASS", "/", pa, pb, pref, pdiv);
-					}
-
 				}
 			}
 			return nrOfFailedTests;
 		}
 
-		// Posit equal diverges from IEEE float in dealing with INFINITY/NAN
-		// Posit NaR can be checked for equality/inequality
-		template<size_t nbits, size_t es>
-		int ValidatePositLogicEqual() {
-			const size_t NR_TEST_CASES = (unsigned(1) << nbits);
-			int nrOfFailedTestCases = 0;
-			sw::unum::areal<nbits, es> a, b;
-			bool ref, presult;
-
-			for (unsigned i = 0; i < NR_TEST_CASES; i++) {
-				a.set_raw_bits(i);
-				for (unsigned j = 0; j < NR_TEST_CASES; j++) {
-					b.set_raw_bits(j);
-					// set the golden reference
-					if (a.isnar() && b.isnar()) {
-						// special case of areal equality
-						ref = true;
-					}
-					else {
-						// initially, we thought this would be the same behavior as IEEE floats
-						// ref = double(a) == double(b);
-						// but we have found that some compilers (MSVC) take liberty with NaN
-						// \fp:fast		floating point model set to fast
-						//	NaN == NaN  : IEEE = true    Posit = true
-						//	NaN == real : IEEE = true    Posit = false
-						// \fp:strict	floating point model set to strict
-						//	NaN == NaN  : IEEE = false    Posit = true
-						//	NaN == real : IEEE = false    Posit = false
-						// and thus we can't relay on IEEE float as reference
-
-						// instead, use the bit pattern as reference
-						ref = (i == j ? true : false);
-					}
-
-					presult = a == b;
-					if (ref != presult) {
-						nrOfFailedTestCases++;
-						std::cout << a << " == " << b << " fails: reference is " << ref << " actual is " << presult << std::endl;
-					}
-				}
-			}
-			return nrOfFailedTestCases;
-		}
-
-		// Posit not-equal diverges from IEEE float in dealing with INFINITY/NAN
-		// Posit NaR can be checked for equality/inequality
-		template<size_t nbits, size_t es>
-		int ValidatePositLogicNotEqual() {
-			const size_t NR_TEST_CASES = (unsigned(1) << nbits);
-			int nrOfFailedTestCases = 0;
-			sw::unum::areal<nbits, es> a, b;
-			bool ref, presult;
-
-			for (unsigned i = 0; i < NR_TEST_CASES; i++) {
-				a.set_raw_bits(i);
-				for (unsigned j = 0; j < NR_TEST_CASES; j++) {
-					b.set_raw_bits(j);
-
-					// set the golden reference
-					if (a.isnar() && b.isnar()) {
-						// special case of areal equality
-						ref = false;
-					}
-					else {
-						// initially, we thought this would be the same behavior as IEEE floats
-						// ref = double(a) == double(b);
-						// but we have found that some compilers (MSVC) take liberty with NaN
-						// \fp:fast		floating point model set to fast
-						//	NaN == NaN  : IEEE = true    Posit = true
-						//	NaN == real : IEEE = true    Posit = false
-						// \fp:strict	floating point model set to strict
-						//	NaN == NaN  : IEEE = false    Posit = true
-						//	NaN == real : IEEE = false    Posit = false
-						// and thus we can't relay on IEEE float as reference
-
-						// instead, use the bit pattern as reference
-						ref = (i != j ? true : false);
-					}
-
-					presult = a != b;
-
-					if (ref != presult) {
-						nrOfFailedTestCases++;
-						std::cout << a << " != " << b << " fails: reference is " << ref << " actual is " << presult << std::endl;
-					}
-				}
-			}
-			return nrOfFailedTestCases;
-		}
-
-		// Posit less-than diverges from IEEE float in dealing with INFINITY/NAN
-		// Posit NaR is smaller than any other value
-		template<size_t nbits, size_t es>
-		int ValidatePositLogicLessThan() {
-			const size_t NR_TEST_CASES = (unsigned(1) << nbits);
-			int nrOfFailedTestCases = 0;
-			sw::unum::areal<nbits, es> a, b;
-			bool ref, presult;
-
-			for (unsigned i = 0; i < NR_TEST_CASES; i++) {
-				a.set_raw_bits(i);
-				for (unsigned j = 0; j < NR_TEST_CASES; j++) {
-					b.set_raw_bits(j);
-
-					// generate the golden reference
-					if (a.isnar() && !b.isnar()) {
-						// special case of areal NaR
-						ref = true;
-					}
-					else {
-						// same behavior as IEEE floats
-						ref = double(a) < double(b);
-					}
-
-					presult = a < b;
-					if (ref != presult) {
-						nrOfFailedTestCases++;
-						std::cout << a << " < " << b << " fails: reference is " << ref << " actual is " << presult << std::endl;
-					}
-				}
-			}
-			return nrOfFailedTestCases;
-		}
-
-		// Posit greater-than diverges from IEEE float in dealing with INFINITY/NAN
-		// Any number is greater-than areal NaR
-		template<size_t nbits, size_t es>
-		int ValidatePositLogicGreaterThan() {
-			const size_t NR_TEST_CASES = (unsigned(1) << nbits);
-			int nrOfFailedTestCases = 0;
-			sw::unum::areal<nbits, es> a, b;
-			bool ref, presult;
-
-			for (unsigned i = 0; i < NR_TEST_CASES; i++) {
-				a.set_raw_bits(i);
-				for (unsigned j = 0; j < NR_TEST_CASES; j++) {
-					b.set_raw_bits(j);
-
-					// generate the golden reference
-					if (!a.isnar() && b.isnar()) {
-						// special case of areal NaR
-						ref = true;
-					}
-					else {
-						// same behavior as IEEE floats
-						ref = double(a) > double(b);
-					}
-
-					presult = a > b;
-					if (ref != presult) {
-						nrOfFailedTestCases++;
-						std::cout << a << " > " << b << " fails: reference is " << ref << " actual is " << presult << std::endl;
-					}
-				}
-			}
-			return nrOfFailedTestCases;
-		}
-
-		// Posit less-or-equal-than diverges from IEEE float in dealing with INFINITY/NAN
-		// Posit NaR is smaller or equal than any other value
+		// exact and uncertain negation
 		template<size_t nbits, size_t es>
-		int ValidatePositLogicLessOrEqualThan() {
-			const size_t NR_TEST_CASES = (unsigned(1) << nbits);
-			int nrOfFailedTestCases = 0;
-			sw::unum::areal<nbits, es> a, b;
-			bool ref, presult;
-
-			for (unsigned i = 0; i < NR_TEST_CASES; i++) {
-				a.set_raw_bits(i);
-				for (unsigned j = 0; j < NR_TEST_CASES; j++) {
-					b.set_raw_bits(j);
-
-					// set the golden reference
-					if (a.isnar()) {
-						// special case of areal <= for NaR
-						ref = true;
-					}
-					else {
-						// same behavior as IEEE floats
-						ref = double(a) <= double(b);
-					}
-
-					presult = a <= b;
-
-					if (ref != presult) {
-						nrOfFailedTestCases++;
-						std::cout << a << " <= " << b << " fails: reference is " << ref << " actual is " << presult << std::endl;
-					}
-				}
-			}
-			return nrOfFailedTestCases;
-		}
-
-		// Posit greater-or-equal-than diverges from IEEE float in dealing with INFINITY/NAN
-		// Any number is greater-or-equal-than areal NaR
-		template<size_t nbits, size_t es>
-		int ValidatePositLogicGreaterOrEqualThan() {
-			const size_t NR_TEST_CASES = (unsigned(1) << nbits);
-			int nrOfFailedTestCases = 0;
-			sw::unum::areal<nbits, es> a, b;
-			bool ref, presult;
-
-			for (unsigned i = 0; i < NR_TEST_CASES; i++) {
-				a.set_raw_bits(i);
-				for (unsigned j = 0; j < NR_TEST_CASES; j++) {
-					b.set_raw_bits(j);
-
-					// set the golden reference
-					if (b.isnar()) {
-						// special case of areal >= for NaR
-						ref = true;
-					}
-					else {
-						// same behavior as IEEE floats
-						ref = double(a) >= double(b);
-					}
-
-					presult = a >= b;
-
-					if (ref != presult) {
-						nrOfFailedTestCases++;
-						std::cout << a << " >= " << b << " fails: reference is " << ref << " actual is " << presult << std::endl;
-					}
+		int ValidateNegation(std::string tag, bool bReportIndividualTestCases) {
+			const size_t NR_VALUES = (size_t(1) << nbits);
+			int nrOfFailedTests = 0;
+			areal<nbits, es> pa, pneg, pref;
+			for (size_t i = 0; i < 2 * NR_VALUES; i++) {
+				pa.set_raw_bits(i, i >= NR_VALUES);
+				pneg = -pa;
+				pref.set_raw_bits(i ^ (uint64_t(1) << (nbits - 1)), pa.ubit());
+				if (!Identical(pneg, pref) || (!pa.isnan() && double(pneg) != -double(pa))) {
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases) ReportUnaryArithmeticError(tag, "-", pa, pref, pneg);
 				}
 			}
-			return nrOfFailedTestCases;
+			return nrOfFailedTests;
 		}
 
 		//////////////////////////////////// RANDOMIZED TEST SUITE FOR BINARY OPERATORS ////////////////////////
 
 		// for testing areal configs that are > 14-15, we need a more efficient approach.
 		// One simple, brute force approach is to generate randoms.
-		// A more white box approach is to focus on the testcases 
-		// where something special happens in the areal arithmetic, such as rounding.
-
-		// operation opcodes
-		const int OPCODE_NOP = 0;
-		const int OPCODE_ADD = 1;
-		const int OPCODE_SUB = 2;
-		const int OPCODE_MUL = 3;
-		const int OPCODE_DIV = 4;
-		const int OPCODE_RAN = 5;
 
+		// random operands, with uniform bit patterns for the specials and the subnormals, and small magnitudes more often
 		template<size_t nbits, size_t es>
-		void execute(int opcode, double da, double db, const areal<nbits, es>& pa, const areal<nbits, es>& pb, areal<nbits, es>& preference, areal<nbits, es>& presult) {
-			double reference = 0.0;
-			switch (opcode) {
-			default:
-			case OPCODE_NOP:
-				preference.setzero();
-				presult.setzero();
-				return;
-			case OPCODE_ADD:
-				presult = pa + pb;
-				reference = da + db;
-				break;
-			case OPCODE_SUB:
-				presult = pa - pb;
-				reference = da - db;
+		areal<nbits, es> RandomOperand(std::mt19937_64& eng) {
+			areal<nbits, es> v;
+			switch (eng() % 4) {
+			case 0:
+				v.set_raw_bits(eng());
 				break;
-			case OPCODE_MUL:
-				presult = pa * pb;
-				reference = da * db;
+			case 1:
+				v.set_raw_bits(eng() >> (eng() % 64));
 				break;
-			case OPCODE_DIV:
-				presult = pa / pb;
-				reference = da / db;
+			default:
+				v = double(int64_t(eng() % 2000001) - 1000000) / double(eng() % 1000 + 1);
+				v.setubit(false);
 				break;
 			}
-			preference = reference;
+			return v;
 		}
 
-		// generate a random set of operands to test the binary operators for a areal configuration
-		// Basic design is that we generate nrOfRandom areal values and store them in an operand array.
-		// We will then execute the binary operator nrOfRandom combinations.
 		template<size_t nbits, size_t es>
-		int ValidateBinaryOperatorThroughRandoms(std::string tag, bool bReportIndividualTestCases, int opcode, uint32_t nrOfRandoms) {
-			const size_t SIZE_STATE_SPACE = nrOfRandoms;
+		int ValidateThroughRandoms(std::string tag, bool bReportIndividualTestCases, int opcode, uint32_t nrOfRandoms) {
 			int nrOfFailedTests = 0;
+			std::mt19937_64 eng(opcode);
 			areal<nbits, es> pa, pb, presult, preference;
-
-			std::string operation_string;
-			switch (opcode) {
-			default:
-			case OPCODE_NOP:
-				operation_string = "nop";
-				break;
-			case OPCODE_ADD:
-				operation_string = "+";
-				break;
-			case OPCODE_SUB:
-				operation_string = "-";
-				break;
-			case OPCODE_MUL:
-				operation_string = "*";
-				break;
-			case OPCODE_DIV:
-				operation_string = "/";
-				break;
-			}
-			// generate the full state space set of valid areal values
-			std::random_device rd;     //Get a random seed from the OS entropy device, or whatever
-			std::mt19937_64 eng(rd()); //Use the 64-bit Mersenne Twister 19937 generator and seed it with entropy.
-									   //Define the distribution, by default it goes from 0 to MAX(unsigned long long)
-			std::uniform_int_distribution<unsigned long long> distr;
-#ifdef POSIT_USE_LONG_DOUBLE
-			std::vector<long double> operand_values(SIZE_STATE_SPACE);
-			for (uint32_t i = 0; i < SIZE_STATE_SPACE; i++) {
-				presult.set_raw_bits(distr(eng));  // take the bottom nbits bits as areal encoding
-				operand_values[i] = (long double)(presult);
-			}
-			long double da, db;
-#else // USE DOUBLE
-			std::vector<double> operand_values(SIZE_STATE_SPACE);
-			for (uint32_t i = 0; i < SIZE_STATE_SPACE; i++) {
-				presult.set_raw_bits(distr(eng));  // take the bottom nbits bits as areal encoding
-				operand_values[i] = double(presult);
-			}
-			double da, db;
-#endif // POSIT_USE_LONG_DOUBLE
-			unsigned ia, ib;  // random indices for picking operands to test
-			for (unsigned i = 1; i < nrOfRandoms; i++) {
-				ia = std::rand() % SIZE_STATE_SPACE;
-				da = operand_values[ia];
-				pa = da;
-				ib = std::rand() % SIZE_STATE_SPACE;
-				db = operand_values[ib];
-				pb = db;
-				// in case you have numeric_limits<long double>::digits trouble... this will show that
-				//std::cout << "sizeof da: " << sizeof(da) << " bits in significant " << (std::numeric_limits<long double>::digits - 1) << " value da " << da << " at index " << ia << " pa " << pa << std::endl;
-				//std::cout << "sizeof db: " << sizeof(db) << " bits in significant " << (std::numeric_limits<long double>::digits - 1) << " value db " << db << " at index " << ia << " pa " << pb << std::endl;
-#if POSIT_THROW_ARITHMETIC_EXCEPTION
-				try {
-					execute(opcode, da, db, pa, pb, preference, presult);
-				}
-				catch (const posit_arithmetic_exception& err) {
-					if (pa.isnar() || pb.isnar() || (opcode == OPCODE_DIV && pb.iszero())) {
-						std::cerr << "Correctly caught arithmetic exception: " << err.what() << std::endl;
-					}
-					else {
-						throw err;
-					}
-				}
-#else
-				execute(opcode, da, db, pa, pb, preference, presult);
-#endif
-				if (presult != preference) {
+			for (uint32_t i = 0; i < nrOfRandoms; i++) {
+				pa = RandomOperand<nbits, es>(eng);
+				pb = RandomOperand<nbits, es>(eng);
+				if (opcode == OPCODE_SQRT) pa = abs(pa);
+				execute(opcode, pa, pb, preference, presult);
+				if (!Identical(presult, preference)) {
 					nrOfFailedTests++;
-					if (bReportIndividualTestCases) ReportBinaryArithmeticErrorInBinary("FAIL", operation_string, pa, pb, preference, presult);
-				}
-				else {
-					//if (bReportIndividualTestCases) ReportBinaryArithmeticSuccessInBinary("PASS", operation_string, pa, pb, preference, presult);
+					if (bReportIndividualTestCases) ReportBinaryArithmeticError(tag, OperationString(opcode), pa, pb, preference, presult);
 				}
 			}
-
 			return nrOfFailedTests;
 		}
 
-
 	} // namespace unum
 
 } // namespace sw
-
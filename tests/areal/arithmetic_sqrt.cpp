@@ -0,0 +1,96 @@
+// arithmetic_sqrt.cpp: functional tests for the square root on arbitrary reals
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// minimum set of include files to reflect source code dependencies
+#include "universal/areal/areal.hpp"
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "areal_test_helpers.hpp"
+
+// generate specific test case that you can trace with the trace conditions in areal.hpp
+// for most bugs they are traceable with _trace_conversion and _trace_sqrt
+template<size_t nbits, size_t es, typename Ty>
+void GenerateTestCase(Ty a) {
+	Ty ref;
+	sw::unum::areal<nbits, es> pa, pref, presult;
+	pa = a;
+	ref = std::sqrt(a);
+	pref = ref;
+	presult = sw::unum::sqrt(pa);
+	std::cout << std::setprecision(nbits - 2);
+	std::cout << " sqrt(" << a << ") = " << std::setw(nbits) << ref << std::endl;
+	std::cout << " sqrt(" << pa.get() << ") = " << presult.get() << (presult.ubit() ? "..." : "") << " (reference: " << pref.get() << (pref.ubit() ? "..." : "") << ")   ";
+	std::cout << (Identical(pref, presult) ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << std::setprecision(5);
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "Sqrt failed: ";
+
+#if MANUAL_TESTING
+
+	// generate individual testcases to hand trace/debug
+	GenerateTestCase<8, 2, float>(2.0f);
+	GenerateTestCase<16, 5, double>(0.25);
+
+	// manual exhaustive test
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<8, 2>("Manual Testing", true), "areal<8,2>", "sqrt");
+
+#else
+
+	cout << "Arbitrary Real square root validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<4, 1>(tag, bReportIndividualTestCases), "areal<4,1>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<5, 2>(tag, bReportIndividualTestCases), "areal<5,2>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<6, 2>(tag, bReportIndividualTestCases), "areal<6,2>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<7, 3>(tag, bReportIndividualTestCases), "areal<7,3>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<8, 2>(tag, bReportIndividualTestCases), "areal<8,2>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<8, 3>(tag, bReportIndividualTestCases), "areal<8,3>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<8, 4>(tag, bReportIndividualTestCases), "areal<8,4>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<10, 3>(tag, bReportIndividualTestCases), "areal<10,3>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<12, 4>(tag, bReportIndividualTestCases), "areal<12,4>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<16, 5>(tag, bReportIndividualTestCases), "areal<16,5>", "sqrt");
+
+	// the ubit of the operand is sticky
+	nrOfFailedTestCases += ReportTestResult(ValidateUncertainty<8, 3>(tag, bReportIndividualTestCases, OPCODE_SQRT), "areal<8,3>", "uncertain sqrt");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<24, 8>(tag, bReportIndividualTestCases, OPCODE_SQRT, 100000), "areal<24,8>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<32, 8>(tag, bReportIndividualTestCases, OPCODE_SQRT, 100000), "areal<32,8>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<48, 8>(tag, bReportIndividualTestCases, OPCODE_SQRT, 100000), "areal<48,8>", "sqrt");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateSqrt<20, 6>(tag, bReportIndividualTestCases), "areal<20,6>", "sqrt");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<32, 8>(tag, bReportIndividualTestCases, OPCODE_SQRT, 10000000), "areal<32,8>", "sqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<60, 8>(tag, bReportIndividualTestCases, OPCODE_SQRT, 10000000), "areal<60,8>", "sqrt");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,108 @@
+// arithmetic_subtract.cpp: functional tests for subtraction on arbitrary reals
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// minimum set of include files to reflect source code dependencies
+#include "universal/areal/areal.hpp"
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "areal_test_helpers.hpp"
+
+// generate specific test case that you can trace with the trace conditions in areal.hpp
+// for most bugs they are traceable with _trace_conversion and _trace_sub
+template<size_t nbits, size_t es, typename Ty>
+void GenerateTestCase(Ty a, Ty b) {
+	Ty ref;
+	sw::unum::areal<nbits, es> pa, pb, pref, presult;
+	pa = a;
+	pb = b;
+	ref = a - b;
+	pref = ref;
+	presult = pa - pb;
+	std::cout << std::setprecision(nbits - 2);
+	std::cout << std::setw(nbits) << a << " - " << std::setw(nbits) << b << " = " << std::setw(nbits) << ref << std::endl;
+	std::cout << pa.get() << " - " << pb.get() << " = " << presult.get() << (presult.ubit() ? "..." : "") << " (reference: " << pref.get() << (pref.ubit() ? "..." : "") << ")   ";
+	std::cout << (Identical(pref, presult) ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << std::setprecision(5);
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "Subtraction failed: ";
+
+#if MANUAL_TESTING
+
+	// generate individual testcases to hand trace/debug
+	GenerateTestCase<8, 2, float>(0.5f, 0.375f);
+	GenerateTestCase<16, 5, double>(1.0, 3.0);
+
+	// manual exhaustive test
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 2>("Manual Testing", true), "areal<8,2>", "subtraction");
+
+#else
+
+	cout << "Arbitrary Real subtraction validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<4, 1>(tag, bReportIndividualTestCases), "areal<4,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<4, 2>(tag, bReportIndividualTestCases), "areal<4,2>", "subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<5, 1>(tag, bReportIndividualTestCases), "areal<5,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<5, 2>(tag, bReportIndividualTestCases), "areal<5,2>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<5, 3>(tag, bReportIndividualTestCases), "areal<5,3>", "subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<6, 2>(tag, bReportIndividualTestCases), "areal<6,2>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<6, 3>(tag, bReportIndividualTestCases), "areal<6,3>", "subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<7, 2>(tag, bReportIndividualTestCases), "areal<7,2>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<7, 3>(tag, bReportIndividualTestCases), "areal<7,3>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<7, 4>(tag, bReportIndividualTestCases), "areal<7,4>", "subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 2>(tag, bReportIndividualTestCases), "areal<8,2>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 3>(tag, bReportIndividualTestCases), "areal<8,3>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 4>(tag, bReportIndividualTestCases), "areal<8,4>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 5>(tag, bReportIndividualTestCases), "areal<8,5>", "subtraction");
+
+	// the ubit of an operand is sticky
+	nrOfFailedTestCases += ReportTestResult(ValidateUncertainty<6, 2>(tag, bReportIndividualTestCases, OPCODE_SUB), "areal<6,2>", "uncertain subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateUncertainty<8, 3>(tag, bReportIndividualTestCases, OPCODE_SUB), "areal<8,3>", "uncertain subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<16, 5>(tag, bReportIndividualTestCases, OPCODE_SUB, 100000), "areal<16,5>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<24, 8>(tag, bReportIndividualTestCases, OPCODE_SUB, 100000), "areal<24,8>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<32, 8>(tag, bReportIndividualTestCases, OPCODE_SUB, 100000), "areal<32,8>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<48, 8>(tag, bReportIndividualTestCases, OPCODE_SUB, 100000), "areal<48,8>", "subtraction");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<10, 3>(tag, bReportIndividualTestCases), "areal<10,3>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<12, 4>(tag, bReportIndividualTestCases), "areal<12,4>", "subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<32, 8>(tag, bReportIndividualTestCases, OPCODE_SUB, 10000000), "areal<32,8>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<60, 8>(tag, bReportIndividualTestCases, OPCODE_SUB, 10000000), "areal<60,8>", "subtraction");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+//  performance.cpp : performance benchmarking of the areal arithmetic against the native floating-point types
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+// configure the areal arithmetic class
+// enable the IEEE-754 hardware specializations of areal<32,8> and areal<64,11>
+#define AREAL_FAST_SPECIALIZATION
+#include <universal/areal/areal.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the number of operations per second of a kernel that performs nrOps operations
+template<typename Kernel>
+double OperationsPerSecond(uint64_t nrOps, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> time_span = duration_cast<duration<double>>(end - begin);
+	return double(nrOps) / time_span.count();
+}
+
+constexpr size_t VECTOR_SIZE = 1024;
+
+// the operators of Scalar element-wise on vectors of positive operands, the square root on the first vector
+template<typename Scalar, typename Add, typename Mul, typename Div, typename Sqrt>
+void ScalarPerformanceTest(const std::string& label, const std::vector<Scalar>& a, const std::vector<Scalar>& b, uint64_t nrOps, Add add, Mul mul, Div div, Sqrt root) {
+	using namespace std;
+	std::vector<Scalar> c(VECTOR_SIZE);
+	const uint64_t rounds = nrOps / VECTOR_SIZE;
+	double addps = OperationsPerSecond(nrOps, [&]() { for (uint64_t r = 0; r < rounds; ++r) for (size_t i = 0; i < VECTOR_SIZE; ++i) c[i] = add(a[i], b[(i + r) % VECTOR_SIZE]); });
+	double mulps = OperationsPerSecond(nrOps, [&]() { for (uint64_t r = 0; r < rounds; ++r) for (size_t i = 0; i < VECTOR_SIZE; ++i) c[i] = mul(a[i], b[(i + r) % VECTOR_SIZE]); });
+	double divps = OperationsPerSecond(nrOps, [&]() { for (uint64_t r = 0; r < rounds; ++r) for (size_t i = 0; i < VECTOR_SIZE; ++i) c[i] = div(a[i], b[(i + r) % VECTOR_SIZE]); });
+	double sqrtps = OperationsPerSecond(nrOps, [&]() { for (uint64_t r = 0; r < rounds; ++r) for (size_t i = 0; i < VECTOR_SIZE; ++i) c[i] = root(a[(i + r) % VECTOR_SIZE]); });
+	cout << setw(32) << left << label << right << setw(12) << addps << " add/sec " << setw(12) << mulps << " mul/sec " << setw(12) << divps << " div/sec " << setw(12) << sqrtps << " sqrt/sec" << endl;
+}
+
+// float against areal<32,8> with the hardware specialization and with the field arithmetic of the general areal
+template<size_t nbits, size_t es, typename Real>
+void ArithmeticPerformanceTest(const std::string& type, uint64_t nrOps) {
+	using namespace std;
+	using namespace sw::unum;
+	using Areal = areal<nbits, es>;
+
+	std::mt19937_64 eng(nbits);
+	std::uniform_real_distribution<Real> dist(Real(0.5), Real(1000));
+	std::vector<Real> ra(VECTOR_SIZE), rb(VECTOR_SIZE);
+	std::vector<Areal> aa(VECTOR_SIZE), ab(VECTOR_SIZE);
+	std::vector<uint64_t> fa(VECTOR_SIZE), fb(VECTOR_SIZE);
+	for (size_t i = 0; i < VECTOR_SIZE; ++i) {
+		ra[i] = dist(eng);
+		rb[i] = dist(eng);
+		aa[i] = ra[i];
+		ab[i] = rb[i];
+		fa[i] = aa[i].encoding();
+		fb[i] = ab[i].encoding();
+	}
+
+	ScalarPerformanceTest(type, ra, rb, nrOps,
+		[](Real x, Real y) { return x + y; }, [](Real x, Real y) { return x * y; }, [](Real x, Real y) { return x / y; }, [](Real x) { return std::sqrt(x); });
+	ScalarPerformanceTest("areal<" + to_string(nbits) + "," + to_string(es) + "> hardware", aa, ab, nrOps,
+		[](const Areal& x, const Areal& y) { return x + y; }, [](const Areal& x, const Areal& y) { return x * y; }, [](const Areal& x, const Areal& y) { return x / y; }, [](const Areal& x) { return sqrt(x); });
+	// the field arithmetic, that the general areal<nbits,es> executes, on the encodings
+	ScalarPerformanceTest("areal<" + to_string(nbits) + "," + to_string(es) + "> fields", fa, fb, nrOps,
+		[](uint64_t x, uint64_t y) { bool ubit = false; return impl::areal_add<nbits, es>(x, y, ubit) ^ uint64_t(ubit); },
+		[](uint64_t x, uint64_t y) { bool ubit = false; return impl::areal_mul<nbits, es>(x, y, ubit) ^ uint64_t(ubit); },
+		[](uint64_t x, uint64_t y) { bool ubit = false; return impl::areal_div<nbits, es>(x, y, ubit) ^ uint64_t(ubit); },
+		[](uint64_t x) { bool ubit = false; return impl::areal_sqrt<nbits, es>(x, ubit) ^ uint64_t(ubit); });
+}
+
+void TestArithmeticPerformance() {
+	using namespace std;
+
+	cout << endl << "TestArithmeticPerformance" << endl;
+
+	const uint64_t NR_OPS = 64 * 1024 * 1024;
+	ArithmeticPerformanceTest<32, 8, float>("float", NR_OPS);
+	ArithmeticPerformanceTest<64, 11, double>("double", NR_OPS);
+	/*
+		the native loops vectorize, the areal loops execute an operator and its error-free transformation per element, -O2 without -mfma
+		float                            7.82557e+08 add/sec   1.3571e+09 mul/sec  7.99062e+08 div/sec  7.49406e+08 sqrt/sec
+		areal<32,8> hardware             1.48263e+08 add/sec  1.36898e+08 mul/sec  1.13996e+08 div/sec  1.65167e+08 sqrt/sec
+		areal<32,8> fields               3.32971e+07 add/sec  9.84743e+07 mul/sec  3.83069e+07 div/sec  2.43664e+07 sqrt/sec
+		double                           1.10411e+09 add/sec  1.10073e+09 mul/sec   6.0457e+08 div/sec  4.10616e+08 sqrt/sec
+		areal<64,11> hardware             1.5123e+08 add/sec  1.39317e+08 mul/sec  1.12816e+08 div/sec  2.01767e+08 sqrt/sec
+		areal<64,11> fields              3.43001e+07 add/sec  9.95432e+07 mul/sec  4.27624e+07 div/sec  2.58507e+07 sqrt/sec
+
+		the hardware specialization with branches on the direction of the error, and the ubit passed by reference to the fallback
+		areal<32,8> hardware             4.18549e+07 add/sec  5.61305e+07 mul/sec  4.96912e+07 div/sec  1.46686e+08 sqrt/sec
+		areal<64,11> hardware            4.23148e+07 add/sec  5.61753e+07 mul/sec  5.05768e+07 div/sec  1.48988e+08 sqrt/sec
+
+		the bit by bit integer square root of the fields
+		areal<32,8> fields               3.32162e+07 add/sec  9.54528e+07 mul/sec  3.51172e+07 div/sec  1.74025e+06 sqrt/sec
+		areal<64,11> fields              3.06592e+07 add/sec  7.46786e+07 mul/sec  3.32838e+07 div/sec   1.7588e+06 sqrt/sec
+	*/
+}
+
+#define MANUAL_TESTING 1
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	std::string tag = "Areal operator performance benchmarking";
+
+#if MANUAL_TESTING
+
+	TestArithmeticPerformance();
+
+	cout << "done" << endl;
+
+	return EXIT_SUCCESS;
+#else
+	std::cout << tag << std::endl;
+
+	int nrOfFailedTestCases = 0;
+
+#if STRESS_TESTING
+
+#endif // STRESS_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+#endif // MANUAL_TESTING
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,227 @@
+// specializations.cpp: functional tests of the IEEE-754 hardware specializations of areal<32,8> and areal<64,11> against the field arithmetic
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+#include <cfenv>
+// configure the areal arithmetic class
+// enable the fast specialized areals
+#define AREAL_FAST_SPECIALIZATION
+#include "universal/areal/areal.hpp"
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+/*
+   The specializations compute the round-to-nearest result in hardware, and recover the truncation toward zero and the ubit
+   from an error-free transformation. They have two independent references: the field arithmetic of the general areal in impl,
+   which the specializations fall back on outside the bounds of the transformations, and the floating-point hardware itself in
+   the round-toward-zero mode, with the inexact flag as the ubit.
+*/
+
+namespace sw {
+namespace unum {
+
+	template<typename Real, typename Bits>
+	Real FromBits(Bits bits) {
+		Real v;
+		std::memcpy(&v, &bits, sizeof(Real));
+		return v;
+	}
+
+	// random operands, with the specials, the subnormals, and the values at the edges of the range more often than uniform bit patterns
+	template<typename Real, typename Bits>
+	Real RandomOperand(std::mt19937_64& eng) {
+		switch (eng() % 8) {
+		case 0: return FromBits<Real, Bits>(Bits(eng()));
+		case 1: return FromBits<Real, Bits>(Bits(eng()) >> (eng() % (8 * sizeof(Bits))));
+		case 2: return (eng() % 2 ? 1 : -1) * std::numeric_limits<Real>::max() / Real(eng() % 16 + 1);
+		case 3: return (eng() % 2 ? 1 : -1) * std::numeric_limits<Real>::min() * Real(eng() % 1024);
+		case 4: {
+			static const Real specials[] = { Real(0), -Real(0), std::numeric_limits<Real>::infinity(), -std::numeric_limits<Real>::infinity(), std::numeric_limits<Real>::quiet_NaN(), Real(1), Real(-1) };
+			return specials[eng() % 7];
+		}
+		default:
+			return Real(int64_t(eng() % 2000001) - 1000000) / Real(eng() % 1000 + 1);
+		}
+	}
+
+	// the result of the hardware in the round-toward-zero mode, and its inexact flag
+	template<typename Real>
+	Real TruncatedHardware(int op, Real a, Real b, bool& inexact) {
+		volatile Real va = a, vb = b, r = 0;
+		std::fesetround(FE_TOWARDZERO);
+		std::feclearexcept(FE_ALL_EXCEPT);
+		switch (op) {
+		case 0: r = va + vb; break;
+		case 1: r = va - vb; break;
+		case 2: r = va * vb; break;
+		case 3: r = va / vb; break;
+		case 4: r = std::sqrt(Real(va)); break;
+		}
+		inexact = std::fetestexcept(FE_INEXACT) != 0;
+		std::fesetround(FE_TONEAREST);
+		// the infinities and NaNs of areal are exact
+		if (std::isinf(r) || std::isnan(r)) inexact = false;
+		return r;
+	}
+
+	template<size_t nbits, size_t es, typename Real, typename Bits>
+	int VerifyArithmeticOperands(const std::string& tag, bool bReportIndividualTestCases, Real a, Real b, bool ua, bool ub) {
+		using Areal = areal<nbits, es>;
+		constexpr uint64_t SIGN = impl::areal_encoding<nbits, es>::sign_mask;
+		static const char* opcodes[] = { "+", "-", "*", "/", "sqrt" };
+		int nrOfFailedTests = 0;
+		Areal pa(a), pb(b), presult;
+		pa.setubit(ua);
+		pb.setubit(ub);
+		uint64_t ea = pa.encoding(), eb = pb.encoding();
+
+		for (int op = 0; op < 5; ++op) {
+			bool ubit = ua || (op < 4 && ub);
+			uint64_t fields = 0;
+			switch (op) {
+			case 0: presult = pa + pb; fields = impl::areal_add<nbits, es>(ea, eb, ubit); break;
+			case 1: presult = pa - pb; fields = impl::areal_add<nbits, es>(ea, eb ^ SIGN, ubit); break;
+			case 2: presult = pa * pb; fields = impl::areal_mul<nbits, es>(ea, eb, ubit); break;
+			case 3: presult = pa / pb; fields = impl::areal_div<nbits, es>(ea, eb, ubit); break;
+			case 4: presult = sqrt(pa); fields = impl::areal_sqrt<nbits, es>(ea, ubit); break;
+			}
+			bool inexact;
+			Real hardware = TruncatedHardware(op, a, b, inexact);
+			inexact = inexact || (!std::isinf(hardware) && !std::isnan(hardware) && (ua || (op < 4 && ub)));
+			bool nan = presult.isnan() && impl::areal_isnan<nbits, es>(fields) && std::isnan(hardware);
+			bool pass = nan || (presult.encoding() == fields && presult.ubit() == ubit
+				&& presult.encoding() == Areal(hardware).encoding() && presult.ubit() == inexact);
+			if (!pass) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << std::hexfloat << a << (ua ? "..." : "") << ' ' << opcodes[op] << ' ' << b << (ub ? "..." : "")
+					<< " = " << presult << (presult.ubit() ? "..." : "") << " fields " << FromBits<Real, Bits>(Bits(fields)) << (ubit ? "..." : "")
+					<< " hardware " << hardware << (inexact ? "..." : "") << std::defaultfloat << '\n';
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+	// the comparisons and conversions against the fields
+	template<size_t nbits, size_t es, typename Real, typename Bits>
+	int VerifyLogicOperands(const std::string& tag, bool bReportIndividualTestCases, Real a, Real b, bool ua, bool ub, long long i) {
+		using Areal = areal<nbits, es>;
+		int nrOfFailedTests = 0;
+		Areal pa(a), pb(b);
+		pa.setubit(ua);
+		pb.setubit(ub);
+		auto check = [&](bool pass, const char* op) {
+			if (!pass) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << op << ' ' << std::hexfloat << a << (ua ? "..." : "") << ' ' << b << (ub ? "..." : "") << ' ' << i << std::defaultfloat << '\n';
+			}
+		};
+		bool unordered = std::isnan(a) || std::isnan(b);
+		int order = unordered ? 2 : impl::areal_compare<nbits, es>(pa.encoding(), ua, pb.encoding(), ub);
+		check((pa == pb) == (order == 0), "==");
+		check((pa != pb) == (order != 0), "!=");
+		check((pa < pb) == (order == -1), "<");
+		check((pa > pb) == (order == 1), ">");
+		check((pa <= pb) == (order == 0 || order == -1), "<=");
+		check((pa >= pb) == (order == 0 || order == 1), ">=");
+
+		bool ubit;
+		uint64_t fields = impl::areal_from_integer<nbits, es>(i < 0, i < 0 ? 0ull - (unsigned long long)(i) : (unsigned long long)(i), ubit);
+		Areal pi(i);
+		check(pi.encoding() == fields && pi.ubit() == ubit, "integer conversion");
+		fields = impl::areal_from_integer<nbits, es>(false, (unsigned long long)(i), ubit);
+		pi = (unsigned long long)(i);
+		check(pi.encoding() == fields && pi.ubit() == ubit, "unsigned conversion");
+		long double ld = (long double)(a) * (1 + std::numeric_limits<long double>::epsilon());
+		fields = impl::areal_from_native<nbits, es>(ld, ubit);
+		pi = ld;
+		check((pi.isnan() && std::isnan(ld)) || (pi.encoding() == fields && pi.ubit() == ubit), "long double conversion");
+		check(std::isnan(a) || (pa.to_double() == double(a) && pa.to_long_double() == (long double)(a)), "native conversion");
+		check(std::isnan(a) || (pa.sign() == bool(std::signbit(a)) && pa.scale() == impl::areal_scale<nbits, es>(pa.encoding())), "sign and scale");
+		return nrOfFailedTests;
+	}
+
+	template<size_t nbits, size_t es, typename Real, typename Bits>
+	int VerifyRandomOperands(const std::string& tag, bool bReportIndividualTestCases, int nrOfRandoms) {
+		int nrOfFailedTests = 0;
+		std::mt19937_64 eng(nbits);
+		for (int i = 0; i < nrOfRandoms; ++i) {
+			Real a = RandomOperand<Real, Bits>(eng), b = RandomOperand<Real, Bits>(eng);
+			bool ua = (eng() % 8) == 0, ub = (eng() % 8) == 0;
+			nrOfFailedTests += VerifyArithmeticOperands<nbits, es, Real, Bits>(tag, bReportIndividualTestCases, a, b, ua, ub);
+			nrOfFailedTests += VerifyLogicOperands<nbits, es, Real, Bits>(tag, bReportIndividualTestCases, a, b, ua, ub, (long long)(eng()) >> (eng() % 64));
+			if (nrOfFailedTests > 10) return nrOfFailedTests;
+		}
+		return nrOfFailedTests;
+	}
+
+	// the specializations hold the value in a native register
+	template<size_t nbits, size_t es, typename Real>
+	int VerifyNativeStorage(const std::string& tag, bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		if (sizeof(areal<nbits, es>) != 2 * sizeof(Real)) nrOfFailedTests++;
+		// one third is inexact, and truncates toward zero, below the nearest float of areal<32,8>
+		areal<nbits, es> third = areal<nbits, es>(1) / areal<nbits, es>(3);
+		if (!third.ubit() || third.to_double() > double(Real(1) / Real(3))) nrOfFailedTests++;
+		if (-third != areal<nbits, es>(-1) / areal<nbits, es>(3)) nrOfFailedTests++;
+		// exact arithmetic stays exact
+		areal<nbits, es> half = areal<nbits, es>(0.25) + areal<nbits, es>(0.25);
+		if (half.ubit() || half.to_double() != 0.5 || sqrt(half * half) != half) nrOfFailedTests++;
+		if (nrOfFailedTests > 0 && bReportIndividualTestCases) std::cerr << "FAIL " << tag << " areal<" << nbits << "," << es << "> of " << sizeof(areal<nbits, es>) << " bytes\n";
+		return nrOfFailedTests;
+	}
+
+} // namespace unum
+} // namespace sw
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "specialized areal failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<32, 8, float, uint32_t>(tag, true, 100), "areal<32,8>", "IEEE hardware");
+
+#else
+
+	cout << "Areal IEEE-754 hardware specialization validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<32, 8, float>(tag, bReportIndividualTestCases), "areal<32,8>", "native storage");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<64, 11, double>(tag, bReportIndividualTestCases), "areal<64,11>", "native storage");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<32, 8, float, uint32_t>(tag, bReportIndividualTestCases, 100000), "areal<32,8>", "IEEE hardware");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<64, 11, double, uint64_t>(tag, bReportIndividualTestCases, 100000), "areal<64,11>", "IEEE hardware");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<32, 8, float, uint32_t>(tag, bReportIndividualTestCases, 10000000), "areal<32,8>", "IEEE hardware");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<64, 11, double, uint64_t>(tag, bReportIndividualTestCases, 10000000), "areal<64,11>", "IEEE hardware");
+#endif // STRESS_TESTING
+
+#endif // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
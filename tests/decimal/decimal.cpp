@@ -5,8 +5,16 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <iostream>
 #include <string>
+// configure the decimal arithmetic class
+#define DECIMAL_THROW_ARITHMETIC_EXCEPTION 1
+// compute the NTT convolutions modulo the three primes on their own threads, from a transform length
+// that the transform multiplication tests reach
+#define NTT_MULTITHREADED 1
+#define NTT_THREAD_THRESHOLD 1024
 #include <universal/decimal/decimal.hpp>
 #include <universal/decimal/numeric_limits.hpp>
+// the integer class is the reference of the multi-limb arithmetic
+#include <universal/integer/integer.hpp>
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
 
@@ -103,12 +111,13 @@ namespace sw {
 			return nrOfFailedTests;
 		}
 
-		// verification of division
+		// verification of division, which truncates toward zero
 		int VerifyDivision(std::string tag, long ub, bool bReportIndividualTestCases) {
 			int nrOfFailedTests = 0;
 			for (long i = -ub; i <= ub; ++i) {
 				decimal d1 = i;
 				for (long j = -ub; j <= ub; ++j) {
+					if (j == 0) continue;
 					decimal d2 = j;
 					long ref = i / j;
 					decimal dref = d1 / d2;
@@ -123,6 +132,129 @@ namespace sw {
 			}
 			return nrOfFailedTests;
 		}
+
+		// verification of the remainder, which has the sign of the dividend
+		int VerifyRemainder(std::string tag, long ub, bool bReportIndividualTestCases) {
+			int nrOfFailedTests = 0;
+			for (long i = -ub; i <= ub; ++i) {
+				decimal d1 = i;
+				for (long j = -ub; j <= ub; ++j) {
+					if (j == 0) continue;
+					decimal d2 = j;
+					long ref = i % j;
+					decimal dref = d1 % d2;
+					if (dref != ref) {
+						++nrOfFailedTests;
+						if (bReportIndividualTestCases) ReportBinaryDecimalError("FAIL", "rem", d1, d2, dref, ref);
+					}
+				}
+			}
+			return nrOfFailedTests;
+		}
+
+		// a random integer of nbits with 1 to maxBits significant bits of magnitude
+		template<size_t nbits>
+		integer<nbits> RandomInteger(unsigned maxBits) {
+			integer<nbits> v;
+			for (unsigned i = 0; i < v.nrLimbs; ++i) v.setlimb(i, (uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand()));
+			v >>= signed(nbits - 1 - unsigned(rand()) % maxBits);
+			if (rand() % 2) v = -v;
+			return v;
+		}
+
+		// the multi-limb operations against integer<nbits> through the decimal text of both: the operands have at most
+		// nbits / 2 - 1 bits, so that the products are exact, and the divisors of one limb and of every length
+		template<size_t nbits>
+		int VerifyLimbArithmetic(std::string tag, int nrOfRandoms, bool bReportIndividualTestCases) {
+			int nrOfFailedTests = 0;
+			for (int n = 0; n < nrOfRandoms; ++n) {
+				integer<nbits> a = RandomInteger<nbits>(nbits / 2 - 1), b = RandomInteger<nbits>(n % 2 ? 64 : nbits / 2 - 1);
+				if (b.iszero()) b = 7;
+				decimal da, db;
+				da.parse(convert_to_decimal_string(a));
+				db.parse(convert_to_decimal_string(b));
+				integer<nbits> results[] = { a + b, a - b, a * b, a / b, a % b, (a * b) / b };
+				decimal dresults[] = { da + db, da - db, da * db, da / db, da % db, (da * db) / db };
+				const char* ops[] = { "add", "sub", "mul", "div", "rem", "mul/div" };
+				for (int i = 0; i < 6; ++i) {
+					std::stringstream ss;
+					ss << dresults[i];
+					if (ss.str() != convert_to_decimal_string(results[i])) {
+						++nrOfFailedTests;
+						if (bReportIndividualTestCases) std::cerr << "FAIL " << ops[i] << " " << da << " " << db << " = " << ss.str() << " reference " << convert_to_decimal_string(results[i]) << '\n';
+					}
+				}
+			}
+			return nrOfFailedTests;
+		}
+
+		// the transform multiply against the schoolbook multiply on limb vectors of random, all nines, and unbalanced lengths,
+		// and the products of decimals past DECIMAL_NTT_THRESHOLD limbs against their quotients
+		int VerifyTransformMultiplication(std::string tag, int nrOfRandoms, bool bReportIndividualTestCases) {
+			int nrOfFailedTests = 0;
+			for (int n = 0; n < nrOfRandoms; ++n) {
+				size_t na = 1 + size_t(rand()) % 600, nb = (n % 4 == 0 ? na : 1 + size_t(rand()) % 600);
+				std::vector<uint32_t> a(na), b(nb), product(na + nb), reference(na + nb);
+				for (uint32_t& limb : a) limb = (n % 5 == 0 ? 999999999u : uint32_t(rand()) % impl::DECIMAL_BASE);
+				for (uint32_t& limb : b) limb = (n % 5 == 0 ? 999999999u : uint32_t(rand()) % impl::DECIMAL_BASE);
+				impl::decimal_ntt_multiply(a.data(), na, b.data(), nb, product.data());
+				impl::decimal_mul_schoolbook(a.data(), na, b.data(), nb, reference.data());
+				if (product != reference) {
+					++nrOfFailedTests;
+					if (bReportIndividualTestCases) std::cerr << "FAIL transform multiply of " << na << " by " << nb << " limbs\n";
+				}
+			}
+			for (size_t digits : { 9 * DECIMAL_NTT_THRESHOLD, 9 * DECIMAL_NTT_THRESHOLD + 4, 4 * 9 * DECIMAL_NTT_THRESHOLD }) {
+				std::string text(digits, '7');
+				text[digits / 3] = '1';
+				decimal a, b;
+				a.parse(text);
+				b.parse(text.substr(0, digits - digits / 5));
+				decimal product = a * b, square = a * a, copy = a;
+				if (product / b != a || product % a != 0 || square != a * copy || square / a != a) {
+					++nrOfFailedTests;
+					if (bReportIndividualTestCases) std::cerr << "FAIL transform multiply of " << digits << " digits\n";
+				}
+			}
+			return nrOfFailedTests;
+		}
+
+		// text round trips, and the edge cases of the limb boundaries
+		int VerifyConversions(std::string tag, bool bReportIndividualTestCases) {
+			int nrOfFailedTests = 0;
+			auto check = [&](bool pass, const std::string& what) {
+				if (!pass) {
+					++nrOfFailedTests;
+					if (bReportIndividualTestCases) std::cerr << "FAIL " << what << '\n';
+				}
+			};
+			for (std::string text : { "0", "-1", "999999999", "1000000000", "-1000000000000000000", "123456789012345678901234567890" }) {
+				decimal d;
+				std::stringstream ss;
+				check(d.parse(text), "parse " + text);
+				ss << d;
+				check(ss.str() == text, "round trip " + text + " " + ss.str());
+			}
+			auto parsed = [](const std::string& text) { decimal v; v.parse(text); return v; };
+			decimal d;
+			check(d.parse("+000123") && d == 123 && d.size() == 3, "leading zeros");
+			check(d.parse("-0") && d.iszero() && !d.isneg(), "minus zero");
+			check(!d.parse("12a") && !d.parse("-") && !d.parse("+-1"), "malformed");
+			check(decimal(-9223372036854775807ll - 1) == parsed(("-9223372036854775808")), "long long min");
+			check(decimal(18446744073709551615ull) == parsed(("18446744073709551615")), "unsigned long long max");
+			check(decimal(-2.75) == -2 && decimal(1.0e30) == parsed(("1000000000000000019884624838656")), "floating-point");
+			check(decimal(123) < decimal(124) && decimal(-124) < decimal(-123) && decimal(-1) < decimal(0) && !(decimal(5) < decimal(5)), "ordering");
+			decimal big;
+			big.parse("1" + std::string(2000, '0'));
+			check(big.size() == 2001 && (big / big) == 1 && (big % decimal(7)) == 2, "2001 digits");
+			try {
+				decimal zero;
+				big /= zero;
+				check(false, "divide by zero");
+			}
+			catch (const decimal_divide_by_zero&) {}
+			return nrOfFailedTests;
+		}
 	}
 }
 
@@ -162,7 +294,7 @@ void examples() {
 	cout << d3 << endl;
 
 	d1.setzero();		cout << d1.iszero() << endl;
-	d1.push_back(0);	cout << d1.iszero() << endl;
+	d1 = 0;				cout << d1.iszero() << endl;
 
 	cout << "Conversions\n";
 	// signed integers
@@ -256,13 +388,22 @@ try {
 #else
 	std::cout << "Decimal Arithmetic verfication" << std::endl;
 
+	nrOfFailedTestCases += ReportTestResult(VerifyConversions("conversions", bReportIndividualTestCases), "decimal", "conversions");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbArithmetic<256>("limbs", 1000, bReportIndividualTestCases), "decimal", "integer<256> arithmetic");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbArithmetic<4096>("limbs", 200, bReportIndividualTestCases), "decimal", "integer<4096> arithmetic");
+	// Karatsuba blocks from DECIMAL_KARATSUBA_THRESHOLD limbs of nine digits up
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbArithmetic<16384>("limbs", 20, bReportIndividualTestCases), "decimal", "integer<16384> arithmetic");
+	// the number theoretic transform from DECIMAL_NTT_THRESHOLD limbs up
+	nrOfFailedTestCases += ReportTestResult(VerifyTransformMultiplication("transform", 100, bReportIndividualTestCases), "decimal", "transform multiplication");
+
 #ifdef STRESS_TESTING
 
 	long rangeBound = (1 << 9);
 	nrOfFailedTestCases += ReportTestResult(VerifyAddition("addition", rangeBound, bReportIndividualTestCases), "decimal", "addition");
 	nrOfFailedTestCases += ReportTestResult(VerifySubtraction("subtraction", rangeBound, bReportIndividualTestCases), "decimal", "subtraction");
 	nrOfFailedTestCases += ReportTestResult(VerifyMultiplication("multiplication", rangeBound, bReportIndividualTestCases), "decimal", "multiplication");
-	//nrOfFailedTestCases += ReportTestResult(VerifyDivision("division", rangeBound, bReportIndividualTestCases), "decimal", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivision("division", rangeBound, bReportIndividualTestCases), "decimal", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyRemainder("remainder", rangeBound, bReportIndividualTestCases), "decimal", "remainder");
 
 #endif // STRESS_TESTING
 
@@ -0,0 +1,168 @@
+//  performance.cpp : performance benchmarking for abitrary precision decimal integers
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <chrono>
+// configure the decimal arithmetic class
+#define DECIMAL_THROW_ARITHMETIC_EXCEPTION 1
+// compute the NTT convolutions modulo the three primes on their own threads
+#define NTT_MULTITHREADED 1
+#include <universal/decimal/decimal.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the number of operations per second of a kernel that performs nrOps operations
+template<typename Kernel>
+double OperationsPerSecond(uint64_t nrOps, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> time_span = duration_cast<duration<double>>(end - begin);
+	return double(nrOps) / time_span.count();
+}
+
+// a decimal of the given number of pseudo random digits
+sw::unum::decimal RandomDecimal(size_t digits) {
+	std::string text(digits, '0');
+	for (size_t i = 0; i < digits; ++i) text[i] = char('0' + rand() % 10);
+	text[0] = char('1' + rand() % 9);
+	sw::unum::decimal d;
+	d.parse(text);
+	return d;
+}
+
+// addition, multiplication, and division of a 2n digit dividend by an n digit divisor, and the text conversions
+void ArithmeticPerformanceTest(size_t digits) {
+	using namespace std;
+	using namespace sw::unum;
+
+	// multiplication and division are quadratic in the digits below the Karatsuba threshold
+	const uint64_t NR_OPS = (400000000ull / (digits * digits)) > 2 ? (400000000ull / (digits * digits)) : 2;
+	const uint64_t NR_FAST_OPS = 100 * NR_OPS;
+
+	decimal a = RandomDecimal(digits), b = RandomDecimal(digits), dividend = RandomDecimal(2 * digits), c;
+	size_t nrDigits = 0;
+	double add = OperationsPerSecond(NR_FAST_OPS, [&]() { for (uint64_t i = 0; i < NR_FAST_OPS; ++i) { c = a + b; nrDigits += c.size(); } });
+	double mul = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { c = a * b; nrDigits += c.size(); } });
+	double div = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { c = dividend / b; nrDigits += c.size(); } });
+	double rem = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { c = dividend % b; nrDigits += c.size(); } });
+	std::stringstream ss;
+	ss << a;
+	std::string text = ss.str();
+	double print = OperationsPerSecond(NR_FAST_OPS / 10, [&]() { for (uint64_t i = 0; i < NR_FAST_OPS / 10; ++i) { std::stringstream s; s << a; nrDigits += s.str().size(); } });
+	double parse = OperationsPerSecond(NR_FAST_OPS / 10, [&]() { for (uint64_t i = 0; i < NR_FAST_OPS / 10; ++i) { c.parse(text); nrDigits += c.size(); } });
+	cout << setw(6) << digits << " digits: " << add << " add/sec " << mul << " mul/sec " << div << " div/sec " << rem << " rem/sec " << print << " print/sec " << parse << " parse/sec" << (nrDigits == 0 ? " (zero)" : "") << endl;
+}
+
+void TestArithmeticPerformance() {
+	using namespace std;
+
+	cout << endl << "TestArithmeticPerformance" << endl;
+
+	for (size_t digits : { 10, 100, 1000, 10000, 100000 }) ArithmeticPerformanceTest(digits);
+	/*
+		performance of the limbs of nine digits, with the number theoretic transform multiply from 320 limbs
+		    10 digits: 3.75618e+07 add/sec 2.21598e+07 mul/sec 6.01315e+06 div/sec 6.73844e+06 rem/sec 2.56422e+06 print/sec 1.22505e+07 parse/sec
+		   100 digits: 1.42811e+07 add/sec 3.65245e+06 mul/sec 1.13484e+06 div/sec 1.09379e+06 rem/sec 1.49194e+06 print/sec 4.74391e+06 parse/sec
+		  1000 digits: 3.63374e+06 add/sec 62010.7 mul/sec 25618.6 div/sec 26137.6 rem/sec 550328 print/sec 792070 parse/sec
+		 10000 digits: 405172 add/sec 3121.85 mul/sec 267.502 div/sec 284.973 rem/sec 39249.4 print/sec 50926 parse/sec
+		100000 digits: 36618.9 add/sec 234.308 mul/sec 2.7557 div/sec 2.55514 rem/sec 6023.39 print/sec 6950.13 parse/sec
+
+		performance of the limbs of nine digits, schoolbook multiply and Knuth division, Karatsuba from 40 limbs
+		    10 digits: 3.18836e+07 add/sec 1.72243e+07 mul/sec 5.10274e+06 div/sec 5.04875e+06 rem/sec 1.76301e+06 print/sec 9.61941e+06 parse/sec
+		   100 digits: 9.95134e+06 add/sec 1.91156e+06 mul/sec 943266 div/sec 952872 rem/sec 933324 print/sec 3.65975e+06 parse/sec
+		  1000 digits: 2.99725e+06 add/sec 46142.2 mul/sec 20011.4 div/sec 22081.8 rem/sec 260056 print/sec 544303 parse/sec
+		 10000 digits: 329308 add/sec 1026.91 mul/sec 244.293 div/sec 243.966 rem/sec 24160.8 print/sec 54172.4 parse/sec
+		100000 digits: 33174 add/sec 30.0562 mul/sec 2.3301 div/sec 2.26606 rem/sec 3513.32 print/sec 6097.08 parse/sec
+
+		the digit-per-byte vector of the previous decimal, division was a stub that returned the dividend
+		    10 digits: 9.45481e+06 add/sec 690617 mul/sec
+		   100 digits: 4.71326e+06 add/sec 11319.5 mul/sec
+		  1000 digits: 423980 add/sec 78.6353 mul/sec
+	*/
+}
+
+// the Karatsuba multiply against the number theoretic transform multiply of limb vectors around and past DECIMAL_NTT_THRESHOLD
+void MultiplicationCrossoverTest(size_t limbs) {
+	using namespace std;
+	using namespace sw::unum;
+
+	const uint64_t NR_OPS = (4000000000ull / (limbs * limbs)) > 2 ? (4000000000ull / (limbs * limbs)) : 2;
+	std::vector<uint32_t> a(limbs), b(limbs), product(2 * limbs), scratch(impl::decimal_multiply_scratch(limbs));
+	for (size_t i = 0; i < limbs; ++i) {
+		a[i] = uint32_t(rand()) % impl::DECIMAL_BASE;
+		b[i] = uint32_t(rand()) % impl::DECIMAL_BASE;
+	}
+	uint64_t check = 0;
+	double karatsuba = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { impl::decimal_karatsuba(a.data(), b.data(), limbs, product.data(), scratch.data()); check += product[limbs]; } });
+	double transform = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { impl::decimal_ntt_multiply(a.data(), limbs, b.data(), limbs, product.data()); check -= product[limbs]; } });
+	cout << "performance is " << karatsuba << " Karatsuba and " << transform << " transform multiplies/sec of " << setw(6) << limbs << " limbs" << (check != 0 ? " (mismatch)" : "") << endl;
+}
+
+void TestMultiplicationCrossover() {
+	using namespace std;
+
+	cout << endl << "TestMultiplicationCrossover" << endl;
+
+	// 10^5 and 10^6 digits are 11112 and 111112 limbs of nine digits
+	for (size_t limbs : { 64, 128, 256, 320, 512, 1024, 4096, 11112, 111112 }) MultiplicationCrossoverTest(limbs);
+	/*
+		the transform packs two limbs into a coefficient in base 10^18, on one hardware thread
+		performance is 140535 Karatsuba and 67217.7 transform multiplies/sec of     64 limbs
+		performance is 35657.4 Karatsuba and 32519.3 transform multiplies/sec of    128 limbs
+		performance is 11426.9 Karatsuba and 18963.2 transform multiplies/sec of    256 limbs
+		performance is 10680.9 Karatsuba and 11556.2 transform multiplies/sec of    320 limbs
+		performance is 4620.71 Karatsuba and 10806.8 transform multiplies/sec of    512 limbs
+		performance is 1425.91 Karatsuba and 5962.21 transform multiplies/sec of   1024 limbs
+		performance is 153.268 Karatsuba and 1247.25 transform multiplies/sec of   4096 limbs
+		performance is 35.522 Karatsuba and 309.957 transform multiplies/sec of  11112 limbs
+		performance is 0.93123 Karatsuba and 22.6241 transform multiplies/sec of 111112 limbs
+	*/
+}
+
+#define MANUAL_TESTING 1
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	std::string tag = "Decimal operator performance benchmarking";
+
+#if MANUAL_TESTING
+
+	TestArithmeticPerformance();
+	TestMultiplicationCrossover();
+
+	cout << "done" << endl;
+
+	return EXIT_SUCCESS;
+#else
+	std::cout << tag << std::endl;
+
+	int nrOfFailedTestCases = 0;
+
+#if STRESS_TESTING
+
+#endif // STRESS_TESTING
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+
+#endif // MANUAL_TESTING
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
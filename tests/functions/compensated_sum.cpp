@@ -0,0 +1,134 @@
+// compensated_sum.cpp: validation of the twoProd error-free transformation and the Sum2/Dot2 compensated kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the UNIVERSAL project, which is released under an MIT Open Source license.
+#include <random>
+#include <universal/posit/posit>
+#include <universal/functions/compensated_sum.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the remainder of twoProd is the correctly rounded error of the product: exhaustive for small posits
+template<size_t nbits, size_t es>
+int ValidateTwoProd(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	const unsigned NR_POSITS = (unsigned(1) << nbits);
+	int nrOfFailedTests = 0;
+	Posit pa, pb;
+	for (unsigned i = 0; i < NR_POSITS; ++i) {
+		pa.set_raw_bits(i);
+		if (pa.isnar()) continue;
+		for (unsigned j = 0; j < NR_POSITS; ++j) {
+			pb.set_raw_bits(j);
+			if (pb.isnar()) continue;
+			std::pair<Posit, Posit> pr = sw::function::twoProd(pa, pb);
+			Posit ref = (long double)pa * (long double)pb - (long double)pr.first;
+			if (pr.first != pa * pb || pr.second != ref) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cerr << tag << " twoProd(" << pa << ", " << pb << ") = (" << pr.first << ", " << pr.second << ") remainder should be " << ref << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// for IEEE doubles twoProd is exact, a * b = p + r: with 32-bit significands the product is exact in long double
+int ValidateTwoProdDouble(const std::string& tag, bool bReportIndividualTestCases) {
+	int nrOfFailedTests = 0;
+	std::mt19937_64 generator(1);
+	for (int i = 0; i < 10000; ++i) {
+		double a = std::ldexp(double(generator() >> 32), int(generator() % 64) - 64);
+		double b = -std::ldexp(double(generator() >> 32), int(generator() % 64) - 32);
+		std::pair<double, double> pr = sw::function::twoProd(a, b);
+		long double exact = (long double)a * (long double)b;
+		if (pr.first != a * b || (long double)pr.first + (long double)pr.second != exact) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " twoProd(" << a << ", " << b << ") = (" << pr.first << ", " << pr.second << ")" << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// Sum2 and Dot2 recover the terms that cancel in a plain accumulation
+template<typename Scalar>
+int ValidateCompensatedKernels(const std::string& tag, bool bReportIndividualTestCases, double big) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	// big + 1 - big + 0.5 - 1 + 0.25: the plain sum loses the small terms to cancellation
+	std::vector<Scalar> v = { Scalar(big), Scalar(1), Scalar(-big), Scalar(0.5), Scalar(-1), Scalar(0.25) };
+	Scalar plain(0);
+	for (const Scalar& e : v) plain += e;
+	Scalar compensated = sum2(v);
+	if (compensated != Scalar(0.75)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << tag << " sum2 = " << compensated << " plain sum = " << plain << " instead of 0.75" << std::endl;
+	}
+
+	// x . y = root*root + 1*1 - root*root + 0.5*0.5, with root*root of the order of big
+	Scalar root = Scalar(std::sqrt(big));
+	std::vector<Scalar> x = { root, Scalar(1), root, Scalar(0.5) };
+	std::vector<Scalar> y = { root, Scalar(1), -root, Scalar(0.5) };
+	Scalar dot = dot2(x, y);
+	if (dot != Scalar(1.25)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << tag << " dot2 = " << dot << " instead of 1.25" << std::endl;
+	}
+
+	// products that are not exact: 1/3 * 3 - 1 leaves the rounding error of the product
+	std::vector<Scalar> a = { Scalar(1) / Scalar(3), Scalar(-1) };
+	std::vector<Scalar> b = { Scalar(3), Scalar(1) };
+	long double ref = (long double)a[0] * 3.0l - 1.0l;
+	if (dot2(a, b) != Scalar(ref)) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cerr << tag << " dot2 = " << dot2(a, b) << " instead of " << Scalar(ref) << std::endl;
+	}
+	return nrOfFailedTests;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	cout << "Error-free transformations and compensated summation validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateTwoProd<8, 0>("posit<8,0>", bReportIndividualTestCases), "posit<8,0>", "twoProd");
+	nrOfFailedTestCases += ReportTestResult(ValidateTwoProd<8, 1>("posit<8,1>", bReportIndividualTestCases), "posit<8,1>", "twoProd");
+	nrOfFailedTestCases += ReportTestResult(ValidateTwoProd<10, 1>("posit<10,1>", bReportIndividualTestCases), "posit<10,1>", "twoProd");
+	nrOfFailedTestCases += ReportTestResult(ValidateTwoProdDouble("double", bReportIndividualTestCases), "double", "twoProd");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateCompensatedKernels<double>("double", bReportIndividualTestCases, 1.0e17), "double", "sum2/dot2");
+	nrOfFailedTestCases += ReportTestResult(ValidateCompensatedKernels<posit<32, 2>>("posit<32,2>", bReportIndividualTestCases, 1.0e8), "posit<32,2>", "sum2/dot2");
+	nrOfFailedTestCases += ReportTestResult(ValidateCompensatedKernels<posit<64, 3>>("posit<64,3>", bReportIndividualTestCases, 1.0e15), "posit<64,3>", "sum2/dot2");
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
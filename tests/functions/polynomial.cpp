@@ -3,9 +3,134 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the UNIVERSAL project, which is released under an MIT Open Source license.
+#include <random>
 #include <universal/posit/posit>
 #include <universal/integer/integer>
 #include <universal/functions/ddpoly.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// horner, compensated_horner, and estrin must agree with ddpoly when all arithmetic is exact
+template<typename Scalar>
+int ValidateExactEvaluation(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::function;
+	int nrOfFailedTests = 0;
+	std::vector<Scalar> c = { 1, 2, 3, 4, -5, 6 };
+	std::vector<Scalar> pd(1);
+	for (int k = -3; k <= 3; ++k) {
+		Scalar x = Scalar(std::ldexp(1.0, k));
+		ddpoly(x, c, pd);
+		Scalar results[] = { horner(x, c), compensated_horner(x, c), estrin(x, c) };
+		for (const Scalar& r : results) {
+			if (r != pd[0]) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cerr << tag << " p(" << x << ") = " << r << " != " << pd[0] << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the quire-accumulated Estrin scheme rounds once: when the powers of x are exact, the result is correctly rounded
+template<size_t nbits, size_t es>
+int ValidateQuireEstrin(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using namespace sw::function;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::vector<double> dc = { 0.1, -1.7, 3.3, 0.0, -2.9, 7.1, 1.0 / 3.0 };
+	std::vector<Posit> c(dc.begin(), dc.end());
+	polynomial_evaluator<nbits, es> polynomial(c);
+	for (int k = -4; k <= 4; ++k) {
+		Posit x = Posit(std::ldexp(1.0, k));
+		long double ref = 0.0l;
+		for (int i = int(c.size()) - 1; i >= 0; --i) ref = ref * (long double)x + (long double)c[size_t(i)];
+		Posit pref(ref), result = polynomial(x);
+		if (result != pref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " p(" << x << ") = " << result << " != " << pref << std::endl;
+		}
+	}
+
+	// batch evaluation, and evaluation with the scratch buffer of the caller, are the same as evaluating one point at a time
+	std::mt19937_64 generator(nbits);
+	std::uniform_real_distribution<double> distribution(-2.0, 2.0);
+	std::vector<Posit> x(100), p, powers;
+	for (auto& v : x) v = distribution(generator);
+	polynomial(x, p);
+	for (size_t i = 0; i < x.size(); ++i) {
+		if (p[i] != quire_estrin(x[i], c) || p[i] != polynomial(x[i], powers)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " batch p(" << x[i] << ") = " << p[i] << " != " << quire_estrin(x[i], c) << std::endl;
+		}
+	}
+
+	// NaR propagates
+	Posit nar;
+	nar.setnar();
+	if (!polynomial(nar).isnar()) ++nrOfFailedTests;
+	c[1] = nar;
+	if (!quire_estrin(Posit(1), c).isnar()) ++nrOfFailedTests;
+	return nrOfFailedTests;
+}
+
+// for non-dyadic x the powers are rounded: the result must stay within the error bound of polynomial_evaluator,
+// the final rounding plus r_i roundings of each power x^i
+template<size_t nbits, size_t es>
+int ValidateQuireEstrinBound(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using namespace sw::function;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::vector<double> dc = { 0.1, -1.7, 3.3, 0.0, -2.9, 7.1, 1.0 / 3.0, 0.7, -1.3 };
+	std::vector<Posit> c(dc.begin(), dc.end());
+	polynomial_evaluator<nbits, es> polynomial(c);
+	for (double d : { 0.3, -0.7, 1.1, 1.7, -1.9, 2.0 / 3.0 }) {
+		Posit x(d);
+		long double ref = 0.0l;
+		for (int i = int(c.size()) - 1; i >= 0; --i) ref = ref * (long double)x + (long double)c[size_t(i)];
+		Posit result = polynomial(x);
+		long double bound = std::fabs((long double)ulp(result));
+		long double power = 1.0l;
+		for (size_t i = 1; i < c.size(); ++i) {
+			power *= (long double)x;
+			size_t r = 0, bits = 0;
+			for (size_t j = 0; (i >> j) != 0; ++j) {
+				if ((i >> j) & 1) { r += j; ++bits; }
+			}
+			r += bits - 1;
+			bound += std::fabs((long double)c[i] * (long double)ulp(Posit(power))) * (long double)r;
+		}
+		if (std::fabs((long double)result - ref) > bound) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " p(" << x << ") = " << result << " error " << (double)std::fabs((long double)result - ref) << " > " << (double)bound << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// near the multiple root of (x - 1)^7 the compensated scheme retains much of the accuracy that Horner's scheme loses
+template<size_t nbits, size_t es>
+int ValidateCompensatedHorner(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using namespace sw::function;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::vector<Posit> c = { -1, 7, -21, 35, -35, 21, -7, 1 };
+	for (double d : { 0.99, 1.01, 1.02 }) {
+		Posit x(d);
+		long double ref = std::pow((long double)x - 1.0l, 7);
+		Posit result = compensated_horner(x, c);
+		long double compensated = (long double)result;
+		long double plain = (long double)horner(x, c);
+		// the compensated error must be orders of magnitude smaller, unless the result is correctly rounded
+		if (result != Posit(ref) && std::fabs(compensated - ref) * 100.0l > std::fabs(plain - ref)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " p(" << x << ") = " << (double)compensated << " vs " << (double)ref << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
 
 
 int main(int argc, char** argv)
@@ -16,6 +141,8 @@ try {
 
 	// print detailed bit-level computational intermediate results
 	// bool verbose = false;
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
 
 	// preserve the existing ostream precision
 	auto precision = cout.precision();
@@ -40,7 +167,19 @@ try {
 	// restore the previous ostream precision
 	cout << setprecision(precision);
 
-	return EXIT_SUCCESS;
+	nrOfFailedTestCases += ReportTestResult(ValidateExactEvaluation<float>("float", bReportIndividualTestCases), "float", "polynomial evaluation");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactEvaluation<double>("double", bReportIndividualTestCases), "double", "polynomial evaluation");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactEvaluation<posit<16, 1>>("posit<16,1>", bReportIndividualTestCases), "posit<16,1>", "polynomial evaluation");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactEvaluation<posit<32, 2>>("posit<32,2>", bReportIndividualTestCases), "posit<32,2>", "polynomial evaluation");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireEstrin<16, 1>("posit<16,1>", bReportIndividualTestCases), "posit<16,1>", "quire Estrin");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireEstrin<24, 1>("posit<24,1>", bReportIndividualTestCases), "posit<24,1>", "quire Estrin");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireEstrin<32, 2>("posit<32,2>", bReportIndividualTestCases), "posit<32,2>", "quire Estrin");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireEstrinBound<16, 1>("posit<16,1>", bReportIndividualTestCases), "posit<16,1>", "quire Estrin error bound");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireEstrinBound<32, 2>("posit<32,2>", bReportIndividualTestCases), "posit<32,2>", "quire Estrin error bound");
+	nrOfFailedTestCases += ReportTestResult(ValidateCompensatedHorner<32, 2>("posit<32,2>", bReportIndividualTestCases), "posit<32,2>", "compensated Horner");
+	nrOfFailedTestCases += ReportTestResult(ValidateCompensatedHorner<64, 3>("posit<64,3>", bReportIndividualTestCases), "posit<64,3>", "compensated Horner");
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 catch (char const* msg) {
 	std::cerr << msg << std::endl;
@@ -504,6 +504,204 @@ namespace unum {
 		std::cout << std::endl;
 		return nrOfFailedTests;
 	}
+
+	// carries and borrows across the limb boundaries of a multi-limb integer<nbits>
+	template<size_t nbits>
+	int VerifyLimbCarryChains(std::string tag, bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		integer<nbits> ia, ib, iresult, iref;
+
+		// (2^(64*i) - 1) + 1 == 2^(64*i), and back
+		for (unsigned i = 1; i < integer<nbits>::nrLimbs; ++i) {
+			ia.clear();
+			for (unsigned bit = 0; bit < 64 * i; ++bit) ia.set(bit);
+			iref.clear();
+			iref.set(64 * i);
+			iresult = ia + integer<nbits>(1);
+			if (iresult != iref) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "+", ia, integer<nbits>(1), iref, iresult);
+			}
+			iresult = iref - integer<nbits>(1);
+			if (iresult != ia) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "-", iref, integer<nbits>(1), ia, iresult);
+			}
+			iresult = ia;
+			++iresult;
+			if (iresult != iref) nrOfFailedTests++;
+			--iresult;
+			if (iresult != ia) nrOfFailedTests++;
+		}
+
+		// random operands: inverse operations, negation, and the order of operands without overflow
+		for (int n = 0; n < 1000; ++n) {
+			for (unsigned i = 0; i < integer<nbits>::nrBytes; ++i) {
+				ia.setbyte(i, uint8_t(rand()));
+				ib.setbyte(i, uint8_t(rand()));
+			}
+			iresult = (ia + ib) - ib;
+			if (iresult != ia) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "+-", ia, ib, ia, iresult);
+			}
+			if (!(ia + -ia).iszero() || !((ia - ib) + (ib - ia)).iszero()) nrOfFailedTests++;
+			// clear the two most significant bits so that the difference does not overflow
+			ia.reset(nbits - 1); ia.reset(nbits - 2);
+			ib.reset(nbits - 1); ib.reset(nbits - 2);
+			if (n % 2) ib = -ib;
+			if ((ia < ib) != (ia - ib).sign() || (ia > ib) != (ib - ia).sign() || (ia == ib) != (ia - ib).iszero()) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "<", ia, ib, ia - ib, ib - ia);
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+	// sign extend an integer<nbits> to an integer<wbits>
+	template<size_t wbits, size_t nbits>
+	integer<wbits> SignExtend(const integer<nbits>& a) {
+		integer<wbits> w;
+		w.bitcopy(a);
+		if (a.sign()) for (unsigned i = nbits; i < wbits; ++i) w.set(i);
+		return w;
+	}
+
+	// the limb multiply against the shift-and-add product, and the widening multiply against the sign extended product
+	template<size_t nbits>
+	int VerifyLimbMultiplication(std::string tag, bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		integer<nbits> ia, ib, iresult, iref;
+		integer<2 * nbits> wresult, wref;
+
+		for (int n = 0; n < 100; ++n) {
+			for (unsigned i = 0; i < integer<nbits>::nrBytes; ++i) {
+				ia.setbyte(i, uint8_t(rand()));
+				ib.setbyte(i, uint8_t(rand()));
+			}
+			if (n == 0) { ia = min_int<nbits>(); ib = min_int<nbits>(); }
+			if (n == 1) { ia = max_int<nbits>(); ib = max_int<nbits>(); }
+			if (n == 2) { ia = min_int<nbits>(); ib = max_int<nbits>(); }
+			if (n % 3 == 0) for (unsigned i = nbits / 3; i < nbits; ++i) ib.set(i, ib.sign());  // a short operand
+
+			iresult = ia * ib;
+			if (nbits <= 1024) {
+				// shift-and-add reference
+				integer<nbits> multiplicant(ib);
+				iref.clear();
+				for (unsigned i = 0; i < nbits; ++i) {
+					if (ia.at(i)) iref += multiplicant;
+					multiplicant <<= 1;
+				}
+			}
+			else {
+				// schoolbook reference of the Karatsuba split and of the number theoretic transform
+				uint64_t x[integer<nbits>::nrLimbs], y[integer<nbits>::nrLimbs], z[integer<nbits>::nrLimbs];
+				for (unsigned i = 0; i < integer<nbits>::nrLimbs; ++i) { x[i] = ia.limb(i); y[i] = ib.limb(i); }
+				impl::mul_low_schoolbook(x, y, integer<nbits>::nrLimbs, z);
+				for (unsigned i = 0; i < integer<nbits>::nrLimbs; ++i) iref.setlimb(i, z[i]);
+			}
+			if (iresult != iref || iresult != ib * ia) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "*", ia, ib, iref, iresult);
+			}
+
+			wresult = multiply(ia, ib);
+			wref = SignExtend<2 * nbits>(ia) * SignExtend<2 * nbits>(ib);
+			iresult.bitcopy(wresult);
+			if (wresult != wref || iresult != iref) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "multiply", ia, ib, iref, iresult);
+			}
+			if (nrOfFailedTests > 10) return nrOfFailedTests;
+		}
+		return nrOfFailedTests;
+	}
+
+	// a limb with the bit patterns that stress the trial quotient of the long division
+	inline uint64_t RandomLimb() {
+		switch (rand() % 6) {
+		case 0: return 0;
+		case 1: return 1;
+		case 2: return ~0ull;
+		case 3: return 0x8000000000000000ull;
+		default: return (uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand());
+		}
+	}
+
+	// the limb division against the identity a == q * b + r with |r| < |b| and r having the sign of a
+	template<size_t nbits>
+	int VerifyLimbDivision(std::string tag, bool bReportIndividualTestCases) {
+		constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+		int nrOfFailedTests = 0;
+		integer<nbits> ia, ib;
+
+		for (int n = 0; n < 1000; ++n) {
+			// a divisor of 1 to nrLimbs limbs
+			unsigned bLimbs = 1 + unsigned(rand()) % nrLimbs;
+			ia.clear(); ib.clear();
+			for (unsigned i = 0; i < nrLimbs; ++i) ia.setlimb(i, RandomLimb());
+			for (unsigned i = 0; i < bLimbs; ++i) ib.setlimb(i, RandomLimb());
+			// the dividend's top limb equal to the divisor's: the trial quotient that does not fit a limb
+			if (n % 5 == 0 && bLimbs < nrLimbs) ia.setlimb(bLimbs, ib.limb(bLimbs - 1));
+			if (ib.iszero()) ib.setlimb(0, 3);
+			if (n % 4 == 1) ia = -ia;
+			if (n % 4 == 2) ib = -ib;
+			if (ia == min_int<nbits>() && ib == integer<nbits>(-1)) continue;  // the one quotient that overflows
+
+			idiv_t<nbits> result = divmod(ia, ib);
+			integer<2 * nbits> wa = SignExtend<2 * nbits>(ia), wr = SignExtend<2 * nbits>(result.rem);
+			bool remainderBound = (result.rem.sign() ? -result.rem : result.rem) < (ib.sign() ? -ib : ib) || ib == min_int<nbits>();
+			bool remainderSign = result.rem.iszero() || result.rem.sign() == ia.sign();
+			if (multiply(result.quot, ib) + wr != wa || !remainderBound || !remainderSign || ia / ib != result.quot || ia % ib != result.rem) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	ReportBinaryArithmeticError("FAIL", "divmod", ia, ib, result.quot, result.rem);
+			}
+			if (nrOfFailedTests > 10) return nrOfFailedTests;
+		}
+		return nrOfFailedTests;
+	}
+
+	// the limb shifts and rotations against the bit positions, and popcount, findMsb, findLsb against a bit scan
+	template<size_t nbits>
+	int VerifyLimbShifts(std::string tag, bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		integer<nbits> ia, iresult;
+
+		for (int n = 0; n < 20; ++n) {
+			for (unsigned i = 0; i < integer<nbits>::nrLimbs; ++i) ia.setlimb(i, RandomLimb());
+			unsigned shifts[] = { 0, 1, 63, 64, 65, 127, 128, unsigned(nbits) - 1, unsigned(nbits), unsigned(rand()) % unsigned(nbits) };
+			for (unsigned s : shifts) {
+				bool pass = true;
+				iresult = ia; iresult <<= signed(s);
+				for (unsigned i = 0; i < nbits; ++i) if (iresult.at(i) != (i >= s ? ia.at(i - s) : false)) pass = false;
+				iresult = ia; iresult >>= signed(s);
+				for (unsigned i = 0; i < nbits; ++i) if (iresult.at(i) != (i + s < nbits ? ia.at(i + s) : false)) pass = false;
+				iresult = ia; iresult.rotl(s);
+				for (unsigned i = 0; i < nbits; ++i) if (iresult.at((i + s) % nbits) != ia.at(i)) pass = false;
+				iresult.rotr(s);
+				if (iresult != ia) pass = false;
+				if (!pass) {
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases)	std::cout << "FAIL shifts by " << s << " of " << to_binary(ia) << std::endl;
+				}
+			}
+			unsigned count = 0;
+			signed msb = -1, lsb = -1;
+			for (unsigned i = 0; i < nbits; ++i) {
+				if (ia.at(i)) {
+					++count;
+					msb = signed(i);
+					if (lsb < 0) lsb = signed(i);
+				}
+			}
+			if (ia.popcount() != count || findMsb(ia) != msb || findLsb(ia) != lsb) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases)	std::cout << "FAIL popcount/findMsb/findLsb of " << to_binary(ia) << std::endl;
+			}
+		}
+		return nrOfFailedTests;
+	}
 }
 }
 
@@ -775,6 +973,24 @@ try {
 	nrOfFailedTestCases += ReportTestResult(VerifyRemainder<NBITS>(tag, bReportIndividualTestCases), type, "remainder");
 #undef NBITS
 
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbCarryChains<128>(tag, bReportIndividualTestCases), "integer<128>", "carry chains");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbCarryChains<200>(tag, bReportIndividualTestCases), "integer<200>", "carry chains");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbCarryChains<1024>(tag, bReportIndividualTestCases), "integer<1024>", "carry chains");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiplication<128>(tag, bReportIndividualTestCases), "integer<128>", "limb multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiplication<200>(tag, bReportIndividualTestCases), "integer<200>", "limb multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiplication<1024>(tag, bReportIndividualTestCases), "integer<1024>", "limb multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiplication<3500>(tag, bReportIndividualTestCases), "integer<3500>", "karatsuba multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiplication<7000>(tag, bReportIndividualTestCases), "integer<7000>", "karatsuba multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiplication<70000>(tag, bReportIndividualTestCases), "integer<70000>", "transform multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<64>(tag, bReportIndividualTestCases), "integer<64>", "limb division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<128>(tag, bReportIndividualTestCases), "integer<128>", "limb division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<200>(tag, bReportIndividualTestCases), "integer<200>", "limb division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<1024>(tag, bReportIndividualTestCases), "integer<1024>", "limb division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbShifts<64>(tag, bReportIndividualTestCases), "integer<64>", "shifts and rotations");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbShifts<130>(tag, bReportIndividualTestCases), "integer<130>", "shifts and rotations");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbShifts<200>(tag, bReportIndividualTestCases), "integer<200>", "shifts and rotations");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbShifts<1024>(tag, bReportIndividualTestCases), "integer<1024>", "shifts and rotations");
+
 #if STRESS_TESTING
 	type = "integer<16>";
 	// VerifyShortAddition compares an integer<16> to native short type to make certain it has all the same behavior
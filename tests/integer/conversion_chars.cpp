@@ -0,0 +1,219 @@
+// conversion_chars.cpp: functional tests for the to_chars/from_chars text conversions of arbitrary precision integers
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <cstdio>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 1
+#include <universal/integer/integer.hpp>
+#include <universal/integer/numeric_limits.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the decimal digits of an integer by repeated division by 10, the reference of the chunked conversions
+template<size_t nbits>
+std::string ReferenceDecimal(const sw::unum::integer<nbits>& v) {
+	using namespace sw::unum;
+	// the magnitude as an unsigned bit pattern in one more bit, so that the largest negative number is positive
+	integer<nbits + 1> w, ten(10);
+	w.bitcopy(v.sign() ? twos_complement(v) : v);
+	std::string digits;
+	do {
+		idiv_t<nbits + 1> qr = divmod(w, ten);
+		digits.insert(digits.begin(), char('0' + qr.rem.limb(0)));
+		w = qr.quot;
+	} while (!w.iszero());
+	return (v.sign() ? "-" : "") + digits;
+}
+
+template<size_t nbits>
+sw::unum::integer<nbits> RandomInteger() {
+	using namespace sw::unum;
+	integer<nbits> v;
+	// random limbs, and a random number of significant limbs
+	unsigned limbs = 1 + unsigned(rand()) % integer<nbits>::nrLimbs;
+	for (unsigned i = 0; i < limbs; ++i) v.setlimb(i, (uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand()));
+	if (rand() % 2) v = -v;
+	return v;
+}
+
+// decimal against the reference, and the round trip through every base
+template<size_t nbits>
+int ValidateCharsRoundTrip(const std::string& tag, bool bReportIndividualTestCases, const sw::unum::integer<nbits>& v) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	char buffer[nbits + 2];
+
+	integer_to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), v);
+	std::string decimal(buffer, r.ptr);
+	if (r.ec != std::errc() || decimal != ReferenceDecimal(v) || decimal != convert_to_decimal_string(v)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " to_chars " << decimal << " reference " << ReferenceDecimal(v) << '\n';
+	}
+	for (int base : { 10, 16, 8, 2 }) {
+		r = to_chars(buffer, buffer + sizeof(buffer), v, base);
+		integer<nbits> w;
+		integer_from_chars_result s = from_chars(buffer, r.ptr, w, base);
+		if (r.ec != std::errc() || s.ec != std::errc() || s.ptr != r.ptr || w != v) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " base " << base << " " << std::string(buffer, r.ptr) << " from_chars " << w << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+template<size_t nbits>
+int ValidateRandomChars(const std::string& tag, bool bReportIndividualTestCases, int nrOfRandoms) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, integer<nbits>(0));
+	nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, integer<nbits>(-1));
+	nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, max_int<nbits>());
+	nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, min_int<nbits>());
+	for (int i = 0; i < nrOfRandoms; ++i) {
+		nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, RandomInteger<nbits>());
+	}
+	return nrOfFailedTests;
+}
+
+// the native 64-bit integer formats of printf
+int ValidateNativeChars(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	char buffer[80], reference[80];
+	for (int i = 0; i < 10000; ++i) {
+		long long ll = (long long)((uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand())) >> (rand() % 63);
+		if (i % 2) ll = -ll;
+		integer<64> v(ll);
+		integer_to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), v);
+		snprintf(reference, sizeof(reference), "%lld", ll);
+		if (std::string(buffer, r.ptr) != reference) nrOfFailedTests++;
+		r = to_chars(buffer, buffer + sizeof(buffer), v, 16);
+		snprintf(reference, sizeof(reference), "%s%llx", (ll < 0 ? "-" : ""), (ll < 0 ? 0ull - (unsigned long long)ll : (unsigned long long)ll));
+		if (std::string(buffer, r.ptr) != reference) nrOfFailedTests++;
+		if (nrOfFailedTests > 0 && bReportIndividualTestCases) {
+			std::cerr << "FAIL " << tag << " " << ll << " " << std::string(buffer, r.ptr) << '\n';
+			return nrOfFailedTests;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+int ValidateCharsEdgeCases(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	char buffer[64];
+	integer<128> v = 42;
+
+	auto check = [&](bool pass, const char* what) {
+		if (!pass) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " " << what << '\n';
+		}
+	};
+
+	// the range of integer<128> is [-2^127, 2^127 - 1]
+	std::string maxText = "170141183460469231731687303715884105727";
+	std::string minText = "-170141183460469231731687303715884105728";
+	integer_from_chars_result s = from_chars(maxText.data(), maxText.data() + maxText.size(), v);
+	check(s.ec == std::errc() && v == max_int<128>(), "max_int");
+	s = from_chars(minText.data(), minText.data() + minText.size(), v);
+	check(s.ec == std::errc() && v == min_int<128>(), "min_int");
+	std::string text = "170141183460469231731687303715884105728";
+	v = 42;
+	s = from_chars(text.data(), text.data() + text.size(), v);
+	check(s.ec == std::errc::result_out_of_range && s.ptr == text.data() + text.size() && v == 42, "max_int + 1 out of range");
+	text = "-170141183460469231731687303715884105729";
+	s = from_chars(text.data(), text.data() + text.size(), v);
+	check(s.ec == std::errc::result_out_of_range && v == 42, "min_int - 1 out of range");
+	text = "800000000000000000000000000000000";
+	s = from_chars(text.data(), text.data() + text.size(), v, 16);
+	check(s.ec == std::errc::result_out_of_range, "hex out of range");
+	text = "-80000000000000000000000000000000";
+	s = from_chars(text.data(), text.data() + text.size(), v, 16);
+	check(s.ec == std::errc() && v == min_int<128>(), "hex min_int");
+
+	// the longest prefix of digits, leading zeros, and no digits at all
+	text = "000123abc";
+	s = from_chars(text.data(), text.data() + text.size(), v);
+	check(s.ec == std::errc() && s.ptr == text.data() + 6 && v == 123, "prefix");
+	text = "-0";
+	s = from_chars(text.data(), text.data() + text.size(), v);
+	check(s.ec == std::errc() && v.iszero(), "minus zero");
+	text = "+1";
+	s = from_chars(text.data(), text.data() + text.size(), v);
+	check(s.ec == std::errc::invalid_argument && s.ptr == text.data(), "no digits");
+	text = "-";
+	s = from_chars(text.data(), text.data() + text.size(), v);
+	check(s.ec == std::errc::invalid_argument && s.ptr == text.data(), "sign only");
+
+	// a buffer that is too small
+	v = -12345;
+	integer_to_chars_result r = to_chars(buffer, buffer + 5, v);
+	check(r.ec == std::errc::value_too_large && r.ptr == buffer + 5, "value too large");
+	r = to_chars(buffer, buffer + 6, v);
+	check(r.ec == std::errc() && std::string(buffer, r.ptr) == "-12345", "exact buffer");
+
+	// parse and the stream operators
+	integer<128> p;
+	check(parse("123456789012345678901234567890", p) && convert_to_decimal_string(p) == "123456789012345678901234567890", "parse");
+	check(!parse(maxText + "0", p), "parse out of range");
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "to_chars/from_chars failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases(tag, true), "integer<128>", "chars edge cases");
+
+#else
+
+	cout << "Integer to_chars/from_chars validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateNativeChars(tag, bReportIndividualTestCases), "integer<64>", "native chars");
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases(tag, bReportIndividualTestCases), "integer<128>", "chars edge cases");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<8>(tag, bReportIndividualTestCases, 1000), "integer<8>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<64>(tag, bReportIndividualTestCases, 1000), "integer<64>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<128>(tag, bReportIndividualTestCases, 1000), "integer<128>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<1000>(tag, bReportIndividualTestCases, 100), "integer<1000>", "chars round trip");
+	// divide and conquer from 24 limbs up
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<1536>(tag, bReportIndividualTestCases, 100), "integer<1536>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<4096>(tag, bReportIndividualTestCases, 20), "integer<4096>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<10000>(tag, bReportIndividualTestCases, 5), "integer<10000>", "chars round trip");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<128>(tag, bReportIndividualTestCases, 1000000), "integer<128>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<4096>(tag, bReportIndividualTestCases, 10000), "integer<4096>", "chars round trip");
+#endif // STRESS_TESTING
+
+#endif // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,312 @@
+// math_functions.cpp: functional tests for the gcd, lcm, isqrt, powmod, factorial, and binomial functions of arbitrary precision integers
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <vector>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 1
+#include <universal/integer/integer>
+#include <universal/functions/factorial.hpp>
+#include <universal/functions/binomial.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+template<size_t nbits>
+sw::unum::integer<nbits> RandomInteger() {
+	using namespace sw::unum;
+	integer<nbits> v;
+	// random limbs, and a random number of significant limbs
+	unsigned limbs = 1 + unsigned(rand()) % integer<nbits>::nrLimbs;
+	for (unsigned i = 0; i < limbs; ++i) v.setlimb(i, (uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand()));
+	if (rand() % 2) v = -v;
+	return v;
+}
+
+// the magnitude of a number in one more bit, so that the largest negative number is positive
+template<size_t nbits>
+sw::unum::integer<nbits + 1> Magnitude(const sw::unum::integer<nbits>& v) {
+	sw::unum::integer<nbits + 1> m;
+	m.bitcopy(v.sign() ? twos_complement(v) : v);
+	return m;
+}
+
+// Euclid's algorithm on the magnitudes is the reference of the binary gcd
+template<size_t nbits>
+int ValidateGcd(const std::string& tag, bool bReportIndividualTestCases, int nrOfRandoms) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	for (int i = 0; i < nrOfRandoms; ++i) {
+		integer<nbits> a = RandomInteger<nbits>(), b = RandomInteger<nbits>();
+		// common factors of two and a common odd factor
+		if (i % 3 == 0) {
+			integer<nbits> f = RandomInteger<nbits>();
+			f >>= signed(nbits / 2);
+			a >>= signed(nbits / 2);
+			b >>= signed(nbits / 2 + 3);
+			a *= f;
+			b *= f;
+			a <<= 5;
+			b <<= 3;
+		}
+		if (i == 0) a = 0;
+		if (i == 1) b = min_int<nbits>();
+		integer<nbits + 1> u = Magnitude(a), v = Magnitude(b);
+		while (!v.iszero()) {
+			integer<nbits + 1> r = u % v;
+			u = v;
+			v = r;
+		}
+		integer<nbits> g = gcd(a, b);
+		if (Magnitude(g) != u) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " gcd(" << a << ", " << b << ") = " << g << " reference " << u << '\n';
+		}
+		// the lcm of the magnitudes divided by each one leaves no remainder
+		if (!a.iszero() && !b.iszero() && findMsb(a) + findMsb(b) < signed(nbits) - 2) {
+			integer<nbits> l = lcm(a, b);
+			if (l.sign() || !(l % a).iszero() || !(l % b).iszero() || gcd(l / a, l / b) != integer<nbits>(1)) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " lcm(" << a << ", " << b << ") = " << l << '\n';
+			}
+		}
+	}
+	if (!gcd(integer<nbits>(0), integer<nbits>(0)).iszero() || !lcm(integer<nbits>(0), integer<nbits>(7)).iszero()) nrOfFailedTests++;
+	return nrOfFailedTests;
+}
+
+// floor(sqrt(a)) is the x with x^2 <= a < (x + 1)^2
+template<size_t nbits>
+int ValidateIsqrt(const std::string& tag, bool bReportIndividualTestCases, int nrOfRandoms) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	for (int i = 0; i < nrOfRandoms; ++i) {
+		integer<nbits> a = RandomInteger<nbits>();
+		if (a.sign()) a = -a;
+		if (i < 64) a = integer<nbits>(i);
+		if (i == 64) a = max_int<nbits>();
+		if (i == 65 && nbits > 2) {
+			// a perfect square and its neighbours
+			a = max_int<nbits>();
+			a >>= signed(nbits / 2);
+			a *= a;
+		}
+		integer<nbits> x = isqrt(a);
+		integer<2 * nbits> square = multiply(x, x), next = multiply(x + 1, x + 1), wa;
+		wa.bitcopy(a);
+		if (x.sign() || wa < square || !(wa < next)) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " isqrt(" << a << ") = " << x << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// square and multiply with the remainders of the products in twice the width is the reference of both powmod paths
+template<size_t nbits>
+sw::unum::integer<nbits> ReferencePowmod(const sw::unum::integer<nbits>& base, const sw::unum::integer<nbits>& exponent, const sw::unum::integer<nbits>& modulus) {
+	using namespace sw::unum;
+	integer<2 * nbits + 2> m, b, r(1);
+	m.bitcopy(Magnitude(modulus));
+	b.bitcopy(Magnitude(base));
+	b %= m;
+	if (base.sign() && !b.iszero()) b = m - b;
+	for (signed i = findMsb(exponent); i >= 0; --i) {
+		r = (r * r) % m;
+		if (exponent.at(unsigned(i))) r = (r * b) % m;
+	}
+	r %= m;
+	integer<nbits> result;
+	result.bitcopy(r);
+	return result;
+}
+
+template<size_t nbits>
+int ValidatePowmod(const std::string& tag, bool bReportIndividualTestCases, int nrOfRandoms) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	for (int i = 0; i < nrOfRandoms; ++i) {
+		integer<nbits> base = RandomInteger<nbits>(), exponent = RandomInteger<nbits>(), modulus = RandomInteger<nbits>();
+		if (exponent.sign()) exponent = -exponent;
+		// odd and even moduli, small moduli and exponents, and the largest negative modulus
+		if (i % 2) modulus.set(0); else modulus.reset(0);
+		if (i % 7 == 0) modulus >>= signed(nbits - 8);
+		if (i % 5 == 0) exponent >>= signed(nbits - 6);
+		if (i == 0) modulus = min_int<nbits>();
+		if (modulus.iszero()) modulus = 2;
+		integer<nbits> result = powmod(base, exponent, modulus), reference = ReferencePowmod(base, exponent, modulus);
+		if (result != reference) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " powmod(" << base << ", " << exponent << ", " << modulus << ") = " << result << " reference " << reference << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the Montgomery domain round trip, and Fermat's little theorem for the prime 2^127 - 1
+int ValidateMontgomery(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	integer<256> p = 1;
+	p <<= 127;
+	p -= 1;
+	montgomery<256> mont(p);
+	for (int i = 0; i < 100; ++i) {
+		integer<256> a = RandomInteger<256>() % p, b = RandomInteger<256>() % p;
+		if (a.sign()) a += p;
+		if (b.sign()) b += p;
+		integer<256> product = mont.from_montgomery(mont.multiply(mont.to_montgomery(a), mont.to_montgomery(b)));
+		if (mont.from_montgomery(mont.to_montgomery(a)) != a || product != (a * b) % p || (!a.iszero() && mont.power(a, p - 1) != integer<256>(1))) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " montgomery " << a << " " << b << '\n';
+		}
+	}
+	try {
+		montgomery<256> even(integer<256>(10));
+		nrOfFailedTests++;
+	}
+	catch (const integer_even_modulus&) {}
+	try {
+		powmod(integer<128>(3), integer<128>(-1), integer<128>(7));
+		nrOfFailedTests++;
+	}
+	catch (const integer_negative_exponent&) {}
+	if (powmod(integer<128>(3), integer<128>(0), integer<128>(1)) != integer<128>(0)) nrOfFailedTests++;
+	if (powmod(integer<128>(-3), integer<128>(3), integer<128>(-7)) != integer<128>(1)) nrOfFailedTests++;
+	return nrOfFailedTests;
+}
+
+// the factorial table against the iteration, and the binomials against the rows of Pascal's triangle
+template<size_t nbits>
+int ValidateFactorialBinomial(const std::string& tag, bool bReportIndividualTestCases, unsigned rows) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	integer<nbits> product = 1;
+	for (unsigned n = 0; n < rows; ++n) {
+		if (n > 1) product *= integer<nbits>(n);
+		// the wrapped factorials beyond the table
+		if (sw::function::factorial(integer<nbits>(n)) != product || sw::function::factoriali<integer<nbits>>(integer<nbits>(n)) != product) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " factorial(" << n << ") = " << sw::function::factorial(integer<nbits>(n)) << " reference " << product << '\n';
+		}
+	}
+	std::vector< integer<nbits> > row(1, integer<nbits>(1));
+	for (unsigned n = 0; n < rows; ++n) {
+		for (unsigned k = 0; k <= n; ++k) {
+			if (binomial(integer<nbits>(n), integer<nbits>(k)) != row[k]) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " binomial(" << n << ", " << k << ") = " << binomial(integer<nbits>(n), integer<nbits>(k)) << " reference " << row[k] << '\n';
+			}
+		}
+		if (!binomial(integer<nbits>(n), integer<nbits>(n + 1)).iszero() || !binomial(integer<nbits>(n), integer<nbits>(-1)).iszero()) nrOfFailedTests++;
+		row.push_back(integer<nbits>(1));
+		for (unsigned k = n; k > 0; --k) row[k] += row[k - 1];
+	}
+	// the generic iteration agrees with the table
+	if (sw::function::BinomialCoefficient<integer<nbits>>(integer<nbits>(30), integer<nbits>(12)) != sw::function::BinomialCoefficient(integer<nbits>(30), integer<nbits>(12))) nrOfFailedTests++;
+	return nrOfFailedTests;
+}
+
+// binomials of an n wider than 64 bits wrap around modulo 2^nbits: the reference is the exact quotient in a wider integer
+template<size_t nbits>
+int ValidateWideBinomial(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Wide = integer<8 * nbits>;
+	int nrOfFailedTests = 0;
+	for (unsigned shift : { 64u, 100u, unsigned(nbits) - 2 }) {
+		integer<nbits> n(1);
+		n <<= signed(shift);
+		n += integer<nbits>(int(shift % 7) + 5);
+		Wide wn;
+		wn.bitcopy(n);
+		Wide numerator(1), denominator(1);
+		for (int k = 0; k <= 6; ++k) {
+			if (k > 0) {
+				numerator *= wn - Wide(k - 1);
+				denominator *= Wide(k);
+			}
+			integer<nbits> reference;
+			reference.bitcopy(numerator / denominator);
+			if (binomial(n, integer<nbits>(k)) != reference || binomial(n, n - integer<nbits>(k)) != reference) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " binomial(" << n << ", " << k << ") = " << binomial(n, integer<nbits>(k)) << " reference " << reference << '\n';
+			}
+		}
+	}
+	// the factorial of a negative number has no value
+	try {
+		factorial(integer<nbits>(-1));
+		nrOfFailedTests++;
+	}
+	catch (const integer_negative_factorial_arg&) {
+		// correctly caught the exception
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "math functions failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePowmod<128>(tag, true, 10), "integer<128>", "powmod");
+
+#else
+
+	cout << "Integer math function validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateGcd<8>(tag, bReportIndividualTestCases, 1000), "integer<8>", "gcd/lcm");
+	nrOfFailedTestCases += ReportTestResult(ValidateGcd<64>(tag, bReportIndividualTestCases, 1000), "integer<64>", "gcd/lcm");
+	nrOfFailedTestCases += ReportTestResult(ValidateGcd<128>(tag, bReportIndividualTestCases, 1000), "integer<128>", "gcd/lcm");
+	nrOfFailedTestCases += ReportTestResult(ValidateGcd<1000>(tag, bReportIndividualTestCases, 100), "integer<1000>", "gcd/lcm");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateIsqrt<8>(tag, bReportIndividualTestCases, 200), "integer<8>", "isqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateIsqrt<64>(tag, bReportIndividualTestCases, 1000), "integer<64>", "isqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateIsqrt<128>(tag, bReportIndividualTestCases, 1000), "integer<128>", "isqrt");
+	nrOfFailedTestCases += ReportTestResult(ValidateIsqrt<1000>(tag, bReportIndividualTestCases, 100), "integer<1000>", "isqrt");
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePowmod<16>(tag, bReportIndividualTestCases, 1000), "integer<16>", "powmod");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowmod<64>(tag, bReportIndividualTestCases, 1000), "integer<64>", "powmod");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowmod<128>(tag, bReportIndividualTestCases, 500), "integer<128>", "powmod");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowmod<500>(tag, bReportIndividualTestCases, 50), "integer<500>", "powmod");
+	nrOfFailedTestCases += ReportTestResult(ValidateMontgomery(tag, bReportIndividualTestCases), "integer<256>", "montgomery");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateFactorialBinomial<16>(tag, bReportIndividualTestCases, 40), "integer<16>", "factorial/binomial");
+	nrOfFailedTestCases += ReportTestResult(ValidateFactorialBinomial<64>(tag, bReportIndividualTestCases, 80), "integer<64>", "factorial/binomial");
+	nrOfFailedTestCases += ReportTestResult(ValidateFactorialBinomial<128>(tag, bReportIndividualTestCases, 140), "integer<128>", "factorial/binomial");
+	nrOfFailedTestCases += ReportTestResult(ValidateWideBinomial<128>(tag, bReportIndividualTestCases), "integer<128>", "wide binomial");
+	nrOfFailedTestCases += ReportTestResult(ValidateWideBinomial<256>(tag, bReportIndividualTestCases), "integer<256>", "wide binomial");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateGcd<4096>(tag, bReportIndividualTestCases, 1000), "integer<4096>", "gcd/lcm");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowmod<1024>(tag, bReportIndividualTestCases, 100), "integer<1024>", "powmod");
+#endif // STRESS_TESTING
+
+#endif // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
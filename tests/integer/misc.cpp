@@ -44,14 +44,15 @@ void TestSizeof() {
 	int1024 o;
 
 	constexpr int WIDTH = 30;
-	cout << setw(WIDTH) << typeid(a).name() << "  size in bytes " << a.nrBytes << endl;
-	cout << setw(WIDTH) << typeid(k).name() << "  size in bytes " << k.nrBytes << endl;
-	cout << setw(WIDTH) << typeid(m).name() << "  size in bytes " << m.nrBytes << endl;
-	cout << setw(WIDTH) << typeid(o).name() << "  size in bytes " << o.nrBytes << endl;
-	if (a.nrBytes != sizeof(a)) pass = false;
-	if (k.nrBytes != sizeof(k)) pass = false;
-	if (m.nrBytes != sizeof(m)) pass = false;
-	if (o.nrBytes != sizeof(o)) pass = false;
+	// the storage is a whole number of 64-bit limbs
+	cout << setw(WIDTH) << typeid(a).name() << "  size in bytes " << a.nrBytes << "  storage " << a.nrLimbs << " limbs" << endl;
+	cout << setw(WIDTH) << typeid(k).name() << "  size in bytes " << k.nrBytes << "  storage " << k.nrLimbs << " limbs" << endl;
+	cout << setw(WIDTH) << typeid(m).name() << "  size in bytes " << m.nrBytes << "  storage " << m.nrLimbs << " limbs" << endl;
+	cout << setw(WIDTH) << typeid(o).name() << "  size in bytes " << o.nrBytes << "  storage " << o.nrLimbs << " limbs" << endl;
+	if (a.nrLimbs * sizeof(uint64_t) != sizeof(a)) pass = false;
+	if (k.nrLimbs * sizeof(uint64_t) != sizeof(k)) pass = false;
+	if (m.nrLimbs * sizeof(uint64_t) != sizeof(m)) pass = false;
+	if (o.nrLimbs * sizeof(uint64_t) != sizeof(o)) pass = false;
 
 	cout << (pass ? "PASS" : "FAIL") << endl;
 }
@@ -95,6 +96,30 @@ void TestFindMsb() {
 	cout << (pass ? "PASS" : "FAIL") << endl;
 }
 
+void TestFindLsb() {
+	using namespace std;
+	using namespace sw::unum;
+
+	cout << endl << "TestFindLsb" << endl;
+	bool pass = true;
+	integer<128> a;
+	a.setlimb(0, 0xAAAAAAAAAAAAAAA0ull);
+	a.setlimb(1, 0x8000000000000001ull);
+	int golden_ref[] = { 5, 7, 9 };
+	for (int i = 0; i < int(sizeof(golden_ref) / sizeof(int)); ++i) {
+		int lsb = findLsb(a);
+		cout << "lsb of " << to_binary(a) << " is " << lsb << endl;
+		if (lsb >= 0) a.reset(lsb);
+		if (lsb != golden_ref[i]) pass = false;
+	}
+	a.setlimb(0, 0);
+	if (findLsb(a) != 64 || a.popcount() != 2) pass = false;
+	a.clear();
+	if (findLsb(a) != -1 || findMsb(a) != -1 || a.popcount() != 0) pass = false;
+
+	cout << (pass ? "PASS" : "FAIL") << endl;
+}
+
 // enumerate a couple ratios to test representability
 void ReproducibilityTestSuite() {
 	for (int i = 0; i < 30; i += 3) {
@@ -120,6 +145,7 @@ try {
 	TestSizeof();
 	TestConversion();
 	TestFindMsb();
+	TestFindLsb();
 	ReproducibilityTestSuite();
 
 	cout << "done" << endl;
@@ -6,9 +6,17 @@
 #include <iostream>
 #include <string>
 // configure the integer arithmetic class
+// first: enable the native register specializations of integer<8>, integer<16>, integer<32>, integer<64>, and integer<128>
+#define INTEGER_FAST_SPECIALIZATION
+// second: enable integer arithmetic exceptions
 #define INTEGER_THROW_ARITHMETIC_EXCEPTION 1
+// third: compute the NTT convolutions modulo the three primes on their own threads
+#define NTT_MULTITHREADED 1
 #include <universal/integer/integer.hpp>
 #include <universal/integer/numeric_limits.hpp>
+#include <universal/integer/math_functions.hpp>
+#include <universal/functions/factorial.hpp>
+#include <universal/functions/binomial.hpp>
 // is representable
 #include <universal/functions/isrepresentable.hpp>
 // test helpers, such as, ReportTestResults
@@ -38,13 +46,26 @@ void ShiftPerformanceTest() {
 	integer<nbits> a = 0xFFFFFFFF;
 	steady_clock::time_point begin = steady_clock::now();
 	for (uint64_t i = 0; i < NR_OPS; ++i) {
-		a >>= 8;
-		a <<= 8;
+		// a varying shift amount keeps the optimizer from folding the loop
+		a >>= signed(i % 71);
+		a <<= signed(i % 71);
 	}
 	steady_clock::time_point end = steady_clock::now();
 	duration<double> time_span = duration_cast<duration<double>>(end - begin);;
 	double elapsed = time_span.count();
 	cout << "performance is " << double(NR_OPS) / elapsed << " integer<" << nbits << "> shifts/sec" << endl;
+
+	unsigned count = a.popcount();
+	a = 0xFFFFFFFF;
+	begin = steady_clock::now();
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		a.rotl(unsigned(i % 71));
+		count += a.popcount();
+	}
+	end = steady_clock::now();
+	time_span = duration_cast<duration<double>>(end - begin);
+	elapsed = time_span.count();
+	cout << "performance is " << double(NR_OPS) / elapsed << " integer<" << nbits << "> rotations+popcounts/sec" << (count == 0 ? " (zero)" : "") << endl;
 }
 
 // do we need to fix the performance of the shift operator?
@@ -59,6 +80,14 @@ void TestShiftOperatorPerformance() {
 	ShiftPerformanceTest<128>();
 	ShiftPerformanceTest<1024>();
 	/*
+	performance of the limb move and funnel shift implementation of the shift operators
+		performance is 2.95053e+08 integer<16> shifts/sec
+		performance is 3.40618e+08 integer<32> shifts/sec
+		performance is 2.89198e+08 integer<64> shifts/sec
+		performance is 9.12295e+07 integer<128> shifts/sec
+		performance is 1.14482e+07 integer<1024> shifts/sec
+		performance is 6.55774e+06 integer<1024> rotations+popcounts/sec
+
 	performance of the serial implementation of the shift operators
 		performance is 1.99374e+07 integer<16> shifts / sec
 		performance is 8.44852e+06 integer<32> shifts / sec
@@ -68,67 +97,84 @@ void TestShiftOperatorPerformance() {
 	*/
 }
 
+// the number of operations per second of a kernel that performs nrOps operations
+template<typename Kernel>
+double OperationsPerSecond(uint64_t nrOps, Kernel kernel) {
+	using namespace std::chrono;
+	steady_clock::time_point begin = steady_clock::now();
+	kernel();
+	steady_clock::time_point end = steady_clock::now();
+	duration<double> time_span = duration_cast<duration<double>>(end - begin);
+	return double(nrOps) / time_span.count();
+}
+
 template<size_t nbits>
 void ArithmeticPerformanceTest() {
 	using namespace std;
-	using namespace std::chrono;
+	using namespace sw::unum;
 
 	constexpr uint64_t NR_OPS = 1000000;
-
-	steady_clock::time_point begin, end;
-	duration<double> time_span;
-	double elapsed;
+	// multiplication and division are quadratic in nbits
+	constexpr uint64_t NR_SLOW_OPS = (NR_OPS * 256 / (nbits * nbits)) > 100 ? (NR_OPS * 256 / (nbits * nbits)) : 100;
 
 	integer<nbits> a, b, c, d;
 	for (int i = 0; i < int(a.nrBytes); ++i) {
-		a.setbyte(i, rand());
-		b.setbyte(i, rand());
-	}
-	begin = steady_clock::now();
-	for (uint64_t i = 0; i < NR_OPS; ++i) {
-		c = a + b;
-		a = c - b;
-	}
-	end = steady_clock::now();
-	time_span = duration_cast<duration<double>>(end - begin);;
-	 elapsed = time_span.count();
-	cout << "performance is " << double(NR_OPS) / elapsed << " integer<" << nbits << "> additions/subtractions" << endl;
-
-	begin = steady_clock::now();
-	for (uint64_t i = 0; i < NR_OPS; ++i) {
-		c = a * b;
-		c.clear();
-		d = c;
-	}
-	end = steady_clock::now();
-	time_span = duration_cast<duration<double>>(end - begin);;
-	elapsed = time_span.count();
-	cout << "performance is " << double(NR_OPS) / elapsed << " integer<" << nbits << "> multiplications" << endl;
-
-	begin = steady_clock::now();
-	for (uint64_t i = 0; i < NR_OPS; ++i) {
-		c = a / b;
-		c.clear();
-		d = c;
+		a.setbyte(i, uint8_t(rand()));
+		b.setbyte(i, uint8_t(rand()));
 	}
-	end = steady_clock::now();
-	time_span = duration_cast<duration<double>>(end - begin);;
-	elapsed = time_span.count();
-	cout << "performance is " << double(NR_OPS) / elapsed << " integer<" << nbits << "> divisions" << endl;
+	// a divisor of half the width, so that the quotient has nbits/2 significant bits
+	for (unsigned i = nbits / 2; i < nbits; ++i) b.reset(i);
+	b.set(0);
+
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) c += a; }) << " integer<" << nbits << "> additions/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) c -= a; }) << " integer<" << nbits << "> subtractions/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_SLOW_OPS, [&]() { for (uint64_t i = 0; i < NR_SLOW_OPS; ++i) { c = a * b; d += c; } }) << " integer<" << nbits << "> multiplications/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_SLOW_OPS, [&]() { for (uint64_t i = 0; i < NR_SLOW_OPS; ++i) { c = a / b; d += c; } }) << " integer<" << nbits << "> divisions/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_SLOW_OPS, [&]() { for (uint64_t i = 0; i < NR_SLOW_OPS; ++i) { c = a % b; d += c; } }) << " integer<" << nbits << "> remainders/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) c = -c; }) << " integer<" << nbits << "> negations/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) ++c; }) << " integer<" << nbits << "> increments/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) --c; }) << " integer<" << nbits << "> decrements/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) c.flip(); }) << " integer<" << nbits << "> one's complements/sec" << endl;
+	// equal operands are the worst case of the comparisons: every limb is compared
+	c = a;
+	size_t nrTrue = 0;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) nrTrue += (a == c); }) << " integer<" << nbits << "> equal comparisons/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) nrTrue += (a < c); }) << " integer<" << nbits << "> less than comparisons/sec" << endl;
+	if (nrTrue != NR_OPS || d.iszero()) cout << "(results " << nrTrue << " " << d << ")" << endl;
 }
 
 void TestArithmeticOperatorPerformance() {
 	using namespace std;
 
-	cout << endl << "TestShiftOperatorPerformance" << endl;
+	cout << endl << "TestArithmeticOperatorPerformance" << endl;
 
 	ArithmeticPerformanceTest<16>();
 	ArithmeticPerformanceTest<32>();
 	ArithmeticPerformanceTest<64>();
 	ArithmeticPerformanceTest<128>();
-//	ArithmeticPerformanceTest<1024>();
+	ArithmeticPerformanceTest<256>();
+	ArithmeticPerformanceTest<1024>();
 	/*
-		TestShiftOperatorPerformance
+		performance of the limb multiply, schoolbook with 64x64->128 bit products, Karatsuba above 48 limbs
+		performance is 2.86517e+07 integer<256> multiplications/sec
+		performance is 3.9502e+06 integer<1024> multiplications/sec
+
+		performance of the 64-bit limb implementation, add/sub are carry chains, mul/div are still bit-serial
+		(rates above 1e12 ops/sec are loops the optimizer folded into a closed form)
+		performance is 8.20659e+08 integer<16> additions/sec
+		performance is 1.94681e+06 integer<16> multiplications/sec
+		performance is 2.96022e+06 integer<16> divisions/sec
+		performance is 2.49972e+09 integer<128> additions/sec
+		performance is 16581.4 integer<128> multiplications/sec
+		performance is 31677.2 integer<128> divisions/sec
+		performance is 1.85854e+08 integer<256> additions/sec
+		performance is 1.89362e+08 integer<256> less than comparisons/sec
+		performance is 3.37893e+07 integer<1024> additions/sec
+		performance is 280.668 integer<1024> multiplications/sec
+		performance is 586.093 integer<1024> divisions/sec
+		performance is 1.08978e+08 integer<1024> equal comparisons/sec
+
+		performance of the byte-serial implementation
 		performance is 1.01249e+08 integer<16> additions/subtractions
 		performance is 1.45226e+06 integer<16> multiplications
 		performance is 3.05808e+07 integer<16> divisions
@@ -147,6 +193,277 @@ void TestArithmeticOperatorPerformance() {
 	*/
 }
 
+// the division of a full width dividend by a single limb, a half width, and a nearly full width divisor
+template<size_t nbits>
+void DivisionPerformanceTest() {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr uint64_t NR_OPS = 200000;
+	constexpr unsigned nrLimbs = integer<nbits>::nrLimbs;
+
+	integer<nbits> a, b, c;
+	for (unsigned i = 0; i < nrLimbs; ++i) a.setlimb(i, 0x9E3779B97F4A7C15ull * (i + 1));
+	a.reset(nbits - 1);
+	const unsigned divisorLimbs[] = { 1, (nrLimbs + 1) / 2, nrLimbs > 1 ? nrLimbs - 1 : 1 };
+	unsigned previous = 0;
+	for (unsigned limbs : divisorLimbs) {
+		if (limbs == previous) continue;
+		previous = limbs;
+		b.clear();
+		for (unsigned i = 0; i < limbs; ++i) b.setlimb(i, 0xC2B2AE3D27D4EB4Full * (i + 3));
+		b.reset(nbits - 1);
+		c.clear();
+		double rate = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { idiv_t<nbits> qr = divmod(a, b); c += qr.quot; c += qr.rem; } });
+		cout << "performance is " << rate << " integer<" << nbits << "> divmods/sec by a " << limbs << " limb divisor" << (c.iszero() ? " (zero)" : "") << endl;
+	}
+}
+
+void TestDivisionPerformance() {
+	using namespace std;
+
+	cout << endl << "TestDivisionPerformance" << endl;
+
+	DivisionPerformanceTest<64>();
+	DivisionPerformanceTest<128>();
+	DivisionPerformanceTest<256>();
+	DivisionPerformanceTest<512>();
+	DivisionPerformanceTest<1024>();
+	DivisionPerformanceTest<2048>();
+	DivisionPerformanceTest<4096>();
+	/*
+		performance of Knuth's Algorithm D on 64-bit limbs
+		performance is 2.24854e+08 integer<64> divmods/sec by a 1 limb divisor
+		performance is 6.59321e+07 integer<128> divmods/sec by a 1 limb divisor
+		performance is 3.49229e+07 integer<256> divmods/sec by a 1 limb divisor
+		performance is 1.83265e+07 integer<256> divmods/sec by a 2 limb divisor
+		performance is 4.87297e+06 integer<1024> divmods/sec by a 1 limb divisor
+		performance is 2.86665e+06 integer<1024> divmods/sec by a 8 limb divisor
+		performance is 4.20731e+06 integer<1024> divmods/sec by a 15 limb divisor
+		performance is 1.16258e+06 integer<4096> divmods/sec by a 1 limb divisor
+		performance is 347047 integer<4096> divmods/sec by a 32 limb divisor
+		performance is 1.10013e+06 integer<4096> divmods/sec by a 63 limb divisor
+		the bit-serial long division did 586 integer<1024> divisions/sec by a 512-bit divisor
+	*/
+}
+
+// decimal to_chars and from_chars of full width values
+template<size_t nbits>
+void DecimalConversionPerformanceTest() {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr uint64_t NR_OPS = (2000000000ull / (nbits * nbits)) > 100 ? (2000000000ull / (nbits * nbits)) : 100;
+
+	integer<nbits> a, b;
+	for (unsigned i = 0; i < a.nrLimbs; ++i) a.setlimb(i, 0x9E3779B97F4A7C15ull * (i + 1));
+	char buffer[nbits + 2];
+	integer_to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), a);
+	size_t nrDigits = 0;
+	double to = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { a.setlimb(0, i); nrDigits += size_t(to_chars(buffer, buffer + sizeof(buffer), a).ptr - buffer); } });
+	double from = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { buffer[2] = char('0' + i % 10); from_chars(buffer, r.ptr, b); nrDigits += b.limb(0) & 1; } });
+	cout << "performance is " << to << " integer<" << nbits << "> to_chars/sec and " << from << " from_chars/sec" << (nrDigits == 0 ? " (zero)" : "") << endl;
+}
+
+void TestDecimalConversionPerformance() {
+	using namespace std;
+
+	cout << endl << "TestDecimalConversionPerformance" << endl;
+
+	DecimalConversionPerformanceTest<128>();
+	DecimalConversionPerformanceTest<512>();
+	DecimalConversionPerformanceTest<1024>();
+	DecimalConversionPerformanceTest<2048>();
+	DecimalConversionPerformanceTest<4096>();
+	DecimalConversionPerformanceTest<8192>();
+	DecimalConversionPerformanceTest<16384>();
+	DecimalConversionPerformanceTest<65536>();
+	/*
+		performance of the chunked and divide and conquer decimal conversions
+		performance is 6.62883e+06 integer<128> to_chars/sec and 7.26661e+06 from_chars/sec
+		performance is 400781 integer<1024> to_chars/sec and 782262 from_chars/sec
+		performance is 61617.5 integer<4096> to_chars/sec and 136733 from_chars/sec
+		performance is 6865.09 integer<16384> to_chars/sec and 13228.9 from_chars/sec
+		performance is 585.613 integer<65536> to_chars/sec and 1660.29 from_chars/sec
+		the doubling of a digit vector in convert_to_decimal_string did 34 integer<4096> conversions/sec
+	*/
+}
+
+// element-wise kernels on vectors of native integers and of integer<nbits>, the rotating index keeps the rounds from folding
+template<typename Int>
+void NativeComparisonTest(const std::string& name) {
+	using namespace std;
+
+	constexpr size_t N = 1024;
+	constexpr uint64_t NR_OPS = 4 * 1024 * 1024;
+	constexpr uint64_t NR_ROUNDS = NR_OPS / N;
+
+	// operands whose products and sums of products fit 32 bits, and nonzero divisors
+	vector<Int> x(N), y(N), z(N);
+	for (size_t i = 0; i < N; ++i) {
+		x[i] = Int(rand() % 2001 - 1000);
+		y[i] = Int(rand() % 1000 + 1);
+	}
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t r = 0; r < NR_ROUNDS; ++r) for (size_t i = 0; i < N; ++i) z[i] = x[i] + y[(i + r) & (N - 1)]; }) << ' ' << name << " additions/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t r = 0; r < NR_ROUNDS; ++r) for (size_t i = 0; i < N; ++i) z[i] = x[i] * y[(i + r) & (N - 1)]; }) << ' ' << name << " multiplications/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t r = 0; r < NR_ROUNDS; ++r) for (size_t i = 0; i < N; ++i) z[i] = x[i] / y[(i + r) & (N - 1)]; }) << ' ' << name << " divisions/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t r = 0; r < NR_ROUNDS; ++r) for (size_t i = 0; i < N; ++i) z[i] = (x[i] < y[(i + r) & (N - 1)] ? x[i] : y[i]); }) << ' ' << name << " less than selections/sec" << endl;
+	Int sum = Int(0);
+	for (size_t i = 0; i < N; ++i) sum += z[i];
+	if (sum == Int(0)) cout << "(zero)" << endl;
+}
+
+void TestNativeComparison() {
+	using namespace std;
+	using namespace sw::unum;
+
+	cout << endl << "TestNativeComparison" << endl;
+
+	NativeComparisonTest<int32_t>("int32_t    ");
+	NativeComparisonTest< integer<32> >("integer<32>");
+	NativeComparisonTest<int64_t>("int64_t    ");
+	NativeComparisonTest< integer<64> >("integer<64>");
+	/*
+		performance of the native register specializations, INTEGER_FAST_SPECIALIZATION
+		performance is 1.21769e+09 int32_t     additions/sec
+		performance is 1.3114e+09 int32_t     multiplications/sec
+		performance is 3.99789e+08 int32_t     divisions/sec
+		performance is 2.36201e+08 int32_t     less than selections/sec
+		performance is 1.25414e+09 integer<32> additions/sec
+		performance is 1.12065e+09 integer<32> multiplications/sec
+		performance is 3.70926e+08 integer<32> divisions/sec
+		performance is 2.23134e+08 integer<32> less than selections/sec
+		performance is 2.36209e+08 int64_t     divisions/sec
+		performance is 2.33841e+08 integer<64> divisions/sec
+		performance is 2.12257e+08 integer<64> less than selections/sec
+
+		performance of the limb implementation
+		performance is 1.26648e+09 integer<32> additions/sec
+		performance is 7.93868e+08 integer<32> multiplications/sec
+		performance is 1.05547e+08 integer<32> divisions/sec
+		performance is 1.46895e+08 integer<32> less than selections/sec
+		performance is 1.42397e+08 integer<64> divisions/sec
+		performance is 1.25369e+08 integer<64> less than selections/sec
+	*/
+}
+
+// gcd, powmod, and isqrt of full width operands, next to the division based algorithms they replace
+template<size_t nbits>
+void MathFunctionPerformanceTest() {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr uint64_t NR_OPS = (20000000000ull / (nbits * nbits)) > 10 ? (20000000000ull / (nbits * nbits)) : 10;
+	// a modular exponentiation is nbits modular multiplies
+	constexpr uint64_t NR_POWMODS = (NR_OPS / nbits) > 10 ? (NR_OPS / nbits) : 10;
+
+	integer<nbits> a, b, c, odd, even;
+	for (unsigned i = 0; i < a.nrLimbs; ++i) {
+		a.setlimb(i, 0x9E3779B97F4A7C15ull * (i + 1));
+		b.setlimb(i, 0xC2B2AE3D27D4EB4Full * (i + 3));
+	}
+	a.reset(nbits - 1);
+	b.reset(nbits - 1);
+	odd = b;
+	odd.set(0);
+	even = b;
+	even.reset(0);
+	double binary = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { a.setlimb(0, i | 1); c += gcd(a, b); } });
+	double euclid = OperationsPerSecond(NR_OPS, [&]() {
+		for (uint64_t i = 0; i < NR_OPS; ++i) {
+			a.setlimb(0, i | 1);
+			integer<nbits> u = a, v = b;
+			while (!v.iszero()) { integer<nbits> r = u % v; u = v; v = r; }
+			c += u;
+		}
+	});
+	cout << "performance is " << binary << " integer<" << nbits << "> binary gcds/sec and " << euclid << " Euclid gcds/sec" << endl;
+	double montgomery = OperationsPerSecond(NR_POWMODS, [&]() { for (uint64_t i = 0; i < NR_POWMODS; ++i) { a.setlimb(0, i); c += powmod(a, b, odd); } });
+	double remainders = OperationsPerSecond(NR_POWMODS, [&]() { for (uint64_t i = 0; i < NR_POWMODS; ++i) { a.setlimb(0, i); c += powmod(a, b, even); } });
+	cout << "performance is " << montgomery << " integer<" << nbits << "> Montgomery powmods/sec and " << remainders << " remainder powmods/sec" << endl;
+	cout << "performance is " << OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { a.setlimb(0, i); c += isqrt(a); } }) << " integer<" << nbits << "> isqrts/sec" << (c.iszero() ? " (zero)" : "") << endl;
+}
+
+// the factorial table and binomials of integer<1024>, against the generic iterations
+void FactorialBinomialPerformanceTest() {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr uint64_t NR_OPS = 1000000;
+	using Integer = integer<1024>;
+	Integer c, n(30), k(15);
+	double lookup = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) c += sw::function::factorial(Integer(30 + (i & 7))); });
+	double iteration = OperationsPerSecond(NR_OPS / 100, [&]() { for (uint64_t i = 0; i < NR_OPS / 100; ++i) c += sw::function::factoriali<Integer>(Integer(30 + (i & 7))); });
+	cout << "performance is " << lookup << " integer<1024> factorial lookups/sec and " << iteration << " factorial iterations/sec" << endl;
+	lookup = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { k.setlimb(0, 8 + (i & 7)); c += sw::function::BinomialCoefficient(n, k); } });
+	iteration = OperationsPerSecond(NR_OPS / 1000, [&]() { for (uint64_t i = 0; i < NR_OPS / 1000; ++i) { k.setlimb(0, 8 + (i & 7)); c += sw::function::BinomialCoefficient<Integer>(n, k); } });
+	cout << "performance is " << lookup << " integer<1024> binomial lookups/sec and " << iteration << " Pascal's triangles/sec" << (c.iszero() ? " (zero)" : "") << endl;
+}
+
+void TestMathFunctionPerformance() {
+	using namespace std;
+
+	cout << endl << "TestMathFunctionPerformance" << endl;
+
+	MathFunctionPerformanceTest<128>();
+	MathFunctionPerformanceTest<256>();
+	MathFunctionPerformanceTest<1024>();
+	MathFunctionPerformanceTest<2048>();
+	FactorialBinomialPerformanceTest();
+	/*
+		performance of the binary gcd, Montgomery powmod, and Newton isqrt, integer<128> is the native specialization
+		performance is 1.20316e+06 integer<128> binary gcds/sec and 1.20379e+06 Euclid gcds/sec
+		performance is 149495 integer<128> Montgomery powmods/sec and 44779.1 remainder powmods/sec
+		performance is 2.78012e+07 integer<128> isqrts/sec
+		performance is 17637.6 integer<1024> binary gcds/sec and 9125.22 Euclid gcds/sec
+		performance is 697.609 integer<1024> Montgomery powmods/sec and 265.095 remainder powmods/sec
+		performance is 341857 integer<1024> isqrts/sec
+		performance is 4666.53 integer<2048> binary gcds/sec and 2979.18 Euclid gcds/sec
+		performance is 103.957 integer<2048> Montgomery powmods/sec and 46.6684 remainder powmods/sec
+		performance is 1.6301e+07 integer<1024> factorial lookups/sec and 90699.1 factorial iterations/sec
+		performance is 2.00765e+06 integer<1024> binomial lookups/sec and 98175.3 Pascal's triangles/sec
+		the recursive BinomialCoefficient took 12.4 sec for the triangles of binomial_coefficients.cpp, the rows of Pascal's triangle take 9 msec
+	*/
+}
+
+// the Karatsuba multiply against the number theoretic transform multiply of limb vectors around and past INTEGER_NTT_THRESHOLD
+void MultiplicationCrossoverTest(size_t limbs) {
+	using namespace std;
+	using namespace sw::unum;
+
+	const uint64_t NR_OPS = (4000000000ull / (limbs * limbs)) > 2 ? (4000000000ull / (limbs * limbs)) : 2;
+	std::vector<uint64_t> a(limbs), b(limbs), product(2 * limbs), scratch(impl::multiply_scratch(limbs));
+	for (size_t i = 0; i < limbs; ++i) {
+		a[i] = 0x9E3779B97F4A7C15ull * (i + 1);
+		b[i] = 0xC2B2AE3D27D4EB4Full * (i + 3);
+	}
+	uint64_t check = 0;
+	double karatsuba = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { impl::karatsuba(a.data(), b.data(), limbs, product.data(), scratch.data()); check += product[limbs]; } });
+	double transform = OperationsPerSecond(NR_OPS, [&]() { for (uint64_t i = 0; i < NR_OPS; ++i) { impl::ntt_multiply(a.data(), limbs, b.data(), limbs, product.data()); check -= product[limbs]; } });
+	cout << "performance is " << karatsuba << " Karatsuba and " << transform << " transform multiplies/sec of " << setw(5) << limbs << " limbs" << (check != 0 ? " (mismatch)" : "") << endl;
+}
+
+void TestMultiplicationCrossover() {
+	using namespace std;
+
+	cout << endl << "TestMultiplicationCrossover" << endl;
+
+	for (size_t limbs : { 256, 512, 1024, 1536, 2048, 4096, 8192, 16384, 65536 }) MultiplicationCrossoverTest(limbs);
+	/*
+		three primes of 62 bits, Montgomery butterflies with lazy reduction, on one hardware thread: the transform length is
+		the power of 2 of the product, so the transform is cheapest at 2^k limbs, and the crossover lies between 1024 and 1536 limbs
+		performance is 22203.6 Karatsuba and 11293 transform multiplies/sec of   256 limbs
+		performance is 5583.71 Karatsuba and 4444.53 transform multiplies/sec of   512 limbs
+		performance is 2086.06 Karatsuba and 2433.14 transform multiplies/sec of  1024 limbs
+		performance is 1374.23 Karatsuba and 1649.52 transform multiplies/sec of  1536 limbs
+		performance is 766.761 Karatsuba and 1673.59 transform multiplies/sec of  2048 limbs
+		performance is 214.406 Karatsuba and 667.059 transform multiplies/sec of  4096 limbs
+		performance is 59.6369 Karatsuba and 211.957 transform multiplies/sec of  8192 limbs
+		performance is 18.2748 Karatsuba and 96.545 transform multiplies/sec of 16384 limbs
+		performance is 2.4077 Karatsuba and 27.1906 transform multiplies/sec of 65536 limbs
+	*/
+}
+
 // enumerate a couple ratios to test representability
 void ReproducibilityTestSuite() {
 	for (int i = 0; i < 30; i += 3) {
@@ -179,6 +496,11 @@ try {
 
 	TestShiftOperatorPerformance();
 	TestArithmeticOperatorPerformance();
+	TestDivisionPerformance();
+	TestDecimalConversionPerformance();
+	TestNativeComparison();
+	TestMathFunctionPerformance();
+	TestMultiplicationCrossover();
 	ReproducibilityTestSuite();
 
 	cout << "done" << endl;
@@ -0,0 +1,372 @@
+// specializations.cpp: functional tests of the native register specializations of integer<8/16/32/64/128> against the limb implementation
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+// configure the integer arithmetic class
+// first: enable the fast specialized integers
+#define INTEGER_FAST_SPECIALIZATION
+// second: enable the integer arithmetic exceptions, including the overflow of +, -, *, /
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 1
+#define INTEGER_THROW_OVERFLOW_EXCEPTION 1
+#include <universal/integer/integer.hpp>
+#include <universal/integer/numeric_limits.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+/*
+   The reference of a specialization integer<nbits> is the limb implementation of integer<2*nbits+2>, which is not a
+   native register width: the exact results of the operators on the sign extended operands, of which the low nbits
+   are the modulo 2^nbits results, and which are out of the range of integer<nbits> when an operator overflows.
+   The same tests on widths that are not specialized verify the overflow detection of the limb implementation.
+*/
+
+namespace sw {
+namespace unum {
+
+	template<size_t wbits, size_t nbits>
+	integer<wbits> SignExtend(const integer<nbits>& a) {
+		integer<wbits> w;
+		w.bitcopy(a);
+		if (a.sign()) for (unsigned i = nbits; i < wbits; ++i) w.set(i);
+		return w;
+	}
+
+	template<size_t wbits, size_t nbits>
+	integer<wbits> ZeroExtend(const integer<nbits>& a) {
+		integer<wbits> w;
+		w.bitcopy(a);
+		return w;
+	}
+
+	template<size_t nbits, size_t wbits>
+	integer<nbits> Truncate(const integer<wbits>& w) {
+		integer<nbits> a;
+		a.bitcopy(w);
+		return a;
+	}
+
+	// random operands, with the values at the edges of the range, and small magnitudes, more often than uniform bit patterns
+	template<size_t nbits>
+	integer<nbits> RandomOperand() {
+		integer<nbits> v;
+		switch (rand() % 8) {
+		case 0: return v;
+		case 1: return integer<nbits>(1);
+		case 2: return integer<nbits>(-1);
+		case 3: return max_int<nbits>();
+		case 4: return min_int<nbits>();
+		default:
+			for (unsigned i = 0; i < v.nrLimbs; ++i) v.setlimb(i, (uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand()));
+			v >>= rand() % int(nbits);
+			if (rand() % 2) v.flip();
+			return v;
+		}
+	}
+
+	// the arithmetic operators against the reference: the wrapped result, and an overflow exception when the exact result does not fit
+	template<size_t nbits, size_t rbits>
+	int VerifyArithmeticOperands(const std::string& tag, bool bReportIndividualTestCases, const integer<nbits>& a, const integer<nbits>& b) {
+		int nrOfFailedTests = 0;
+		integer<rbits> ra = SignExtend<rbits>(a), rb = SignExtend<rbits>(b);
+
+		auto check = [&](const char* op, const integer<nbits>& result, bool overflow, const integer<rbits>& exact, bool overflowReference) {
+			if (result != Truncate<nbits>(exact) || overflow != overflowReference) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " integer<" << nbits << "> " << a << ' ' << op << ' ' << b << " = " << result << (overflow ? " (overflow)" : "") << " reference " << exact << '\n';
+			}
+		};
+		auto fits = [](const integer<rbits>& exact) { return SignExtend<rbits>(Truncate<nbits>(exact)) == exact; };
+
+		integer<nbits> r;
+		bool overflow;
+		integer<rbits> exact;
+
+		r = a; overflow = false;
+		try { r += b; } catch (const integer_overflow&) { overflow = true; }
+		exact = ra + rb;
+		check("+", r, overflow, exact, !fits(exact));
+
+		r = a; overflow = false;
+		try { r -= b; } catch (const integer_overflow&) { overflow = true; }
+		exact = ra - rb;
+		check("-", r, overflow, exact, !fits(exact));
+
+		r = a; overflow = false;
+		try { r *= b; } catch (const integer_overflow&) { overflow = true; }
+		exact = ra * rb;
+		check("*", r, overflow, exact, !fits(exact));
+
+		if (!b.iszero()) {
+			// the operand is left unchanged when the quotient overflows, the largest negative number is its own wrapped quotient
+			exact = ra / rb;
+			bool quotientOverflow = !fits(exact);
+			r = a; overflow = false;
+			try { r /= b; } catch (const integer_overflow&) { overflow = true; }
+			check("/", r, overflow, exact, quotientOverflow);
+
+			// the remainder comes out of the same divmod, and throws with its quotient
+			r = a; overflow = false;
+			try { r %= b; } catch (const integer_overflow&) { overflow = true; }
+			exact = (quotientOverflow ? ra : ra % rb);
+			check("%", r, overflow, exact, quotientOverflow);
+		}
+
+		// negate r in place: gcc 12 at -O2 drops the store r = a ahead of an r = -a that throws
+		r = a; overflow = false;
+		try { r = -r; } catch (const integer_overflow&) { overflow = true; }
+		check("negate", r, overflow, -ra, !fits(-ra));
+		return nrOfFailedTests;
+	}
+
+	// the logic, shift, bit, and conversion operators against the reference of the sign and zero extended bit patterns
+	template<size_t nbits, size_t rbits>
+	int VerifyLogicOperands(const std::string& tag, bool bReportIndividualTestCases, const integer<nbits>& a, const integer<nbits>& b) {
+		int nrOfFailedTests = 0;
+		integer<rbits> ra = SignExtend<rbits>(a), rb = SignExtend<rbits>(b);
+		integer<rbits> za = ZeroExtend<rbits>(a);
+
+		auto check = [&](bool pass, const char* op) {
+			if (!pass) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " integer<" << nbits << "> " << op << ' ' << a << ' ' << b << '\n';
+			}
+		};
+
+		check((a == b) == (ra == rb), "==");
+		check((a != b) == (ra != rb), "!=");
+		check((a < b) == (ra < rb), "<");
+		check((a > b) == (ra > rb), ">");
+		check((a <= b) == (ra <= rb), "<=");
+		check((a >= b) == (ra >= rb), ">=");
+		check(nbits > 64 || (a == (long long)b) == (ra == rb), "== literal");
+
+		// shifts by every amount, negative amounts shift the other way, and the right shift is logical
+		for (int shift = -int(nbits) - 2; shift <= int(nbits) + 2; ++shift) {
+			integer<nbits> r = a;
+			integer<rbits> w = za;
+			r <<= shift;
+			w <<= shift;
+			check(r == Truncate<nbits>(w), "<<=");
+			r = a;
+			w = za;
+			r >>= shift;
+			w >>= shift;
+			check(r == Truncate<nbits>(w), ">>=");
+		}
+		unsigned k = unsigned(rand()) % (2 * nbits);
+		// the two parts of the rotation have no bits in common, so that their sum is their union
+		integer<rbits> left = za, right = za;
+		left <<= int(k % nbits);
+		right >>= int(nbits - k % nbits);
+		integer<nbits> rotated = a;
+		check(rotated.rotl(k) == Truncate<nbits>(k % nbits == 0 ? za : left + right), "rotl");
+		check(rotated.rotr(k) == a, "rotr");
+
+		check(a.popcount() == za.popcount(), "popcount");
+		check(findMsb(a) == findMsb(za), "findMsb");
+		check(findLsb(a) == findLsb(za), "findLsb");
+		check(a.sign() == ra.sign() && a.iszero() == ra.iszero(), "sign");
+		check((~a) == Truncate<nbits>(~ra), "~");
+		integer<nbits> bytes, limbs;
+		for (unsigned i = 0; i < nbits; ++i) check(a.at(i) == za.at(i), "at");
+		for (unsigned i = 0; i < a.nrBytes; ++i) {
+			check(a.byte(i) == za.byte(i), "byte");
+			bytes.setbyte(i, a.byte(i));
+		}
+		for (unsigned i = 0; i < a.nrLimbs; ++i) {
+			check(a.limb(i) == za.limb(i), "limb");
+			limbs.setlimb(i, ~0ull);
+			limbs.setlimb(i, a.limb(i));
+		}
+		check(bytes == a && limbs == a, "setbyte/setlimb");
+
+		check((long long)a == (long long)ra && (int)a == (int)ra && (unsigned long long)a == za.limb(0), "native conversion");
+		check(convert_to_decimal_string(a) == convert_to_decimal_string(ra), "decimal");
+		check(multiply(a, b) == Truncate<2 * nbits>(ra * rb), "multiply");
+		return nrOfFailedTests;
+	}
+
+	template<size_t nbits, size_t rbits = 2 * nbits + 2>
+	int VerifyRandomOperands(const std::string& tag, bool bReportIndividualTestCases, int nrOfRandoms) {
+		int nrOfFailedTests = 0;
+		for (int i = 0; i < nrOfRandoms; ++i) {
+			integer<nbits> a = RandomOperand<nbits>(), b = RandomOperand<nbits>();
+			nrOfFailedTests += VerifyArithmeticOperands<nbits, rbits>(tag, bReportIndividualTestCases, a, b);
+			nrOfFailedTests += VerifyLogicOperands<nbits, rbits>(tag, bReportIndividualTestCases, a, b);
+			if (nrOfFailedTests > 10) return nrOfFailedTests;
+		}
+		return nrOfFailedTests;
+	}
+
+	template<size_t nbits, size_t rbits = 2 * nbits + 2>
+	int VerifyAllOperands(const std::string& tag, bool bReportIndividualTestCases) {
+		constexpr size_t NR_VALUES = (size_t(1) << nbits);
+		int nrOfFailedTests = 0;
+		integer<nbits> a, b;
+		for (size_t i = 0; i < NR_VALUES; ++i) {
+			a.set_raw_bits(i);
+			for (size_t j = 0; j < NR_VALUES; ++j) {
+				b.set_raw_bits(j);
+				nrOfFailedTests += VerifyArithmeticOperands<nbits, rbits>(tag, bReportIndividualTestCases, a, b);
+				if (j % 16 == 0) nrOfFailedTests += VerifyLogicOperands<nbits, rbits>(tag, bReportIndividualTestCases, a, b);
+				if (nrOfFailedTests > 10) return nrOfFailedTests;
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+	// the specializations hold the value in a native register, and signal a zero divisor like the limb implementation
+	template<size_t nbits>
+	int VerifyNativeStorage(const std::string& tag, bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		if (sizeof(integer<nbits>) != nbits / 8) nrOfFailedTests++;
+		integer<nbits> a = 42, zero;
+		try {
+			a /= zero;
+			nrOfFailedTests++;
+		}
+		catch (const integer_divide_by_zero&) {
+			// correctly caught the exception
+		}
+		if (nrOfFailedTests > 0 && bReportIndividualTestCases) std::cerr << "FAIL " << tag << " integer<" << nbits << "> of " << sizeof(integer<nbits>) << " bytes\n";
+		return nrOfFailedTests;
+	}
+
+	// floating-point values truncate toward zero, and values outside of the range of integer<nbits> overflow
+	template<size_t nbits>
+	int VerifyFloatConversion(const std::string& tag, bool bReportIndividualTestCases) {
+		int nrOfFailedTests = 0;
+		auto check = [&](bool pass, const char* op) {
+			if (!pass) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " integer<" << nbits << "> from " << op << '\n';
+			}
+		};
+		check(integer<nbits>(3.0) == integer<nbits>(3), "3.0");
+		check(integer<nbits>(-3.7) == integer<nbits>(-3), "-3.7");
+		check(integer<nbits>(2.5f) == integer<nbits>(2), "2.5f");
+		check(integer<nbits>(99.9l) == integer<nbits>(99), "99.9l");
+		check(integer<nbits>(0.9) == integer<nbits>(0) && integer<nbits>(-0.9) == integer<nbits>(0), "0.9");
+		integer<nbits> a;
+		a = -1.0;
+		check(a == integer<nbits>(-1), "assignment");
+		// the largest magnitudes of both signs
+		integer<nbits> e(3), minimum(1);
+		e <<= int(nbits) - 3;
+		minimum <<= int(nbits) - 1;
+		double x = std::ldexp(1.5, int(nbits) - 2);
+		check(integer<nbits>(x) == e && integer<nbits>(-x) == -e, "0.75 * 2^(nbits-1)");
+		check(integer<nbits>(-std::ldexp(1.0, int(nbits) - 1)) == minimum, "-2^(nbits-1)");
+		for (double v : { std::ldexp(1.0, int(nbits) - 1), -std::ldexp(1.0, int(nbits)), std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN() }) {
+			try {
+				integer<nbits> overflow(v);
+				check(false, "out of range value");
+			}
+			catch (const integer_overflow&) {
+				// correctly caught the exception
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+	// the conversion of the specialization against the conversion of the limb implementation of the reference width,
+	// on random doubles of all magnitudes up to the range of integer<nbits>, and the truncated long doubles
+	template<size_t nbits, size_t rbits = 2 * nbits + 2>
+	int VerifyFloatConversionAgainstLimbs(const std::string& tag, bool bReportIndividualTestCases, unsigned nrOfRandoms) {
+		int nrOfFailedTests = 0;
+		for (unsigned i = 0; i < nrOfRandoms; ++i) {
+			double fraction = double(rand()) / double(RAND_MAX) + 0.5;   // [0.5, 1.5]
+			double v = std::ldexp(fraction, rand() % int(nbits)) * ((rand() % 2) ? -1.0 : 1.0);
+			long double lv = (long double)(v) + 0.25l;
+			if (std::fabs(v) >= std::ldexp(1.0, int(nbits) - 1)) continue;
+			integer<nbits> fast(v), fastLong(lv);
+			integer<rbits> limb(v), limbLong(lv);
+			if (fast != Truncate<nbits>(limb) || fastLong != Truncate<nbits>(limbLong)) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " integer<" << nbits << "> from " << v << " = " << fast << " reference " << limb << '\n';
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+} // namespace unum
+} // namespace sw
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "specialized integer failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<32>(tag, true, 100), "integer<32>", "native register");
+
+#else
+
+	cout << "Integer native register specialization validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<8>(tag, bReportIndividualTestCases), "integer<8>", "native storage");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<16>(tag, bReportIndividualTestCases), "integer<16>", "native storage");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<32>(tag, bReportIndividualTestCases), "integer<32>", "native storage");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<64>(tag, bReportIndividualTestCases), "integer<64>", "native storage");
+#if defined(__SIZEOF_INT128__)
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeStorage<128>(tag, bReportIndividualTestCases), "integer<128>", "native storage");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<128>(tag, bReportIndividualTestCases), "integer<128>", "float conversion");
+#endif
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<8>(tag, bReportIndividualTestCases), "integer<8>", "float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<16>(tag, bReportIndividualTestCases), "integer<16>", "float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<32>(tag, bReportIndividualTestCases), "integer<32>", "float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<64>(tag, bReportIndividualTestCases), "integer<64>", "float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<12>(tag, bReportIndividualTestCases), "integer<12>", "limb float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<100>(tag, bReportIndividualTestCases), "integer<100>", "limb float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversion<192>(tag, bReportIndividualTestCases), "integer<192>", "limb float conversion");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversionAgainstLimbs<16>(tag, bReportIndividualTestCases, 10000), "integer<16>", "float conversion vs limbs");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversionAgainstLimbs<32>(tag, bReportIndividualTestCases, 10000), "integer<32>", "float conversion vs limbs");
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversionAgainstLimbs<64>(tag, bReportIndividualTestCases, 10000), "integer<64>", "float conversion vs limbs");
+#if defined(__SIZEOF_INT128__)
+	nrOfFailedTestCases += ReportTestResult(VerifyFloatConversionAgainstLimbs<128>(tag, bReportIndividualTestCases, 10000), "integer<128>", "float conversion vs limbs");
+#endif
+
+	nrOfFailedTestCases += ReportTestResult(VerifyAllOperands<8>(tag, bReportIndividualTestCases), "integer<8>", "native register");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<16>(tag, bReportIndividualTestCases, 10000), "integer<16>", "native register");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<32>(tag, bReportIndividualTestCases, 10000), "integer<32>", "native register");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<64>(tag, bReportIndividualTestCases, 10000), "integer<64>", "native register");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<128>(tag, bReportIndividualTestCases, 10000), "integer<128>", "native register");
+
+	// the overflow exceptions of the limb implementation
+	nrOfFailedTestCases += ReportTestResult(VerifyAllOperands<6>(tag, bReportIndividualTestCases), "integer<6>", "limb overflow");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<12>(tag, bReportIndividualTestCases, 10000), "integer<12>", "limb overflow");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<100>(tag, bReportIndividualTestCases, 10000), "integer<100>", "limb overflow");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<64>(tag, bReportIndividualTestCases, 10000000), "integer<64>", "native register");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomOperands<128>(tag, bReportIndividualTestCases, 10000000), "integer<128>", "native register");
+#endif // STRESS_TESTING
+
+#endif // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
@@ -3,6 +3,7 @@
 // Copyright (C) 2017-2019 Stillwater Supercomputing, Inc.
 //
 // This file is part of the UNIVERSAL project, which is released under an MIT Open Source license.
+#include <cstring>
 #include "common.hpp"
 
 #define BATCHMODE 1
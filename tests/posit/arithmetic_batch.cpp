@@ -0,0 +1,169 @@
+// arithmetic_batch.cpp: functional tests for the batch arithmetic kernels over arrays of posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits that have SIMD batch kernels
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the batch kernels of the active instruction set must reproduce the scalar operators bit for bit
+template<size_t nbits, size_t es>
+int ValidateBatchOperators(const std::string& tag, bool bReportIndividualTestCases, const std::vector< sw::unum::posit<nbits, es> >& a,
+	                       const std::vector< sw::unum::posit<nbits, es> >& b, const std::vector< sw::unum::posit<nbits, es> >& c) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	size_t n = a.size();
+	int nrOfFailedTests = 0;
+	std::vector<Posit> r(n);
+	std::unique_ptr<bool[]> lt(new bool[n]), eq(new bool[n]);
+	auto check = [&](const char* op, size_t i, const Posit& result, const Posit& ref) {
+		if (result.encoding() != ref.encoding()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL batch " << op << " " << a[i] << " " << b[i] << " " << c[i] << " != " << ref << " instead it yielded " << result << '\n';
+		}
+	};
+
+	batch_add(a.data(), b.data(), r.data(), n);
+	for (size_t i = 0; i < n; ++i) check("add", i, r[i], a[i] + b[i]);
+	batch_sub(a.data(), b.data(), r.data(), n);
+	for (size_t i = 0; i < n; ++i) check("sub", i, r[i], a[i] - b[i]);
+	batch_mul(a.data(), b.data(), r.data(), n);
+	for (size_t i = 0; i < n; ++i) check("mul", i, r[i], a[i] * b[i]);
+	batch_div(a.data(), b.data(), r.data(), n);
+	for (size_t i = 0; i < n; ++i) check("div", i, r[i], a[i] / b[i]);
+	batch_fma(a.data(), b.data(), c.data(), r.data(), n);
+	for (size_t i = 0; i < n; ++i) check("fma", i, r[i], sw::unum::fma(a[i], b[i], c[i]));
+	batch_negate(a.data(), r.data(), n);
+	for (size_t i = 0; i < n; ++i) check("negate", i, r[i], -a[i]);
+	batch_less(a.data(), b.data(), lt.get(), n);
+	batch_equal(a.data(), b.data(), eq.get(), n);
+	for (size_t i = 0; i < n; ++i) {
+		if (lt[i] != (a[i] < b[i]) || eq[i] != (a[i] == b[i])) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL batch compare " << a[i] << " " << b[i] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// all pairs of posits, with a pseudo-random addend for the fma
+template<size_t nbits, size_t es>
+int ValidateExhaustiveBatch(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	const size_t NR_POSITS = (size_t(1) << nbits);
+	std::mt19937_64 generator(nbits);
+	std::vector<Posit> a(NR_POSITS * NR_POSITS), b(a.size()), c(a.size());
+	for (size_t i = 0; i < a.size(); ++i) {
+		a[i].set_raw_bits(i / NR_POSITS);
+		b[i].set_raw_bits(i % NR_POSITS);
+		c[i].set_raw_bits(generator());
+	}
+	return ValidateBatchOperators(tag, bReportIndividualTestCases, a, b, c);
+}
+
+// random encodings, with zero, NaR, minpos, and maxpos interspersed, over an array length that exercises the remainder loop
+template<size_t nbits, size_t es>
+int ValidateRandomBatch(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(nbits * 1000 + es);
+	const uint64_t special[] = { 0, uint64_t(1) << (nbits - 1), 1, (uint64_t(1) << (nbits - 1)) - 1 };
+	std::vector<Posit> a(n), b(n), c(n);
+	for (size_t i = 0; i < n; ++i) {
+		a[i].set_raw_bits((i % 37 == 0) ? special[i % 4] : generator());
+		b[i].set_raw_bits((i % 41 == 0) ? special[(i / 41) % 4] : generator());
+		// half of the addends close to -a*b to exercise cancellation in the fma
+		if (i & 1) c[i] = -(a[i] * b[i]); else c[i].set_raw_bits(generator());
+	}
+	return ValidateBatchOperators(tag, bReportIndividualTestCases, a, b, c);
+}
+
+template<size_t nbits, size_t es>
+int ValidateBatch(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	int nrOfFailedTestCases = 0;
+	nrOfFailedTestCases += ValidateRandomBatch<nbits, es>(tag, bReportIndividualTestCases, n);
+	// every remainder length of the widest register
+	for (size_t length = 1; length < 17; ++length) {
+		nrOfFailedTestCases += ValidateRandomBatch<nbits, es>(tag, bReportIndividualTestCases, length);
+	}
+	return nrOfFailedTestCases;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "batch arithmetic failed: ";
+
+#if MANUAL_TESTING
+
+	batch_select_isa(batch_isa::avx2);
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomBatch<16, 1>(tag, true, 1000), "posit<16,1>", "batch avx2");
+
+#else
+
+	cout << "Posit batch arithmetic validation: processor supports " << to_string(batch_detect_isa()) << endl;
+
+	// every instruction set the processor supports
+	for (int isa = int(batch_detect_isa()); isa >= 0; --isa) {
+		batch_select_isa(batch_isa(isa));
+		std::string op = std::string("batch ") + to_string(batch_active_isa());
+		nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveBatch<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", op);
+		nrOfFailedTestCases += ReportTestResult(ValidateBatch<16, 1>(tag, bReportIndividualTestCases, 100003), "posit<16,1>", op);
+		nrOfFailedTestCases += ReportTestResult(ValidateBatch<32, 2>(tag, bReportIndividualTestCases, 100003), "posit<32,2>", op);
+		// configurations without SIMD kernels run the scalar loop
+		nrOfFailedTestCases += ReportTestResult(ValidateBatch<12, 1>(tag, bReportIndividualTestCases, 1003), "posit<12,1>", op);
+	}
+	batch_select_isa(batch_detect_isa());
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateBatch<16, 1>(tag, bReportIndividualTestCases, 10000000), "posit<16,1>", "batch");
+	nrOfFailedTestCases += ReportTestResult(ValidateBatch<32, 2>(tag, bReportIndividualTestCases, 10000000), "posit<32,2>", "batch");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
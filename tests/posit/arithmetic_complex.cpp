@@ -0,0 +1,274 @@
+// arithmetic_complex.cpp: functional tests for complex posit arithmetic and the complex_array kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits so that their fused paths are exercised
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the exact value a * b + c * d + e rounded once, accumulated in a quire
+template<size_t nbits, size_t es>
+sw::unum::posit<nbits, es> QuireReference(const sw::unum::posit<nbits, es>& a, const sw::unum::posit<nbits, es>& b,
+	                                      const sw::unum::posit<nbits, es>& c, const sw::unum::posit<nbits, es>& d,
+	                                      const sw::unum::posit<nbits, es>& e) {
+	using namespace sw::unum;
+	posit<nbits, es> p;
+	if (a.isnar() || b.isnar() || c.isnar() || d.isnar() || e.isnar()) {
+		p.setnar();
+		return p;
+	}
+	quire<nbits, es> q;
+	q += quire_mul(a, b);
+	q += quire_mul(c, d);
+	q += quire_mul(e, posit<nbits, es>(1));
+	return convert(q.to_value(), p);
+}
+
+// exhaustive validation of the complex product and the norm of a small posit configuration:
+// the products and sums of posits with few bits are exact in long double, so the reference is rounded once
+template<size_t nbits, size_t es>
+int ValidateComplexMultiply(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	const unsigned NR_POSITS = (unsigned(1) << nbits);
+	int nrOfFailedTests = 0;
+	Posit ar, ai, br, bi, re, im;
+	for (unsigned i = 0; i < NR_POSITS; ++i) {
+		ar.set_raw_bits(i);
+		for (unsigned j = 0; j < NR_POSITS; ++j) {
+			ai.set_raw_bits(j);
+			complex<Posit> a(ar, ai);
+			if (!a.isnar()) {
+				Posit n = norm(a);
+				Posit nref = (long double)ar * (long double)ar + (long double)ai * (long double)ai;
+				if (n != nref) {
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases) std::cerr << "FAIL norm" << a << " != " << nref << " instead it yielded " << n << '\n';
+				}
+			}
+			for (unsigned k = 0; k < NR_POSITS; ++k) {
+				br.set_raw_bits(k);
+				for (unsigned l = 0; l < NR_POSITS; ++l) {
+					bi.set_raw_bits(l);
+					complex<Posit> b(br, bi);
+					complex<Posit> c = a * b;
+					if (a.isnar() || b.isnar()) {
+						if (!c.real().isnar()) nrOfFailedTests++;
+						continue;
+					}
+					re = (long double)ar * (long double)br - (long double)ai * (long double)bi;
+					im = (long double)ar * (long double)bi + (long double)ai * (long double)br;
+					if (c.real() != re || c.imag() != im) {
+						nrOfFailedTests++;
+						if (bReportIndividualTestCases) std::cerr << "FAIL " << a << " * " << b << " != " << complex<Posit>(re, im) << " instead it yielded " << c << '\n';
+					}
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// random samples of the complex product and multiply-accumulate against the quire reference,
+// with half of the accumulators chosen close to -a*b to exercise cancellation
+template<size_t nbits, size_t es>
+int ValidateRandomComplexFmac(const std::string& tag, bool bReportIndividualTestCases, unsigned nrOfSamples) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(nbits * 1000 + es);
+	const uint64_t mask = (nbits == 64) ? ~uint64_t(0) : ((uint64_t(1) << nbits) - 1);
+	int nrOfFailedTests = 0;
+	Posit ar, ai, br, bi, cr, ci;
+	for (unsigned i = 0; i < nrOfSamples; ++i) {
+		ar.set_raw_bits(generator() & mask);
+		ai.set_raw_bits(generator() & mask);
+		br.set_raw_bits(generator() & mask);
+		bi.set_raw_bits(generator() & mask);
+		complex<Posit> a(ar, ai), b(br, bi);
+		complex<Posit> product = a * b;
+		if (i & 1) {
+			cr = -product.real();
+			ci = -product.imag();
+		}
+		else {
+			cr.set_raw_bits(generator() & mask);
+			ci.set_raw_bits(generator() & mask);
+		}
+		complex<Posit> acc(cr, ci);
+		complex<Posit> result = fmac(acc, a, b);
+		complex<Posit> ref(QuireReference(ar, br, -ai, bi, cr), QuireReference(ar, bi, ai, br, ci));
+		complex<Posit> pref(QuireReference(ar, br, -ai, bi, Posit(0)), QuireReference(ar, bi, ai, br, Posit(0)));
+		if (result != ref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL fmac(" << acc << ", " << a << ", " << b << ") != " << ref << " instead it yielded " << result << '\n';
+		}
+		if (product != pref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << a << " * " << b << " != " << pref << " instead it yielded " << product << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// identities that must hold exactly for any posit precision
+template<size_t nbits, size_t es>
+int ValidateComplexIdentities(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Complex = complex< posit<nbits, es> >;
+	int nrOfFailedTests = 0;
+	auto check = [&](const char* op, const Complex& result, const Complex& ref) {
+		if (result != ref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << op << " " << result << " != " << ref << '\n';
+		}
+	};
+	Complex a(3, 4), b(1, -2), i(0, 1);
+	check("(3+4i)*(1-2i)", a * b, Complex(11, -2));
+	check("(11-2i)/(1-2i)", Complex(11, -2) / b, a);
+	check("i*i", i * i, Complex(-1, 0));
+	check("conj(a)*a", conj(a) * a, Complex(norm(a), posit<nbits, es>(0)));
+	check("fmac(1, i, i)", fmac(Complex(1, 0), i, i), Complex(0, 0));
+	check("a/0", a / Complex(0, 0), Complex(posit<nbits, es>(0), posit<nbits, es>(0)) / Complex(0, 0));
+	Complex x(1, 2), y(3, 4);
+	butterfly(x, y, i);
+	check("butterfly top", x, Complex(-3, 5));
+	check("butterfly bottom", y, Complex(5, -1));
+	return nrOfFailedTests;
+}
+
+// the complex_array kernels must agree with the elementwise complex operators for both storage layouts
+template<size_t nbits, size_t es>
+int ValidateComplexArray(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	using Complex = complex<Posit>;
+	using Interleaved = complex_array<nbits, es, complex_layout::interleaved>;
+	using Split = complex_array<nbits, es, complex_layout::split>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 generator(n);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector<Complex> va(n), vb(n), vc(n);
+	for (size_t i = 0; i < n; ++i) {
+		va[i] = Complex(distribution(generator), distribution(generator));
+		vb[i] = Complex(distribution(generator), distribution(generator));
+		vc[i] = Complex(distribution(generator), distribution(generator));
+	}
+	Interleaved ia(va), ib(vb), ic(vc), ip;
+	Split sa(va), sb(vb), sc(vc), sp;
+	if (ia.real_data() + 2 != &ia.real(1) || sa.imag_data() + 1 != &sa.imag(1) || sa.imag_data() != sa.real_data() + n) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL complex_array storage layout\n";
+	}
+
+	multiply(ia, ib, ip);
+	multiply(sa, sb, sp);
+	multiply_accumulate(ic, ia, ib);
+	multiply_accumulate(sc, sa, sb);
+	Complex alpha(0.5, -0.25);
+	scale(alpha, ia);
+	scale(alpha, sa);
+	Complex ref(0);
+	for (size_t i = 0; i < n; ++i) ref = fmac(ref, va[i], vb[i]);
+	for (size_t i = 0; i < n; ++i) {
+		Complex product = va[i] * vb[i];
+		Complex accumulated = fmac(vc[i], va[i], vb[i]);
+		Complex scaled = alpha * va[i];
+		if (ip[i] != product || sp[i] != product || ic[i] != accumulated || sc[i] != accumulated || ia[i] != scaled || sa[i] != scaled) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL complex_array kernels at " << i << " : " << ip[i] << ' ' << ic[i] << ' ' << ia[i] << '\n';
+		}
+	}
+
+	// the exact dot product in the quire rounds once, the running fmac rounds every step: they are within a few ulps
+	Interleaved ix(va), iy(vb);
+	Split sx(va), sy(vb);
+	Complex idot = cdot(ix, iy), sdot = cdot(sx, sy);
+	long double tolerance = 16.0l * (long double)std::numeric_limits<Posit>::epsilon() * n;
+	if (idot != sdot || std::abs((long double)idot.real() - (long double)ref.real()) > tolerance || std::abs((long double)idot.imag() - (long double)ref.imag()) > tolerance) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL cdot " << idot << " vs " << sdot << " vs " << ref << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "complex arithmetic failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexMultiply<4, 0>(tag, true), "posit<4,0>", "complex multiply");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<16, 1>(tag, true, 1000), "posit<16,1>", "complex fmac");
+
+#else
+
+	cout << "Complex posit arithmetic validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexMultiply<4, 0>(tag, bReportIndividualTestCases), "posit<4,0>", "complex multiply");
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexMultiply<5, 1>(tag, bReportIndividualTestCases), "posit<5,1>", "complex multiply");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<8, 0>(tag, bReportIndividualTestCases, 10000), "posit<8,0>", "complex fmac");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<16, 1>(tag, bReportIndividualTestCases, 10000), "posit<16,1>", "complex fmac");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<24, 2>(tag, bReportIndividualTestCases, 10000), "posit<24,2>", "complex fmac");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<32, 2>(tag, bReportIndividualTestCases, 10000), "posit<32,2>", "complex fmac");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<64, 3>(tag, bReportIndividualTestCases, 1000), "posit<64,3>", "complex fmac");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexIdentities<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "complex identities");
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexIdentities<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", "complex identities");
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexIdentities<80, 3>(tag, bReportIndividualTestCases), "posit<80,3>", "complex identities");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexArray<16, 1>(tag, bReportIndividualTestCases, 64), "posit<16,1>", "complex_array");
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexArray<32, 2>(tag, bReportIndividualTestCases, 64), "posit<32,2>", "complex_array");
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexArray<80, 3>(tag, bReportIndividualTestCases, 16), "posit<80,3>", "complex_array");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateComplexMultiply<6, 1>(tag, bReportIndividualTestCases), "posit<6,1>", "complex multiply");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomComplexFmac<32, 2>(tag, bReportIndividualTestCases, 1000000), "posit<32,2>", "complex fmac");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -6,10 +6,14 @@
 #include <cstdint>	// uint8_t, etc.
 #include <cmath>	// for frexp/frexpf and std::fma
 #include <cfenv>	// feclearexcept/fetestexcept
+#include <random>
 
 // minimum set of include files to reflect source code dependencies
 // enable/disable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+// enable the fast specialized posits so that their fma fast paths are exercised
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
 #include "universal/posit/posit.hpp"
 // posit type manipulators such as pretty printers
 #include "universal/posit/posit_manipulators.hpp"
@@ -37,7 +41,104 @@ void GenerateTestCase(Ty a, Ty b, Ty c) {
 	std::cout << std::setprecision(5);
 }
 
-#define MANUAL_TESTING 1
+// exhaustive validation of fma(a, b, c) for a small posit configuration:
+// the product and sum of posits with few bits are exact in long double, so the reference is rounded once
+template<size_t nbits, size_t es>
+int ValidateFMA(std::string tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	const unsigned NR_POSITS = (unsigned(1) << nbits);
+	int nrOfFailedTests = 0;
+	posit<nbits, es> pa, pb, pc, pfma, pref;
+	for (unsigned i = 0; i < NR_POSITS; ++i) {
+		pa.set_raw_bits(i);
+		for (unsigned j = 0; j < NR_POSITS; ++j) {
+			pb.set_raw_bits(j);
+			for (unsigned k = 0; k < NR_POSITS; ++k) {
+				pc.set_raw_bits(k);
+				pfma = sw::unum::fma(pa, pb, pc);
+				if (pa.isnar() || pb.isnar() || pc.isnar()) {
+					pref.setnar();
+				}
+				else {
+					pref = (long double)pa * (long double)pb + (long double)pc;
+				}
+				if (pfma != pref) {
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases) std::cerr << "FAIL fma(" << pa << ", " << pb << ", " << pc << ") != " << pref << " instead it yielded " << pfma << '\n';
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// random samples of fma(a, b, c), with half of the addends chosen close to -a*b to exercise cancellation:
+// only the samples for which the long double reference a*b + c is exact are compared
+template<size_t nbits, size_t es>
+int ValidateRandomFMA(std::string tag, bool bReportIndividualTestCases, unsigned nrOfSamples) {
+	using namespace sw::unum;
+	static_assert(nbits - es <= 34, "the product of the significands must be exact in long double");
+	std::mt19937_64 generator(nbits * 1000 + es);
+	const uint64_t mask = (uint64_t(1) << nbits) - 1;
+	int nrOfFailedTests = 0;
+	posit<nbits, es> pa, pb, pc, pfma, pref;
+	for (unsigned i = 0; i < nrOfSamples; ++i) {
+		pa.set_raw_bits(generator() & mask);
+		pb.set_raw_bits(generator() & mask);
+		if (i & 1) {
+			pc = -(pa * pb);
+			pc.set_raw_bits((pc.encoding() + (generator() % 7) - 3) & mask);
+		}
+		else {
+			pc.set_raw_bits(generator() & mask);
+		}
+		if (pa.isnar() || pb.isnar() || pc.isnar()) continue;
+		long double product = (long double)pa * (long double)pb;   // exact
+		long double sum = product + (long double)pc;
+		long double bp = sum - product;
+		long double error = (product - (sum - bp)) + ((long double)pc - bp);  // TwoSum rounding error
+		if (error != 0.0l) continue;
+		pref = sum;
+		pfma = sw::unum::fma(pa, pb, pc);
+		if (pfma != pref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL fma(" << pa << ", " << pb << ", " << pc << ") != " << pref << " instead it yielded " << pfma << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// fms and fnma are fma with a negated operand, and a single rounding is observable in a*b - a*b
+template<size_t nbits, size_t es>
+int ValidateFusedVariants(std::string tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	auto check = [&](const char* op, const Posit& result, const Posit& ref) {
+		if (result != ref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << op << " " << result << " != " << ref << '\n';
+		}
+	};
+	Posit a(0.1), b(10), c(-1), one(1), nar;
+	nar.setnar();
+	Posit high = a * b;
+	// the rounding error of the product is recovered exactly by a fused operation
+	Posit low = sw::unum::fms(a, b, high);
+	check("fms(a, b, a*b) + a*b", low + high, high);
+	check("fms(a, b, a*b) rounding error", Posit((long double)a * (long double)b - (long double)high), low);
+	check("fnma(a, b, a*b)", sw::unum::fnma(a, b, high), -low);
+	check("fma(a, b, -1)", sw::unum::fma(a, b, c), Posit((long double)a * (long double)b - 1.0l));
+	check("fma(0, b, c)", sw::unum::fma(Posit(0), b, c), c);
+	check("fma(a, b, NaR)", sw::unum::fma(a, b, nar), nar);
+	check("fma(NaR, 0, c)", sw::unum::fma(nar, Posit(0), c), nar);
+	check("fma(maxpos, maxpos, -maxpos)", sw::unum::fma(maxpos<nbits, es>(), maxpos<nbits, es>(), -maxpos<nbits, es>()), maxpos<nbits, es>());
+	check("fma(minpos, minpos, 0)", sw::unum::fma(minpos<nbits, es>(), minpos<nbits, es>(), Posit(0)), minpos<nbits, es>());
+	check("fma(1, 1, -1)", sw::unum::fma(one, one, -one), Posit(0));
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 // forward references
@@ -50,7 +151,7 @@ try {
 	using namespace std;
 	using namespace sw::unum;
 
-	//bool bReportIndividualTestCases = false;
+	bool bReportIndividualTestCases = false;
 	int nrOfFailedTestCases = 0;
 
 	std::string tag = "Fused Multiply-Accumulate failed: ";
@@ -62,43 +163,38 @@ try {
 	//ReportErrors():
 
 	{
-		double da(0.25), db(0.0), dc(0.0);
-		posit<64, 3> pa, pb, pc, pfma;
-		pa = da;
-		pb = db;
-		pc = dc;
-		pfma = sw::unum::fma(pa, pb, pc);
-		if (da*db + dc != 0.0)  cout << "Incorrect:  ";
-		cout << pfma << " : " << (long double)(pfma) << endl;
-	}
-
-	{
-		double da(0.25), db(0.0), dc(1.0);
-		posit<64, 3> pa, pb, pc, pfma;
-		pa = da;
-		pb = db;
-		pc = dc;
-		pfma = sw::unum::fma(pa, pb, pc);
-		if (da*db + dc != 1.0)  cout << "Incorrect:  ";
-		cout << pfma << " : " << (long double)(pfma) << endl;
-	}
-
-	return 0;
-	{
-		// this is not a good test case, because 0.1 is not representable in binary so you get round-off in the conversion
+		// 0.1 is not representable in binary, so fma yields the rounding error of the conversion
 		GenerateTestCase<16, 1, double>(0.1, 10, -1);
 		GenerateTestCase<32, 2, double>(0.1, 10, -1);
 		GenerateTestCase<64, 3, double>(0.1, 10, -1);
 	}
 
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<5, 2>(tag, true), "posit<5,2>", "fused multiply-add");
 
 #else
 
-	nrOfFailedTestCases += ReportTestResult(ValidateFMA<2, 0>(tag, bReportIndividualTestCases), "posit<2,0>", "fused multiply-accumulate");
+	cout << "Posit fused multiply-add validation" << endl;
 
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<3, 0>(tag, bReportIndividualTestCases), "posit<3,0>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<4, 1>(tag, bReportIndividualTestCases), "posit<4,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<5, 2>(tag, bReportIndividualTestCases), "posit<5,2>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<6, 1>(tag, bReportIndividualTestCases), "posit<6,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<7, 1>(tag, bReportIndividualTestCases), "posit<7,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "fused multiply-add");
 
-#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFMA<12, 1>(tag, bReportIndividualTestCases, 100000), "posit<12,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFMA<16, 1>(tag, bReportIndividualTestCases, 100000), "posit<16,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFMA<24, 2>(tag, bReportIndividualTestCases, 100000), "posit<24,2>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFMA<32, 2>(tag, bReportIndividualTestCases, 100000), "posit<32,2>", "fused multiply-add");
 
+	nrOfFailedTestCases += ReportTestResult(ValidateFusedVariants<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "fms/fnma");
+	nrOfFailedTestCases += ReportTestResult(ValidateFusedVariants<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", "fms/fnma");
+	nrOfFailedTestCases += ReportTestResult(ValidateFusedVariants<64, 3>(tag, bReportIndividualTestCases), "posit<64,3>", "fms/fnma");
+	nrOfFailedTestCases += ReportTestResult(ValidateFusedVariants<80, 3>(tag, bReportIndividualTestCases), "posit<80,3>", "fms/fnma");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateFMA<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "fused multiply-add");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFMA<32, 2>(tag, bReportIndividualTestCases, 10000000), "posit<32,2>", "fused multiply-add");
 #endif
 
 #endif
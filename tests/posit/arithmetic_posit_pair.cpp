@@ -0,0 +1,136 @@
+// arithmetic_posit_pair.cpp: functional tests for the double-word posit_pair arithmetic
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits that back the posit_pair
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// random operands of order 1, where the posit has its widest fraction, against a long double reference:
+// the relative error of each operation must be below 2^-precision, roughly twice the fraction bits of the posit
+template<size_t nbits, size_t es>
+int ValidatePairArithmetic(const std::string& tag, bool bReportIndividualTestCases, int precision, unsigned nrOfSamples) {
+	using namespace sw::unum;
+	using Pair = posit_pair<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 generator(nbits);
+	std::uniform_real_distribution<double> distribution(0.5, 2.0);
+	const long double bound = std::ldexp(1.0l, -precision);
+	auto check = [&](const char* op, const Pair& x, const Pair& y, const Pair& result, long double ref) {
+		long double error = std::fabs(((long double)result - ref) / ref);
+		// the pair must also be normalized: the high part is the rounded value of the pair
+		if (error > bound || result.high() != posit<nbits, es>(result.high() + result.low())) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " " << x << ' ' << op << ' ' << y << " = " << result << " relative error " << (double)error << std::endl;
+		}
+	};
+	for (unsigned i = 0; i < nrOfSamples; ++i) {
+		// operands with a non-zero low part
+		Pair x = Pair(distribution(generator)) + Pair(1) / Pair(3);
+		Pair y = Pair(distribution(generator)) + Pair(1) / Pair(7);
+		long double X = (long double)x, Y = (long double)y;
+		check("+", x, y, x + y, X + Y);
+		check("-", x, -y, x - -y, X + Y);
+		check("*", x, y, x * y, X * Y);
+		check("/", x, y, x / y, X / Y);
+	}
+	return nrOfFailedTests;
+}
+
+// exact results and special cases
+template<size_t nbits, size_t es>
+int ValidatePairIdentities(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	using Pair = posit_pair<nbits, es>;
+	int nrOfFailedTests = 0;
+	auto check = [&](const char* op, bool pass) {
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cerr << tag << " " << op << " FAIL" << std::endl;
+		}
+	};
+	Posit one(1), third = one / Posit(3);
+	// the sum and product of two posits are exact pairs
+	Pair product = mul_pair(third, Posit(3));
+	check("mul_pair(1/3, 3) == 3 * 1/3", (long double)product == 3.0l * (long double)third);
+	Pair sum = add_pair(one, minpos<nbits, es>());
+	check("add_pair(1, minpos) keeps minpos", sum.high() == one && sum.low() == minpos<nbits, es>());
+	check("(1 + minpos) - 1 == minpos", (sum - Pair(one)).high() == minpos<nbits, es>());
+	check("1/3 * 3 == 1", Posit((Pair(1) / Pair(3)) * Pair(3)) == one);
+	check("x - x == 0", (Pair(0.1) - Pair(0.1)).iszero());
+	check("x / 0 is NaR", (Pair(1) / Pair(0)).isnar());
+	Pair nar;
+	nar.setnar();
+	check("NaR + x is NaR", (nar + Pair(1)).isnar());
+	check("ordering", Pair(1) < Pair(1) + Pair(minpos<nbits, es>()) && Pair(-1) < Pair(0));
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "posit_pair failed: ";
+
+#if MANUAL_TESTING
+	posit_pair<32, 2> third = posit_pair<32, 2>(1) / posit_pair<32, 2>(3);
+	cout << setprecision(25) << third << " : " << third.high() << " + " << third.low() << endl;
+
+#else
+	cout << "Double-word posit_pair arithmetic validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePairArithmetic<16, 1>(tag, bReportIndividualTestCases, 17, 10000), "posit_pair<16,1>", "arithmetic");
+	nrOfFailedTestCases += ReportTestResult(ValidatePairArithmetic<32, 2>(tag, bReportIndividualTestCases, 45, 10000), "posit_pair<32,2>", "arithmetic");
+	nrOfFailedTestCases += ReportTestResult(ValidatePairIdentities<16, 1>(tag, bReportIndividualTestCases), "posit_pair<16,1>", "identities");
+	nrOfFailedTestCases += ReportTestResult(ValidatePairIdentities<32, 2>(tag, bReportIndividualTestCases), "posit_pair<32,2>", "identities");
+	nrOfFailedTestCases += ReportTestResult(ValidatePairIdentities<64, 3>(tag, bReportIndividualTestCases), "posit_pair<64,3>", "identities");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidatePairArithmetic<32, 2>(tag, bReportIndividualTestCases, 45, 10000000), "posit_pair<32,2>", "arithmetic");
+#endif
+
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
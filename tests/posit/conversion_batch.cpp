@@ -0,0 +1,210 @@
+// conversion_batch.cpp: functional tests for the bulk conversions between arrays of IEEE-754 floats and doubles and arrays of posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits that have SIMD conversion kernels
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cstring>
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the bits of an IEEE-754 value, so that NaNs and signed zeros compare
+template<typename Real>
+uint64_t ieee_bits(Real v) {
+	typename sw::unum::internal::ieee_bits<Real> bits;
+	std::memcpy(&bits, &v, sizeof(v));
+	return uint64_t(bits);
+}
+
+// the bulk conversion of the IEEE values must round as the value<> conversion of the library
+template<size_t nbits, size_t es, typename Real>
+int ValidateBatchFromIeee(const std::string& tag, bool bReportIndividualTestCases, const std::vector<Real>& f) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::vector<Posit> p(f.size());
+	convert(f.data(), p.data(), f.size());
+	for (size_t i = 0; i < f.size(); ++i) {
+		Posit ref;
+		convert(value<std::numeric_limits<Real>::digits - 1>(f[i]), ref);
+		if (p[i].encoding() != ref.encoding()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " " << std::setprecision(std::numeric_limits<Real>::max_digits10) << f[i] << " != " << ref << " instead it yielded " << p[i] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the bulk conversion of the posits must yield the bits of the conversion operator
+template<size_t nbits, size_t es, typename Real>
+int ValidateBatchToIeee(const std::string& tag, bool bReportIndividualTestCases, const std::vector< sw::unum::posit<nbits, es> >& p) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	std::vector<Real> f(p.size());
+	convert(p.data(), f.data(), p.size());
+	for (size_t i = 0; i < p.size(); ++i) {
+		Real ref = Real(p[i]);
+		if (ieee_bits(f[i]) != ieee_bits(ref)) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " " << p[i] << " != " << ref << " instead it yielded " << f[i] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// every posit to float and double
+template<size_t nbits, size_t es>
+int ValidateExhaustiveToIeee(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::vector< posit<nbits, es> > p(size_t(1) << nbits);
+	for (size_t i = 0; i < p.size(); ++i) p[i].set_raw_bits(i);
+	int nrOfFailedTests = 0;
+	nrOfFailedTests += ValidateBatchToIeee<nbits, es, float>(tag, bReportIndividualTestCases, p);
+	nrOfFailedTests += ValidateBatchToIeee<nbits, es, double>(tag, bReportIndividualTestCases, p);
+	return nrOfFailedTests;
+}
+
+// random posits to float and double, for the configurations too large to enumerate
+template<size_t nbits, size_t es>
+int ValidateRandomToIeee(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	std::mt19937_64 generator(nbits);
+	std::vector< posit<nbits, es> > p(n);
+	for (size_t i = 0; i < p.size(); ++i) p[i].set_raw_bits(i < 4 ? (i << (nbits - 2)) : generator());
+	int nrOfFailedTests = 0;
+	nrOfFailedTests += ValidateBatchToIeee<nbits, es, float>(tag, bReportIndividualTestCases, p);
+	nrOfFailedTests += ValidateBatchToIeee<nbits, es, double>(tag, bReportIndividualTestCases, p);
+	return nrOfFailedTests;
+}
+
+// all the rounding decisions of the posit configuration: every posit, the midpoints to its successor, and the neighbors
+// of the midpoints in the IEEE format, together with the special values of the format
+template<size_t nbits, size_t es, typename Real>
+int ValidateExhaustiveFromIeee(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	const Real inf = std::numeric_limits<Real>::infinity();
+	std::vector<Real> f = { Real(0), -Real(0), inf, -inf, std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::denorm_min(),
+		-std::numeric_limits<Real>::denorm_min(), std::numeric_limits<Real>::min(), std::numeric_limits<Real>::max(), -std::numeric_limits<Real>::max() };
+	for (size_t i = 0; i < (size_t(1) << nbits); ++i) {
+		Posit p, q;
+		p.set_raw_bits(i);
+		q.set_raw_bits(i + 1);
+		if (p.isnar() || q.isnar()) continue;
+		Real a = Real(p), b = Real(q);
+		Real mid = a + (b - a) / 2;
+		f.insert(f.end(), { a, std::nextafter(a, -inf), std::nextafter(a, inf), mid, std::nextafter(mid, -inf), std::nextafter(mid, inf) });
+	}
+	return ValidateBatchFromIeee<nbits, es>(tag, bReportIndividualTestCases, f);
+}
+
+// random IEEE values over the full exponent range of the format, including the subnormals
+template<size_t nbits, size_t es, typename Real>
+int ValidateRandomFromIeee(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using Bits = sw::unum::internal::ieee_bits<Real>;
+	std::mt19937_64 generator(nbits * 1000 + sizeof(Real));
+	std::vector<Real> f(n);
+	for (size_t i = 0; i < n; ++i) {
+		Bits bits = Bits(generator());
+		std::memcpy(&f[i], &bits, sizeof(bits));
+	}
+	return ValidateBatchFromIeee<nbits, es>(tag, bReportIndividualTestCases, f);
+}
+
+template<size_t nbits, size_t es>
+int ValidateBatchConversion(const std::string& tag, bool bReportIndividualTestCases) {
+	int nrOfFailedTestCases = 0;
+	if (nbits <= 16) {
+		nrOfFailedTestCases += ValidateExhaustiveToIeee<nbits, es>(tag, bReportIndividualTestCases);
+		nrOfFailedTestCases += ValidateExhaustiveFromIeee<nbits, es, float>(tag, bReportIndividualTestCases);
+		nrOfFailedTestCases += ValidateExhaustiveFromIeee<nbits, es, double>(tag, bReportIndividualTestCases);
+	}
+	else {
+		nrOfFailedTestCases += ValidateRandomToIeee<nbits, es>(tag, bReportIndividualTestCases, 100003);
+	}
+	nrOfFailedTestCases += ValidateRandomFromIeee<nbits, es, float>(tag, bReportIndividualTestCases, 100003);
+	nrOfFailedTestCases += ValidateRandomFromIeee<nbits, es, double>(tag, bReportIndividualTestCases, 100003);
+	// every remainder length of the widest register
+	for (size_t length = 1; length < 17; ++length) {
+		nrOfFailedTestCases += ValidateRandomFromIeee<nbits, es, float>(tag, bReportIndividualTestCases, length);
+		nrOfFailedTestCases += ValidateRandomToIeee<nbits, es>(tag, bReportIndividualTestCases, length);
+	}
+	return nrOfFailedTestCases;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "batch conversion failed: ";
+
+#if MANUAL_TESTING
+
+	batch_select_isa(batch_isa::avx2);
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveFromIeee<16, 1, float>(tag, true), "posit<16,1>", "batch float conversion");
+
+#else
+
+	cout << "Posit batch conversion validation: processor supports " << to_string(batch_detect_isa()) << endl;
+
+	// every instruction set the processor supports
+	for (int isa = int(batch_detect_isa()); isa >= 0; --isa) {
+		batch_select_isa(batch_isa(isa));
+		std::string op = std::string("batch conversion ") + to_string(batch_active_isa());
+		nrOfFailedTestCases += ReportTestResult(ValidateBatchConversion<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", op);
+		nrOfFailedTestCases += ReportTestResult(ValidateBatchConversion<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", op);
+		nrOfFailedTestCases += ReportTestResult(ValidateBatchConversion<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", op);
+		// configurations without SIMD kernels run the scalar loop
+		nrOfFailedTestCases += ReportTestResult(ValidateBatchConversion<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", op);
+	}
+	batch_select_isa(batch_detect_isa());
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFromIeee<16, 1, float>(tag, bReportIndividualTestCases, 100000000), "posit<16,1>", "batch float conversion");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomFromIeee<32, 2, double>(tag, bReportIndividualTestCases, 100000000), "posit<32,2>", "batch double conversion");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,331 @@
+// conversion_chars.cpp: functional tests for the allocation-free to_chars/from_chars text conversions of posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the native format must reproduce hex_format(), and the text in both formats must read back to the same posit
+template<size_t nbits, size_t es>
+int ValidateCharsRoundTrip(const std::string& tag, bool bReportIndividualTestCases, const sw::unum::posit<nbits, es>& p) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	char buffer[128];
+
+	posit_to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), p, posit_chars_format::hex);
+	std::string hex(buffer, r.ptr);
+	posit<nbits, es> q;
+	posit_from_chars_result s = from_chars(buffer, r.ptr, q);
+	if (r.ec != std::errc() || hex != hex_format(p) || s.ec != std::errc() || s.ptr != r.ptr || q != p) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " hex " << hex_format(p) << " to_chars " << hex << " from_chars " << hex_format(q) << '\n';
+	}
+
+	r = to_chars(buffer, buffer + sizeof(buffer), p);
+	std::string decimal(buffer, r.ptr);
+	q.setzero();
+	s = from_chars(buffer, r.ptr, q);
+	if (r.ec != std::errc() || s.ec != std::errc() || s.ptr != r.ptr || q.get() != p.get()) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " decimal " << hex_format(p) << " to_chars " << decimal << " from_chars " << hex_format(q) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// every posit of the configuration
+template<size_t nbits, size_t es>
+int ValidateExhaustiveChars(const std::string& tag, bool bReportIndividualTestCases) {
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < (size_t(1) << nbits); ++i) {
+		sw::unum::posit<nbits, es> p;
+		p.set_raw_bits(i);
+		nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, p);
+	}
+	return nrOfFailedTests;
+}
+
+// random encodings of the full width of the configurations too large to enumerate
+template<size_t nbits, size_t es>
+int ValidateRandomChars(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	std::mt19937_64 generator(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < n; ++i) {
+		sw::unum::bitblock<nbits> bits;
+		uint64_t word = 0;
+		for (size_t b = 0; b < nbits; ++b) {
+			if (b % 64 == 0) word = generator();
+			bits[b] = (word >> (b % 64)) & 1;
+		}
+		sw::unum::posit<nbits, es> p;
+		p.set(bits);
+		nrOfFailedTests += ValidateCharsRoundTrip(tag, bReportIndividualTestCases, p);
+	}
+	return nrOfFailedTests;
+}
+
+// decimals whose first approximation through long double is far from the posit when nbits exceeds its 64 bits:
+// the decimal is the quotient of exact posits, which the division rounds like from_chars
+template<size_t nbits, size_t es>
+int ValidateWideDecimals(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	struct { const char* text; long long numerator; int exponent10; } decimals[] = {
+		{ "0.1", 1, 1 }, { "-0.3", -3, 1 }, { "1e-30", 1, 30 }, { "2.718281828459045", 2718281828459045ll, 15 }, { "123456.789", 123456789, 3 }
+	};
+	int nrOfFailedTests = 0;
+	for (auto& d : decimals) {
+		Posit denominator(1);
+		for (int i = 0; i < d.exponent10; ++i) denominator *= Posit(10);
+		Posit expected = Posit(d.numerator) / denominator;
+		Posit p;
+		size_t length = std::strlen(d.text);
+		posit_from_chars_result r = from_chars(d.text, d.text + length, p);
+		if (r.ec != std::errc() || r.ptr != d.text + length || p != expected) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " from_chars(" << d.text << ") yielded " << hex_format(p) << " instead of " << hex_format(expected) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the exact decimal text of a posit reads back to it, and the exact decimal text of a rounding bound, hundreds of digits
+// long, rounds to the even neighbor, or to the posit above once a digit far beyond the rounding digits is added
+template<size_t nbits, size_t es>
+int ValidateExactDecimalChars(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	auto read = [&](const std::string& text, const Posit& expected) {
+		Posit p;
+		posit_from_chars_result r = from_chars(text.data(), text.data() + text.size(), p);
+		if (r.ec != std::errc() || r.ptr != text.data() + text.size() || p != expected) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " from_chars(" << text << ") yielded " << hex_format(p) << " instead of " << hex_format(expected) << '\n';
+		}
+	};
+	std::mt19937_64 generator(nbits);
+	std::vector<Posit> samples = { minpos<nbits, es>(), -minpos<nbits, es>(), maxpos<nbits, es>(), Posit(1) };
+	for (size_t i = 0; i < n; ++i) {
+		Posit p;
+		p.set_raw_bits(generator());
+		if (!p.isnar() && !p.iszero()) samples.push_back(p);
+	}
+	for (const Posit& p : samples) {
+		read(exact_decimal_format(p), p);
+		Posit a = p.isneg() ? -p : p;
+		if (a == maxpos<nbits, es>()) continue;
+		Posit above(a);
+		++above;
+		// the bound between a and above is the posit of nbits + 1 bits with the encoding 2 * a + 1
+		posit<nbits + 1, es> bound;
+		bound.set(internal::rounding_bound<nbits>(a.get()));
+		std::string text = exact_decimal_format(bound);
+		read(text, a.get()[0] ? above : a);
+		text += (text.find('.') == std::string::npos ? "." : "") + std::string(2 * internal::rounding_digits<nbits, es>::digits, '0') + "1";
+		read(text, above);
+		read("-" + text, -above);
+	}
+	return nrOfFailedTests;
+}
+
+// the default decimal text is the shortest: neither neighbor of its digits truncated by one reads back to the posit
+template<size_t nbits, size_t es>
+int ValidateShortestDigits(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	char digits[128], shorter[128];
+	for (size_t i = 1; i < (size_t(1) << (nbits - 1)); ++i) {
+		posit<nbits, es> p;
+		p.set_raw_bits(i);
+		int k;
+		size_t n = internal::shortest_digits(p, digits, k);
+		if (n < 2) continue;
+		for (int up = 0; up < 2; ++up) {
+			// the n-1 leading digits, rounded down or up, and renormalized when rounding up carries out
+			std::copy(digits, digits + n - 1, shorter);
+			size_t m = n - 1;
+			int e = k;
+			if (up) {
+				size_t j = m;
+				while (j > 0 && shorter[j - 1] == '9') shorter[--j] = '0';
+				if (j == 0) {
+					shorter[0] = '1';
+					m = 1;
+					++e;
+				}
+				else {
+					++shorter[j - 1];
+				}
+			}
+			posit<nbits, es> q(p);
+			internal::round_decimal(shorter, m, e - int(m), false, q);
+			if (q == p) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " shortest " << hex_format(p) << " digits " << std::string(digits, n) << " has a shorter representation " << std::string(shorter, m) << "e" << (e - int(m)) << '\n';
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the decimal text with an explicit precision is the stream text of the long double value
+template<size_t nbits, size_t es>
+int ValidateDecimalPrecision(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	char buffer[128];
+	std::mt19937_64 generator(nbits);
+	for (int precision = 1; precision < 25; ++precision) {
+		posit<nbits, es> p;
+		p.set_raw_bits(generator());
+		posit_to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), p, posit_chars_format::decimal, precision);
+		std::stringstream ss;
+		ss << std::setprecision(precision) << (long double)p;
+		if (std::string(buffer, r.ptr) != ss.str()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " precision " << precision << " to_chars " << std::string(buffer, r.ptr) << " stream " << ss.str() << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the text that from_chars reads and rejects, and the buffers that to_chars rejects
+template<size_t nbits, size_t es>
+int ValidateCharsEdgeCases(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	auto read = [&](const std::string& text, size_t consumed, std::errc ec, const Posit& expected) {
+		Posit p(0.5);
+		posit_from_chars_result r = from_chars(text.data(), text.data() + text.size(), p);
+		bool pass = r.ec == ec && r.ptr == text.data() + consumed && (ec != std::errc() || p.get() == expected.get());
+		if (!pass) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " from_chars(" << text << ") yielded " << hex_format(p) << " and consumed " << (r.ptr - text.data()) << '\n';
+		}
+	};
+	Posit nar;
+	nar.setnar();
+	Posit one(1), maxpos = sw::unum::maxpos<nbits, es>(), minpos = sw::unum::minpos<nbits, es>();
+	read("nar", 3, std::errc(), nar);
+	read("NaN", 3, std::errc(), nar);
+	read("-inf", 4, std::errc(), nar);
+	read("Infinity", 8, std::errc(), nar);
+	read("1", 1, std::errc(), one);
+	read("+1.0e0,2", 6, std::errc(), one);
+	read(".1e1", 4, std::errc(), one);
+	read("1e", 1, std::errc(), one);
+	read("-0", 2, std::errc(), Posit(0));
+	read("1e99999", 7, std::errc(), maxpos);
+	read("-1e-99999", 9, std::errc(), -minpos);
+	read(hex_format(one) + " ", hex_format(one).size(), std::errc(), one);
+	read("abc", 0, std::errc::invalid_argument, one);
+	read("-.e1", 0, std::errc::invalid_argument, one);
+	read("", 0, std::errc::invalid_argument, one);
+	read(std::string(200, '1'), 200, std::errc(), maxpos);
+	read("0." + std::string(300, '0') + "1e301", 307, std::errc(), one);
+	read("1" + std::string(300, '0') + "e-300", 306, std::errc(), one);
+
+	char buffer[3];
+	posit_to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), Posit(0.125), posit_chars_format::decimal);
+	if (r.ec != std::errc::value_too_large || r.ptr != buffer + sizeof(buffer)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " to_chars into a buffer too small for 0.125\n";
+	}
+	r = to_chars(buffer, buffer + sizeof(buffer), nar);
+	if (r.ec != std::errc() || std::string(buffer, r.ptr) != "nar") {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " to_chars of NaR\n";
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "to_chars/from_chars failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases<16, 1>(tag, true), "posit<16,1>", "chars edge cases");
+
+#else
+
+	cout << "Posit to_chars/from_chars validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveChars<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveChars<10, 2>(tag, bReportIndividualTestCases), "posit<10,2>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveChars<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveChars<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<32, 2>(tag, bReportIndividualTestCases, 100000), "posit<32,2>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<64, 3>(tag, bReportIndividualTestCases, 10000), "posit<64,3>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<128, 4>(tag, bReportIndividualTestCases, 1000), "posit<128,4>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactDecimalChars<16, 1>(tag, bReportIndividualTestCases, 1000), "posit<16,1>", "exact decimal chars");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactDecimalChars<32, 2>(tag, bReportIndividualTestCases, 1000), "posit<32,2>", "exact decimal chars");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactDecimalChars<64, 3>(tag, bReportIndividualTestCases, 200), "posit<64,3>", "exact decimal chars");
+	nrOfFailedTestCases += ReportTestResult(ValidateWideDecimals<128, 4>(tag, bReportIndividualTestCases), "posit<128,4>", "wide decimals");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateShortestDigits<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "shortest digits");
+	nrOfFailedTestCases += ReportTestResult(ValidateShortestDigits<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "shortest digits");
+	nrOfFailedTestCases += ReportTestResult(ValidateShortestDigits<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "shortest digits");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateDecimalPrecision<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "chars precision");
+	nrOfFailedTestCases += ReportTestResult(ValidateDecimalPrecision<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", "chars precision");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "chars edge cases");
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "chars edge cases");
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", "chars edge cases");
+	nrOfFailedTestCases += ReportTestResult(ValidateCharsEdgeCases<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "chars edge cases");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<32, 2>(tag, bReportIndividualTestCases, 10000000), "posit<32,2>", "chars round trip");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomChars<64, 3>(tag, bReportIndividualTestCases, 1000000), "posit<64,3>", "chars round trip");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,241 @@
+// conversion_exact_decimal.cpp: functional tests for the exact decimal expansions of posits, quires, and values
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cstdio>
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// the exact expansion of a long double that printf produces with enough fraction digits, without the trailing zeros
+std::string ReferenceDecimal(long double v, int precision) {
+	std::vector<char> buffer(size_t(precision) + 5000);
+	snprintf(buffer.data(), buffer.size(), "%.*Lf", precision, v);
+	std::string s(buffer.data());
+	if (s.find('.') != std::string::npos) {
+		s.erase(s.find_last_not_of('0') + 1);
+		if (s.back() == '.') s.pop_back();
+	}
+	if (s == "-0") s = "0";
+	return s;
+}
+
+// 2^n and 2^-n by doubling and halving a digit string, independent of the limb arithmetic
+std::string ReferencePowerOfTwo(int n) {
+	std::vector<int> digits = { 1 };  // most significant first
+	size_t fractionDigits = 0;
+	for (int i = 0; i < (n < 0 ? -n : n); ++i) {
+		if (n > 0) {
+			int carry = 0;
+			for (size_t j = digits.size(); j-- > 0; ) {
+				int d = 2 * digits[j] + carry;
+				digits[j] = d % 10;
+				carry = d / 10;
+			}
+			if (carry) digits.insert(digits.begin(), carry);
+		}
+		else {
+			// multiply by 5 and shift the decimal point one position
+			int carry = 0;
+			for (size_t j = digits.size(); j-- > 0; ) {
+				int d = 5 * digits[j] + carry;
+				digits[j] = d % 10;
+				carry = d / 10;
+			}
+			if (carry) digits.insert(digits.begin(), carry);
+			++fractionDigits;
+		}
+	}
+	std::string s;
+	for (int d : digits) s += char('0' + d);
+	if (fractionDigits > 0) {
+		if (s.size() <= fractionDigits) s.insert(0, fractionDigits - s.size() + 1, '0');
+		s.insert(s.size() - fractionDigits, 1, '.');
+	}
+	return s;
+}
+
+template<size_t nbits, size_t es>
+int ValidateExactDecimal(const std::string& tag, bool bReportIndividualTestCases, const sw::unum::posit<nbits, es>& p) {
+	std::string exact = sw::unum::exact_decimal_format(p);
+	// the fraction digits of minpos, plus the fraction bits
+	const int precision = int(((nbits - 2) << es) + nbits);
+	std::string reference = p.isnar() ? std::string("nar") : ReferenceDecimal((long double)p, precision);
+	if (exact != reference) {
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " " << hex_format(p) << " exact " << exact << " reference " << reference << '\n';
+		return 1;
+	}
+	return 0;
+}
+
+// every posit of the configuration, against the exact printf expansion of its long double value
+template<size_t nbits, size_t es>
+int ValidateExhaustiveExactDecimal(const std::string& tag, bool bReportIndividualTestCases) {
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < (size_t(1) << nbits); ++i) {
+		sw::unum::posit<nbits, es> p;
+		p.set_raw_bits(i);
+		nrOfFailedTests += ValidateExactDecimal(tag, bReportIndividualTestCases, p);
+	}
+	return nrOfFailedTests;
+}
+
+template<size_t nbits, size_t es>
+int ValidateRandomExactDecimal(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	std::mt19937_64 generator(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < n; ++i) {
+		sw::unum::posit<nbits, es> p;
+		p.set_raw_bits(generator());
+		nrOfFailedTests += ValidateExactDecimal(tag, bReportIndividualTestCases, p);
+	}
+	return nrOfFailedTests;
+}
+
+// the extremes of a wide posit, whose expansions have thousands of digits
+template<size_t nbits, size_t es>
+int ValidateExtremeExactDecimal(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	const int scale = int(nbits - 2) << es;
+	struct { posit<nbits, es> p; std::string reference; } cases[] = {
+		{ maxpos<nbits, es>(), ReferencePowerOfTwo(scale) },
+		{ minpos<nbits, es>(), ReferencePowerOfTwo(-scale) },
+		{ -minpos<nbits, es>(), "-" + ReferencePowerOfTwo(-scale) },
+	};
+	for (auto& c : cases) {
+		if (exact_decimal_format(c.p) != c.reference) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " " << hex_format(c.p) << " exact decimal differs from the power of two\n";
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// values of random doubles over the full exponent range
+int ValidateValueExactDecimal(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	std::mt19937_64 generator(52);
+	std::uniform_real_distribution<double> fraction(-2.0, 2.0);
+	std::uniform_int_distribution<int> exponent(-1020, 1020);
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < n; ++i) {
+		double d = std::ldexp(fraction(generator), exponent(generator));
+		value<52> v(d);
+		if (exact_decimal_format(v) != ReferenceDecimal(d, 1100)) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " value " << components(v) << " exact " << exact_decimal_format(v) << '\n';
+		}
+	}
+	value<52> zero(0.0);
+	if (exact_decimal_format(zero) != "0") nrOfFailedTests++;
+	return nrOfFailedTests;
+}
+
+// the quire of a single product against the exact double product, and of a dot product against its value
+template<size_t nbits, size_t es>
+int ValidateQuireExactDecimal(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	std::mt19937_64 generator(nbits);
+	int nrOfFailedTests = 0;
+	quire<nbits, es> sum;
+	for (size_t i = 0; i < n; ++i) {
+		posit<nbits, es> a, b;
+		a.set_raw_bits(generator());
+		b.set_raw_bits(generator());
+		if (a.isnar() || b.isnar()) continue;
+		quire<nbits, es> q;
+		q += quire_mul(a, b);
+		sum += quire_mul(a, b);
+		std::string reference = ReferenceDecimal((long double)a * (long double)b, int(2 * (((nbits - 2) << es) + nbits)));
+		if (exact_decimal_format(q) != reference) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " quire " << a << " * " << b << " exact " << exact_decimal_format(q) << " reference " << reference << '\n';
+		}
+	}
+	if (exact_decimal_format(sum) != exact_decimal_format(sum.to_value())) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " quire sum differs from its value\n";
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "exact decimal failed: ";
+
+#if MANUAL_TESTING
+
+	cout << exact_decimal_format(minpos<32, 2>()) << endl;
+	nrOfFailedTestCases += ReportTestResult(ValidateExtremeExactDecimal<256, 5>(tag, true), "posit<256,5>", "exact decimal extremes");
+
+#else
+
+	cout << "Exact decimal expansion validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveExactDecimal<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveExactDecimal<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateExhaustiveExactDecimal<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomExactDecimal<32, 2>(tag, bReportIndividualTestCases, 10000), "posit<32,2>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomExactDecimal<64, 3>(tag, bReportIndividualTestCases, 2000), "posit<64,3>", "exact decimal");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExtremeExactDecimal<64, 3>(tag, bReportIndividualTestCases), "posit<64,3>", "exact decimal extremes");
+	nrOfFailedTestCases += ReportTestResult(ValidateExtremeExactDecimal<128, 4>(tag, bReportIndividualTestCases), "posit<128,4>", "exact decimal extremes");
+	nrOfFailedTestCases += ReportTestResult(ValidateExtremeExactDecimal<256, 5>(tag, bReportIndividualTestCases), "posit<256,5>", "exact decimal extremes");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateValueExactDecimal(tag, bReportIndividualTestCases, 2000), "value<52>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireExactDecimal<16, 1>(tag, bReportIndividualTestCases, 1000), "quire<16,1>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireExactDecimal<32, 2>(tag, bReportIndividualTestCases, 1000), "quire<32,2>", "exact decimal");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomExactDecimal<32, 2>(tag, bReportIndividualTestCases, 1000000), "posit<32,2>", "exact decimal");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomExactDecimal<64, 3>(tag, bReportIndividualTestCases, 100000), "posit<64,3>", "exact decimal");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
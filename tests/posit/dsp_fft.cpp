@@ -0,0 +1,301 @@
+// dsp_fft.cpp: functional tests for the radix-2/radix-4 fast Fourier transform of complex posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cmath>
+#include <complex>
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// n complex posits with components uniformly distributed in [-1, 1)
+template<size_t nbits, size_t es, sw::unum::complex_layout layout = sw::unum::complex_layout::interleaved>
+sw::unum::complex_array<nbits, es, layout> RandomComplexSignal(size_t n, unsigned seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	sw::unum::complex_array<nbits, es, layout> x(n);
+	for (size_t i = 0; i < n; ++i) {
+		x.real(i) = distribution(generator);
+		x.imag(i) = distribution(generator);
+	}
+	return x;
+}
+
+// the discrete Fourier transform of the posit values in long double, by definition
+template<size_t nbits, size_t es, sw::unum::complex_layout layout>
+std::vector< std::complex<long double> > ReferenceDft(const sw::unum::complex_array<nbits, es, layout>& x, bool inverse) {
+	const long double two_pi = 6.283185307179586476925286766559005768L;
+	size_t n = x.size();
+	std::vector< std::complex<long double> > X(n);
+	for (size_t k = 0; k < n; ++k) {
+		std::complex<long double> sum(0.0L, 0.0L);
+		for (size_t j = 0; j < n; ++j) {
+			long double angle = (inverse ? 1.0L : -1.0L) * two_pi * (long double)((j * k) % n) / (long double)n;
+			sum += std::complex<long double>((long double)x.real(j), (long double)x.imag(j)) * std::polar(1.0L, angle);
+		}
+		X[k] = inverse ? sum / (long double)n : sum;
+	}
+	return X;
+}
+
+// the relative root mean square error of y with respect to the reference
+template<size_t nbits, size_t es, sw::unum::complex_layout layout>
+double RelativeError(const sw::unum::complex_array<nbits, es, layout>& y, const std::vector< std::complex<long double> >& reference) {
+	long double signal = 0, noise = 0;
+	for (size_t i = 0; i < y.size(); ++i) {
+		std::complex<long double> v((long double)y.real(i), (long double)y.imag(i));
+		signal += std::norm(reference[i]);
+		noise += std::norm(v - reference[i]);
+	}
+	return double(std::sqrt(noise / signal));
+}
+
+// the forward and inverse transforms agree with the definition of the DFT within the tolerance
+template<size_t nbits, size_t es>
+int ValidateDft(const std::string& tag, bool bReportIndividualTestCases, size_t n, sw::unum::fft_butterfly butterfly, double tolerance) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	fft_plan< posit<nbits, es> > plan(n, butterfly);
+	complex_array<nbits, es> x = RandomComplexSignal<nbits, es>(n, unsigned(n));
+	complex_array<nbits, es> X = x;
+	plan.forward(X);
+	double error = RelativeError(X, ReferenceDft(x, false));
+	if (!(error < tolerance)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " forward fft of size " << n << " relative error " << error << '\n';
+	}
+	complex_array<nbits, es> y = X;
+	plan.inverse(y);
+	error = RelativeError(y, ReferenceDft(X, true));
+	if (!(error < tolerance)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " inverse fft of size " << n << " relative error " << error << '\n';
+	}
+	// the round trip returns the input within the tolerance
+	std::vector< std::complex<long double> > input(n);
+	for (size_t i = 0; i < n; ++i) input[i] = std::complex<long double>((long double)x.real(i), (long double)x.imag(i));
+	error = RelativeError(y, input);
+	if (!(error < tolerance)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " round trip of size " << n << " relative error " << error << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// with exact twiddles the exact butterflies round each output once: sizes 2 and 4 are a single stage
+template<size_t nbits, size_t es>
+int ValidateExactButterfly(const std::string& tag, bool bReportIndividualTestCases, size_t nrTrials) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	std::mt19937_64 generator(nbits);
+	for (size_t n : { size_t(2), size_t(4) }) {
+		fft_plan<Posit> plan(n, fft_butterfly::exact);
+		for (size_t t = 0; t < nrTrials; ++t) {
+			// random encodings exercise the extremes of the dynamic range and the cancellation of the sums
+			complex_array<nbits, es> x(n);
+			for (size_t i = 0; i < n; ++i) {
+				x.real(i).set_raw_bits(generator());
+				x.imag(i).set_raw_bits(generator());
+				if (x.real(i).isnar()) x.real(i) = 1;
+				if (x.imag(i).isnar()) x.imag(i) = -1;
+			}
+			complex_array<nbits, es> X = x;
+			plan.forward(X);
+			for (size_t k = 0; k < n; ++k) {
+				// X[k] = sum_j x[j] (-i)^(jk n/4) for n = 4, and x[0] +- x[1] for n = 2
+				quire<nbits, es> qr, qi;
+				for (size_t j = 0; j < n; ++j) {
+					size_t rotation = (j * k * (4 / n)) % 4;
+					Posit one(1);
+					switch (rotation) {
+					case 0: qr += quire_mul(one, x.real(j)); qi += quire_mul(one, x.imag(j)); break;   //  1
+					case 1: qr += quire_mul(one, x.imag(j)); qi -= quire_mul(one, x.real(j)); break;   // -i
+					case 2: qr -= quire_mul(one, x.real(j)); qi -= quire_mul(one, x.imag(j)); break;   // -1
+					case 3: qr -= quire_mul(one, x.imag(j)); qi += quire_mul(one, x.real(j)); break;   //  i
+					}
+				}
+				Posit re, im;
+				convert(qr.to_value(), re);
+				convert(qi.to_value(), im);
+				if (X.real(k) != re || X.imag(k) != im) {
+					nrOfFailedTests++;
+					if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " size " << n << " X[" << k << "] = (" << X.real(k) << ", " << X.imag(k) << ") != (" << re << ", " << im << ")\n";
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the exact butterflies are at least as accurate as the rounded butterflies
+template<size_t nbits, size_t es>
+int ValidateExactAccuracy(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	complex_array<nbits, es> x = RandomComplexSignal<nbits, es>(n, 7);
+	std::vector< std::complex<long double> > reference = ReferenceDft(x, false);
+	complex_array<nbits, es> rounded = x, exact = x;
+	fft_plan< posit<nbits, es> >(n, fft_butterfly::rounded).forward(rounded);
+	fft_plan< posit<nbits, es> >(n, fft_butterfly::exact).forward(exact);
+	double roundedError = RelativeError(rounded, reference), exactError = RelativeError(exact, reference);
+	if (exactError > roundedError) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " size " << n << " exact butterfly error " << exactError << " > rounded butterfly error " << roundedError << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the transforms of an impulse and of a constant are exact in both butterflies
+template<size_t nbits, size_t es>
+int ValidateExactTransforms(const std::string& tag, bool bReportIndividualTestCases, size_t n, sw::unum::fft_butterfly butterfly) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	fft_plan<Posit> plan(n, butterfly);
+	complex_array<nbits, es> impulse(n), constant(n);
+	impulse.real(0) = 1;
+	for (size_t i = 0; i < n; ++i) constant.real(i) = 1;
+	plan.forward(impulse);
+	plan.forward(constant);
+	for (size_t k = 0; k < n; ++k) {
+		if (impulse.real(k) != Posit(1) || !impulse.imag(k).iszero()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " size " << n << " impulse X[" << k << "] = (" << impulse.real(k) << ", " << impulse.imag(k) << ")\n";
+		}
+		Posit expected = (k == 0 ? Posit(double(n)) : Posit(0));
+		if (constant.real(k) != expected || !constant.imag(k).iszero()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " size " << n << " constant X[" << k << "] = (" << constant.real(k) << ", " << constant.imag(k) << ")\n";
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// interleaved, split, strided, and vector transforms compute the same values; a NaR sample reaches every output
+template<size_t nbits, size_t es>
+int ValidateInterfaces(const std::string& tag, bool bReportIndividualTestCases, size_t n, sw::unum::fft_butterfly butterfly) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	fft_plan<Posit> plan(n, butterfly);
+	complex_array<nbits, es, complex_layout::interleaved> a = RandomComplexSignal<nbits, es, complex_layout::interleaved>(n, 3);
+	complex_array<nbits, es, complex_layout::split> b = RandomComplexSignal<nbits, es, complex_layout::split>(n, 3);
+	std::vector< complex<Posit> > c(n);
+	for (size_t i = 0; i < n; ++i) c[i] = a[i];
+	plan.forward(a);
+	plan.forward(b);
+	plan.forward(c);
+	for (size_t k = 0; k < n; ++k) {
+		if (a.real(k) != b.real(k) || a.imag(k) != b.imag(k) || a.real(k) != c[k].real() || a.imag(k) != c[k].imag()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " size " << n << " layouts differ at X[" << k << "]\n";
+		}
+	}
+
+	complex_array<nbits, es> x = RandomComplexSignal<nbits, es>(n, 4);
+	x.real(n / 3).setnar();
+	plan.forward(x);
+	for (size_t k = 0; k < n; ++k) {
+		if (!x[k].isnar()) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " size " << n << " NaR did not reach X[" << k << "]\n";
+		}
+	}
+
+	int rejected = 0;
+	try { fft_plan<Posit> bad(n + 1); } catch (const std::runtime_error&) { ++rejected; }
+	try { complex_array<nbits, es> y(2 * n); plan.forward(y); } catch (const std::runtime_error&) { ++rejected; }
+	if (rejected != 2) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " invalid sizes were not rejected\n";
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "fft failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidateDft<16, 1>(tag, true, 8, fft_butterfly::exact, 1.0e-2), "posit<16,1>", "fft exact");
+
+#else
+
+	cout << "FFT validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExactButterfly<8, 0>(tag, bReportIndividualTestCases, 500), "posit<8,0>", "exact butterfly");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactButterfly<16, 1>(tag, bReportIndividualTestCases, 500), "posit<16,1>", "exact butterfly");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactButterfly<32, 2>(tag, bReportIndividualTestCases, 500), "posit<32,2>", "exact butterfly");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactButterfly<80, 3>(tag, bReportIndividualTestCases, 20), "posit<80,3>", "exact butterfly");
+
+	for (size_t n : { 1, 2, 4, 8, 16, 32, 64, 128 }) {
+		nrOfFailedTestCases += ReportTestResult(ValidateDft<16, 1>(tag, bReportIndividualTestCases, n, fft_butterfly::rounded, 1.0e-2), "posit<16,1>", "fft rounded");
+		nrOfFailedTestCases += ReportTestResult(ValidateDft<16, 1>(tag, bReportIndividualTestCases, n, fft_butterfly::exact, 1.0e-2), "posit<16,1>", "fft exact");
+		nrOfFailedTestCases += ReportTestResult(ValidateDft<32, 2>(tag, bReportIndividualTestCases, n, fft_butterfly::rounded, 1.0e-6), "posit<32,2>", "fft rounded");
+		nrOfFailedTestCases += ReportTestResult(ValidateDft<32, 2>(tag, bReportIndividualTestCases, n, fft_butterfly::exact, 1.0e-6), "posit<32,2>", "fft exact");
+	}
+	nrOfFailedTestCases += ReportTestResult(ValidateDft<64, 3>(tag, bReportIndividualTestCases, 64, fft_butterfly::exact, 1.0e-15), "posit<64,3>", "fft exact");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExactAccuracy<16, 1>(tag, bReportIndividualTestCases, 256), "posit<16,1>", "exact butterfly accuracy");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactAccuracy<32, 2>(tag, bReportIndividualTestCases, 512), "posit<32,2>", "exact butterfly accuracy");
+
+	for (fft_butterfly butterfly : { fft_butterfly::rounded, fft_butterfly::exact }) {
+		nrOfFailedTestCases += ReportTestResult(ValidateExactTransforms<16, 1>(tag, bReportIndividualTestCases, 64, butterfly), "posit<16,1>", "fft impulse and constant");
+		nrOfFailedTestCases += ReportTestResult(ValidateExactTransforms<32, 2>(tag, bReportIndividualTestCases, 128, butterfly), "posit<32,2>", "fft impulse and constant");
+		nrOfFailedTestCases += ReportTestResult(ValidateInterfaces<16, 1>(tag, bReportIndividualTestCases, 32, butterfly), "posit<16,1>", "fft interfaces");
+		nrOfFailedTestCases += ReportTestResult(ValidateInterfaces<32, 2>(tag, bReportIndividualTestCases, 64, butterfly), "posit<32,2>", "fft interfaces");
+	}
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateDft<32, 2>(tag, bReportIndividualTestCases, 4096, fft_butterfly::exact, 1.0e-6), "posit<32,2>", "fft exact");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactAccuracy<16, 1>(tag, bReportIndividualTestCases, 4096), "posit<16,1>", "exact butterfly accuracy");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
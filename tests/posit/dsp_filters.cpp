@@ -0,0 +1,298 @@
+// dsp_filters.cpp: functional tests for the streaming FIR, biquad, and polyphase filters
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cmath>
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// uniformly distributed posits in [-1, 1)
+template<typename Posit>
+std::vector<Posit> RandomSignal(size_t n, unsigned seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector<Posit> x(n);
+	for (Posit& p : x) p = distribution(generator);
+	return x;
+}
+
+// the limb accumulator of the filters rounds sums of products over the full dynamic range the same as the quire
+template<size_t nbits, size_t es>
+int ValidateAccumulator(const std::string& tag, bool bReportIndividualTestCases, size_t nrSums) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(nbits);
+	int nrOfFailedTests = 0;
+	internal::product_accumulator<nbits, es, 10> accumulator;
+	for (size_t r = 0; r < nrSums; ++r) {
+		quire<nbits, es, 10> q;
+		accumulator.reset();
+		size_t n = 1 + generator() % 20;
+		for (size_t i = 0; i < n; ++i) {
+			Posit a, b;
+			a.set_raw_bits(generator());
+			b.set_raw_bits(generator());
+			if (a.isnar() || b.isnar()) continue;
+			q += quire_mul(a, b);
+			accumulator.add_product(a, b);
+			// cancel some of the products exactly
+			if (generator() % 4 == 0) {
+				q += quire_mul(-a, b);
+				accumulator.add_product(-a, b);
+			}
+		}
+		Posit reference;
+		convert(q.to_value(), reference);
+		Posit sum = accumulator.template round<Posit>();
+		if (sum != reference) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " sum " << hex_format(sum) << " != " << hex_format(reference) << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// sums with the leading one at every bit of a limb, and a product far below the 128 bits that the rounding keeps,
+// so that the sticky bit decides the ties at the half ulp of the second term
+template<size_t nbits, size_t es>
+int ValidateAccumulatorSticky(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	internal::product_accumulator<nbits, es, 10> accumulator;
+	Posit one(1), tiny(std::ldexp(1.0, -30));
+	for (int e = 0; e < 100; ++e) {
+		for (int d = 1; d < 40; ++d) {
+			Posit big(std::ldexp(1.0, e)), small(std::ldexp(1.0, e - d));
+			quire<nbits, es, 10> q;
+			q += quire_mul(one, big);
+			q += quire_mul(one, small);
+			q += quire_mul(tiny, tiny);
+			accumulator.reset();
+			accumulator.add_product(one, big);
+			accumulator.add_product(one, small);
+			accumulator.add_product(tiny, tiny);
+			Posit reference;
+			convert(q.to_value(), reference);
+			Posit sum = accumulator.template round<Posit>();
+			if (sum != reference) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " 2^" << e << " + 2^" << (e - d) << " + 2^-60 sum " << hex_format(sum) << " != " << hex_format(reference) << '\n';
+			}
+		}
+	}
+
+	// the FIR of taps {1, 1, 2^-30} over the samples {2^-30, 2^73, 2^81}
+	fir_filter<Posit> fir({ one, one, tiny });
+	std::vector<Posit> x = { tiny, Posit(std::ldexp(1.0, 73)), Posit(std::ldexp(1.0, 81)) }, window = { x[2], x[1], x[0] };
+	Posit y;
+	for (const Posit& sample : x) y = fir.process(sample);
+	if (y != fdp(std::vector<Posit>{ one, one, tiny }, window)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " fir sticky " << hex_format(y) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the FIR output equals the fused dot product of the taps with the reversed window of the input, zero before the first sample
+template<typename Posit>
+int ValidateFir(const std::string& tag, bool bReportIndividualTestCases, size_t nrTaps, size_t n) {
+	using namespace sw::unum;
+	std::vector<Posit> h = RandomSignal<Posit>(nrTaps, 1), x = RandomSignal<Posit>(n, 2);
+	fir_filter<Posit> fir(h);
+	int nrOfFailedTests = 0;
+	std::vector<Posit> window(nrTaps);
+	std::vector<Posit> y(n);
+	for (size_t i = 0; i < n; ++i) {
+		y[i] = fir.process(x[i]);
+		for (size_t k = 0; k < nrTaps; ++k) window[k] = (k <= i ? x[i - k] : Posit(0));
+		Posit reference = fdp(h, window);
+		if (y[i] != reference) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " sample " << i << " " << y[i] << " != " << reference << '\n';
+		}
+	}
+
+	// the block interface, in place, continues from the state after a reset
+	fir.reset();
+	std::vector<Posit> z(x);
+	fir.process(z.data(), z.data(), 7);
+	fir.process(z.data() + 7, z.data() + 7, n - 7);
+	if (z != y) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " block processing\n";
+	}
+
+	// a NaR sample makes exactly the outputs NaR whose window holds it
+	fir.reset();
+	size_t nrNaR = 0;
+	for (size_t i = 0; i < 3 * nrTaps; ++i) {
+		Posit sample = x[i];
+		if (i == nrTaps) sample.setnar();
+		if (fir.process(sample).isnar()) ++nrNaR;
+	}
+	if (nrNaR != nrTaps) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " NaR propagates to " << nrNaR << " outputs instead of " << nrTaps << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+// the biquad output is the single rounding of the five products, and a cascade of low pass sections has unit gain at DC
+template<typename Posit>
+int ValidateBiquad(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	// second order Butterworth low pass at a tenth of the sample rate
+	const double pi = 3.14159265358979323846;
+	double w = std::tan(pi * 0.1), norm = 1.0 / (1.0 + std::sqrt(2.0) * w + w * w);
+	double b0 = w * w * norm, b1 = 2.0 * b0, b2 = b0;
+	double a1 = 2.0 * (w * w - 1.0) * norm, a2 = (1.0 - std::sqrt(2.0) * w + w * w) * norm;
+	std::vector<Posit> coefficients = { Posit(b0), Posit(b1), Posit(b2), Posit(-a1), Posit(-a2) };
+	biquad<Posit> section{ Posit(b0), Posit(b1), Posit(b2), Posit(a1), Posit(a2) };
+
+	std::vector<Posit> x = RandomSignal<Posit>(n, 3);
+	Posit x1(0), x2(0), y1(0), y2(0);
+	for (size_t i = 0; i < n; ++i) {
+		Posit y = section.process(x[i]);
+		std::vector<Posit> state = { x[i], x1, x2, y1, y2 };
+		Posit reference = fdp(coefficients, state);
+		if (y != reference) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " biquad sample " << i << " " << y << " != " << reference << '\n';
+		}
+		x2 = x1; x1 = x[i];
+		y2 = y1; y1 = reference;
+	}
+
+	biquad_cascade<Posit> cascade;
+	cascade.add_section(Posit(b0), Posit(b1), Posit(b2), Posit(a1), Posit(a2));
+	cascade.add_section(Posit(b0), Posit(b1), Posit(b2), Posit(a1), Posit(a2));
+	std::vector<Posit> step(200, Posit(1)), response(step.size());
+	cascade.process(step.data(), response.data(), step.size());
+	if (std::fabs(double(response.back()) - 1.0) > 0.01) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " cascade step response settles at " << response.back() << '\n';
+	}
+	// the block interface agrees with the sample interface
+	cascade.reset();
+	for (size_t i = 0; i < step.size(); ++i) {
+		if (cascade.process(step[i]) != response[i]) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " cascade block sample " << i << '\n';
+			break;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the polyphase decimator yields every factor-th output of the FIR filter with the same taps
+template<typename Posit>
+int ValidateDecimator(const std::string& tag, bool bReportIndividualTestCases, size_t nrTaps, size_t factor, size_t n) {
+	using namespace sw::unum;
+	std::vector<Posit> h = RandomSignal<Posit>(nrTaps, 4), x = RandomSignal<Posit>(n, 5);
+	fir_filter<Posit> fir(h);
+	polyphase_decimator<Posit> decimator(h, factor);
+	std::vector<Posit> y(n), d(n / factor + 1);
+	fir.process(x.data(), y.data(), n);
+	size_t m = 0;
+	for (size_t first = 0; first < n; first += 13) m += decimator.process(x.data() + first, std::min(size_t(13), n - first), d.data() + m);
+	int nrOfFailedTests = 0;
+	if (m != (n + factor - 1) / factor) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " decimator produced " << m << " samples\n";
+	}
+	for (size_t i = 0; i < m; ++i) {
+		if (d[i] != y[i * factor]) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " decimated sample " << i << " " << d[i] << " != " << y[i * factor] << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "dsp filters failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<16, 1>>(tag, true, 5, 20), "posit<16,1>", "fir filter");
+
+#else
+
+	cout << "DSP filter validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulator<8, 0>(tag, bReportIndividualTestCases, 1000), "posit<8,0>", "product accumulator");
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulator<16, 1>(tag, bReportIndividualTestCases, 1000), "posit<16,1>", "product accumulator");
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulator<24, 1>(tag, bReportIndividualTestCases, 1000), "posit<24,1>", "product accumulator");
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulator<32, 2>(tag, bReportIndividualTestCases, 1000), "posit<32,2>", "product accumulator");
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulator<64, 3>(tag, bReportIndividualTestCases, 200), "posit<64,3>", "product accumulator");
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulatorSticky<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", "product accumulator sticky");
+	nrOfFailedTestCases += ReportTestResult(ValidateAccumulatorSticky<64, 3>(tag, bReportIndividualTestCases), "posit<64,3>", "product accumulator sticky");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<8, 0>>(tag, bReportIndividualTestCases, 7, 100), "posit<8,0>", "fir filter");
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<16, 1>>(tag, bReportIndividualTestCases, 16, 200), "posit<16,1>", "fir filter");
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<32, 2>>(tag, bReportIndividualTestCases, 33, 200), "posit<32,2>", "fir filter");
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<24, 1>>(tag, bReportIndividualTestCases, 9, 100), "posit<24,1>", "fir filter");
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<80, 3>>(tag, bReportIndividualTestCases, 3, 10), "posit<80,3>", "fir filter");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateBiquad<posit<16, 1>>(tag, bReportIndividualTestCases, 200), "posit<16,1>", "biquad");
+	nrOfFailedTestCases += ReportTestResult(ValidateBiquad<posit<32, 2>>(tag, bReportIndividualTestCases, 200), "posit<32,2>", "biquad");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateDecimator<posit<16, 1>>(tag, bReportIndividualTestCases, 32, 4, 301), "posit<16,1>", "polyphase decimator");
+	nrOfFailedTestCases += ReportTestResult(ValidateDecimator<posit<16, 1>>(tag, bReportIndividualTestCases, 30, 7, 300), "posit<16,1>", "polyphase decimator");
+	nrOfFailedTestCases += ReportTestResult(ValidateDecimator<posit<32, 2>>(tag, bReportIndividualTestCases, 5, 8, 100), "posit<32,2>", "polyphase decimator");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateFir<posit<32, 2>>(tag, bReportIndividualTestCases, 255, 10000), "posit<32,2>", "fir filter");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
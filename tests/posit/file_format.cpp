@@ -0,0 +1,359 @@
+// file_format.cpp: functional tests for the binary posit array file format and its readers and writer
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <cstdio>
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// a file name in the working directory that is unique to the configuration and packing
+std::string TemporaryFileName(size_t nbits, size_t es, sw::unum::posit_file_packing packing) {
+	return std::string("file_format_") + std::to_string(nbits) + "_" + std::to_string(es) + (packing == sw::unum::posit_file_packing::bit ? "_bit" : "_word") + ".posit";
+}
+
+// write random posits in chunks of odd sizes, and read them back through the streaming reader and the mapped view
+template<size_t nbits, size_t es>
+int ValidateRoundTrip(const std::string& tag, bool bReportIndividualTestCases, sw::unum::posit_file_packing packing, size_t rows, size_t columns) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	const size_t n = rows * columns;
+	std::string path = TemporaryFileName(nbits, es, packing);
+	std::mt19937_64 generator(nbits);
+	std::vector<Posit> v(n);
+	for (size_t i = 0; i < n; ++i) v[i].set_raw_bits(generator());
+	int nrOfFailedTests = 0;
+
+	{
+		posit_file_writer<nbits, es> writer(path, packing, { rows, columns });
+		size_t i = 0, chunk = 1;
+		while (i < n) {
+			size_t count = std::min(chunk, n - i);
+			writer.write(v.data() + i, count);
+			i += count;
+			chunk = 2 * chunk + 1;
+		}
+	}  // the destructor closes the file
+
+	posit_file_header h = read_posit_file_header(path);
+	if (h.nbits != nbits || h.es != es || h.rank != 2 || h.shape[0] != rows || h.shape[1] != columns || h.size() != n) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " header\n";
+	}
+
+	{
+		posit_file_reader<nbits, es> reader(path);
+		std::vector<Posit> w(n);
+		size_t i = 0, chunk = 3;
+		while (size_t count = reader.read(w.data() + i, std::min(chunk, n - i))) {
+			i += count;
+			chunk += 7;
+		}
+		if (i != n || w != v) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " streaming reader\n";
+		}
+	}
+
+	{
+		mapped_posit_file<nbits, es> file(path);
+		posit_array_view<nbits, es> view = file.view();
+		if (file.size() != n || file.rank() != 2 || file.extent(1) != columns || view.packing() != packing) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " mapped file shape\n";
+		}
+		for (size_t i = 0; i < n; ++i) {
+			if (view[i] != v[i]) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " mapped element " << i << " " << hex_format(view[i]) << " != " << hex_format(v[i]) << '\n';
+			}
+		}
+		std::vector<Posit> block(37);
+		view.unpack(n - block.size(), block.size(), block.data());
+		if (!std::equal(block.begin(), block.end(), v.end() - block.size())) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " mapped unpack\n";
+		}
+	}
+	std::remove(path.c_str());
+	return nrOfFailedTests;
+}
+
+// the bit packed file holds the same words as the packed_posit_vector, and a word packed posit<16,1> file maps onto uint16_t
+int ValidateLayout(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	std::vector<posit<10, 0>> v(1000);
+	for (size_t i = 0; i < v.size(); ++i) v[i].set_raw_bits(i * 7);
+	packed_posit_vector<10, 0> packed(v.begin(), v.end());
+	std::string path = TemporaryFileName(10, 0, posit_file_packing::bit);
+	{
+		posit_file_writer<10, 0> writer(path, posit_file_packing::bit);
+		writer.write(v.data(), v.size());
+	}
+	{
+		mapped_posit_file<10, 0> file(path);
+		if (file.header().data_bytes() != 8 * ((v.size() * 10 + 63) / 64 + 1)) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " bit packed data size\n";
+		}
+		posit_file_reader<10, 0> reader(path);
+		std::vector<posit<10, 0>> w(v.size());
+		reader.read(w.data(), w.size());
+		if (w != v) nrOfFailedTests++;
+	}
+	{
+		// compare the encodings on disk with the words of the packed container
+		FILE* f = std::fopen(path.c_str(), "rb");
+		std::vector<uint64_t> words((v.size() * 10 + 63) / 64 + 1);
+		std::fseek(f, long(sizeof(posit_file_header)), SEEK_SET);
+		size_t nrWords = std::fread(words.data(), sizeof(uint64_t), words.size(), f);
+		std::fclose(f);
+		if (nrWords != words.size() || std::memcmp(words.data(), packed.data(), words.size() * sizeof(uint64_t)) != 0) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " bit packed layout differs from packed_posit_vector\n";
+		}
+	}
+	std::remove(path.c_str());
+
+	path = TemporaryFileName(16, 1, posit_file_packing::word);
+	std::vector<posit<16, 1>> p(100);
+	for (size_t i = 0; i < p.size(); ++i) p[i] = double(i) / 8.0;
+	{
+		posit_file_writer<16, 1> writer(path);
+		writer.write(p.data(), p.size());
+	}
+	{
+		mapped_posit_file<16, 1> file(path);
+		const uint16_t* encodings = file.view().encodings<uint16_t>();
+		for (size_t i = 0; i < p.size(); ++i) {
+			if (encodings[i] != p[i].encoding()) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " word packed encoding " << i << '\n';
+			}
+		}
+	}
+	std::remove(path.c_str());
+	return nrOfFailedTests;
+}
+
+// configuration mismatches, shape mismatches, crafted headers, and files of the other byte order
+int ValidateErrors(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	std::string path = TemporaryFileName(32, 2, posit_file_packing::word);
+	std::vector<posit<32, 2>> v(50);
+	for (size_t i = 0; i < v.size(); ++i) v[i] = 1.0 / double(i + 1);
+	{
+		posit_file_writer<32, 2> writer(path);
+		writer.write(v.data(), v.size());
+	}
+	try {
+		mapped_posit_file<16, 1> file(path);
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " configuration mismatch not detected\n";
+	}
+	catch (const posit_file_exception&) {}
+	try {
+		posit_file_writer<32, 2> writer(path, posit_file_packing::word, { 10, 10 });
+		writer.write(v.data(), v.size());
+		writer.close();
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " shape mismatch not detected\n";
+	}
+	catch (const posit_file_exception&) {}
+
+	// crafted headers whose extents or data offset wrap the size computations must be reported as truncated,
+	// and a misaligned data offset or an unused extent other than 1 as a corrupt header
+	{
+		posit_file_writer<32, 2> writer(path, posit_file_packing::word, { 5, 10 });
+		writer.write(v.data(), v.size());
+	}
+	posit_file_header valid;
+	std::vector<char> data;
+	{
+		FILE* f = std::fopen(path.c_str(), "rb");
+		std::fread(&valid, sizeof(valid), 1, f);
+		data.resize(valid.data_bytes());
+		std::fread(data.data(), 1, data.size(), f);
+		std::fclose(f);
+	}
+	// the encodings are followed by padding, so that a data offset past the header still finds all of them
+	data.resize(data.size() + 64);
+	for (int c = 0; c < 7; ++c) {
+		posit_file_header h = valid;
+		const char* error = " is truncated";
+		switch (c) {
+		case 0: h.shape[0] = uint64_t(1) << 62; h.shape[1] = 4; break;                // size() wraps to 0
+		case 1: h.shape[0] = (uint64_t(1) << 62) + 1; h.shape[1] = 1; break;          // size() * 4 wraps to 4
+		case 2: h.data_offset = ~uint64_t(0) - 127; break;                              // data_offset + data_bytes() wraps
+		case 3: h.data_offset = 72; error = " has a corrupt header"; break;             // misaligned encodings
+		case 4: h.data_offset = 96; error = " has a corrupt header"; break;
+		case 5: h.shape[1] = 5; h.shape[2] = 2; error = " has a corrupt header"; break; // an unused extent holds part of the size
+		default: h.shape[3] = 0; error = " has a corrupt header"; break;                // an unused extent empties the array
+		}
+		{
+			FILE* f = std::fopen(path.c_str(), "wb");
+			std::fwrite(&h, sizeof(h), 1, f);
+			std::fwrite(data.data(), 1, data.size(), f);
+			std::fclose(f);
+		}
+		try {
+			mapped_posit_file<32, 2> file(path);
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " crafted header " << c << " mapped\n";
+		}
+		catch (const posit_file_exception& err) {
+			if (std::string(err.what()) != "posit file exception: " + path + error) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " crafted header " << c << " mapped: " << err.what() << '\n';
+			}
+		}
+		try {
+			posit_file_reader<32, 2> reader(path);
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " crafted header " << c << " streamed\n";
+		}
+		catch (const posit_file_exception& err) {
+			if (std::string(err.what()) != "posit file exception: " + path + error) {
+				nrOfFailedTests++;
+				if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " crafted header " << c << " streamed: " << err.what() << '\n';
+			}
+		}
+	}
+	{
+		// the padded file with the valid header still reads
+		FILE* f = std::fopen(path.c_str(), "wb");
+		std::fwrite(&valid, sizeof(valid), 1, f);
+		std::fwrite(data.data(), 1, data.size(), f);
+		std::fclose(f);
+		mapped_posit_file<32, 2> file(path);
+		if (file.size() != v.size() || file.view()[7] != v[7]) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " padded file\n";
+		}
+	}
+
+	// write the file of a machine of the other endianness: the streaming reader swaps, the mapped reader refuses
+	for (posit_file_packing packing : { posit_file_packing::word, posit_file_packing::bit }) {
+		{
+			posit_file_writer<32, 2> writer(path, packing);
+			writer.write(v.data(), v.size());
+		}
+		posit_file_header h;
+		std::vector<uint64_t> words;
+		{
+			FILE* f = std::fopen(path.c_str(), "rb");
+			std::fread(&h, sizeof(h), 1, f);
+			words.resize(h.data_bytes() / 8);
+			std::fread(words.data(), 8, words.size(), f);
+			std::fclose(f);
+		}
+		if (packing == posit_file_packing::word) {
+			uint32_t* encodings = reinterpret_cast<uint32_t*>(words.data());
+			for (size_t i = 0; i < v.size(); ++i) encodings[i] = internal::byteswap(encodings[i]);
+		}
+		else {
+			for (uint64_t& w : words) w = internal::byteswap(w);
+		}
+		internal::byteswap(h);
+		{
+			FILE* f = std::fopen(path.c_str(), "wb");
+			std::fwrite(&h, sizeof(h), 1, f);
+			std::fwrite(words.data(), 8, words.size(), f);
+			std::fclose(f);
+		}
+		posit_file_reader<32, 2> reader(path);
+		std::vector<posit<32, 2>> w(v.size());
+		if (reader.read(w.data(), w.size()) != v.size() || w != v) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " byte swapped streaming read\n";
+		}
+		try {
+			mapped_posit_file<32, 2> file(path);
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " byte swapped file mapped\n";
+		}
+		catch (const posit_file_exception&) {}
+	}
+	std::remove(path.c_str());
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "posit file format failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<10, 0>(tag, true, posit_file_packing::bit, 3, 7), "posit<10,0>", "bit packed file");
+
+#else
+
+	cout << "Binary posit array file validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<8, 0>(tag, bReportIndividualTestCases, posit_file_packing::word, 31, 33), "posit<8,0>", "word packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<10, 0>(tag, bReportIndividualTestCases, posit_file_packing::word, 31, 33), "posit<10,0>", "word packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<16, 1>(tag, bReportIndividualTestCases, posit_file_packing::word, 31, 33), "posit<16,1>", "word packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<32, 2>(tag, bReportIndividualTestCases, posit_file_packing::word, 31, 33), "posit<32,2>", "word packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<48, 2>(tag, bReportIndividualTestCases, posit_file_packing::word, 31, 33), "posit<48,2>", "word packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<10, 0>(tag, bReportIndividualTestCases, posit_file_packing::bit, 31, 33), "posit<10,0>", "bit packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<14, 1>(tag, bReportIndividualTestCases, posit_file_packing::bit, 31, 33), "posit<14,1>", "bit packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<16, 1>(tag, bReportIndividualTestCases, posit_file_packing::bit, 31, 33), "posit<16,1>", "bit packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<48, 2>(tag, bReportIndividualTestCases, posit_file_packing::bit, 31, 33), "posit<48,2>", "bit packed file");
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<64, 3>(tag, bReportIndividualTestCases, posit_file_packing::bit, 31, 33), "posit<64,3>", "bit packed file");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateLayout(tag, bReportIndividualTestCases), "posit file", "layout");
+	nrOfFailedTestCases += ReportTestResult(ValidateErrors(tag, bReportIndividualTestCases), "posit file", "errors");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRoundTrip<12, 1>(tag, bReportIndividualTestCases, posit_file_packing::bit, 1000, 1000), "posit<12,1>", "bit packed file");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,181 @@
+// math_exponential_logarithm.cpp: exhaustive tests for the native exp/exp2/exp10/log/log2/log10/pow functions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// enable the fast specialized posit<16,1> so that the exhaustive test runs against the configuration in use
+#define POSIT_FAST_POSIT_16_1 1
+// minimum set of include files to reflect source code dependencies
+#include "universal/posit/posit.hpp"
+#include "universal/posit/posit_manipulators.hpp"
+#include "universal/posit/math/exponent.hpp"
+#include "universal/posit/math/logarithm.hpp"
+#include "universal/posit/math/pow.hpp"
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "../utils/posit_math_helpers.hpp"
+
+// exhaustive validation of the logarithm and exponential functions of a posit configuration
+template<size_t nbits, size_t es>
+int ValidateExponentialLogarithm(std::string tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::stringstream ss;
+	ss << "posit<" << nbits << "," << es << ">";
+	std::string type = ss.str();
+	int nrOfFailedTestCases = 0;
+	nrOfFailedTestCases += ReportTestResult(ValidateLog<nbits, es>(tag, bReportIndividualTestCases), type, "log");
+	nrOfFailedTestCases += ReportTestResult(ValidateLog2<nbits, es>(tag, bReportIndividualTestCases), type, "log2");
+	nrOfFailedTestCases += ReportTestResult(ValidateLog10<nbits, es>(tag, bReportIndividualTestCases), type, "log10");
+	nrOfFailedTestCases += ReportTestResult(ValidateExp<nbits, es>(tag, bReportIndividualTestCases), type, "exp");
+	nrOfFailedTestCases += ReportTestResult(ValidateExp2<nbits, es>(tag, bReportIndividualTestCases), type, "exp2");
+	nrOfFailedTestCases += ReportTestResult(ValidateExp10<nbits, es>(tag, bReportIndividualTestCases), type, "exp10");
+	return nrOfFailedTestCases;
+}
+
+// random samples of pow(a, b) compared to a long double reference
+template<size_t nbits, size_t es>
+int ValidateRandomPowerFunction(std::string tag, bool bReportIndividualTestCases, unsigned nrOfSamples) {
+	using namespace sw::unum;
+	std::mt19937_64 generator(nbits * 1000 + es);
+	const uint64_t mask = (nbits == 64) ? ~uint64_t(0) : ((uint64_t(1) << nbits) - 1);
+	int nrOfFailedTests = 0;
+	posit<nbits, es> pa, pb, ppow, pref;
+	for (unsigned i = 0; i < nrOfSamples; ++i) {
+		pa.set_raw_bits(generator() & mask);
+		pb.set_raw_bits(generator() & mask);
+		ppow = sw::unum::pow(pa, pb);
+		if (pa.isnar() || pb.isnar()) {
+			pref.setnar();
+		}
+		else if (pb.iszero()) {
+			pref = 1;
+		}
+		else if (pa.iszero()) {
+			pref.setzero();
+			if (pb.isneg()) pref.setnar();
+		}
+		else {
+			pref = SaturatingReference<nbits, es>(std::pow((long double)pa, (long double)pb));
+		}
+		if (ppow != pref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases)	ReportTwoInputFunctionError("FAIL", "pow", pa, pb, pref, ppow);
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// identities that must hold exactly for any posit precision
+template<size_t nbits, size_t es>
+int ValidateExactIdentities(std::string tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	auto check = [&](const char* op, const Posit& result, const Posit& ref) {
+		if (result != ref) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << op << " " << result << " != " << ref << '\n';
+		}
+	};
+	for (int k = -20; k <= 20; ++k) {
+		Posit pk(k);
+		check("log2(2^k)", sw::unum::log2(Posit(std::ldexp(1.0, k))), pk);
+		check("exp2(k)", sw::unum::exp2(pk), Posit(std::ldexp(1.0, k)));
+	}
+	for (int k = 0; k <= 8; ++k) {
+		Posit pk(k);
+		Posit power(std::pow(10.0, k));
+		if (double(power) != std::pow(10.0, k)) break;   // 10^k is no longer representable
+		check("log10(10^k)", sw::unum::log10(power), pk);
+		check("exp10(k)", sw::unum::exp10(pk), power);
+	}
+	check("log(1)", sw::unum::log(Posit(1)), Posit(0));
+	check("exp(0)", sw::unum::exp(Posit(0)), Posit(1));
+	check("pow(36, 1.5)", sw::unum::pow(Posit(36), Posit(1.5)), Posit(216));
+	check("pow(2.25, 0.5)", sw::unum::pow(Posit(2.25), 0.5), Posit(1.5));
+	check("pow(-2, 3)", sw::unum::pow(Posit(-2), 3), Posit(-8));
+	check("pow(2, -2)", sw::unum::pow(Posit(2), -2), Posit(0.25));
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "exponential/logarithm failed: ";
+
+#if MANUAL_TESTING
+	bReportIndividualTestCases = true;
+	nrOfFailedTestCases += ValidateExponentialLogarithm<8, 0>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ReportTestResult(ValidatePowerFunction<8, 0>(tag, bReportIndividualTestCases, 1 << 16), "posit<8,0>", "pow");
+
+#else
+
+	cout << "Posit native exponential and logarithm function validation" << endl;
+
+	nrOfFailedTestCases += ValidateExponentialLogarithm<2, 0>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<3, 0>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<3, 1>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<5, 2>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<8, 0>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<8, 1>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<8, 2>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<9, 6>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<10, 6>(tag, bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateExponentialLogarithm<12, 1>(tag, bReportIndividualTestCases);
+	// exhaustive over the fast posit<16,1>
+	nrOfFailedTestCases += ValidateExponentialLogarithm<16, 1>(tag, bReportIndividualTestCases);
+
+	// pow is exhaustive for the small configurations and sampled for the larger ones
+	nrOfFailedTestCases += ReportTestResult(ValidatePowerFunction<6, 2>(tag, bReportIndividualTestCases, 1 << 12), "posit<6,2>", "pow");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowerFunction<8, 0>(tag, bReportIndividualTestCases, 1 << 16), "posit<8,0>", "pow");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowerFunction<8, 1>(tag, bReportIndividualTestCases, 1 << 16), "posit<8,1>", "pow");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomPowerFunction<10, 1>(tag, bReportIndividualTestCases, 100000), "posit<10,1>", "pow");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomPowerFunction<16, 1>(tag, bReportIndividualTestCases, 100000), "posit<16,1>", "pow");
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomPowerFunction<32, 2>(tag, bReportIndividualTestCases, 10000), "posit<32,2>", "pow");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExactIdentities<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "identities");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactIdentities<32, 2>(tag, bReportIndividualTestCases), "posit<32,2>", "identities");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactIdentities<64, 3>(tag, bReportIndividualTestCases), "posit<64,3>", "identities");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactIdentities<80, 3>(tag, bReportIndividualTestCases), "posit<80,3>", "identities");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateRandomPowerFunction<16, 1>(tag, bReportIndividualTestCases, 10000000), "posit<16,1>", "pow");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,200 @@
+// packed_vector.cpp: functional tests for the bit-packed posit container
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable the fast specialized posits
+#define POSIT_FAST_POSIT_8_0 1
+#define POSIT_FAST_POSIT_16_1 1
+#define POSIT_FAST_POSIT_32_2 1
+// second: enable/disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// random writes to the packed container must agree with the same writes to a std::vector, and leave the neighbors alone
+template<size_t nbits, size_t es>
+int ValidatePackedAccess(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(nbits);
+	int nrOfFailedTests = 0;
+	packed_posit_vector<nbits, es> packed(n);
+	std::vector<Posit> reference(n, Posit(0));
+	for (size_t r = 0; r < 8 * n; ++r) {
+		size_t i = generator() % n;
+		Posit p;
+		p.set_raw_bits(generator());
+		packed[i] = p;
+		reference[i] = p;
+	}
+	for (size_t i = 0; i < n; ++i) {
+		if (Posit(packed[i]) != reference[i]) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " element " << i << " " << hex_format(Posit(packed[i])) << " != " << hex_format(reference[i]) << '\n';
+		}
+	}
+	if (packed.storage_bytes() != (n * nbits + 7) / 8) nrOfFailedTests++;
+
+	// the extremes of the encoding stay within their element
+	for (size_t i = 0; i < n; ++i) packed[i] = (i & 1) ? Posit(0) : -minpos<nbits, es>();
+	for (size_t i = 0; i < n; ++i) {
+		if (Posit(packed[i]) != ((i & 1) ? Posit(0) : -minpos<nbits, es>())) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " alternating pattern at element " << i << '\n';
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// every encoding of a small configuration through push_back, the iterators, and the block moves at unaligned offsets
+template<size_t nbits, size_t es>
+int ValidatePackedBlocks(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	const size_t n = size_t(1) << nbits;
+	packed_posit_vector<nbits, es> packed;
+	std::vector<Posit> all(n);
+	for (size_t i = 0; i < n; ++i) {
+		all[i].set_raw_bits(i);
+		packed.push_back(all[i]);
+	}
+	if (packed.size() != n || !std::equal(packed.cbegin(), packed.cend(), all.begin())) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " push_back and iteration\n";
+	}
+
+	std::vector<Posit> block(200);
+	for (size_t first : { size_t(0), size_t(1), size_t(63), size_t(64), size_t(333) }) {
+		size_t count = std::min(block.size(), n - first);
+		packed.unpack(first, count, block.data());
+		if (!std::equal(block.begin(), block.begin() + count, all.begin() + first)) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " unpack at " << first << '\n';
+		}
+		std::reverse(block.begin(), block.begin() + count);
+		packed.pack(first, count, block.data());
+		std::reverse(all.begin() + first, all.begin() + first + count);
+		if (!std::equal(packed.cbegin(), packed.cend(), all.begin())) {
+			nrOfFailedTests++;
+			if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " pack at " << first << '\n';
+		}
+	}
+
+	// the standard algorithms through the proxy references
+	std::sort(all.begin(), all.end());
+	std::sort(packed.begin(), packed.end(), [](const Posit& a, const Posit& b) { return a < b; });
+	if (!std::equal(packed.cbegin(), packed.cend(), all.begin())) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " sort\n";
+	}
+	packed_posit_vector<nbits, es> copy(all.begin(), all.end());
+	if (copy != packed) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " construction from a range\n";
+	}
+	copy.resize(n / 2);
+	copy.resize(n);
+	if (Posit(copy[n / 2]) != Posit(0) || Posit(copy[n / 2 - 1]) != all[n / 2 - 1]) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " resize\n";
+	}
+	return nrOfFailedTests;
+}
+
+// the fused dot products of fdp.hpp over packed vectors agree with those over std::vector
+template<size_t nbits, size_t es>
+int ValidatePackedDotProduct(const std::string& tag, bool bReportIndividualTestCases, size_t n) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 generator(nbits);
+	std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+	std::vector<Posit> x(n), y(n);
+	for (size_t i = 0; i < n; ++i) {
+		x[i] = distribution(generator);
+		y[i] = distribution(generator);
+	}
+	packed_posit_vector<nbits, es> px(x.begin(), x.end()), py(y.begin(), y.end());
+	int nrOfFailedTests = 0;
+	if (fdp(px, py) != fdp(x, y) || fdp_stride(n, px, 3, py, 3) != fdp_stride(n, x, 3, y, 3)) {
+		nrOfFailedTests++;
+		if (bReportIndividualTestCases) std::cerr << "FAIL " << tag << " fdp " << fdp(px, py) << " != " << fdp(x, y) << '\n';
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "packed posit vector failed: ";
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<10, 0>(tag, true, 100), "posit<10,0>", "packed access");
+
+#else
+
+	cout << "Packed posit vector validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<8, 0>(tag, bReportIndividualTestCases, 1000), "posit<8,0>", "packed access");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<10, 0>(tag, bReportIndividualTestCases, 1000), "posit<10,0>", "packed access");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<12, 0>(tag, bReportIndividualTestCases, 1000), "posit<12,0>", "packed access");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<14, 0>(tag, bReportIndividualTestCases, 1000), "posit<14,0>", "packed access");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<16, 1>(tag, bReportIndividualTestCases, 1000), "posit<16,1>", "packed access");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<48, 2>(tag, bReportIndividualTestCases, 1000), "posit<48,2>", "packed access");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedAccess<64, 3>(tag, bReportIndividualTestCases, 1000), "posit<64,3>", "packed access");
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedBlocks<10, 0>(tag, bReportIndividualTestCases), "posit<10,0>", "packed blocks");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedBlocks<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "packed blocks");
+
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedDotProduct<10, 0>(tag, bReportIndividualTestCases, 100), "posit<10,0>", "packed fdp");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedDotProduct<14, 0>(tag, bReportIndividualTestCases, 100), "posit<14,0>", "packed fdp");
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedDotProduct<32, 2>(tag, bReportIndividualTestCases, 100), "posit<32,2>", "packed fdp");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidatePackedBlocks<16, 1>(tag, bReportIndividualTestCases), "posit<16,1>", "packed blocks");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
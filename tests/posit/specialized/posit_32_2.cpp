@@ -83,6 +83,18 @@ try {
 	if (!p.isnar()) ++nrOfFailedTestCases;
 	p = INFINITY;
 	if (!p.isnar()) ++nrOfFailedTestCases;
+	// NaR is its own two's complement, and subtracting it raises the exception
+	{
+		posit<nbits, es> pa, nar;
+		pa.set_raw_bits(0xef7d02f8);
+		nar.setnar();
+		if (!nar.twosComplement().isnar()) ++nrOfFailedTestCases;
+		try {
+			p = pa - nar;
+			++nrOfFailedTestCases;
+		}
+		catch (const operand_is_nar&) {}
+	}
 
 	// logic tests
 	cout << "Logic operator tests " << endl;
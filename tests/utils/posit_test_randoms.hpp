@@ -79,6 +79,9 @@ namespace sw {
 			case OPCODE_POW:
 				presult = sw::unum::pow(pa, pb);
 				reference = std::pow(da, db);
+				// pow saturates: results beyond the dynamic range of the posit yield maxpos or minpos
+				if (std::isinf(reference)) reference = std::copysign(double(sw::unum::maxpos<nbits, es>()), reference);
+				if (0.0 == reference && 0.0 != da) reference = std::copysign(double(sw::unum::minpos<nbits, es>()), reference);
 				break;
 			case OPCODE_NOP:
 			default:
@@ -101,11 +104,13 @@ namespace sw {
 				presult = sw::unum::exp(pa);
 				reference = std::exp(da);
 				if (0.0 == reference) reference = double(sw::unum::minpos<nbits, es>());
+				if (std::isinf(reference)) reference = double(sw::unum::maxpos<nbits, es>());
 				break;
 			case OPCODE_EXP2:
 				presult = sw::unum::exp2(pa);
 				reference = std::exp2(da);
 				if (0.0 == reference) reference = double(sw::unum::minpos<nbits, es>());
+				if (std::isinf(reference)) reference = double(sw::unum::maxpos<nbits, es>());
 				break;
 			case OPCODE_LOG:
 				presult = sw::unum::log(pa);
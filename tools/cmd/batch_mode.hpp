@@ -0,0 +1,308 @@
+#pragma once
+// batch_mode.hpp: streaming batch mode of the command line tools: convert columns of values with buffered, allocation-free I/O
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <universal/posit/posit>
+
+/*
+The tools convert a single value from the command line, and in a shell pipeline that converts a
+column of numbers the process startup per value dominates. In batch mode a tool reads whitespace or comma
+separated values from stdin or a file, and writes one line per value to stdout:
+
+	pc --batch [-p nbits.es] [--bits] [--hex] [--decimal] [file]
+	fc --batch [--bits] [--hex] [--decimal] [file]
+
+The fields are the encoding as a bit string, the hex format, and the shortest decimal that reads
+back to the same encoding; without a field option all three are written. A value that does not
+parse writes "invalid" on its line, so that the output stays aligned with the input, and the tool
+exits with EXIT_FAILURE at the end of the input.
+*/
+
+namespace sw {
+namespace unum {
+namespace batch {
+
+// reads whitespace separated tokens from a file in blocks
+class token_reader {
+public:
+	static constexpr size_t capacity = size_t(1) << 16;
+
+	explicit token_reader(FILE* file) : _file(file), _first(_buffer), _last(_buffer), _eof(false) {}
+	token_reader(const token_reader&) = delete;
+	token_reader& operator=(const token_reader&) = delete;
+
+	// the next token, null terminated in the buffer and valid until the next call; false at the end of the input
+	bool next(char*& token, size_t& length) {
+		for (;;) {
+			while (_first != _last && is_space(*_first)) ++_first;
+			char* t = _first;
+			while (t != _last && !is_space(*t)) ++t;
+			if (t != _last || (_eof && t != _first)) {
+				token = _first;
+				length = size_t(t - _first);
+				*t = 0;   // the buffer has room for the terminator of a token that ends the input
+				_first = t == _last ? t : t + 1;
+				return true;
+			}
+			if (_eof) return false;
+			refill();
+		}
+	}
+
+private:
+	static bool is_space(char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f' || c == ','; }
+	void refill() {
+		size_t pending = size_t(_last - _first);
+		if (pending == capacity) throw std::runtime_error("batch input holds a token longer than " + std::to_string(capacity) + " characters");
+		std::memmove(_buffer, _first, pending);
+		_first = _buffer;
+		_last = _buffer + pending;
+		size_t n = std::fread(_last, 1, capacity - pending, _file);
+		_last += n;
+		if (n == 0) _eof = true;
+	}
+
+	FILE* _file;
+	char* _first;
+	char* _last;
+	bool _eof;
+	char _buffer[capacity + 1];
+};
+
+// collects the output lines in a block, and writes the block when it fills up
+class line_writer {
+public:
+	static constexpr size_t capacity = size_t(1) << 16;
+	// no field of a line exceeds this length
+	static constexpr size_t max_line = 512;
+
+	explicit line_writer(FILE* file) : _file(file), _next(_buffer) {}
+	~line_writer() { flush(); }
+	line_writer(const line_writer&) = delete;
+	line_writer& operator=(const line_writer&) = delete;
+
+	// room for a line of up to max_line characters
+	char* begin_line() {
+		if (size_t(_buffer + capacity - _next) < max_line) flush();
+		return _next;
+	}
+	char* end_of_line() const { return _next + max_line; }
+	void end_line(char* last) { _next = last; }
+	void flush() {
+		if (_next != _buffer) std::fwrite(_buffer, 1, size_t(_next - _buffer), _file);
+		_next = _buffer;
+	}
+
+private:
+	FILE* _file;
+	char* _next;
+	char _buffer[capacity];
+};
+
+// the fields of an output line
+struct fields {
+	bool bits;
+	bool hex;
+	bool decimal;
+};
+
+// the bit string of the nbits least significant bits of an encoding
+inline char* bits_to_chars(char* t, uint64_t bits, size_t nbits) {
+	for (size_t i = nbits; i-- > 0; ) *t++ = char('0' + ((bits >> i) & 1));
+	return t;
+}
+
+inline char* invalid_to_chars(char* t) {
+	std::memcpy(t, "invalid", 7);
+	return t + 7;
+}
+
+// write the line of the posit nearest to the decimal or posit format token, and return false if the token does not parse
+template<size_t nbits, size_t es>
+bool convert_posit(line_writer& out, const char* token, size_t length, const fields& f) {
+	static_assert(nbits <= 64, "batch mode converts posits of up to 64 bits");
+	posit<nbits, es> p;
+	posit_from_chars_result r = from_chars(token, token + length, p);
+	char* t = out.begin_line();
+	bool valid = r.ec == std::errc() && r.ptr == token + length;
+	if (!valid) {
+		t = invalid_to_chars(t);
+	}
+	else {
+		char* last = out.end_of_line();
+		char* first = t;
+		if (f.bits) t = bits_to_chars(t, uint64_t(p.encoding()), nbits);
+		posit_to_chars_result hex{ t, std::errc() }, decimal{ t, std::errc() };
+		if (f.hex) {
+			if (t != first) *t++ = ' ';
+			hex = to_chars(t, last, p, posit_chars_format::hex);
+			t = hex.ptr;
+		}
+		if (f.decimal && hex.ec == std::errc()) {
+			if (t != first) *t++ = ' ';
+			decimal = to_chars(t, last, p);
+			t = decimal.ptr;
+		}
+		// a value that does not fit the line is reported like a token that does not parse
+		if (hex.ec != std::errc() || decimal.ec != std::errc()) {
+			t = invalid_to_chars(first);
+			valid = false;
+		}
+	}
+	*t++ = '\n';
+	out.end_line(t);
+	return valid;
+}
+
+// write the line of the IEEE float or double nearest to the decimal token
+template<typename Real>
+bool convert_ieee(line_writer& out, const char* token, size_t length, const fields& f) {
+	using Bits = typename std::conditional<sizeof(Real) == 4, uint32_t, uint64_t>::type;
+	char* end;
+	Real v = std::is_same<Real, float>::value ? Real(std::strtof(token, &end)) : Real(std::strtod(token, &end));
+	char* t = out.begin_line();
+	bool valid = end == token + length;
+	if (!valid) {
+		t = invalid_to_chars(t);
+	}
+	else {
+		char* first = t;
+		Bits bits;
+		std::memcpy(&bits, &v, sizeof(bits));
+		if (f.bits) t = bits_to_chars(t, bits, 8 * sizeof(Bits));
+		if (f.hex) {
+			if (t != first) *t++ = ' ';
+			const char* hexits = "0123456789abcdef";
+			*t++ = '0';
+			*t++ = 'x';
+			for (size_t i = 2 * sizeof(Bits); i-- > 0; ) *t++ = hexits[(bits >> (4 * i)) & 0xF];
+		}
+		if (f.decimal) {
+			if (t != first) *t++ = ' ';
+			// the shortest of the precisions from digits10 to max_digits10 that reads back to the same value
+			size_t room = size_t(out.end_of_line() - t);
+			int written = 0;
+			for (int precision = std::numeric_limits<Real>::digits10; precision <= std::numeric_limits<Real>::max_digits10; ++precision) {
+				written = std::snprintf(t, room, "%.*g", precision, double(v));
+				if (written < 0 || size_t(written) >= room) break;
+				Real w = std::is_same<Real, float>::value ? Real(std::strtof(t, nullptr)) : Real(std::strtod(t, nullptr));
+				if (w == v) break;
+			}
+			if (written < 0 || size_t(written) >= room) {
+				t = invalid_to_chars(first);
+				valid = false;
+			}
+			else {
+				t += written;
+			}
+		}
+	}
+	*t++ = '\n';
+	out.end_line(t);
+	return valid;
+}
+
+// convert every token of the input, and return the number of tokens that do not parse
+template<typename Converter>
+size_t convert_stream(FILE* in, FILE* out, const fields& f, Converter converter) {
+	token_reader reader(in);
+	line_writer writer(out);
+	size_t nrInvalid = 0;
+	char* token;
+	size_t length;
+	while (reader.next(token, length)) {
+		if (!converter(writer, token, length, f)) ++nrInvalid;
+	}
+	return nrInvalid;
+}
+
+template<size_t nbits, size_t es>
+size_t convert_posit_stream(FILE* in, FILE* out, const fields& f) {
+	return convert_stream(in, out, f, convert_posit<nbits, es>);
+}
+
+// the posit configurations of the batch mode, selected at run time
+inline size_t convert_posit_stream(const std::string& configuration, FILE* in, FILE* out, const fields& f) {
+	if (configuration == "8.0")  return convert_posit_stream< 8, 0>(in, out, f);
+	if (configuration == "8.1")  return convert_posit_stream< 8, 1>(in, out, f);
+	if (configuration == "8.2")  return convert_posit_stream< 8, 2>(in, out, f);
+	if (configuration == "8.3")  return convert_posit_stream< 8, 3>(in, out, f);
+	if (configuration == "16.1") return convert_posit_stream<16, 1>(in, out, f);
+	if (configuration == "16.2") return convert_posit_stream<16, 2>(in, out, f);
+	if (configuration == "16.3") return convert_posit_stream<16, 3>(in, out, f);
+	if (configuration == "32.1") return convert_posit_stream<32, 1>(in, out, f);
+	if (configuration == "32.2") return convert_posit_stream<32, 2>(in, out, f);
+	if (configuration == "32.3") return convert_posit_stream<32, 3>(in, out, f);
+	if (configuration == "48.2") return convert_posit_stream<48, 2>(in, out, f);
+	if (configuration == "64.3") return convert_posit_stream<64, 3>(in, out, f);
+	throw std::runtime_error("unsupported posit configuration " + configuration + ", expected 8.0-8.3, 16.1-16.3, 32.1-32.3, 48.2, or 64.3");
+}
+
+// the options that follow --batch on the command line
+struct options {
+	std::string configuration;
+	fields f;
+	std::string input;
+
+	// parse the arguments after --batch; the configuration option -p (or -t for the IEEE types) is accepted when a default is given
+	options(int argc, char** argv, const std::string& defaultConfiguration, const char* configurationOption)
+		: configuration(defaultConfiguration), f{ false, false, false }, input("-") {
+		bool anyField = false;
+		for (int i = 0; i < argc; ++i) {
+			std::string arg(argv[i]);
+			if (arg == "--bits") { f.bits = anyField = true; }
+			else if (arg == "--hex") { f.hex = anyField = true; }
+			else if (arg == "--decimal") { f.decimal = anyField = true; }
+			else if (configurationOption != nullptr && arg == configurationOption && i + 1 < argc) { configuration = argv[++i]; }
+			else if (arg.size() > 1 && arg[0] == '-') { throw std::runtime_error("unknown batch option " + arg); }
+			else { input = arg; }
+		}
+		if (!anyField) f = fields{ true, true, true };
+	}
+};
+
+// run the conversion over the input of the options, and return the exit status of the tool
+template<typename Run>
+int run(const options& opt, Run conversion) {
+	FILE* in = stdin;
+	if (opt.input != "-") {
+		in = std::fopen(opt.input.c_str(), "rb");
+		if (in == nullptr) throw std::runtime_error("cannot open " + opt.input);
+	}
+	size_t nrInvalid = conversion(in, stdout);
+	if (in != stdin) std::fclose(in);
+	std::fflush(stdout);
+	if (nrInvalid > 0) {
+		std::fprintf(stderr, "%zu values did not parse\n", nrInvalid);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// batch mode of the posit tools
+inline int posit_main(int argc, char** argv) {
+	options opt(argc, argv, "32.2", "-p");
+	return run(opt, [&opt](FILE* in, FILE* out) { return convert_posit_stream(opt.configuration, in, out, opt.f); });
+}
+
+// batch mode of the IEEE tools: the type is fixed, or selected with -t float32|float64
+inline int ieee_main(int argc, char** argv, const char* type, bool selectable) {
+	options opt(argc, argv, type, selectable ? "-t" : nullptr);
+	if (opt.configuration == "float32") return run(opt, [&opt](FILE* in, FILE* out) { return convert_stream(in, out, opt.f, convert_ieee<float>); });
+	if (opt.configuration == "float64") return run(opt, [&opt](FILE* in, FILE* out) { return convert_stream(in, out, opt.f, convert_ieee<double>); });
+	throw std::runtime_error("unsupported IEEE type " + opt.configuration + ", expected float32 or float64");
+}
+
+}  // namespace batch
+}  // namespace unum
+}  // namespace sw
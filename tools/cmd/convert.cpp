@@ -4,6 +4,7 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/posit>
+#include "batch_mode.hpp"
 
 // convert a floating point value to a specific posit configuration. Semantically, p = v, return reference to p
 template<size_t nbits, size_t es, typename Ty>
@@ -177,9 +178,11 @@ try {
 	using namespace std;
 	using namespace sw::unum;
 
+	if (argc >= 2 && string(argv[1]) == "--batch") return batch::posit_main(argc - 2, argv + 2);
 	if (argc != 3) {
 		cerr << "Show the conversion of a float to a posit step-by-step." << endl;
 	    cerr << "Usage: convert floating_point_value standard_posit_size(8/16/32/64/128/256)" << endl;
+		cerr << "       convert --batch [-p nbits.es] [--bits] [--hex] [--decimal] [file]   convert a stream of values" << endl;
 		cerr << "Example: convert -1.123456789e17 32" << endl;
 		cerr <<  msg << endl;
 		return EXIT_SUCCESS;  // signal successful completion for ctest
@@ -247,6 +250,10 @@ catch (const char* const msg) {
 	std::cerr << msg << std::endl;
 	return EXIT_FAILURE;
 }
+catch (const std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
 catch (...) {
 	std::cerr << "caught unknown exception" << std::endl;
 	return EXIT_FAILURE;
@@ -4,6 +4,7 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/value>
+#include "batch_mode.hpp"
 
 // receive a float and print the components of a double representation
 int main(int argc, char** argv)
@@ -15,10 +16,12 @@ try {
 	constexpr int max_digits10 = std::numeric_limits<double>::max_digits10;
 	constexpr int fbits = std::numeric_limits<double>::digits - 1;
 
+	if (argc >= 2 && string(argv[1]) == "--batch") return batch::ieee_main(argc - 2, argv + 2, "float64", false);
 	if (argc != 2) {
 		cerr << "dc : IEEE double components" << endl;
 		cerr << "Show the sign/scale/fraction components of a double." << endl;
 		cerr << "Usage: dc double_value" << endl;
+		cerr << "       dc --batch [--bits] [--hex] [--decimal] [file]   convert a stream of values" << endl;
 		cerr << "Example: dc 0.03124999" << endl;
 		cerr << "double: 0.031249989999999998 (+,-6,1111111111111111111101010100001100111000100011101110)" << endl;
 		return EXIT_SUCCESS;   // signal successful completion for ctest
@@ -33,6 +36,10 @@ catch (const char* const msg) {
 	std::cerr << msg << std::endl;
 	return EXIT_FAILURE;
 }
+catch (const std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
 catch (...) {
 	std::cerr << "caught unknown exception" << std::endl;
 	return EXIT_FAILURE;
@@ -4,6 +4,7 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/value>
+#include "batch_mode.hpp"
 
 // receive a float and print its components
 int main(int argc, char** argv)
@@ -15,10 +16,12 @@ try {
 	constexpr int max_digits10 = std::numeric_limits<double>::max_digits10;
 	constexpr int fbits = std::numeric_limits<float>::digits - 1;
 
+	if (argc >= 2 && string(argv[1]) == "--batch") return batch::ieee_main(argc - 2, argv + 2, "float32", false);
 	if (argc != 2) {
 		cerr << "fc : IEEE float components" << endl;
 		cerr << "Show the sign/scale/fraction components of a float." << endl;
 	    cerr << "Usage: fc float_value" << endl;
+		cerr << "       fc --batch [--bits] [--hex] [--decimal] [file]   convert a stream of values" << endl;
 		cerr << "Example: fc 0.03124999" << endl;
 		cerr << "float: 0.031249990686774254 (+,-6,11111111111111111111011)" << endl;
 		return EXIT_SUCCESS;  // signal successful completion for ctest
@@ -33,6 +36,10 @@ catch (const char* const msg) {
 	std::cerr << msg << std::endl;
 	return EXIT_FAILURE;
 }
+catch (const std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
 catch (...) {
 	std::cerr << "caught unknown exception" << std::endl;
 	return EXIT_FAILURE;
@@ -0,0 +1,93 @@
+// ieee2posit.cpp: cli to convert a raw file of IEEE floats or doubles into a binary posit array file
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdio>
+#include <vector>
+#include <universal/posit/posit>
+
+// convert the raw IEEE values of the input file in chunks, so that files larger than memory can be converted
+template<typename Real, size_t nbits, size_t es>
+uint64_t ConvertFile(const std::string& input, const std::string& output, sw::unum::posit_file_packing packing) {
+	using namespace sw::unum;
+	constexpr size_t chunk = size_t(1) << 16;
+	FILE* in = std::fopen(input.c_str(), "rb");
+	if (in == nullptr) throw posit_file_exception("cannot open " + input);
+	std::vector<Real> reals(chunk);
+	std::vector<posit<nbits, es>> posits(chunk);
+	posit_file_writer<nbits, es> writer(output, packing);
+	size_t n;
+	while ((n = std::fread(reals.data(), sizeof(Real), chunk, in)) > 0) {
+		convert(reals.data(), posits.data(), n);
+		writer.write(posits.data(), n);
+	}
+	bool failed = std::ferror(in) != 0;
+	std::fclose(in);
+	if (failed) throw posit_file_exception("cannot read " + input);
+	writer.close();
+	return writer.size();
+}
+
+template<typename Real>
+uint64_t ConvertFile(const std::string& input, const std::string& output, const std::string& configuration, sw::unum::posit_file_packing packing) {
+	if (configuration == "8.0")  return ConvertFile<Real, 8, 0>(input, output, packing);
+	if (configuration == "16.1") return ConvertFile<Real, 16, 1>(input, output, packing);
+	if (configuration == "32.2") return ConvertFile<Real, 32, 2>(input, output, packing);
+	if (configuration == "64.3") return ConvertFile<Real, 64, 3>(input, output, packing);
+	throw posit_file_exception("unsupported posit configuration " + configuration);
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	if (argc == 3 && string(argv[1]) == "info") {
+		posit_file_header h = read_posit_file_header(argv[2]);
+		cout << argv[2] << " : posit<" << h.nbits << "," << h.es << "> "
+		     << (h.packing == uint8_t(posit_file_packing::bit) ? "bit" : "word") << " packed, shape";
+		for (size_t d = 0; d < h.rank; ++d) cout << (d == 0 ? " " : " x ") << h.shape[d];
+		cout << ", " << h.data_bytes() << " bytes of encodings" << endl;
+		return EXIT_SUCCESS;
+	}
+	if (argc != 5 && argc != 6) {
+		cerr << "ieee2posit : convert a raw file of IEEE floating-point values into a binary posit array file" << endl;
+		cerr << "Usage: ieee2posit float32|float64 input.raw output.posit 8.0|16.1|32.2|64.3 [packed]" << endl;
+		cerr << "       ieee2posit info file.posit" << endl;
+		cerr << "Example: ieee2posit float32 weights.raw weights.posit 16.1" << endl;
+		cerr << "The optional packed argument stores the posits at a stride of nbits bits" << endl;
+		return EXIT_SUCCESS;  // signal successful completion for ctest
+	}
+	string type(argv[1]);
+	posit_file_packing packing = posit_file_packing::word;
+	if (argc == 6) {
+		if (string(argv[5]) != "packed") throw posit_file_exception(string("unknown option ") + argv[5]);
+		packing = posit_file_packing::bit;
+	}
+	uint64_t n;
+	if (type == "float32") {
+		n = ConvertFile<float>(argv[2], argv[3], argv[4], packing);
+	}
+	else if (type == "float64") {
+		n = ConvertFile<double>(argv[2], argv[3], argv[4], packing);
+	}
+	else {
+		throw posit_file_exception("unknown input type " + type + ", expected float32 or float64");
+	}
+	cout << "converted " << n << " values of " << argv[2] << " to " << argv[3] << endl;
+
+	return EXIT_SUCCESS;
+}
+catch (const char* const msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -4,6 +4,7 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/value>
+#include "batch_mode.hpp"
 
 std::string version_string(int a, int b, int c) {
 	std::ostringstream ss;
@@ -64,9 +65,11 @@ try {
 	constexpr int d_fbits = std::numeric_limits<double>::digits - 1;
 	constexpr int q_fbits = std::numeric_limits<long double>::digits - 1;
 
+	if (argc >= 2 && string(argv[1]) == "--batch") return batch::ieee_main(argc - 2, argv + 2, "float64", true);
 	if (argc != 2) {
 		cerr << "Show the truncated value and (sign/scale/fraction) components of different floating point types." << endl;
 		cerr << "Usage: ieee_fp float_value" << endl;
+		cerr << "       ieee_fp --batch [-t float32|float64] [--bits] [--hex] [--decimal] [file]   convert a stream of values" << endl;
 		cerr << "Example: ieee_fp 0.03124999" << endl;
                 cerr << "input value:                0.03124999" << endl;
                 cerr << "      float:              0.0312499907 (+,-6,11111111111111111111011)" << endl;
@@ -106,6 +109,10 @@ catch (const char* const msg) {
 	std::cerr << msg << std::endl;
 	return EXIT_FAILURE;
 }
+catch (const std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
 catch (...) {
 	std::cerr << "caught unknown exception" << std::endl;
 	return EXIT_FAILURE;
@@ -4,6 +4,7 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/posit>
+#include "batch_mode.hpp"
 
 typedef std::numeric_limits< double > dbl;
 const char* msg = "posit< 8, 0> = s1 r1111111 e f qNW v-64\n\
@@ -30,10 +31,12 @@ try {
 	using namespace std;
 	using namespace sw::unum;
 
+	if (argc >= 2 && string(argv[1]) == "--batch") return batch::posit_main(argc - 2, argv + 2);
 	if (argc != 2) {
 		cerr << "pc : posit components" << endl;
 		cerr << "Show the sign/scale/regime/exponent/fraction components of a posit." << endl;
 	    cerr << "Usage: pc float_value" << endl;
+		cerr << "       pc --batch [-p nbits.es] [--bits] [--hex] [--decimal] [file]   convert a stream of values" << endl;
 		cerr << "Example: pc -1.123456789e17" << endl;
 		cerr <<  msg << endl;
 		return EXIT_SUCCESS;  // signal successful completion for ctest
@@ -82,6 +85,10 @@ catch (const char* const msg) {
 	std::cerr << msg << std::endl;
 	return EXIT_FAILURE;
 }
+catch (const std::runtime_error& err) {
+	std::cerr << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
 catch (...) {
 	std::cerr << "caught unknown exception" << std::endl;
 	return EXIT_FAILURE;